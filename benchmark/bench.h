@@ -0,0 +1,85 @@
+/*
+ * The common utilities of the benchmark programs for parsers generated by PackCC
+ *
+ * Copyright (c) 2014, 2019-2026 Arihiro Yoshida. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file must be included before any other header files.
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 199309L /* for clock_gettime() */
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#define BENCH_CONCAT_(x, y) x##y
+#define BENCH_CONCAT(x, y) BENCH_CONCAT_(x, y)
+
+static double bench_now(void) { /* in seconds */
+#ifdef _WIN32
+    LARGE_INTEGER f, c;
+    QueryPerformanceFrequency(&f);
+    QueryPerformanceCounter(&c);
+    return (double)c.QuadPart / (double)f.QuadPart;
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec + (double)t.tv_nsec * 1e-9;
+#endif
+}
+
+static double bench_t_value(size_t df) { /* the two-sided critical value of Student's t-distribution for 95% confidence */
+    static const double t[30] = {
+        12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+    };
+    return (df == 0) ? 0.0 : (df <= 30) ? t[df - 1] : 1.960;
+}
+
+static void bench_print_statistics(int width, const char *name, const double *v, size_t n, const char *unit, double scale) {
+    double m = 0.0, s = 0.0;
+    size_t i;
+    for (i = 0; i < n; i++) m += v[i];
+    m /= (double)n;
+    for (i = 0; i < n; i++) s += (v[i] - m) * (v[i] - m);
+    s = (n > 1) ? sqrt(s / (double)(n - 1)) : 0.0;
+    fprintf(
+        stderr, "%-*s %12.3f %s +- %.3f (95%% CI)\n",
+        width, name, m * scale, unit, bench_t_value(n - 1) * s / sqrt((double)n) * scale
+    );
+}
+
+#endif /* !BENCH_H */
@@ -0,0 +1,250 @@
+/*
+ * A benchmark driver for parsers generated by PackCC
+ *
+ * Copyright (c) 2014, 2019-2026 Arihiro Yoshida. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file includes the source file of a generated parser, and is compiled
+ * once per grammar with the macros below defined:
+ *   BENCH_PREFIX      the prefix of the API functions, such as calc
+ * The parser is driven by <prefix>_parse(), and the time to parse and that to
+ * execute the actions are measured separately by using the macro PCC_PHASE().
+ */
+
+#include "bench.h"
+
+#ifndef BENCH_PREFIX
+#error "BENCH_PREFIX is not defined"
+#endif
+
+#define BENCH_API(name) BENCH_CONCAT(BENCH_PREFIX, name)
+
+#define BENCH_RUNS_DEFAULT 10
+#define BENCH_WARMUPS_DEFAULT 1
+
+#ifdef _WIN32
+#define BENCH_NULL_DEVICE "NUL"
+#else
+#define BENCH_NULL_DEVICE "/dev/null"
+#endif
+
+typedef struct bench_counts_tag {
+    size_t mallocs;
+    size_t reallocs;
+    size_t frees;
+    size_t bytes; /* the total bytes requested by malloc and realloc */
+} bench_counts_t;
+
+static const char *g_bench_text = NULL;
+static size_t g_bench_len = 0;
+static size_t g_bench_pos = 0;
+static bench_counts_t g_bench_counts;
+static double g_bench_times[2]; /* the times spent in the respective phases in seconds */
+static double g_bench_since = 0.0; /* the time when the current phase began */
+
+static int bench_getchar(void) {
+    return (g_bench_pos < g_bench_len) ? (int)(unsigned char)g_bench_text[g_bench_pos++] : -1;
+}
+
+static void *bench_malloc(size_t size) {
+    void *const p = malloc(size);
+    if (p == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    g_bench_counts.mallocs++;
+    g_bench_counts.bytes += size;
+    return p;
+}
+
+static void *bench_realloc(void *ptr, size_t size) {
+    void *const p = realloc(ptr, size);
+    if (p == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    g_bench_counts.reallocs++;
+    g_bench_counts.bytes += size;
+    return p;
+}
+
+static void bench_free(void *ptr) {
+    if (ptr) g_bench_counts.frees++;
+    free(ptr);
+}
+
+static void bench_phase(int phase) { /* called when the specified phase begins */
+    const double t = bench_now();
+    g_bench_times[1 - phase] += t - g_bench_since;
+    g_bench_since = t;
+}
+
+#define PCC_GETCHAR(auxil) bench_getchar()
+#define PCC_MALLOC(auxil, size) bench_malloc(size)
+#define PCC_REALLOC(auxil, ptr, size) bench_realloc(ptr, size)
+#define PCC_FREE(auxil, ptr) bench_free(ptr)
+#define PCC_PHASE(auxil, phase) bench_phase(phase)
+
+#define main bench_grammar_main /* the main function in the grammar is not used */
+#include "parser.c"
+#undef main
+
+typedef struct bench_run_tag {
+    double parse;  /* the time to parse in seconds */
+    double action; /* the time to execute the actions in seconds */
+    double total;  /* the time from the creation to the destruction of the context in seconds */
+    bench_counts_t counts;
+    size_t entries; /* the peak number of the memo table entries */
+} bench_run_t;
+
+static void bench_run(bench_run_t *run) {
+    BENCH_API(_context_t) *ctx;
+    pcc_value_t ret;
+    BENCH_API(_memory_stats_t) stats[8];
+    size_t i, n;
+    double t0;
+    g_bench_pos = 0;
+    memset(&g_bench_counts, 0, sizeof(g_bench_counts));
+    g_bench_times[PCC_PHASE_PARSE] = 0.0;
+    g_bench_times[PCC_PHASE_ACTION] = 0.0;
+    run->entries = 0;
+    t0 = bench_now();
+    ctx = BENCH_API(_create)(NULL);
+    g_bench_since = bench_now();
+    while (BENCH_API(_parse)(ctx, &ret));
+    bench_phase(PCC_PHASE_ACTION); /* closes the parse phase */
+    n = BENCH_API(_get_memory_stats)(ctx, stats, sizeof(stats) / sizeof(stats[0]));
+    for (i = 0; i < n && i < sizeof(stats) / sizeof(stats[0]); i++) {
+        if (strcmp(stats[i].name, "lr_table_entry") == 0) run->entries = stats[i].peak;
+    }
+    BENCH_API(_destroy)(ctx);
+    run->total = bench_now() - t0;
+    run->parse = g_bench_times[PCC_PHASE_PARSE];
+    run->action = g_bench_times[PCC_PHASE_ACTION];
+    run->counts = g_bench_counts;
+}
+
+static char *bench_read_file(const char *path, size_t *len) {
+    FILE *const file = fopen(path, "rb");
+    char *p = NULL;
+    size_t n = 0, m = 0;
+    if (file == NULL) return NULL;
+    for (;;) {
+        if (n == m) {
+            m = (m > 0) ? m * 2 : 65536;
+            p = (char *)realloc(p, m);
+            if (p == NULL) {
+                fprintf(stderr, "Out of memory\n");
+                exit(1);
+            }
+        }
+        {
+            const size_t k = fread(p + n, 1, m - n, file);
+            if (k == 0) break;
+            n += k;
+        }
+    }
+    fclose(file);
+    *len = n;
+    return p;
+}
+
+static void bench_print_usage(const char *cmd) {
+    fprintf(
+        stderr,
+        "Usage: %s [-r runs] [-w warmups] input\n"
+        "  -r runs     the number of the measured runs (default: %d)\n"
+        "  -w warmups  the number of the runs before the measurement (default: %d)\n"
+        "The output of the actions is discarded, and the results are printed to the standard error.\n",
+        cmd, BENCH_RUNS_DEFAULT, BENCH_WARMUPS_DEFAULT
+    );
+}
+
+int main(int argc, char **argv) {
+    const char *path = NULL;
+    size_t runs = BENCH_RUNS_DEFAULT, warmups = BENCH_WARMUPS_DEFAULT;
+    bench_run_t *results;
+    double *v;
+    char *text;
+    size_t len = 0, i;
+    int k;
+    for (k = 1; k < argc; k++) {
+        if (strcmp(argv[k], "-r") == 0 && k + 1 < argc) {
+            runs = (size_t)atol(argv[++k]);
+        }
+        else if (strcmp(argv[k], "-w") == 0 && k + 1 < argc) {
+            warmups = (size_t)atol(argv[++k]);
+        }
+        else if (argv[k][0] != '-' && path == NULL) {
+            path = argv[k];
+        }
+        else {
+            bench_print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (path == NULL || runs == 0) {
+        bench_print_usage(argv[0]);
+        return 1;
+    }
+    text = bench_read_file(path, &len);
+    if (text == NULL) {
+        fprintf(stderr, "Cannot open file: %s\n", path);
+        return 2;
+    }
+    results = (bench_run_t *)malloc(sizeof(bench_run_t) * runs);
+    v = (double *)malloc(sizeof(double) * runs);
+    if (results == NULL || v == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+    if (freopen(BENCH_NULL_DEVICE, "w", stdout) == NULL) {
+        fprintf(stderr, "Cannot open the null device\n");
+        return 2;
+    }
+    g_bench_text = text;
+    g_bench_len = len;
+    for (i = 0; i < warmups; i++) bench_run(&(results[0]));
+    for (i = 0; i < runs; i++) bench_run(&(results[i]));
+    fprintf(stderr, "input      %12lu bytes, %lu runs\n", (unsigned long)len, (unsigned long)runs);
+    for (i = 0; i < runs; i++) v[i] = (double)len / results[i].total;
+    bench_print_statistics(10, "throughput", v, runs, "MB/s", 1e-6);
+    for (i = 0; i < runs; i++) v[i] = results[i].total;
+    bench_print_statistics(10, "total", v, runs, "ms  ", 1e3);
+    for (i = 0; i < runs; i++) v[i] = results[i].parse;
+    bench_print_statistics(10, "parse", v, runs, "ms  ", 1e3);
+    for (i = 0; i < runs; i++) v[i] = results[i].action;
+    bench_print_statistics(10, "action", v, runs, "ms  ", 1e3);
+    fprintf(
+        stderr, "allocation %12lu mallocs, %lu reallocs, %lu frees, %lu bytes\n",
+        (unsigned long)results[0].counts.mallocs, (unsigned long)results[0].counts.reallocs,
+        (unsigned long)results[0].counts.frees, (unsigned long)results[0].counts.bytes
+    );
+    fprintf(
+        stderr, "memo       %12lu entries at peak\n",
+        (unsigned long)results[0].entries
+    );
+    free(v);
+    free(results);
+    free(text);
+    return 0;
+}
@@ -0,0 +1,245 @@
+# Copyright (c) 2024-2026 Arihiro Yoshida. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+
+# Generates an input text of the requested size for a benchmark grammar in the directory grammars.
+# The shape of the text can be chosen to expose the scaling behavior of the generated parser,
+# such as deep nesting, long left-recursive expressions, wide objects, long string literals,
+# and many comments.
+
+from typing import Callable, Iterator
+import argparse
+import random
+import re
+import sys
+
+
+class Options:
+    def __init__(self, shape: str, depth: int, width: int, seed: int) -> None:
+        self.shape: str = shape
+        self.depth: int = depth  # the nesting depth
+        self.width: int = width  # the number of the elements in a line, an object, or a string literal
+        self.rand: random.Random = random.Random(seed)
+
+
+def identifier(opts: Options) -> str:
+    return opts.rand.choice(['alpha', 'beta', 'gamma', 'delta', 'value', 'count', 'index', 'total']) + str(opts.rand.randrange(100))
+
+
+def calc_expression(opts: Options, depth: int) -> str:  # never overflows nor divides by zero in int
+    if depth <= 0 or opts.rand.random() < 0.3:
+        return str(opts.rand.randrange(1, 10))
+    op: str = opts.rand.choice(['+', '-', '*', '/'])
+    if op == '/':
+        return calc_expression(opts, depth - 1) + ' / ' + str(opts.rand.randrange(1, 10))
+    return calc_expression(opts, depth - 1) + ' ' + op + ' ' + calc_expression(opts, depth - 1)
+
+
+def generate_calc(opts: Options) -> Iterator[str]:
+    while True:
+        if opts.shape == 'long':  # a long left-recursive expression per line
+            yield ' + '.join(str(opts.rand.randrange(1, 1000)) for _ in range(opts.width)) + '\n'
+        elif opts.shape == 'nested':  # deeply nested parentheses
+            yield '(' * opts.depth + '1' + ''.join(' + ' + str(opts.rand.randrange(1, 10)) + ')' for _ in range(opts.depth)) + '\n'
+        else:
+            yield calc_expression(opts, 3) + '\n'
+
+
+def json_value(opts: Options, depth: int) -> str:
+    r: float = opts.rand.random()
+    if depth > 0 and r < 0.2:
+        return '[' + ', '.join(json_value(opts, depth - 1) for _ in range(opts.rand.randrange(4))) + ']'
+    if depth > 0 and r < 0.4:
+        return json_object(opts, depth - 1, opts.rand.randrange(4))
+    if r < 0.6:
+        return '"' + identifier(opts) + '"'
+    if r < 0.8:
+        return str(opts.rand.randrange(-100000, 100000) / 100)
+    return opts.rand.choice(['true', 'false', 'null'])
+
+
+def json_object(opts: Options, depth: int, width: int) -> str:
+    return '{' + ', '.join('"' + identifier(opts) + '": ' + json_value(opts, depth) for _ in range(width)) + '}'
+
+
+def generate_json(opts: Options) -> Iterator[str]:  # an array of the elements; closed by the caller
+    sep: str = '[\n  '
+    while True:
+        if opts.shape == 'nested':  # deeply nested arrays and objects
+            yield sep + '[{"a": ' * opts.depth + '0' + '}]' * opts.depth
+        elif opts.shape == 'wide':  # objects with many members
+            yield sep + json_object(opts, 0, opts.width)
+        elif opts.shape == 'strings':  # long string literals with escapes
+            yield sep + '"' + ''.join(opts.rand.choice(['abcdefgh', ' ', '\\"', '\\t', '\\n']) for _ in range(opts.width)) + '"'
+        else:
+            yield sep + json_object(opts, 3, 4)
+        sep = ',\n  '
+
+
+def generate_kotlin(opts: Options) -> Iterator[str]:
+    yield 'package benchmark.generated\n\nimport kotlin.math.max\n\n'
+    n: int = 0
+    while True:
+        n += 1
+        if opts.shape == 'comments':  # more comments than code
+            yield '/*\n' + ''.join(' * ' + identifier(opts) + ' ' + identifier(opts) + '\n' for _ in range(opts.width // 10 + 1)) + ' */\n'
+            yield '// ' + identifier(opts) + '\n'
+        a: str = identifier(opts)
+        b: str = identifier(opts)
+        yield (
+            'fun f' + str(n) + '(' + a + ': Int, ' + b + ': Int): Int {\n'
+            '    val x = ' + a + ' + ' + b + ' * ' + str(opts.rand.randrange(100)) + '\n'
+            '    if (x > ' + str(opts.rand.randrange(100)) + ') {\n'
+            '        return max(x, ' + a + ')\n'
+            '    }\n'
+            '    return x - ' + b + '\n'
+            '}\n\n'
+        )
+
+
+def generate_csv(opts: Options) -> Iterator[str]:
+    width: int = opts.width if opts.shape == 'wide' else 8
+    while True:
+        fields: list[str] = []
+        for i in range(width):
+            r: float = opts.rand.random()
+            if opts.shape == 'strings':  # long quoted fields
+                fields.append('"' + ' '.join(identifier(opts) for _ in range(opts.width)).replace('a', '""') + '"')
+            elif r < 0.4:
+                fields.append(str(opts.rand.randrange(1000000)))
+            elif r < 0.6:
+                fields.append('"' + identifier(opts) + ', ' + identifier(opts) + '"')
+            elif r < 0.7:
+                fields.append('')
+            else:
+                fields.append(identifier(opts))
+        yield ','.join(fields) + '\r\n'
+
+
+def ini_value(opts: Options, depth: int) -> str:
+    r: float = opts.rand.random()
+    if depth > 0 and r < 0.15:
+        return '[' + ', '.join(ini_value(opts, depth - 1) for _ in range(opts.rand.randrange(1, 5))) + ']'
+    if depth > 0 and r < 0.25:
+        return '{ ' + ', '.join(identifier(opts) + ' = ' + ini_value(opts, depth - 1) for _ in range(opts.rand.randrange(1, 4))) + ' }'
+    if r < 0.5:
+        return '"' + identifier(opts) + '\\t' + identifier(opts) + '"'
+    if r < 0.8:
+        return str(opts.rand.randrange(-100000, 100000))
+    return opts.rand.choice(['true', 'false', '3.14', '1e-9', "'literal'"])
+
+
+def generate_ini(opts: Options) -> Iterator[str]:
+    while True:
+        yield '\n[' + identifier(opts) + '.' + identifier(opts) + ']\n'
+        for _ in range(opts.rand.randrange(1, 10)):
+            if opts.shape == 'comments':  # more comments than settings
+                yield ''.join('# ' + identifier(opts) + ' ' + identifier(opts) + '\n' for _ in range(opts.width // 10 + 1))
+            yield identifier(opts) + ' = ' + ini_value(opts, 2) + '  # ' + identifier(opts) + '\n'
+
+
+def tinyc_expression(opts: Options, depth: int) -> str:
+    r: float = opts.rand.random()
+    if depth <= 0 or r < 0.3:
+        return opts.rand.choice([identifier(opts), str(opts.rand.randrange(1000)), '0x1f', "'c'"])
+    if r < 0.4:
+        return identifier(opts) + '(' + tinyc_expression(opts, depth - 1) + ', ' + tinyc_expression(opts, depth - 1) + ')'
+    if r < 0.5:
+        return '(' + tinyc_expression(opts, depth - 1) + ')'
+    if r < 0.6:
+        return identifier(opts) + '[' + tinyc_expression(opts, depth - 1) + ']'
+    op: str = opts.rand.choice(['+', '-', '*', '/', '%', '<', '>=', '==', '!=', '&&', '||'])
+    return tinyc_expression(opts, depth - 1) + ' ' + op + ' ' + tinyc_expression(opts, depth - 1)
+
+
+def tinyc_statement(opts: Options, depth: int, indent: str) -> str:
+    r: float = opts.rand.random()
+    e: str = tinyc_expression(opts, 3)
+    if depth > 0 and r < 0.15:
+        return indent + 'if (' + e + ') {\n' + tinyc_statement(opts, depth - 1, indent + '    ') + indent + '} else {\n' + \
+            tinyc_statement(opts, depth - 1, indent + '    ') + indent + '}\n'
+    if depth > 0 and r < 0.25:
+        return indent + 'for (i = 0; i < ' + e + '; i++) {\n' + tinyc_statement(opts, depth - 1, indent + '    ') + indent + '}\n'
+    if depth > 0 and r < 0.35:
+        return indent + 'while (' + e + ') ' + identifier(opts) + ' -= ' + tinyc_expression(opts, depth - 1) + ';\n'
+    if r < 0.5:
+        return indent + 'int ' + identifier(opts) + ' = ' + e + ';\n'
+    return indent + identifier(opts) + ' = ' + e + ';\n'
+
+
+def generate_tinyc(opts: Options) -> Iterator[str]:  # each chunk is a complete unit to be truncated at
+    n: int = 0
+    while True:
+        n += 1
+        s: str = ''
+        if opts.shape == 'comments':  # more comments than code
+            s += '/*\n' + ''.join(' * ' + identifier(opts) + ' ' + identifier(opts) + '\n' for _ in range(opts.width // 10 + 1)) + ' */\n'
+        s += 'static const char *name' + str(n) + ' = "' + identifier(opts) + '\\n";\n'
+        s += 'int f' + str(n) + '(int a, const char *s, long b[]) {\n    int i;\n'
+        if opts.shape == 'long':  # a long left-recursive expression
+            s += '    return ' + ' + '.join(identifier(opts) for _ in range(opts.width)) + ';\n}\n\n'
+        else:
+            s += ''.join(tinyc_statement(opts, 3, '    ') for _ in range(opts.rand.randrange(1, 8))) + '    return i; // done\n}\n\n'
+        yield s
+
+
+GENERATORS: dict[str, tuple[Callable[[Options], Iterator[str]], list[str], str]] = {
+    'calc': (generate_calc, ['mixed', 'long', 'nested'], ''),
+    'json': (generate_json, ['mixed', 'nested', 'wide', 'strings'], '\n]\n'),
+    'kotlin': (generate_kotlin, ['mixed', 'comments'], ''),
+    'csv': (generate_csv, ['mixed', 'wide', 'strings'], ''),
+    'ini': (generate_ini, ['mixed', 'comments'], ''),
+    'tinyc': (generate_tinyc, ['mixed', 'long', 'comments'], ''),
+}
+
+
+def parse_size(s: str) -> int:
+    res: re.Match[str] | None = re.fullmatch(r'([0-9]+)([kKmMgG]?)', s)
+    if res is None:
+        raise argparse.ArgumentTypeError('Invalid size: ' + s)
+    return int(res.group(1)) * {'': 1, 'k': 1 << 10, 'm': 1 << 20, 'g': 1 << 30}[res.group(2).lower()]
+
+
+def main() -> None:
+    parser: argparse.ArgumentParser = argparse.ArgumentParser(
+        description='Generate an input text of about the requested size for a benchmark grammar.'
+    )
+    parser.add_argument('grammar', choices=list(GENERATORS), help='the name of the grammar')
+    parser.add_argument('size', type=parse_size, help='the size in bytes, optionally followed by K, M, or G')
+    parser.add_argument('-s', '--shape', default='mixed', help='the shape of the text (default: mixed)')
+    parser.add_argument('-d', '--depth', type=int, default=100, help='the nesting depth for the shape "nested" (default: 100)')
+    parser.add_argument('-w', '--width', type=int, default=1000, help='the width for the shapes "long", "wide", "strings", and "comments" (default: 1000)')
+    parser.add_argument('--seed', type=int, default=0, help='the seed of the random numbers (default: 0)')
+    args: argparse.Namespace = parser.parse_args()
+    generator, shapes, tail = GENERATORS[args.grammar]
+    if args.shape not in shapes:
+        parser.error('Shape for ' + args.grammar + ' must be one of: ' + ', '.join(shapes))
+    n: int = 0
+    out = sys.stdout
+    for chunk in generator(Options(args.shape, args.depth, args.width, args.seed)):
+        if n > 0 and n + len(chunk) + len(tail) > args.size:
+            break
+        out.write(chunk)
+        n += len(chunk)
+    out.write(tail)
+
+
+if __name__ == '__main__':
+    main()
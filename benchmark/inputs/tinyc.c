@@ -0,0 +1,4434 @@
+static const char *name1 = "index97\n";
+int f1(int a, const char *s, long b[]) {
+    int i;
+    if ((913 % value17) == gamma39 != count60 % count78('c', value7)) {
+        if ((delta93) && 822 || 'c' == 0x1f) {
+            value23 = value56[589];
+        } else {
+            for (i = 0; i < value60; i++) {
+                index90 = gamma4;
+            }
+        }
+    } else {
+        beta18 = delta27[0x1f >= 0x1f && 722 / gamma42];
+    }
+    beta50 = 127;
+    if (984 - 'c' == 0x1f % alpha64) {
+        value19 = 481 >= 0x1f + total85 / ('c');
+    } else {
+        value17 = beta42;
+    }
+    for (i = 0; i < gamma91(index83, 245) || 'c' >= alpha21 < 'c'; i++) {
+        value57 = total6(index24, 'c') == delta1(alpha86, 286) + index80;
+    }
+    return i; // done
+}
+
+static const char *name2 = "beta32\n";
+int f2(int a, const char *s, long b[]) {
+    int i;
+    count99 = gamma35(0x1f + 'c', 182 == 141) || count47;
+    count50 = 0x1f;
+    return i; // done
+}
+
+static const char *name3 = "gamma37\n";
+int f3(int a, const char *s, long b[]) {
+    int i;
+    int value51 = alpha39;
+    return i; // done
+}
+
+static const char *name4 = "count38\n";
+int f4(int a, const char *s, long b[]) {
+    int i;
+    if (total60[count15((0x1f), index81 * delta95)]) {
+        int delta54 = 'c';
+    } else {
+        if (795) {
+            int delta79 = beta89(693, index32);
+        } else {
+            if (559) {
+                int delta1 = total18[index66[(510)]];
+            } else {
+                int total42 = value77['c'] + beta66 < gamma5;
+            }
+        }
+    }
+    delta36 = (index67(beta86, 'c')) || delta2 >= 0x1f == total33('c', 656);
+    count13 = alpha61(((715)), (index58) < (632));
+    value14 = total14(0x1f && 0x1f, 881 || 380) / (alpha62 - 'c');
+    return i; // done
+}
+
+static const char *name5 = "gamma54\n";
+int f5(int a, const char *s, long b[]) {
+    int i;
+    int index99 = beta53;
+    for (i = 0; i < ((count92)) == beta45(0x1f < 3, value47 - 'c'); i++) {
+        if (value16('c', gamma75 != 385 % 772 / 47)) {
+            gamma89 = beta16((gamma75['c']), 0x1f + 'c' || gamma13);
+        } else {
+            int delta69 = index55(959, beta61(total79 % 0x1f, gamma54['c']));
+        }
+    }
+    alpha32 = alpha15;
+    int index37 = (delta76 < 0x1f) >= delta97;
+    while ('c') index94 -= 643 % 'c';
+    return i; // done
+}
+
+static const char *name6 = "gamma71\n";
+int f6(int a, const char *s, long b[]) {
+    int i;
+    while (0x1f >= (908 == total50)) beta87 -= count5 || 922 || 'c';
+    int alpha49 = gamma42((323 >= 'c'), ((962)));
+    if (gamma29(0x1f && 'c', total32[delta43]) * 0x1f) {
+        delta58 = 'c';
+    } else {
+        for (i = 0; i < total41(alpha24, 857) < 'c' && count91; i++) {
+            while (alpha58[(('c'))]) beta10 -= 'c';
+        }
+    }
+    alpha23 = 'c';
+    for (i = 0; i < 'c'; i++) {
+        if (delta91['c'] && value34[beta78]) {
+            for (i = 0; i < ('c'); i++) {
+                delta86 = 0x1f;
+            }
+        } else {
+            gamma22 = value28[335 / total36(0x1f, 'c')];
+        }
+    }
+    delta93 = 508;
+    return i; // done
+}
+
+static const char *name7 = "gamma29\n";
+int f7(int a, const char *s, long b[]) {
+    int i;
+    int delta83 = 0x1f + 668 - total69 == 0x1f * 'c' / 352 >= count73('c', alpha30);
+    while (445 >= gamma83('c', total97) < (alpha64(337, gamma31))) gamma95 -= beta54['c'] || 'c' && 0x1f;
+    while (364) index43 -= 0x1f;
+    alpha58 = 0x1f;
+    int value94 = count63;
+    count49 = 780;
+    alpha72 = 0x1f / gamma42;
+    return i; // done
+}
+
+static const char *name8 = "gamma44\n";
+int f8(int a, const char *s, long b[]) {
+    int i;
+    while ('c') gamma0 -= gamma43 && 626 == 972;
+    index34 = 'c';
+    while (0x1f) count24 -= 'c' + 'c' >= 963 / 'c';
+    return i; // done
+}
+
+static const char *name9 = "alpha93\n";
+int f9(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < 'c' % total65; i++) {
+        value32 = 'c';
+    }
+    int alpha40 = total1('c', index89) - count72[value41] < gamma5(count46, 'c');
+    count89 = gamma97(0x1f >= 914, alpha93 || index23) + 0x1f;
+    alpha99 = 599 == alpha96 * 'c' != count83[0x1f];
+    if ((total42(beta17 != 345, 'c'))) {
+        alpha22 = beta52(0x1f, total52 && 'c') * 0x1f;
+    } else {
+        int value42 = total60('c', 0x1f % 0x1f) + gamma70(798, delta79) + (231);
+    }
+    for (i = 0; i < 'c'; i++) {
+        int index9 = alpha20(gamma19 + alpha4, gamma99['c']) * count91[522];
+    }
+    return i; // done
+}
+
+static const char *name10 = "gamma52\n";
+int f10(int a, const char *s, long b[]) {
+    int i;
+    gamma43 = ('c') / beta32('c', 0x1f) >= 'c' - 'c' >= (473);
+    int count44 = value97;
+    if (total80(alpha25[count37 % 'c'], 137)) {
+        if (alpha55(total9[743 || delta21], total45['c' && 0x1f])) {
+            delta48 = 0x1f;
+        } else {
+            while (index52(gamma0 || delta76, gamma48) != 0x1f) beta86 -= 498;
+        }
+    } else {
+        index21 = beta99[418 * (601)];
+    }
+    total8 = index11[total5('c', 271) >= 309];
+    value18 = (index71[total29]);
+    return i; // done
+}
+
+static const char *name11 = "count12\n";
+int f11(int a, const char *s, long b[]) {
+    int i;
+    alpha4 = 572;
+    beta9 = total91[count12[0x1f] == 0x1f];
+    return i; // done
+}
+
+static const char *name12 = "value73\n";
+int f12(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < index97('c', 'c' < total29(0x1f, 0x1f)); i++) {
+        gamma43 = (352);
+    }
+    int delta86 = 'c';
+    int count3 = delta40(alpha11[(delta55)], (115));
+    for (i = 0; i < 4; i++) {
+        if (total25 / index8[delta29[index60]]) {
+            int index26 = alpha78(count43[gamma76] + 0x1f, 790);
+        } else {
+            count29 = (beta88['c']) / ((index32));
+        }
+    }
+    return i; // done
+}
+
+static const char *name13 = "total31\n";
+int f13(int a, const char *s, long b[]) {
+    int i;
+    int beta24 = (439 != 'c') + 954;
+    while (beta7[890]) total49 -= (0x1f) >= 335 || 'c';
+    alpha5 = delta76[(748)];
+    return i; // done
+}
+
+static const char *name14 = "alpha17\n";
+int f14(int a, const char *s, long b[]) {
+    int i;
+    int delta81 = 'c' != 0x1f - 68 >= 'c' / count90 != ('c');
+    if (total39[beta10(15, count39)] * 0x1f + 899 / count29(45, 'c')) {
+        int alpha66 = alpha14(('c' * value33), count78(alpha43 / 0x1f, count12(0x1f, 'c')));
+    } else {
+        gamma88 = 856;
+    }
+    return i; // done
+}
+
+static const char *name15 = "delta51\n";
+int f15(int a, const char *s, long b[]) {
+    int i;
+    beta84 = 872 < count16;
+    total11 = count4(alpha37, 0x1f);
+    return i; // done
+}
+
+static const char *name16 = "index64\n";
+int f16(int a, const char *s, long b[]) {
+    int i;
+    delta80 = 0x1f;
+    int alpha90 = 0x1f + 0x1f;
+    for (i = 0; i < 0x1f != value40['c' != 'c']; i++) {
+        int gamma56 = 844;
+    }
+    if ((total36[index60]) != 255) {
+        for (i = 0; i < gamma23(value69[427], 697); i++) {
+            value52 = value90['c' / total13 == beta1['c']];
+        }
+    } else {
+        count81 = delta5[alpha65] * 0x1f / 0x1f % value64(957 % 'c', 0x1f);
+    }
+    delta23 = index89(0x1f && 'c' % total83 % delta32, beta32);
+    return i; // done
+}
+
+static const char *name17 = "gamma84\n";
+int f17(int a, const char *s, long b[]) {
+    int i;
+    value30 = 622;
+    int alpha6 = (count11(beta89[0x1f], delta49(508, 642)));
+    int value87 = index39[0x1f] * 0x1f < 823 || 'c' != gamma87 && 'c';
+    return i; // done
+}
+
+static const char *name18 = "beta87\n";
+int f18(int a, const char *s, long b[]) {
+    int i;
+    int alpha5 = beta81;
+    alpha67 = total3('c', 'c') >= 0x1f + 'c' * gamma82['c'] * value27;
+    gamma97 = 291;
+    value45 = count74 < 0x1f + 'c' == 'c' - delta18[beta18 != 0x1f];
+    total95 = (353 || 0x1f) == alpha31(total14[delta69], 0x1f && 830);
+    count31 = gamma5(gamma49[total27] == 0x1f && 787, index30[value30(0x1f, 345)]);
+    if (491 != delta90('c', 'c') && alpha5(851, 0x1f)) {
+        beta72 = (index6(0x1f - 'c', beta92 == 0x1f));
+    } else {
+        for (i = 0; i < beta93; i++) {
+            delta75 = 302 && 133 && 0x1f * 416;
+        }
+    }
+    return i; // done
+}
+
+static const char *name19 = "alpha44\n";
+int f19(int a, const char *s, long b[]) {
+    int i;
+    index16 = 754 % gamma26;
+    if (count28[total29(724, 0x1f) == 'c']) {
+        if (beta66[549 == 0x1f * 'c']) {
+            delta27 = gamma98(alpha39[479] != beta12('c', 206), 71);
+        } else {
+            int index76 = 133;
+        }
+    } else {
+        int count24 = 787 && 451 == delta0[0x1f] % value85(beta63, 943) % 693 == count40;
+    }
+    for (i = 0; i < 'c'; i++) {
+        int delta77 = 644;
+    }
+    int delta14 = 0x1f;
+    value96 = index22;
+    return i; // done
+}
+
+static const char *name20 = "total73\n";
+int f20(int a, const char *s, long b[]) {
+    int i;
+    gamma97 = delta66 - 0x1f - index20 || 665 && 615;
+    return i; // done
+}
+
+static const char *name21 = "gamma8\n";
+int f21(int a, const char *s, long b[]) {
+    int i;
+    while (0x1f) index5 -= 'c' == 668 * 738;
+    return i; // done
+}
+
+static const char *name22 = "delta66\n";
+int f22(int a, const char *s, long b[]) {
+    int i;
+    int total6 = gamma90[index25] >= (0x1f) + 'c';
+    gamma88 = (delta20) >= 263 != ((0x1f));
+    return i; // done
+}
+
+static const char *name23 = "alpha26\n";
+int f23(int a, const char *s, long b[]) {
+    int i;
+    while (delta42(126, 0x1f) >= (count74) - total16[491]) index81 -= 0x1f >= 0x1f;
+    if (0x1f) {
+        int value69 = 'c';
+    } else {
+        for (i = 0; i < (337); i++) {
+            while (0x1f) alpha31 -= 'c';
+        }
+    }
+    for (i = 0; i < ((alpha71) * 'c' - count23); i++) {
+        beta58 = 'c' && 900 % 0x1f == (value86);
+    }
+    return i; // done
+}
+
+static const char *name24 = "gamma25\n";
+int f24(int a, const char *s, long b[]) {
+    int i;
+    int alpha25 = alpha62[(12)] < beta62[285 || 0x1f];
+    count4 = (value8['c']) >= delta36((0x1f), 0x1f * 428);
+    int beta99 = 'c' % 'c';
+    if ('c' + total39 * gamma13) {
+        int gamma2 = alpha75(0x1f < 316, beta54(0x1f, alpha4)) % gamma60;
+    } else {
+        alpha93 = beta9[beta62 - 744 && gamma47[index65]];
+    }
+    index39 = 0x1f;
+    for (i = 0; i < 1 < 924 < 495 * value17; i++) {
+        for (i = 0; i < 'c' < value41; i++) {
+            gamma63 = 339 >= 276 - 0x1f + 0x1f < gamma32;
+        }
+    }
+    for (i = 0; i < beta52[alpha33]; i++) {
+        alpha82 = 239;
+    }
+    return i; // done
+}
+
+static const char *name25 = "delta58\n";
+int f25(int a, const char *s, long b[]) {
+    int i;
+    total94 = count44[alpha53(total29(index97, 'c'), ('c'))];
+    total59 = 0x1f % 'c' * 'c';
+    if (value48 % ('c' != alpha53)) {
+        count70 = 'c';
+    } else {
+        int count56 = (alpha77[68] == 'c');
+    }
+    alpha17 = (0x1f) % 915 % 0x1f == alpha62;
+    index18 = value10[gamma59(beta79 + 374, 648 || 'c')];
+    return i; // done
+}
+
+static const char *name26 = "index26\n";
+int f26(int a, const char *s, long b[]) {
+    int i;
+    int total16 = 0x1f % 251;
+    beta14 = 325 == 0x1f;
+    int value10 = alpha24('c' % 0x1f, 'c' - gamma7) % beta51;
+    total89 = 923;
+    while (gamma82(0x1f * total84 % index38(357, 'c'), (delta15(0x1f, 'c')))) value99 -= gamma34;
+    while ('c') index40 -= count63 < alpha10 == 0x1f;
+    total43 = 0x1f || 'c' && 'c' || 592 >= 0x1f;
+    return i; // done
+}
+
+static const char *name27 = "index62\n";
+int f27(int a, const char *s, long b[]) {
+    int i;
+    index94 = value56[(index96) < 'c'];
+    beta6 = 194 || 861 / gamma84[444];
+    gamma22 = 0x1f && 0x1f - delta77[total77] - 925;
+    return i; // done
+}
+
+static const char *name28 = "value35\n";
+int f28(int a, const char *s, long b[]) {
+    int i;
+    index1 = count69;
+    if (delta42('c' && 0x1f, beta71(810, 'c' != 0x1f))) {
+        int gamma38 = alpha58;
+    } else {
+        while (871 * 'c' + 0x1f != count75 == 489) alpha48 -= count75('c', 'c');
+    }
+    if (820 < value25 >= index19(value90(gamma51, index52), 'c' / 173)) {
+        gamma47 = alpha56[total9[192] / (value73)];
+    } else {
+        gamma93 = value69('c', 0x1f) && count4 % 442 + ('c') && alpha85['c'];
+    }
+    for (i = 0; i < alpha5[value21(0x1f + alpha53, 201 / 0x1f)]; i++) {
+        while (gamma23(index35['c'], 'c')) gamma71 -= 658 && index62;
+    }
+    beta16 = 0x1f;
+    index3 = value1[45] * 61 || delta43 != (alpha33) % delta43('c', 0x1f);
+    delta68 = (delta65) != index86[gamma18] - 0x1f;
+    return i; // done
+}
+
+static const char *name29 = "delta9\n";
+int f29(int a, const char *s, long b[]) {
+    int i;
+    beta68 = value41(count64 * 'c' - value61(alpha52, gamma8), 0x1f / 0x1f + delta20);
+    gamma76 = 'c';
+    count19 = count23;
+    if (delta13('c' - 'c' != 0x1f, 818)) {
+        if (0x1f) {
+            int gamma11 = count81(0x1f, 0x1f >= ('c'));
+        } else {
+            delta72 = 0x1f;
+        }
+    } else {
+        if (0x1f) {
+            if ((total1 >= alpha11)) {
+                gamma78 = 0x1f == 133 && beta17 == 'c' - 534;
+            } else {
+                int total73 = index76;
+            }
+        } else {
+            alpha2 = value94[0x1f] % 0x1f != beta91(count95, 107);
+        }
+    }
+    return i; // done
+}
+
+static const char *name30 = "alpha39\n";
+int f30(int a, const char *s, long b[]) {
+    int i;
+    int value79 = alpha63['c' != total39 % value13 && 0x1f];
+    gamma45 = 951 == 0x1f != index85(0x1f, 0x1f) / 'c';
+    gamma31 = 'c';
+    while ('c') alpha41 -= 0x1f;
+    for (i = 0; i < 'c'; i++) {
+        index67 = 0x1f;
+    }
+    value94 = (48) < (43) % alpha93[817] - total55[0x1f];
+    return i; // done
+}
+
+static const char *name31 = "count80\n";
+int f31(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < 0x1f; i++) {
+        gamma10 = 957;
+    }
+    if (index49[value44]) {
+        for (i = 0; i < count46(0x1f, 189) < beta40 != 0x1f < (count12('c', 0x1f)); i++) {
+            delta97 = ('c');
+        }
+    } else {
+        if (total52) {
+            value2 = ('c') / 0x1f == 'c' % 735;
+        } else {
+            alpha28 = (value72 != 0x1f == 441);
+        }
+    }
+    total25 = delta98['c'] || total78('c', 317) * 406;
+    return i; // done
+}
+
+static const char *name32 = "gamma63\n";
+int f32(int a, const char *s, long b[]) {
+    int i;
+    index13 = 0x1f;
+    while (133) count26 -= 0x1f + 0x1f && 0x1f;
+    delta52 = index77(601, 0x1f) + 9 != 0x1f != index69['c' - 0x1f];
+    index25 = 956 >= 'c';
+    beta96 = 731;
+    delta79 = total74[alpha72] % 0x1f || value12(value73, gamma41(delta17, 889));
+    index44 = value13(('c'), 163);
+    return i; // done
+}
+
+static const char *name33 = "index33\n";
+int f33(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < ('c' && 0x1f) != alpha46[alpha73 >= 0x1f]; i++) {
+        int beta31 = index35(alpha7 + alpha80, index35 != 244) != ('c' % 'c');
+    }
+    for (i = 0; i < 262 - index19['c' && 791]; i++) {
+        delta65 = 0x1f;
+    }
+    int delta12 = 0x1f;
+    while (965) count27 -= ((0x1f));
+    return i; // done
+}
+
+static const char *name34 = "index8\n";
+int f34(int a, const char *s, long b[]) {
+    int i;
+    value1 = (0x1f);
+    int count54 = 'c';
+    alpha56 = value60(beta4[0x1f] && (total31), delta31);
+    while (gamma4(0x1f, 'c') + 'c' / beta69 * 283) alpha40 -= gamma13 && 925 % 440;
+    while (0x1f && count47 && 99 == 0x1f) count80 -= alpha66(index84 - index58, 752 == 0x1f);
+    return i; // done
+}
+
+static const char *name35 = "value18\n";
+int f35(int a, const char *s, long b[]) {
+    int i;
+    gamma70 = count76['c'];
+    return i; // done
+}
+
+static const char *name36 = "alpha92\n";
+int f36(int a, const char *s, long b[]) {
+    int i;
+    total37 = value7[value49[307]];
+    if ((alpha88[429])) {
+        beta41 = 362;
+    } else {
+        for (i = 0; i < 0x1f; i++) {
+            while (delta72) total31 -= 462;
+        }
+    }
+    return i; // done
+}
+
+static const char *name37 = "alpha10\n";
+int f37(int a, const char *s, long b[]) {
+    int i;
+    int delta63 = ('c' % 'c' * alpha12(0x1f, 'c'));
+    for (i = 0; i < (alpha67) != count93 || 634 || 'c' + 'c' || 0x1f; i++) {
+        beta5 = index59(gamma99(263, 83), 0x1f != 'c') || 'c';
+    }
+    return i; // done
+}
+
+static const char *name38 = "index60\n";
+int f38(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < alpha22; i++) {
+        if (780) {
+            alpha57 = delta69;
+        } else {
+            int alpha81 = beta7;
+        }
+    }
+    for (i = 0; i < beta71 == count80(694, 253) % 'c'; i++) {
+        beta80 = gamma14[index15(0x1f * count30, 0x1f)];
+    }
+    count46 = total7 - (beta17);
+    value46 = 'c';
+    while ((beta54) * 0x1f) index7 -= ('c') / count43 / index96;
+    return i; // done
+}
+
+static const char *name39 = "count49\n";
+int f39(int a, const char *s, long b[]) {
+    int i;
+    int value90 = 'c';
+    alpha46 = 187 / index83;
+    for (i = 0; i < index43(value41(('c'), count40), 0x1f < 'c' * 'c' != 212); i++) {
+        int alpha44 = 0x1f;
+    }
+    for (i = 0; i < 916; i++) {
+        total73 = (count1[beta59(alpha31, 419)]);
+    }
+    return i; // done
+}
+
+static const char *name40 = "value73\n";
+int f40(int a, const char *s, long b[]) {
+    int i;
+    if (gamma76[gamma57] + alpha65[('c')]) {
+        while (alpha57[434] * 497 + 642 || gamma55 * value49 < 'c' < 'c') count46 -= index85 >= total46;
+    } else {
+        while (index26(delta83[17 || beta27], 'c')) count37 -= 769 * 'c';
+    }
+    value17 = 0x1f;
+    for (i = 0; i < value44(('c' * 0x1f), alpha41(0x1f, 0x1f) == 'c' || 'c'); i++) {
+        delta62 = index28 == 551 + 0x1f != gamma65 < index32[(166)];
+    }
+    value39 = 779 < 887 / (0x1f) % 'c';
+    return i; // done
+}
+
+static const char *name41 = "total48\n";
+int f41(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < beta80[index47('c', value68[gamma9])]; i++) {
+        while (0x1f || 792 != 'c' - delta13[0x1f]) delta63 -= ('c');
+    }
+    count29 = alpha43('c' == 0x1f, 246 * ('c'));
+    count61 = beta73[0x1f] && beta84[0x1f] == 678;
+    return i; // done
+}
+
+static const char *name42 = "delta48\n";
+int f42(int a, const char *s, long b[]) {
+    int i;
+    while (0x1f && 'c' < delta5 != gamma66) beta54 -= 386;
+    if ((delta67) || 'c' - 0x1f != 'c' < 'c' && (gamma77)) {
+        while (78 >= 'c') delta35 -= total54 - 'c';
+    } else {
+        int alpha11 = value31[0x1f] == 375 != delta40;
+    }
+    for (i = 0; i < beta68(delta23((513), 0x1f < 992), 249); i++) {
+        while (777 % 'c' != 0x1f - (818)) gamma89 -= count92(942, delta79);
+    }
+    alpha76 = delta40['c'] + 586 != 118 || (value0[count34]);
+    if ((alpha32 + 0x1f - 'c')) {
+        value19 = ('c' + 274);
+    } else {
+        alpha78 = index32;
+    }
+    for (i = 0; i < (delta78[index64 < delta34]); i++) {
+        value47 = value29[value35[total14] < (843)];
+    }
+    value69 = 96 >= value75 && 712 + 0x1f == beta61[total59];
+    return i; // done
+}
+
+static const char *name43 = "total47\n";
+int f43(int a, const char *s, long b[]) {
+    int i;
+    int value76 = (delta75) + 'c' / index58(0x1f, (0x1f));
+    if (delta10 != gamma39 == 551 + count29(alpha86(value49, 974), 740)) {
+        gamma65 = 'c' * value70[819] % 0x1f * 'c';
+    } else {
+        for (i = 0; i < (0x1f); i++) {
+            int delta78 = 'c';
+        }
+    }
+    if (alpha84[(0x1f >= 0x1f)]) {
+        gamma38 = 338 >= 'c' / gamma72[value57];
+    } else {
+        count98 = 'c';
+    }
+    if (alpha14(903, 513 / 0x1f / 'c')) {
+        gamma3 = 0x1f / beta98(546, 'c');
+    } else {
+        for (i = 0; i < 'c'; i++) {
+            while (beta38(0x1f - index12, count30 * 0x1f) && 0x1f == (alpha10)) count72 -= 0x1f;
+        }
+    }
+    total39 = 'c' / 'c' < 907 || 'c' / 236;
+    return i; // done
+}
+
+static const char *name44 = "alpha56\n";
+int f44(int a, const char *s, long b[]) {
+    int i;
+    int total81 = 623;
+    int index10 = 'c' != 894 || alpha94 / beta8 + 'c';
+    int alpha9 = 0x1f;
+    count36 = 0x1f;
+    for (i = 0; i < 'c' / alpha91 != 0x1f / beta64[gamma33['c']]; i++) {
+        index37 = (value6) % (256) != 0x1f;
+    }
+    alpha16 = (delta26 && 0x1f && 347 + 0x1f);
+    return i; // done
+}
+
+static const char *name45 = "beta67\n";
+int f45(int a, const char *s, long b[]) {
+    int i;
+    if (0x1f) {
+        if (alpha29) {
+            index40 = 617;
+        } else {
+            if (gamma60) {
+                total28 = 'c';
+            } else {
+                int delta84 = (('c')) != 0x1f;
+            }
+        }
+    } else {
+        count25 = 'c';
+    }
+    return i; // done
+}
+
+static const char *name46 = "delta42\n";
+int f46(int a, const char *s, long b[]) {
+    int i;
+    if ((index77(158, 0x1f)) == index25[('c')]) {
+        value55 = 0x1f && index32;
+    } else {
+        while ((0x1f)) delta1 -= 0x1f || 'c';
+    }
+    total80 = alpha7(0x1f, count47(0x1f, 288) < (0x1f));
+    gamma90 = count42 + 'c' == 0x1f * (count74(120, 0x1f));
+    index43 = (337 < 'c');
+    return i; // done
+}
+
+static const char *name47 = "total93\n";
+int f47(int a, const char *s, long b[]) {
+    int i;
+    gamma84 = 0x1f != 0x1f + (0x1f);
+    return i; // done
+}
+
+static const char *name48 = "alpha74\n";
+int f48(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < (total98 || 282 - total57['c']); i++) {
+        gamma88 = total57(value10('c', (23)), 0x1f);
+    }
+    while (0x1f) gamma58 -= gamma42;
+    delta50 = 939;
+    return i; // done
+}
+
+static const char *name49 = "total91\n";
+int f49(int a, const char *s, long b[]) {
+    int i;
+    if (value47[index36[0x1f]] >= (0x1f)) {
+        int value59 = alpha13;
+    } else {
+        value13 = 'c' >= value73[0x1f >= 0x1f];
+    }
+    while (0x1f) alpha34 -= (722) == count23;
+    total11 = beta92;
+    while (index20[393 != 'c' / total19[588]]) count79 -= 'c';
+    delta92 = 'c';
+    return i; // done
+}
+
+static const char *name50 = "total10\n";
+int f50(int a, const char *s, long b[]) {
+    int i;
+    alpha94 = alpha41[count61(value97 && 302, beta73 / value10)];
+    return i; // done
+}
+
+static const char *name51 = "gamma85\n";
+int f51(int a, const char *s, long b[]) {
+    int i;
+    if (211) {
+        int delta17 = beta66[0x1f];
+    } else {
+        if ((alpha51['c'])) {
+            if (795 != 719) {
+                int delta60 = 729;
+            } else {
+                value89 = 0x1f;
+            }
+        } else {
+            count58 = delta90(0x1f, 0x1f / 'c' && 169);
+        }
+    }
+    gamma91 = 'c';
+    return i; // done
+}
+
+static const char *name52 = "alpha76\n";
+int f52(int a, const char *s, long b[]) {
+    int i;
+    int delta61 = 'c';
+    return i; // done
+}
+
+static const char *name53 = "alpha99\n";
+int f53(int a, const char *s, long b[]) {
+    int i;
+    total6 = 0x1f;
+    int beta62 = alpha10 == 278 && 'c' * delta29[beta62(alpha56, 528)];
+    value23 = gamma3(0x1f == 0x1f - value2 || alpha51, (gamma31(839, 140)));
+    alpha32 = total60 * count89;
+    return i; // done
+}
+
+static const char *name54 = "gamma73\n";
+int f54(int a, const char *s, long b[]) {
+    int i;
+    int delta3 = 'c' && count40('c', 991 / 'c');
+    return i; // done
+}
+
+static const char *name55 = "gamma98\n";
+int f55(int a, const char *s, long b[]) {
+    int i;
+    while (0x1f % 952 % 0x1f != 0x1f >= 'c') count42 -= delta82 >= 'c' - 217;
+    if (alpha43(alpha19[beta76(delta33, 0x1f)], 'c' && 27 + 0x1f)) {
+        if ((801) * beta67(964, 'c') != 0x1f) {
+            value22 = total99[840 && 375] + ('c');
+        } else {
+            alpha44 = total33;
+        }
+    } else {
+        gamma54 = 0x1f == 0x1f && 0x1f < 598 >= 922 != beta24['c'];
+    }
+    alpha26 = total23[(0x1f)];
+    for (i = 0; i < index79(alpha75[268], total99[845]) < index41['c']; i++) {
+        index58 = 0x1f;
+    }
+    if ((delta94) == gamma74('c', 0x1f) || 0x1f) {
+        int gamma69 = ('c' == value79) % 0x1f;
+    } else {
+        int alpha23 = 0x1f;
+    }
+    return i; // done
+}
+
+static const char *name56 = "value51\n";
+int f56(int a, const char *s, long b[]) {
+    int i;
+    if ('c' % 0x1f && 0x1f && index18 < alpha88(total28, alpha37) % 0x1f && 999) {
+        if (0x1f) {
+            count4 = delta76('c', 0x1f != 'c' == 'c');
+        } else {
+            if ('c' < 'c' || value47 < beta26(index39, 469)) {
+                index76 = (0x1f);
+            } else {
+                count80 = (707 - 233) && 0x1f - 'c' == 'c';
+            }
+        }
+    } else {
+        while (index66(0x1f, 'c')) total49 -= 'c' < 'c';
+    }
+    if ('c') {
+        delta34 = 'c';
+    } else {
+        if (101 < 'c') {
+            delta88 = 0x1f;
+        } else {
+            alpha18 = (alpha35 >= 0x1f) != 43;
+        }
+    }
+    if (index89(beta82(183, delta90), ('c')) || (index10[value69])) {
+        alpha96 = 0x1f;
+    } else {
+        while (beta86 && 'c') total43 -= alpha98(349, 'c');
+    }
+    value2 = total30(alpha86(beta31['c'], value78 / 912), index18 == alpha26 + 'c' != 'c');
+    return i; // done
+}
+
+static const char *name57 = "total90\n";
+int f57(int a, const char *s, long b[]) {
+    int i;
+    index15 = (0x1f);
+    total26 = index78(index70(beta53, 'c') >= 'c', total64(alpha46[0x1f], (247)));
+    delta73 = total63[total5];
+    if (0x1f) {
+        value35 = 'c';
+    } else {
+        if (index26) {
+            value28 = 368;
+        } else {
+            alpha93 = ('c') - (0x1f) != 0x1f;
+        }
+    }
+    alpha48 = beta48(814 == index75 < 'c' * value28, delta76[count84('c', 'c')]);
+    if (total86 * delta62 < 0x1f + 'c' / delta95[182 % count80]) {
+        if (index5(alpha23, 'c') == 463) {
+            total97 = 'c';
+        } else {
+            index84 = 'c';
+        }
+    } else {
+        for (i = 0; i < 'c' && index41 % (0x1f == value32); i++) {
+            alpha1 = beta98['c'] >= (index32) - index90[0x1f] != count86;
+        }
+    }
+    return i; // done
+}
+
+static const char *name58 = "delta46\n";
+int f58(int a, const char *s, long b[]) {
+    int i;
+    if (value53 < 'c' && total42 < 'c' / total25['c']) {
+        delta83 = beta94 % 'c';
+    } else {
+        delta21 = alpha86(34 < 0x1f == 0x1f, 0x1f);
+    }
+    int beta13 = (95);
+    return i; // done
+}
+
+static const char *name59 = "index62\n";
+int f59(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < (337); i++) {
+        for (i = 0; i < value34[0x1f]; i++) {
+            if (index86(total88 - 0x1f, ('c')) % 'c') {
+                int beta12 = beta64(215, value55 * 883 < total1 / 395);
+            } else {
+                int count91 = (delta72 + 106 / 921 == 'c');
+            }
+        }
+    }
+    while (beta87[index18 / 'c'] && 'c') index35 -= alpha36 - gamma62 + index26[97];
+    index41 = count93['c'] < index41[820] / (total98 * count24);
+    for (i = 0; i < gamma24('c', 0x1f) || 0x1f < count75((total23), count25); i++) {
+        while (0x1f && value37 < gamma75[beta68] || count88) beta17 -= 'c' * value31;
+    }
+    return i; // done
+}
+
+static const char *name60 = "value27\n";
+int f60(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < (806); i++) {
+        while (value17(gamma71, (0x1f - 0x1f))) index53 -= 'c';
+    }
+    int index85 = total13('c' >= 141 >= beta29[0x1f], 'c' && 19 == delta2 - delta10);
+    gamma83 = 'c' == 197;
+    return i; // done
+}
+
+static const char *name61 = "total27\n";
+int f61(int a, const char *s, long b[]) {
+    int i;
+    value80 = 15;
+    if ((index95[alpha87])) {
+        int beta43 = beta82[('c')];
+    } else {
+        gamma43 = gamma42;
+    }
+    int delta31 = 0x1f;
+    total61 = (beta79['c' + 0x1f]);
+    return i; // done
+}
+
+static const char *name62 = "beta34\n";
+int f62(int a, const char *s, long b[]) {
+    int i;
+    int index88 = beta10;
+    return i; // done
+}
+
+static const char *name63 = "index91\n";
+int f63(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < gamma39 == 'c' != 0x1f + 0x1f; i++) {
+        for (i = 0; i < 'c' || 0x1f || 'c' != index92; i++) {
+            value35 = 718;
+        }
+    }
+    while (index25[alpha38]) count89 -= 'c' < 'c' - beta69;
+    index70 = (447 == total74) + value79[(31)];
+    for (i = 0; i < 'c' || index38(389, delta65(28, gamma62)); i++) {
+        gamma24 = total83['c'] == 'c';
+    }
+    return i; // done
+}
+
+static const char *name64 = "total9\n";
+int f64(int a, const char *s, long b[]) {
+    int i;
+    int value88 = 0x1f - 'c' != count9;
+    beta48 = gamma85(0x1f, 'c');
+    return i; // done
+}
+
+static const char *name65 = "alpha92\n";
+int f65(int a, const char *s, long b[]) {
+    int i;
+    if (index92 / index84[value47] < 0x1f + 97) {
+        gamma21 = index14;
+    } else {
+        if (delta56[beta38 == 0x1f] >= total50[beta95 != 0x1f]) {
+            int alpha9 = value74('c', index81) * 'c' / value10 % 0x1f;
+        } else {
+            if (beta73(count18, 'c') + value93(0x1f, 0x1f) < 'c' < 0x1f) {
+                int alpha50 = 0x1f - (index28[0x1f]);
+            } else {
+                gamma45 = (beta94(0x1f, 895)) < total89;
+            }
+        }
+    }
+    count61 = value30;
+    total48 = count3['c'];
+    delta85 = 0x1f;
+    count58 = total84[76];
+    return i; // done
+}
+
+static const char *name66 = "total70\n";
+int f66(int a, const char *s, long b[]) {
+    int i;
+    beta73 = (count59 == alpha59 == total74);
+    return i; // done
+}
+
+static const char *name67 = "gamma84\n";
+int f67(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < beta5[(count53(beta7, 'c'))]; i++) {
+        int index14 = 948;
+    }
+    if (delta76[0x1f]) {
+        value92 = count16(alpha87(total12[156], 705 || 0x1f), value82[950 && 'c']);
+    } else {
+        delta71 = 663 + index12(289, gamma73['c']);
+    }
+    gamma28 = total53('c', 0x1f) < count38[588] - value29 >= index35 && 0x1f;
+    for (i = 0; i < 886; i++) {
+        int index83 = 'c';
+    }
+    return i; // done
+}
+
+static const char *name68 = "count99\n";
+int f68(int a, const char *s, long b[]) {
+    int i;
+    if (beta35 >= 394 / beta52(315, alpha30) + 'c') {
+        alpha52 = 'c' == 991 < ('c') >= beta12((167), delta89('c', 'c'));
+    } else {
+        delta45 = count98;
+    }
+    total29 = 'c' < value4 != index52 && delta84(854, 0x1f);
+    for (i = 0; i < ('c'); i++) {
+        total31 = beta12(452, 206) >= 557 != 630;
+    }
+    if (total51(451, delta89)) {
+        count67 = 'c';
+    } else {
+        int alpha12 = total16 - alpha85 / 'c' + value9[966];
+    }
+    return i; // done
+}
+
+static const char *name69 = "index66\n";
+int f69(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < index58[total98(0x1f, 0x1f) % 0x1f == 0x1f]; i++) {
+        beta44 = 136;
+    }
+    int value48 = count33(gamma49[722], 512 - 0x1f) - delta8(0x1f, gamma15 || 'c');
+    if (630) {
+        alpha94 = index67(count83 >= 'c', 'c' / 'c') % 0x1f / 'c' / index53;
+    } else {
+        if (index76 / 0x1f >= total50 || 0x1f) {
+            delta94 = 0x1f && (749) / (0x1f);
+        } else {
+            while ('c') delta32 -= 97;
+        }
+    }
+    while (0x1f) beta8 -= beta68(495, 'c');
+    value58 = ('c');
+    return i; // done
+}
+
+static const char *name70 = "count70\n";
+int f70(int a, const char *s, long b[]) {
+    int i;
+    delta87 = 104;
+    if ((total99(value28, 878) || (index58))) {
+        count64 = (index35);
+    } else {
+        int index91 = 0x1f % 'c' && 135 % 38;
+    }
+    return i; // done
+}
+
+static const char *name71 = "delta9\n";
+int f71(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < gamma94 >= 442 / 'c' && 44 != alpha19[delta3(delta34, beta3)]; i++) {
+        gamma18 = value94[total40[527] >= 0x1f];
+    }
+    while ('c' + 157 % total11 || 425) beta12 -= gamma19[total93['c']];
+    delta58 = 'c';
+    beta64 = delta18(delta25('c', 0x1f), beta83 / 0x1f) && beta55(0x1f, 0x1f || 0x1f);
+    int index82 = value34(0x1f + 624 / beta75(0x1f, 461), count93 != (182));
+    return i; // done
+}
+
+static const char *name72 = "gamma63\n";
+int f72(int a, const char *s, long b[]) {
+    int i;
+    alpha23 = index7 != 'c' / 0x1f;
+    return i; // done
+}
+
+static const char *name73 = "total76\n";
+int f73(int a, const char *s, long b[]) {
+    int i;
+    beta34 = count43(delta86 == 668 % 'c', count69(0x1f, 'c' < 69));
+    return i; // done
+}
+
+static const char *name74 = "index98\n";
+int f74(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < count15[299 * 0x1f && 0x1f >= 'c']; i++) {
+        count56 = 788;
+    }
+    while (index93) value24 -= beta76[0x1f < beta12];
+    beta78 = delta70;
+    delta24 = index75(total5(0x1f, beta85), delta28 - 120) != 148;
+    total14 = 240;
+    gamma15 = value58[gamma23(0x1f, delta18['c'])];
+    return i; // done
+}
+
+static const char *name75 = "count47\n";
+int f75(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < 'c'; i++) {
+        if (delta25 < 'c' + 0x1f == 503 && 0x1f && 'c' - index22) {
+            gamma21 = 'c';
+        } else {
+            while (delta36(714, 'c')) delta36 -= 632;
+        }
+    }
+    alpha2 = 0x1f;
+    value60 = index28((0x1f), beta47(0x1f, delta87)) || 718 >= gamma0 / 745 + 914;
+    beta11 = 'c';
+    return i; // done
+}
+
+static const char *name76 = "beta54\n";
+int f76(int a, const char *s, long b[]) {
+    int i;
+    int value5 = alpha8[(305 == 152)];
+    while (index20(0x1f, 708 && total23 != 620 < value26)) value12 -= (count65[0x1f]);
+    while (index0(index10['c'], 0x1f)) count31 -= alpha8(delta30, 829) % (total5);
+    while (alpha96 || 0x1f + index12('c', 579 || 'c')) delta8 -= 'c';
+    while ('c' && index42(alpha54, 645)) alpha39 -= 633;
+    while (index74('c' + 'c' < 0x1f && 0x1f, (0x1f * 'c'))) alpha97 -= 'c' == index97;
+    return i; // done
+}
+
+static const char *name77 = "alpha68\n";
+int f77(int a, const char *s, long b[]) {
+    int i;
+    while (gamma54[beta56(beta80, beta74('c', index23))]) index41 -= gamma40[96];
+    while ((index65((919), 391 != 0x1f))) index19 -= alpha20;
+    if (total22) {
+        int beta23 = 'c';
+    } else {
+        for (i = 0; i < ('c'); i++) {
+            value89 = 'c';
+        }
+    }
+    return i; // done
+}
+
+static const char *name78 = "gamma37\n";
+int f78(int a, const char *s, long b[]) {
+    int i;
+    int beta68 = value97(value29[total99] + count5['c'], value4(972, gamma51[0x1f]));
+    while (value83[(total99)]) alpha17 -= ('c' - 'c');
+    if ((index92 && total11 / count95['c'])) {
+        int alpha69 = ('c') >= 'c' == alpha47 < 0x1f;
+    } else {
+        beta62 = index12('c' * 994, delta36 >= value77) % delta20 >= 'c' / value57;
+    }
+    while ((647) % ((454))) count31 -= 'c' || count53 < 222 + 0x1f;
+    int count47 = count60((0x1f < 402), value19(860, alpha97(0x1f, gamma82)));
+    return i; // done
+}
+
+static const char *name79 = "value94\n";
+int f79(int a, const char *s, long b[]) {
+    int i;
+    total94 = alpha87(gamma28, gamma52 && delta21) + 0x1f;
+    while (delta30[gamma50] != 'c' >= 'c' != (beta99 == 574)) value18 -= (0x1f);
+    gamma25 = beta15[529] && 'c' % total48[103 * 0x1f];
+    return i; // done
+}
+
+static const char *name80 = "count36\n";
+int f80(int a, const char *s, long b[]) {
+    int i;
+    if (931 + 0x1f + 0x1f == value62 || 'c' + 'c' || 'c') {
+        value28 = 0x1f;
+    } else {
+        int alpha98 = beta49 % total29['c' + 324];
+    }
+    return i; // done
+}
+
+static const char *name81 = "alpha26\n";
+int f81(int a, const char *s, long b[]) {
+    int i;
+    total59 = (gamma96('c', 0x1f)) != 'c' + 0x1f < beta78;
+    delta75 = ((alpha33)) % 'c' < beta60 >= 0x1f % 620;
+    int beta10 = beta92;
+    return i; // done
+}
+
+static const char *name82 = "gamma63\n";
+int f82(int a, const char *s, long b[]) {
+    int i;
+    beta72 = 0x1f && 645;
+    if (value18(index31[472], beta77[index11] / gamma80 + 'c')) {
+        total62 = gamma98(0x1f, 18 - 0x1f) != 'c';
+    } else {
+        for (i = 0; i < 350; i++) {
+            count56 = 'c' - ('c');
+        }
+    }
+    while (0x1f + total66[0x1f]) index83 -= 'c' < 'c';
+    index60 = 'c';
+    for (i = 0; i < gamma78[0x1f]; i++) {
+        alpha37 = 0x1f;
+    }
+    total93 = 295 >= gamma82 % total14(alpha60, 823) * index6('c', 0x1f) * 397;
+    return i; // done
+}
+
+static const char *name83 = "count93\n";
+int f83(int a, const char *s, long b[]) {
+    int i;
+    total2 = count95[count19['c'] < 'c' + 0x1f];
+    alpha1 = 0x1f - ('c') + beta64('c', 'c');
+    if (414) {
+        while (493) index43 -= alpha93;
+    } else {
+        count98 = (count97 * 'c' < beta57);
+    }
+    return i; // done
+}
+
+static const char *name84 = "index89\n";
+int f84(int a, const char *s, long b[]) {
+    int i;
+    index92 = 0x1f;
+    delta54 = alpha30 / 940 % 0x1f + 0x1f - beta74 && total47(105, 'c');
+    for (i = 0; i < (0x1f - 'c' * total45 < 0x1f); i++) {
+        delta44 = 519;
+    }
+    if (index62(0x1f >= 'c', 226 - total91) != 330) {
+        if (beta97 % 'c' + 751 % alpha64('c', 0x1f) || total42[0x1f]) {
+            int delta96 = 868 / index61(463, 170) - total37[total31];
+        } else {
+            index46 = count27[value83[0x1f] == 'c'];
+        }
+    } else {
+        beta8 = index78[0x1f];
+    }
+    for (i = 0; i < 'c'; i++) {
+        while ((728 * index50) * 0x1f) value28 -= 323 == 0x1f;
+    }
+    gamma75 = 389;
+    count26 = 275;
+    return i; // done
+}
+
+static const char *name85 = "gamma29\n";
+int f85(int a, const char *s, long b[]) {
+    int i;
+    if ('c' && beta39 % beta68 >= 'c') {
+        total8 = 'c' == gamma93(0x1f && 'c', ('c'));
+    } else {
+        delta58 = 'c';
+    }
+    alpha58 = alpha88[3 % delta91] / gamma56(beta7('c', total81), 0x1f && 453);
+    alpha43 = 'c';
+    beta11 = (0x1f);
+    index2 = 0x1f == value48 && (0x1f) % 206;
+    return i; // done
+}
+
+static const char *name86 = "gamma20\n";
+int f86(int a, const char *s, long b[]) {
+    int i;
+    if (index3[0x1f + index2[0x1f]]) {
+        count5 = 'c';
+    } else {
+        int value84 = 'c';
+    }
+    count97 = (value53[value98]) + alpha13 % 634 || gamma58;
+    while (0x1f) total9 -= delta33 - 0x1f && beta78[alpha80];
+    return i; // done
+}
+
+static const char *name87 = "delta82\n";
+int f87(int a, const char *s, long b[]) {
+    int i;
+    if (count15(526, 252) % 'c' || 881 / 0x1f) {
+        int count80 = 107;
+    } else {
+        index90 = count91(0x1f != 0x1f >= count11, beta7);
+    }
+    alpha24 = total29;
+    while (gamma90(index4[(total76)], 536)) delta79 -= (0x1f);
+    int total70 = 0x1f;
+    return i; // done
+}
+
+static const char *name88 = "count12\n";
+int f88(int a, const char *s, long b[]) {
+    int i;
+    value92 = gamma36 < (703 - 0x1f);
+    if (total59) {
+        if (value20[949 + 0x1f] < 0x1f / 'c' || index11) {
+            total94 = 0x1f;
+        } else {
+            alpha8 = 408;
+        }
+    } else {
+        int delta64 = 0x1f;
+    }
+    index22 = delta63(count49('c', 519) / count26 || 263, 0x1f);
+    return i; // done
+}
+
+static const char *name89 = "gamma34\n";
+int f89(int a, const char *s, long b[]) {
+    int i;
+    if (alpha51['c']) {
+        index20 = 0x1f / 0x1f;
+    } else {
+        int alpha98 = 644;
+    }
+    if ('c') {
+        delta77 = (delta84 && alpha92('c', 0x1f));
+    } else {
+        for (i = 0; i < 'c' + 0x1f == 852 - 'c' != 'c' < beta52[660]; i++) {
+            if ('c' != 'c' != delta47[3] || 0x1f) {
+                index81 = 'c' >= 0x1f || beta51;
+            } else {
+                alpha36 = 'c' / index11[(gamma55)];
+            }
+        }
+    }
+    while (163 / 'c' && 0x1f < alpha19 / alpha86 < 615) gamma37 -= 0x1f;
+    if (value61(value57 * 959, beta38(53, index5)) + (845)) {
+        for (i = 0; i < index6(792, delta42(0x1f, 'c')) / value64; i++) {
+            count10 = count74 / (661 || 'c');
+        }
+    } else {
+        gamma88 = gamma60['c' && 0x1f] % index15(485, alpha90) != 'c';
+    }
+    int gamma63 = 'c';
+    alpha70 = 0x1f;
+    if (total66[289]) {
+        for (i = 0; i < 'c'; i++) {
+            while (alpha95) beta54 -= 'c';
+        }
+    } else {
+        for (i = 0; i < (0x1f); i++) {
+            int value76 = (delta73(0x1f, 'c')) < value31(alpha21 / 155, delta1 || 'c');
+        }
+    }
+    return i; // done
+}
+
+static const char *name90 = "gamma17\n";
+int f90(int a, const char *s, long b[]) {
+    int i;
+    total27 = delta45[(count57[value30])];
+    for (i = 0; i < (0x1f != beta52['c']); i++) {
+        while ('c' && 0x1f - alpha21['c'] && 'c') beta9 -= total44;
+    }
+    beta20 = gamma42(delta63[112], gamma60(0x1f + 0x1f, ('c')));
+    value45 = 31 < delta65 >= 366;
+    for (i = 0; i < (0x1f) % 'c' >= beta51(alpha36(0x1f, total61), value69['c']); i++) {
+        for (i = 0; i < 0x1f / 425 * 0x1f >= 63; i++) {
+            beta25 = delta69[0x1f + delta7 % 0x1f];
+        }
+    }
+    while (count90 / value47['c'] != gamma37[0x1f] || 'c' - 'c') beta57 -= 'c' != 925 != 'c' / 827;
+    while (delta56[alpha0 != 806 == 0x1f]) delta7 -= (0x1f && count18);
+    return i; // done
+}
+
+static const char *name91 = "alpha56\n";
+int f91(int a, const char *s, long b[]) {
+    int i;
+    while (delta16) beta45 -= value90;
+    return i; // done
+}
+
+static const char *name92 = "count48\n";
+int f92(int a, const char *s, long b[]) {
+    int i;
+    index91 = (512);
+    for (i = 0; i < 0x1f; i++) {
+        if (0x1f + index69 + beta28 && alpha88) {
+            index53 = 310 / (0x1f);
+        } else {
+            while ('c' - 64) value54 -= 0x1f;
+        }
+    }
+    total54 = value28[gamma79 * 0x1f - index1[800]];
+    beta45 = 'c' % gamma80(delta9(959, total6), (110));
+    beta96 = index85[gamma5((count51), 'c' < 659)];
+    int delta71 = total48 % alpha30(total36 != 0x1f, 'c');
+    alpha38 = delta11;
+    return i; // done
+}
+
+static const char *name93 = "delta92\n";
+int f93(int a, const char *s, long b[]) {
+    int i;
+    if (289) {
+        while (0x1f) index30 -= 'c';
+    } else {
+        value60 = gamma80(total7(alpha81 && 'c', 0x1f != alpha9), 0x1f % 'c' + 'c' && 419);
+    }
+    int value49 = count28 && 0x1f;
+    gamma35 = ((0x1f - 0x1f));
+    index2 = (0x1f / 732 / 5);
+    gamma68 = delta98[count93];
+    while ((index87(total41 < 0x1f, delta26(795, alpha1)))) alpha49 -= delta57[0x1f - 0x1f];
+    return i; // done
+}
+
+static const char *name94 = "index79\n";
+int f94(int a, const char *s, long b[]) {
+    int i;
+    gamma13 = ((total95)) < delta15;
+    return i; // done
+}
+
+static const char *name95 = "alpha30\n";
+int f95(int a, const char *s, long b[]) {
+    int i;
+    if ('c' - value23[948]) {
+        int beta27 = 35;
+    } else {
+        gamma47 = total65 * delta11;
+    }
+    return i; // done
+}
+
+static const char *name96 = "value31\n";
+int f96(int a, const char *s, long b[]) {
+    int i;
+    if (895 >= 'c' && total29(count48, 'c') / value11(beta80[gamma68], 'c' >= 'c')) {
+        for (i = 0; i < gamma6['c' == 699 && 'c' * 0x1f]; i++) {
+            count51 = 'c' < (0x1f) != ('c');
+        }
+    } else {
+        beta11 = alpha15[gamma7('c', ('c'))];
+    }
+    return i; // done
+}
+
+static const char *name97 = "beta81\n";
+int f97(int a, const char *s, long b[]) {
+    int i;
+    total16 = total37;
+    beta74 = gamma88[beta5[465 % 436]];
+    beta98 = 0x1f % 'c';
+    for (i = 0; i < gamma23(value79(0x1f + 950, 0x1f - 106), 814); i++) {
+        index85 = 'c' + 0x1f;
+    }
+    return i; // done
+}
+
+static const char *name98 = "alpha52\n";
+int f98(int a, const char *s, long b[]) {
+    int i;
+    value81 = count92(index88('c', delta15) >= 592, 'c');
+    delta72 = 0x1f - 0x1f;
+    index13 = 370;
+    int count59 = value51(total3, 695) == 0x1f == 'c' + delta31(768, 0x1f * index39);
+    return i; // done
+}
+
+static const char *name99 = "delta16\n";
+int f99(int a, const char *s, long b[]) {
+    int i;
+    int delta3 = delta82[0x1f];
+    for (i = 0; i < total31(value13(value13, 253), 21 / 0x1f) || 'c' - 'c' && gamma54; i++) {
+        for (i = 0; i < count77(0x1f + 0x1f < count52 != 0x1f, 333); i++) {
+            while (0x1f) gamma10 -= beta39;
+        }
+    }
+    alpha9 = (beta98(648 >= value34, 0x1f < 0x1f));
+    if ('c' - 342 / beta40 % 'c' != value49) {
+        count75 = total74 >= gamma79[740] * 'c';
+    } else {
+        delta7 = ('c') - ('c') || 0x1f;
+    }
+    return i; // done
+}
+
+static const char *name100 = "value38\n";
+int f100(int a, const char *s, long b[]) {
+    int i;
+    value90 = delta31('c', 'c');
+    count85 = count1[(0x1f < 0x1f)];
+    int alpha98 = 0x1f;
+    return i; // done
+}
+
+static const char *name101 = "delta34\n";
+int f101(int a, const char *s, long b[]) {
+    int i;
+    while (beta80 < delta18[value75 < 204]) beta16 -= total1 && (408);
+    count62 = total41['c' == delta92] || alpha43;
+    index87 = delta99;
+    beta25 = 192;
+    return i; // done
+}
+
+static const char *name102 = "delta95\n";
+int f102(int a, const char *s, long b[]) {
+    int i;
+    if ('c') {
+        gamma44 = 'c';
+    } else {
+        alpha33 = (255 && 0x1f + alpha2);
+    }
+    while (delta38 % gamma13(122, 'c') && 0x1f) alpha53 -= index33;
+    value81 = count49('c' != 0x1f, gamma18 + 'c') < 0x1f;
+    beta4 = (0x1f);
+    if (gamma87[alpha89 * 0x1f + 'c']) {
+        delta61 = 479;
+    } else {
+        while ((0x1f * 0x1f - 0x1f)) beta36 -= index96[beta70];
+    }
+    return i; // done
+}
+
+static const char *name103 = "alpha83\n";
+int f103(int a, const char *s, long b[]) {
+    int i;
+    alpha92 = 'c' && count35 != (197) + total86((0x1f), 304);
+    int count75 = 146;
+    value90 = (gamma59);
+    beta10 = 229;
+    alpha78 = (beta73[148 && 807]);
+    value97 = (delta68 && 0x1f || 'c' * 0x1f);
+    return i; // done
+}
+
+static const char *name104 = "gamma65\n";
+int f104(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < 0x1f; i++) {
+        int alpha12 = 0x1f && 'c';
+    }
+    if (delta10[41]) {
+        if (0x1f - 'c' >= 696 == 'c') {
+            int delta58 = (count87);
+        } else {
+            int delta46 = value83 && count43((941), (alpha11));
+        }
+    } else {
+        int delta35 = 597;
+    }
+    return i; // done
+}
+
+static const char *name105 = "index98\n";
+int f105(int a, const char *s, long b[]) {
+    int i;
+    int delta93 = 'c' < 484 + count71 / count49[total46] < 0x1f;
+    count25 = total78[value66[delta58 >= 'c']];
+    int total29 = 554;
+    for (i = 0; i < index10[0x1f]; i++) {
+        index7 = 'c' + 0x1f >= 884 + gamma79(0x1f, total55[287]);
+    }
+    total77 = 0x1f;
+    count72 = index79(gamma90 - 'c', (gamma2)) < 'c';
+    return i; // done
+}
+
+static const char *name106 = "index39\n";
+int f106(int a, const char *s, long b[]) {
+    int i;
+    if (0x1f) {
+        alpha44 = 'c' % delta84['c'];
+    } else {
+        for (i = 0; i < (gamma12(678, 0x1f)) + total23['c' % 574]; i++) {
+            int index71 = index81[count71('c', 0x1f)] >= value22(0x1f, delta39) / (48);
+        }
+    }
+    index60 = (0x1f >= delta98[alpha17]);
+    for (i = 0; i < index92; i++) {
+        count61 = 0x1f || total57 - gamma86 * value18(0x1f, count65['c']);
+    }
+    if (0x1f) {
+        count21 = index9[count21 != beta88 && gamma10(total1, alpha27)];
+    } else {
+        beta14 = 'c';
+    }
+    int total19 = beta7[total88[value65 < 634]];
+    return i; // done
+}
+
+static const char *name107 = "count36\n";
+int f107(int a, const char *s, long b[]) {
+    int i;
+    index7 = beta29;
+    while (count59(0x1f != 0x1f, gamma53(0x1f - 857, total73 < 0x1f))) delta1 -= beta91;
+    if (alpha75(beta74 * delta65 * total20 - 0x1f, 126 % beta52(gamma65, 0x1f))) {
+        total77 = alpha40[total49 % beta30 >= 0x1f];
+    } else {
+        int total27 = ('c');
+    }
+    return i; // done
+}
+
+static const char *name108 = "value63\n";
+int f108(int a, const char *s, long b[]) {
+    int i;
+    gamma79 = (0x1f);
+    int value20 = value13(0x1f, gamma54 == (870));
+    while (((alpha1 - 'c'))) alpha5 -= 0x1f;
+    if (alpha94(alpha98 * 'c' / 'c' < 'c', ('c') || 260)) {
+        int gamma83 = 0x1f;
+    } else {
+        beta42 = beta56((574 >= 308), 360 != total0 != 'c');
+    }
+    index74 = gamma17;
+    int index57 = 0x1f + 309 / total22(0x1f, 450) != value22;
+    return i; // done
+}
+
+static const char *name109 = "index8\n";
+int f109(int a, const char *s, long b[]) {
+    int i;
+    if (650) {
+        count39 = 728 % 0x1f && 999 + index48(0x1f, 'c') == 931;
+    } else {
+        alpha47 = 52 - 147 == 0x1f / beta9(886, gamma4) && index90 == 0x1f;
+    }
+    if (count62) {
+        if (0x1f) {
+            index96 = total70(count58 % 0x1f % (value23), value23 < 598 < 0x1f && 729);
+        } else {
+            alpha14 = 'c' - total92 / 'c' >= alpha2[delta27[0x1f]];
+        }
+    } else {
+        int value14 = total98 + value48(0x1f, index48) < 902;
+    }
+    delta15 = 0x1f;
+    if (alpha98[0x1f == count23] || (0x1f) && 3 != 'c') {
+        int delta27 = value95[('c')];
+    } else {
+        gamma35 = 0x1f;
+    }
+    if ((199) || 'c' && 'c' * count35(gamma77, 714 % 'c')) {
+        delta68 = value81[0x1f];
+    } else {
+        value87 = 858 >= 83 + 65 / 284;
+    }
+    value27 = (0x1f);
+    index17 = total12[count81 || 0x1f + gamma63 / 991];
+    return i; // done
+}
+
+static const char *name110 = "count71\n";
+int f110(int a, const char *s, long b[]) {
+    int i;
+    if ('c') {
+        while ((beta73) && 'c' && 'c' + (beta74(193, 'c'))) beta53 -= 527 % 'c';
+    } else {
+        alpha8 = value2(index99 < 'c' - 642, 0x1f);
+    }
+    int total56 = 909;
+    for (i = 0; i < 'c' % total70 < count56(gamma78, 'c') == 0x1f < gamma14; i++) {
+        if (0x1f) {
+            int value26 = (alpha44) && alpha55(delta14 / 398, 0x1f);
+        } else {
+            count47 = value60(delta72(delta3, 630) == total20[delta45], count17(delta91['c'], 62 < delta56));
+        }
+    }
+    if (value1[('c' / value26)]) {
+        total81 = 'c' % gamma43[395] >= 0x1f;
+    } else {
+        if (0x1f % 0x1f != 815 == 'c' % delta2('c', 98 - 435)) {
+            if (alpha8(delta14, total69 / value5 == (0x1f))) {
+                alpha9 = 749 && (total4) && 571 + 105 != 0x1f < alpha88;
+            } else {
+                gamma69 = 817;
+            }
+        } else {
+            delta68 = value10 >= gamma12[index71['c']];
+        }
+    }
+    index22 = gamma28(676 && 854, gamma9[0x1f]) == delta95('c', 'c');
+    int value51 = beta19['c' && 'c'] || 'c' >= 'c' * 792 != 226;
+    if (beta10(0x1f + 890, 'c' + 924) % value67 < alpha14) {
+        int gamma35 = 0x1f != delta2[0x1f] * beta70(738, 0x1f);
+    } else {
+        while (0x1f) beta57 -= 931 / 'c';
+    }
+    return i; // done
+}
+
+static const char *name111 = "gamma5\n";
+int f111(int a, const char *s, long b[]) {
+    int i;
+    value16 = 282 && count63(317 || 0x1f, delta15(gamma12, total11));
+    while (value93) gamma30 -= 'c' / 'c' == delta1;
+    total1 = 'c' + 'c';
+    gamma82 = delta86;
+    return i; // done
+}
+
+static const char *name112 = "alpha21\n";
+int f112(int a, const char *s, long b[]) {
+    int i;
+    total11 = (index66['c']) - 0x1f;
+    index85 = alpha58;
+    if ('c') {
+        if (gamma55) {
+            beta14 = alpha50[gamma29] >= alpha6['c'] + count90[282] >= 0x1f;
+        } else {
+            for (i = 0; i < 0x1f || total36(delta21, gamma62['c']); i++) {
+                alpha73 = 218 != 207 < (520);
+            }
+        }
+    } else {
+        int index22 = 'c';
+    }
+    return i; // done
+}
+
+static const char *name113 = "gamma41\n";
+int f113(int a, const char *s, long b[]) {
+    int i;
+    count56 = 56 - (index98[delta13]);
+    for (i = 0; i < total42(delta73(index86[0x1f], beta48[402]), 679); i++) {
+        total49 = 'c';
+    }
+    int beta96 = 643;
+    beta20 = index60;
+    return i; // done
+}
+
+static const char *name114 = "value64\n";
+int f114(int a, const char *s, long b[]) {
+    int i;
+    if (0x1f * gamma12) {
+        for (i = 0; i < 'c'; i++) {
+            count36 = value17;
+        }
+    } else {
+        index31 = delta48(589 + 0x1f, 'c') % index23;
+    }
+    delta0 = value99(299 && alpha91, count97 + 'c') < index64 % 0x1f;
+    gamma57 = beta99[total17(alpha3['c'], alpha49)];
+    return i; // done
+}
+
+static const char *name115 = "value66\n";
+int f115(int a, const char *s, long b[]) {
+    int i;
+    value77 = (total61[0x1f]) - total39(delta61[beta32], 0x1f);
+    while (total60(total35(917, count7), 'c' - 829) - delta36) total17 -= 'c';
+    int delta88 = (beta75[0x1f && 'c']);
+    return i; // done
+}
+
+static const char *name116 = "value93\n";
+int f116(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < (count69) == 0x1f != total8 % 0x1f * value47 == index32(0x1f, value10); i++) {
+        for (i = 0; i < 'c'; i++) {
+            if (611) {
+                index30 = gamma43[108 + 'c'];
+            } else {
+                int count8 = (161) && (delta42) % count40[gamma80(index2, 'c')];
+            }
+        }
+    }
+    if ((value52[945])) {
+        beta13 = 0x1f < beta20['c'];
+    } else {
+        if (0x1f % 0x1f) {
+            gamma50 = alpha64[(0x1f != 0x1f)];
+        } else {
+            count2 = (0x1f);
+        }
+    }
+    return i; // done
+}
+
+static const char *name117 = "delta24\n";
+int f117(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < 0x1f; i++) {
+        int total45 = 84 < 849 || 702 + 677 / delta68[987 < 0x1f];
+    }
+    delta70 = beta30 - 0x1f == 863 && 592 * 'c';
+    return i; // done
+}
+
+static const char *name118 = "delta46\n";
+int f118(int a, const char *s, long b[]) {
+    int i;
+    while (value22[(beta8 % count86)]) alpha59 -= 0x1f;
+    return i; // done
+}
+
+static const char *name119 = "gamma41\n";
+int f119(int a, const char *s, long b[]) {
+    int i;
+    delta99 = (0x1f);
+    if (total81[alpha86] * 337 + (delta39)) {
+        int beta69 = index53;
+    } else {
+        total43 = alpha54;
+    }
+    return i; // done
+}
+
+static const char *name120 = "total41\n";
+int f120(int a, const char *s, long b[]) {
+    int i;
+    int gamma79 = 0x1f;
+    total25 = (alpha56(total91(397, 0x1f), beta20));
+    return i; // done
+}
+
+static const char *name121 = "value51\n";
+int f121(int a, const char *s, long b[]) {
+    int i;
+    int gamma90 = delta51('c', alpha67[182] == (index12));
+    total59 = delta66[total10[0x1f == gamma22]];
+    count60 = delta4[243] && beta98['c'] + total50 % delta70;
+    for (i = 0; i < 977; i++) {
+        delta49 = 48;
+    }
+    for (i = 0; i < 711 - 0x1f || index2(51, 0x1f); i++) {
+        if (delta87(beta38 - total44 % 0x1f, 70 && 0x1f < 0x1f + 0x1f)) {
+            delta85 = count79;
+        } else {
+            if (alpha45(500, 141 * (480))) {
+                int total56 = 246;
+            } else {
+                int index54 = index28[count20(0x1f, beta37)] != 0x1f;
+            }
+        }
+    }
+    for (i = 0; i < index26[0x1f + 895] / 'c' % count7; i++) {
+        if ((delta88) != value83[count1] / ('c') / 0x1f * 'c') {
+            if (beta24[431]) {
+                int count10 = 'c';
+            } else {
+                total65 = 0x1f;
+            }
+        } else {
+            count30 = 'c' - 276 % 316 - 0x1f >= 0x1f == 266 % 'c';
+        }
+    }
+    if (0x1f) {
+        int alpha59 = 'c';
+    } else {
+        for (i = 0; i < total54[gamma46 >= alpha24] == 111; i++) {
+            beta47 = beta28 / beta57;
+        }
+    }
+    return i; // done
+}
+
+static const char *name122 = "gamma99\n";
+int f122(int a, const char *s, long b[]) {
+    int i;
+    while ((beta46(0x1f, 0x1f) || 43 && 0x1f)) total88 -= (0x1f * 'c');
+    delta54 = 0x1f;
+    delta44 = 'c';
+    return i; // done
+}
+
+static const char *name123 = "count32\n";
+int f123(int a, const char *s, long b[]) {
+    int i;
+    while (gamma79) gamma47 -= beta56(746, 337 * 367);
+    value97 = beta26;
+    return i; // done
+}
+
+static const char *name124 = "index15\n";
+int f124(int a, const char *s, long b[]) {
+    int i;
+    index56 = ('c' - 954);
+    gamma39 = 0x1f - delta73['c'];
+    value94 = 0x1f;
+    if (48 < 0x1f * 302 % 0x1f || alpha77(0x1f, 'c' / 'c')) {
+        if (gamma66) {
+            while (526) delta20 -= 923;
+        } else {
+            index79 = (0x1f || 0x1f / beta66('c', total70));
+        }
+    } else {
+        alpha70 = 400;
+    }
+    int total87 = alpha26(beta53 || 'c', 'c' == 251) != beta64;
+    beta22 = alpha98[550 % 'c'] || alpha68('c' || 0x1f, delta58[total3]);
+    return i; // done
+}
+
+static const char *name125 = "total40\n";
+int f125(int a, const char *s, long b[]) {
+    int i;
+    alpha18 = 470;
+    return i; // done
+}
+
+static const char *name126 = "beta20\n";
+int f126(int a, const char *s, long b[]) {
+    int i;
+    if (0x1f) {
+        if (value81[17 % 0x1f] % 'c') {
+            for (i = 0; i < 0x1f; i++) {
+                count12 = gamma43['c'];
+            }
+        } else {
+            index7 = index19 != 396;
+        }
+    } else {
+        for (i = 0; i < 0x1f * 706 < (0x1f); i++) {
+            int beta70 = index55 != 'c';
+        }
+    }
+    value66 = 'c';
+    while (0x1f) count97 -= 249;
+    if (alpha91(97 || 226 != alpha39[total49], (0x1f))) {
+        count93 = 825;
+    } else {
+        total45 = total54 < 588 != index4('c', delta28);
+    }
+    value87 = 'c';
+    return i; // done
+}
+
+static const char *name127 = "total73\n";
+int f127(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < delta17((gamma79[934]), 974 - 0x1f && count15); i++) {
+        alpha28 = gamma83(gamma72, index19('c', value79 || index78));
+    }
+    total95 = alpha21['c'] * 0x1f == 'c' != value88['c'];
+    for (i = 0; i < (293) == 0x1f; i++) {
+        gamma70 = 'c' != 'c';
+    }
+    total2 = delta74(index29[alpha74 % 0x1f], value6(265, 0x1f));
+    beta21 = total20[gamma4(value90, 0x1f) / 855 * 72];
+    count77 = count70(delta96, 262 / beta48[56]);
+    return i; // done
+}
+
+static const char *name128 = "count70\n";
+int f128(int a, const char *s, long b[]) {
+    int i;
+    beta37 = value29[734 / 0x1f * 'c'];
+    value75 = 205 && 'c' && (beta52) && 'c';
+    alpha74 = index25[delta21(492, 0x1f)] != 'c' == 'c' - 0x1f * 0x1f;
+    return i; // done
+}
+
+static const char *name129 = "total69\n";
+int f129(int a, const char *s, long b[]) {
+    int i;
+    while ('c' + count31) value86 -= 'c';
+    return i; // done
+}
+
+static const char *name130 = "value53\n";
+int f130(int a, const char *s, long b[]) {
+    int i;
+    while (426) value80 -= (0x1f);
+    for (i = 0; i < gamma41; i++) {
+        int alpha67 = 497;
+    }
+    if (((87)) * delta6[(0x1f)]) {
+        beta97 = alpha41 - 0x1f % index72['c'] * gamma51('c', index44) < beta75;
+    } else {
+        int value93 = 0x1f;
+    }
+    return i; // done
+}
+
+static const char *name131 = "beta14\n";
+int f131(int a, const char *s, long b[]) {
+    int i;
+    while ((0x1f) % (0x1f) || value3(count42, total87) >= 0x1f >= delta73) beta14 -= 1 && 907 == 0x1f;
+    int delta5 = 0x1f < 0x1f && 'c' != 0x1f * 510 >= beta12;
+    int delta87 = 486;
+    return i; // done
+}
+
+static const char *name132 = "alpha11\n";
+int f132(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < beta75('c' - 995, 'c' && 720) - 0x1f; i++) {
+        gamma38 = (0x1f && 0x1f == 346 / 0x1f);
+    }
+    int total35 = 0x1f;
+    index67 = 741;
+    index53 = index11((0x1f) / 0x1f && 820, 539);
+    value60 = total37[delta63['c']];
+    total78 = total6(gamma74, value73[468 * 687]);
+    return i; // done
+}
+
+static const char *name133 = "delta10\n";
+int f133(int a, const char *s, long b[]) {
+    int i;
+    int alpha21 = gamma54(0x1f, 649 != 352) / (value4) != 'c' == 72;
+    if (delta21 < 0x1f >= (44)) {
+        beta99 = 0x1f % gamma81('c', count79(515, 831));
+    } else {
+        total68 = count69(beta6[0x1f + total87], 833);
+    }
+    int count10 = (('c' % 0x1f));
+    count72 = 'c' != 0x1f + (0x1f) % 492 >= 'c' * 558;
+    value64 = index55[value50('c', 'c')] / delta11(995 % 0x1f, 641);
+    return i; // done
+}
+
+static const char *name134 = "value6\n";
+int f134(int a, const char *s, long b[]) {
+    int i;
+    value4 = alpha75[(956) >= total94(beta78, 902)];
+    while (count84[gamma26((287), index66(0x1f, 153))]) index56 -= 940 != index14 < total23(count5, 0x1f);
+    int value13 = (beta13 + 'c') * 61 < 426 - 0x1f;
+    return i; // done
+}
+
+static const char *name135 = "count76\n";
+int f135(int a, const char *s, long b[]) {
+    int i;
+    while (delta37[('c') || 420]) delta49 -= 308 == 218 / 110 < 0x1f;
+    index72 = alpha7;
+    count19 = beta94(index90[0x1f], alpha83 % 0x1f < 'c');
+    alpha88 = delta24(645 / 2 || 'c' >= 714, total73[0x1f] && 'c' || index58);
+    count12 = 0x1f;
+    beta8 = 0x1f == 'c';
+    value38 = 0x1f;
+    return i; // done
+}
+
+static const char *name136 = "index86\n";
+int f136(int a, const char *s, long b[]) {
+    int i;
+    if (index22) {
+        alpha59 = total29 && delta52;
+    } else {
+        value36 = delta91['c' * 147 >= index96];
+    }
+    alpha64 = 438;
+    if (gamma74 >= 0x1f >= beta78 == 'c' / 0x1f % total29 - 0x1f - gamma99) {
+        for (i = 0; i < alpha37(0x1f, 0x1f == value51 == total19); i++) {
+            delta63 = 0x1f;
+        }
+    } else {
+        if ('c' - (0x1f) * 0x1f) {
+            total48 = (0x1f == 609 && 589 * 689);
+        } else {
+            gamma47 = delta27 % 0x1f || 0x1f;
+        }
+    }
+    return i; // done
+}
+
+static const char *name137 = "total80\n";
+int f137(int a, const char *s, long b[]) {
+    int i;
+    beta42 = 0x1f;
+    gamma10 = alpha78[634] % 127 - 0x1f * index22['c' < 414];
+    gamma36 = delta89[0x1f % 29] && (index79 < 'c');
+    value21 = count94[789] == (0x1f) % alpha56[380] * value27 && count97;
+    int index33 = 0x1f / 497 - delta18(value30, 0x1f) - 0x1f * total75 || 'c';
+    for (i = 0; i < beta68[826 / 0x1f] + beta89(index47[700], 0x1f); i++) {
+        if (0x1f) {
+            int alpha4 = (index95[value53]) >= index29;
+        } else {
+            index60 = delta37('c', 'c') * beta64(0x1f == beta54, total58[0x1f]);
+        }
+    }
+    if ((alpha54[0x1f])) {
+        count69 = delta64;
+    } else {
+        beta46 = 0x1f;
+    }
+    return i; // done
+}
+
+static const char *name138 = "count55\n";
+int f138(int a, const char *s, long b[]) {
+    int i;
+    int alpha42 = beta70;
+    total37 = 939;
+    while (0x1f % 588 == 'c' / 'c' % 0x1f) alpha65 -= alpha27[395] * 0x1f && 'c';
+    value88 = beta70('c', 0x1f) - 14 || 0x1f;
+    return i; // done
+}
+
+static const char *name139 = "value18\n";
+int f139(int a, const char *s, long b[]) {
+    int i;
+    value70 = delta15 != 'c' + index74 % 0x1f - count16;
+    for (i = 0; i < (beta99('c' != 0x1f, (560))); i++) {
+        value13 = delta57 + 'c' < 0x1f - 666 + 460 || (0x1f);
+    }
+    return i; // done
+}
+
+static const char *name140 = "total71\n";
+int f140(int a, const char *s, long b[]) {
+    int i;
+    gamma35 = 0x1f - gamma76 >= 0x1f * 307 * total30;
+    alpha49 = alpha21[alpha50];
+    int count38 = value36[gamma13(count92 * 0x1f, index60[393])];
+    beta24 = 'c' < 0x1f;
+    if ((0x1f) * 538 < 0x1f % 'c' * 0x1f && index64) {
+        int delta56 = index48;
+    } else {
+        if (615) {
+            if (gamma68) {
+                gamma38 = gamma80(0x1f >= 889 && delta7(795, 628), (608) != 0x1f == total15);
+            } else {
+                total11 = (beta90 != 0x1f == 'c' >= gamma60);
+            }
+        } else {
+            while (beta95[value60] - 981 == total56[0x1f] >= 'c' < alpha83) index53 -= 0x1f;
+        }
+    }
+    gamma23 = 85;
+    int total58 = index42(value99[304 && index45], value93('c', count8(delta4, 'c')));
+    return i; // done
+}
+
+static const char *name141 = "alpha87\n";
+int f141(int a, const char *s, long b[]) {
+    int i;
+    int alpha96 = index95[index35(beta41, 0x1f)] >= ('c' >= delta98);
+    int gamma17 = 0x1f;
+    while (258) beta85 -= 'c';
+    while (690 % 0x1f || 333 == index28(delta59, 'c') == 129) index9 -= 0x1f >= 222 % 106;
+    beta87 = 0x1f;
+    total69 = (gamma78(922, beta80) && beta9);
+    return i; // done
+}
+
+static const char *name142 = "index81\n";
+int f142(int a, const char *s, long b[]) {
+    int i;
+    beta35 = (0x1f + 0x1f);
+    while (alpha60(alpha54(0x1f, 0x1f) * count34 == alpha86, 170 - 375 && 'c')) delta90 -= 707;
+    if (588 * index13['c'] == gamma98) {
+        beta47 = 0x1f;
+    } else {
+        int count36 = 164 || total71 || 'c' >= (total47 >= 0x1f);
+    }
+    return i; // done
+}
+
+static const char *name143 = "beta26\n";
+int f143(int a, const char *s, long b[]) {
+    int i;
+    int index66 = alpha12[0x1f >= 312 != 'c'];
+    return i; // done
+}
+
+static const char *name144 = "gamma17\n";
+int f144(int a, const char *s, long b[]) {
+    int i;
+    if ('c' * (70) - 290) {
+        for (i = 0; i < ('c' * 934 || delta21 < 'c'); i++) {
+            index67 = index57;
+        }
+    } else {
+        total22 = (gamma67(615, gamma98));
+    }
+    gamma75 = 792;
+    while (('c' && 834 && 383 || 0x1f)) total92 -= ('c' % 'c');
+    alpha99 = ((alpha83 < 679));
+    return i; // done
+}
+
+static const char *name145 = "alpha74\n";
+int f145(int a, const char *s, long b[]) {
+    int i;
+    gamma4 = alpha74;
+    index59 = count56(927, 0x1f) / 680 || 0x1f == 481;
+    return i; // done
+}
+
+static const char *name146 = "gamma50\n";
+int f146(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < 0x1f < gamma4 - gamma16[0x1f] % 0x1f < alpha32 >= delta60[delta53]; i++) {
+        count62 = beta31[651 % 0x1f >= 0x1f * total52];
+    }
+    total23 = index43((891), 0x1f < value13) % 'c';
+    if (index5[alpha27] == 0x1f >= 0x1f - 'c' % delta21 % 0x1f) {
+        int index96 = beta47['c' < gamma85[945]];
+    } else {
+        index10 = ((664 >= 0x1f));
+    }
+    total50 = delta53;
+    return i; // done
+}
+
+static const char *name147 = "count73\n";
+int f147(int a, const char *s, long b[]) {
+    int i;
+    gamma59 = 0x1f;
+    int index71 = alpha86[305] % 'c' + 0x1f || 0x1f % 0x1f && (0x1f);
+    int alpha47 = value19;
+    gamma64 = total25(value3, index7(0x1f % 'c', 0x1f));
+    gamma0 = (count46);
+    if (count65(total57['c'] / index93 % 'c', index32 != 539 * 0x1f)) {
+        value73 = value88(0x1f != 0x1f >= gamma60(523, 'c'), index95(634 && 0x1f, 'c' == 'c'));
+    } else {
+        index60 = index1(value56(total26['c'], gamma8[0x1f]), 0x1f * 726 < 'c' / 0x1f);
+    }
+    int count6 = (delta91('c', delta31 && value10));
+    return i; // done
+}
+
+static const char *name148 = "delta27\n";
+int f148(int a, const char *s, long b[]) {
+    int i;
+    while (0x1f != 0x1f) alpha15 -= 948 != 'c' + delta51[868];
+    gamma9 = total95(0x1f != 0x1f == total64 + 0x1f, 0x1f + gamma75 + alpha87);
+    alpha96 = 51;
+    alpha50 = beta68[value7('c', 0x1f) % 0x1f];
+    int delta74 = 0x1f;
+    return i; // done
+}
+
+static const char *name149 = "value37\n";
+int f149(int a, const char *s, long b[]) {
+    int i;
+    index56 = count13(0x1f, ('c')) >= (0x1f || 246);
+    total34 = count7(471, 'c') + total40 + 'c' + 'c' == 'c';
+    beta85 = 540;
+    gamma16 = 'c';
+    if (431 == 0x1f) {
+        int index21 = 947 + 659 / beta47 == delta77(0x1f, 52) >= 'c';
+    } else {
+        for (i = 0; i < 452; i++) {
+            while (0x1f) index91 -= 0x1f;
+        }
+    }
+    return i; // done
+}
+
+static const char *name150 = "delta38\n";
+int f150(int a, const char *s, long b[]) {
+    int i;
+    delta60 = 505;
+    int count54 = delta13(alpha70(0x1f, 0x1f) < 0x1f, 'c' >= gamma60 - gamma50 * delta93);
+    while (total0) count69 -= 35;
+    count38 = value11('c', 0x1f - alpha8('c', alpha83));
+    if (0x1f) {
+        if ((value1[903] + 'c' % 'c')) {
+            int beta61 = index13;
+        } else {
+            int count90 = 0x1f < delta58(('c'), 0x1f);
+        }
+    } else {
+        count7 = 777 / 'c';
+    }
+    while ((gamma61[636 / 'c'])) gamma97 -= count73;
+    while (157 < 0x1f / 'c' || value7[55 % 0x1f]) alpha97 -= 'c' % gamma68 == 0x1f - total19;
+    return i; // done
+}
+
+static const char *name151 = "gamma65\n";
+int f151(int a, const char *s, long b[]) {
+    int i;
+    gamma48 = 0x1f / alpha60['c'] != total34('c', 851);
+    if (30) {
+        total25 = value3(total87[total80], index99[delta32 % 0x1f]);
+    } else {
+        beta83 = 240 || 651 * 0x1f - 'c';
+    }
+    while (value40(('c'), total77[434 * 393])) value41 -= alpha13 * count88['c'];
+    int delta69 = 0x1f;
+    if (166 - 'c' % 'c' * beta34 != 'c' - 'c' - 'c') {
+        count65 = (71) * 286 || 86 || 704 * 0x1f;
+    } else {
+        int alpha62 = index29(0x1f - 856 || 858 / 0x1f, beta58 + count10 < (578));
+    }
+    for (i = 0; i < 928 >= delta73['c'] + value34(index41, 0x1f); i++) {
+        for (i = 0; i < 194 - 0x1f < beta34 % 84; i++) {
+            index64 = (index57);
+        }
+    }
+    int beta19 = 0x1f;
+    return i; // done
+}
+
+static const char *name152 = "total27\n";
+int f152(int a, const char *s, long b[]) {
+    int i;
+    beta53 = 959;
+    total50 = total23[((433))];
+    gamma44 = delta16(total89 % 0x1f, 637 + 0x1f) && value1;
+    count22 = 'c' || delta47 % 'c' || 'c';
+    int delta14 = delta94;
+    int index97 = 954 / 360 / gamma16 * 0x1f;
+    int beta8 = (alpha47((delta67), gamma48[count95]));
+    return i; // done
+}
+
+static const char *name153 = "value60\n";
+int f153(int a, const char *s, long b[]) {
+    int i;
+    if (value14 - 657 * (beta14) != 0x1f) {
+        total15 = 426 >= count21;
+    } else {
+        if (29) {
+            for (i = 0; i < (0x1f - index38(0x1f, 0x1f)); i++) {
+                int gamma61 = 'c';
+            }
+        } else {
+            gamma16 = gamma74(total84[index64(index83, 147)], alpha84 && 0x1f != 'c' * 0x1f);
+        }
+    }
+    int beta19 = 0x1f;
+    return i; // done
+}
+
+static const char *name154 = "index63\n";
+int f154(int a, const char *s, long b[]) {
+    int i;
+    total53 = beta50;
+    for (i = 0; i < alpha49['c'] % total73(343, 39) == 881 % 0x1f; i++) {
+        delta92 = value64[delta87];
+    }
+    int count96 = index86[0x1f / 406] % 0x1f != 'c' == count57 % 0x1f;
+    return i; // done
+}
+
+static const char *name155 = "gamma74\n";
+int f155(int a, const char *s, long b[]) {
+    int i;
+    count51 = beta3(0x1f != delta90 % ('c'), index69(count73(200, 'c'), value8(value33, value2)));
+    for (i = 0; i < count84; i++) {
+        index46 = 'c';
+    }
+    if (value35[0x1f] / delta39 == 'c' - 0x1f != 0x1f || 526) {
+        beta35 = 0x1f;
+    } else {
+        while (alpha75) index57 -= gamma61[754];
+    }
+    total67 = 'c' * 0x1f && 247 != 618;
+    int total22 = 953 && ('c') % 'c' + 'c';
+    return i; // done
+}
+
+static const char *name156 = "delta22\n";
+int f156(int a, const char *s, long b[]) {
+    int i;
+    value90 = delta44 == beta81 / 'c' / 594;
+    while (0x1f) delta98 -= 'c';
+    int delta71 = 'c';
+    int value41 = alpha75('c', 896);
+    return i; // done
+}
+
+static const char *name157 = "value28\n";
+int f157(int a, const char *s, long b[]) {
+    int i;
+    beta44 = (264);
+    return i; // done
+}
+
+static const char *name158 = "beta49\n";
+int f158(int a, const char *s, long b[]) {
+    int i;
+    total40 = 'c';
+    count98 = 0x1f;
+    index21 = 126;
+    while (839) count72 -= 0x1f || 194 - 453 % 977;
+    return i; // done
+}
+
+static const char *name159 = "beta59\n";
+int f159(int a, const char *s, long b[]) {
+    int i;
+    if (('c' == 'c' * 0x1f)) {
+        while (607 - 'c' || 0x1f < 'c' - value82('c', gamma13)) beta26 -= 'c' * 0x1f;
+    } else {
+        beta86 = 911;
+    }
+    gamma4 = ('c') < 812 - ((beta19));
+    beta95 = delta99(149 % 0x1f, total69 - 893);
+    index89 = value57;
+    count64 = 879;
+    return i; // done
+}
+
+static const char *name160 = "beta43\n";
+int f160(int a, const char *s, long b[]) {
+    int i;
+    delta44 = 879;
+    int count58 = ('c') % 247 / 'c' - beta38('c', index52);
+    for (i = 0; i < 0x1f == (gamma35) % 'c' + 0x1f && total62 < count97; i++) {
+        gamma38 = delta20[(0x1f - delta45)];
+    }
+    value20 = index44;
+    delta97 = 0x1f;
+    total74 = count13[beta24(0x1f, index74)] != beta55;
+    return i; // done
+}
+
+static const char *name161 = "gamma29\n";
+int f161(int a, const char *s, long b[]) {
+    int i;
+    if ((gamma40 || 'c') && count31('c', beta34) >= index75 || 616) {
+        for (i = 0; i < index45[('c')]; i++) {
+            if (251) {
+                int index78 = 'c';
+            } else {
+                int total45 = delta14[index63 && 0x1f < (22)];
+            }
+        }
+    } else {
+        index94 = (134) % 927 - 'c' % value56 && 924 + value22(718, 615);
+    }
+    return i; // done
+}
+
+static const char *name162 = "total94\n";
+int f162(int a, const char *s, long b[]) {
+    int i;
+    alpha79 = 0x1f && value35[beta2] >= 'c' >= 269;
+    return i; // done
+}
+
+static const char *name163 = "delta57\n";
+int f163(int a, const char *s, long b[]) {
+    int i;
+    if (0x1f && 'c' + value77 && 473) {
+        value10 = index30(delta82[740 >= 827], alpha29);
+    } else {
+        total70 = 'c' || gamma3[959];
+    }
+    count59 = 360;
+    int delta1 = index95('c', beta43);
+    count77 = 'c';
+    int total22 = 0x1f;
+    return i; // done
+}
+
+static const char *name164 = "value84\n";
+int f164(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < index22[(0x1f) - total0]; i++) {
+        int alpha6 = 34 * 656 + gamma20 + index52;
+    }
+    int gamma20 = 'c';
+    int gamma81 = gamma41;
+    for (i = 0; i < value23[0x1f + delta96 / total42]; i++) {
+        value66 = value55;
+    }
+    while (631 || alpha15 && beta66(0x1f, 882) / 0x1f) value43 -= 'c';
+    if ((297)) {
+        if (gamma19[298 == 670] - 999 + 811 != count6(0x1f, 409)) {
+            value74 = index87('c', 783 / total92);
+        } else {
+            for (i = 0; i < (total52[867]); i++) {
+                beta64 = delta52[715 >= 0x1f] != 750;
+            }
+        }
+    } else {
+        index44 = (('c' - 'c'));
+    }
+    return i; // done
+}
+
+static const char *name165 = "alpha17\n";
+int f165(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < 824; i++) {
+        beta68 = 126 + 0x1f;
+    }
+    gamma9 = 0x1f;
+    gamma17 = 'c';
+    alpha91 = 0x1f != value12('c', 178 || 361);
+    if (count50(total26['c'] * 442, value81(index65(739, value85), value72(value49, 0x1f)))) {
+        alpha87 = 'c';
+    } else {
+        for (i = 0; i < total39(0x1f, beta29[0x1f]) >= 'c'; i++) {
+            if (value39[0x1f]) {
+                total22 = value26(gamma41, 'c') % alpha85 != 0x1f || beta82;
+            } else {
+                int alpha37 = beta20[delta91(0x1f, 344 < 0x1f)];
+            }
+        }
+    }
+    int beta19 = delta69[beta73(581, 192)] / 662;
+    count94 = 364;
+    return i; // done
+}
+
+static const char *name166 = "beta74\n";
+int f166(int a, const char *s, long b[]) {
+    int i;
+    if (index76) {
+        if ((649 % 'c') && gamma40(453, alpha76[158])) {
+            while (762) alpha31 -= total7;
+        } else {
+            for (i = 0; i < value69(844, 80) / 0x1f || total15 % (0x1f) || 'c' / 0x1f; i++) {
+                int beta52 = 0x1f || 'c' % value47 && delta36 < 114;
+            }
+        }
+    } else {
+        if (total7[index45((0x1f), 0x1f)]) {
+            value65 = total9('c', 0x1f && 0x1f) - 0x1f && 'c' * 'c' - 0x1f;
+        } else {
+            gamma18 = index28[index21 + 0x1f * alpha78(count71, 365)];
+        }
+    }
+    gamma52 = index48[0x1f * alpha99];
+    int value15 = (alpha93('c' + value62, beta40[delta16]));
+    return i; // done
+}
+
+static const char *name167 = "count28\n";
+int f167(int a, const char *s, long b[]) {
+    int i;
+    delta70 = (alpha65[797]);
+    if (0x1f) {
+        if ('c') {
+            int gamma5 = count2(delta76, beta36(0x1f * 'c', value50 % 168));
+        } else {
+            alpha31 = count24(gamma14 - total24, 873) && 0x1f == 324 >= 'c' && total39;
+        }
+    } else {
+        for (i = 0; i < (569 || 0x1f - value68(926, 0x1f)); i++) {
+            alpha25 = count34[(17)] && 0x1f;
+        }
+    }
+    return i; // done
+}
+
+static const char *name168 = "count8\n";
+int f168(int a, const char *s, long b[]) {
+    int i;
+    index93 = count68['c' == value64] && 0x1f;
+    if ((beta66)) {
+        count59 = value16['c' < (0x1f)];
+    } else {
+        beta90 = beta56(gamma4 - 597, count49) >= gamma83[891] % alpha30[520];
+    }
+    if ('c') {
+        value45 = 0x1f;
+    } else {
+        int alpha17 = value54(106 >= 0x1f - 0x1f >= 266, value8[0x1f]);
+    }
+    return i; // done
+}
+
+static const char *name169 = "alpha6\n";
+int f169(int a, const char *s, long b[]) {
+    int i;
+    while ((total69 || index35) || delta3[634 < 990]) gamma52 -= 360 && 'c' && value83[34];
+    if (index3[total89[gamma35 || 0x1f]]) {
+        for (i = 0; i < gamma41[total6[457]]; i++) {
+            count99 = (284) - 'c' == 'c' != 'c';
+        }
+    } else {
+        beta88 = (beta22);
+    }
+    delta14 = (alpha38[0x1f - 'c']);
+    for (i = 0; i < count46[0x1f]; i++) {
+        while ((0x1f) && 'c' && beta15 && 'c') gamma6 -= 'c' == 'c';
+    }
+    count11 = 991 + index93 + value76 || 'c' / beta73 / 'c';
+    index11 = 'c' % index54 < delta86[448] >= 715;
+    return i; // done
+}
+
+static const char *name170 = "count60\n";
+int f170(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < gamma30 - 319 && 'c' == ('c'); i++) {
+        value77 = (total79);
+    }
+    if (0x1f) {
+        total5 = 0x1f;
+    } else {
+        alpha44 = 833 == 692 == value42[783] < (0x1f) * 0x1f + 0x1f;
+    }
+    return i; // done
+}
+
+static const char *name171 = "index97\n";
+int f171(int a, const char *s, long b[]) {
+    int i;
+    value71 = gamma77[value8('c', 'c')] || 'c' != beta33 + delta24(839, 0x1f);
+    count46 = (0x1f);
+    return i; // done
+}
+
+static const char *name172 = "total26\n";
+int f172(int a, const char *s, long b[]) {
+    int i;
+    int count10 = alpha84;
+    total0 = value54[value6('c' && 0x1f, 0x1f + count53)];
+    total69 = (0x1f) && gamma12[713] < gamma94(0x1f && index36, total19 < 660);
+    if (total98) {
+        total64 = 705;
+    } else {
+        delta52 = delta56(delta44[value55], alpha88);
+    }
+    beta38 = beta7(16, 0x1f);
+    value60 = 0x1f;
+    return i; // done
+}
+
+static const char *name173 = "value94\n";
+int f173(int a, const char *s, long b[]) {
+    int i;
+    int total90 = 'c';
+    int index17 = 0x1f;
+    alpha63 = 0x1f;
+    return i; // done
+}
+
+static const char *name174 = "delta67\n";
+int f174(int a, const char *s, long b[]) {
+    int i;
+    index65 = 320 == 'c';
+    int alpha15 = index14;
+    return i; // done
+}
+
+static const char *name175 = "delta43\n";
+int f175(int a, const char *s, long b[]) {
+    int i;
+    if (alpha51[total68]) {
+        delta31 = alpha65[0x1f];
+    } else {
+        int alpha26 = count23 < (('c'));
+    }
+    value2 = 85;
+    value42 = 468;
+    value34 = value33(195, delta22 % 929);
+    for (i = 0; i < 169; i++) {
+        count16 = gamma58[gamma94(alpha44 != count55, alpha14(alpha38, index82))];
+    }
+    return i; // done
+}
+
+static const char *name176 = "gamma31\n";
+int f176(int a, const char *s, long b[]) {
+    int i;
+    while (alpha15[0x1f]) delta39 -= 297 * alpha55 && 900;
+    while (gamma49('c', 226 || 'c' && value11 + 0x1f)) index50 -= gamma55(246, 977) * 202;
+    count67 = 0x1f == gamma82 % total94 - 0x1f * alpha64;
+    for (i = 0; i < delta42 || beta56(655, total21) + 'c'; i++) {
+        alpha10 = 'c' && (gamma4(0x1f, 'c'));
+    }
+    for (i = 0; i < 'c'; i++) {
+        delta43 = 'c' % count52(value76, 'c');
+    }
+    int index9 = 0x1f;
+    while (index81 - count77 + 657 * beta31['c']) gamma0 -= beta3;
+    return i; // done
+}
+
+static const char *name177 = "gamma73\n";
+int f177(int a, const char *s, long b[]) {
+    int i;
+    int total98 = delta57;
+    int delta57 = ('c' / beta40 != count9(gamma79, 0x1f));
+    for (i = 0; i < total33(beta71(0x1f, 20) != 'c', (884) == index64[909]); i++) {
+        index20 = index98(index32('c', 'c'), alpha30(0x1f, 'c')) * 0x1f < delta32 % (0x1f);
+    }
+    return i; // done
+}
+
+static const char *name178 = "count55\n";
+int f178(int a, const char *s, long b[]) {
+    int i;
+    beta32 = alpha65(0x1f && 0x1f, total2) && value79['c'];
+    count4 = gamma48[total71(595 - 0x1f, 494 / 569)];
+    if (beta57(beta17(468, 90) * 940, delta62['c'])) {
+        int total54 = 'c' < 105;
+    } else {
+        delta80 = 'c';
+    }
+    index9 = index4[0x1f % 'c'];
+    return i; // done
+}
+
+static const char *name179 = "beta76\n";
+int f179(int a, const char *s, long b[]) {
+    int i;
+    value38 = gamma17['c'] >= value56(825, total6);
+    int total50 = delta58((0x1f) * alpha35 && 0x1f, 'c');
+    for (i = 0; i < 994; i++) {
+        gamma3 = alpha73['c'] / beta44['c'] == beta9('c', 321) * gamma92[index25];
+    }
+    while (count84((delta22), 'c')) alpha18 -= index50['c' || 115];
+    if (alpha87 != 'c' * (beta6 / index94)) {
+        for (i = 0; i < 0x1f; i++) {
+            for (i = 0; i < ((alpha22[283])); i++) {
+                int value78 = 0x1f * beta93[alpha99] + 822;
+            }
+        }
+    } else {
+        value42 = 0x1f && 0x1f;
+    }
+    return i; // done
+}
+
+static const char *name180 = "alpha6\n";
+int f180(int a, const char *s, long b[]) {
+    int i;
+    index43 = total87(0x1f % 0x1f == value46(855, 0x1f), beta51(total39 != 'c', total5));
+    int count19 = 0x1f == 'c';
+    total67 = (total78[gamma48]);
+    int count41 = (469);
+    index22 = 611 || alpha54(total51, 0x1f) >= 785;
+    return i; // done
+}
+
+static const char *name181 = "delta77\n";
+int f181(int a, const char *s, long b[]) {
+    int i;
+    value1 = index14[(beta23)] && value38;
+    count77 = (0x1f) + (gamma62[total94]);
+    count69 = 'c';
+    return i; // done
+}
+
+static const char *name182 = "value52\n";
+int f182(int a, const char *s, long b[]) {
+    int i;
+    total9 = 0x1f;
+    while ('c') gamma18 -= 'c' == 942 / delta33(value95, 590);
+    gamma95 = 0x1f % 'c';
+    if (value49[total43[index14]]) {
+        while (306) value95 -= 573 == 'c';
+    } else {
+        int value55 = count69[266] != 'c';
+    }
+    total1 = (alpha13);
+    alpha78 = ('c');
+    int beta99 = ((delta63));
+    return i; // done
+}
+
+static const char *name183 = "value36\n";
+int f183(int a, const char *s, long b[]) {
+    int i;
+    while (0x1f) value54 -= index21(('c'), 'c' * 'c');
+    int alpha11 = alpha91[beta15['c' + 0x1f]];
+    return i; // done
+}
+
+static const char *name184 = "total53\n";
+int f184(int a, const char *s, long b[]) {
+    int i;
+    if ('c' + delta92 < 482 % 690) {
+        int beta51 = 0x1f;
+    } else {
+        while (gamma86) alpha53 -= 0x1f;
+    }
+    for (i = 0; i < 149; i++) {
+        index16 = 942;
+    }
+    for (i = 0; i < 537 + 695 != 693 < beta90('c', 'c') < 0x1f * 501; i++) {
+        delta50 = 0x1f;
+    }
+    if (value59) {
+        int value50 = 0x1f / delta88('c', value95 / 0x1f);
+    } else {
+        int beta72 = total24(627, 993);
+    }
+    index90 = (0x1f == 0x1f) / gamma13[0x1f] + 638 && 0x1f;
+    while (delta44[(876) != total31]) gamma91 -= 0x1f;
+    return i; // done
+}
+
+static const char *name185 = "alpha11\n";
+int f185(int a, const char *s, long b[]) {
+    int i;
+    delta75 = 'c';
+    int total40 = 'c';
+    if (count33(823, 725) == delta25 && 693 >= index84(total92 + 'c', 839)) {
+        int index51 = count41 && beta34;
+    } else {
+        if (416 == 0x1f - 'c' + index48 % 0x1f) {
+            int delta41 = 0x1f && 815;
+        } else {
+            for (i = 0; i < beta29; i++) {
+                int value56 = 47 - 0x1f * (beta35) * index47[0x1f] + 'c';
+            }
+        }
+    }
+    int count38 = gamma11;
+    index24 = total32 + delta82['c'] && alpha17[total17];
+    return i; // done
+}
+
+static const char *name186 = "value20\n";
+int f186(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < index83(883 + 0x1f != 'c', 423); i++) {
+        int gamma24 = (592 && 'c') && 3;
+    }
+    count2 = 785 == alpha14;
+    if (alpha83(0x1f, 488) || 453 || 491 / 898 + 0x1f + count61('c', 0x1f)) {
+        delta97 = beta46(gamma79(316, 0x1f) < 'c' / total75, beta66);
+    } else {
+        count30 = (total73 >= 299) / value54(545, index21) != (0x1f);
+    }
+    if (total39('c' * 0x1f, 0x1f - 0x1f) * (0x1f * 656)) {
+        for (i = 0; i < value51(346 == beta95, 69); i++) {
+            for (i = 0; i < 'c'; i++) {
+                int delta32 = 571;
+            }
+        }
+    } else {
+        int count61 = index3 >= 0x1f == 0x1f >= 0x1f + (beta60[delta90]);
+    }
+    alpha60 = beta5(134, 0x1f) >= 527 < alpha49(567 - 122, alpha72);
+    total47 = beta75;
+    return i; // done
+}
+
+static const char *name187 = "alpha8\n";
+int f187(int a, const char *s, long b[]) {
+    int i;
+    alpha4 = gamma26((count53) != (0x1f), index22(value38[0x1f], alpha22));
+    int gamma52 = total2;
+    total22 = 'c';
+    while (beta24[delta25('c', 392)] != (gamma15 * value83)) gamma53 -= 'c';
+    int value67 = 0x1f;
+    while (gamma4[(0x1f) == 902 + value72]) gamma69 -= (0x1f);
+    int count6 = (beta44) - 'c' || 0x1f < beta5;
+    return i; // done
+}
+
+static const char *name188 = "value23\n";
+int f188(int a, const char *s, long b[]) {
+    int i;
+    int index5 = alpha26;
+    return i; // done
+}
+
+static const char *name189 = "gamma76\n";
+int f189(int a, const char *s, long b[]) {
+    int i;
+    while (998) alpha92 -= (count72(0x1f, 58));
+    if (733) {
+        int index46 = 526 == 723 * 'c' % value47[count40] < beta47[beta52];
+    } else {
+        if (0x1f) {
+            if (value61[delta29] % 367 + 'c' || 0x1f >= total14) {
+                value94 = 662;
+            } else {
+                beta58 = beta74('c' || 'c', 'c') < 'c';
+            }
+        } else {
+            delta76 = 'c';
+        }
+    }
+    if (value78[count56(872, alpha35) / value53[total14]]) {
+        if (82 % beta40[0x1f] != 0x1f && 492) {
+            index34 = 0x1f;
+        } else {
+            alpha40 = total23;
+        }
+    } else {
+        count86 = beta13;
+    }
+    int delta68 = 'c';
+    alpha7 = 'c';
+    while (total39) index6 -= 'c';
+    if (873 && 'c') {
+        index35 = count86(value49['c'] * 213 && 'c', index40(beta78, 'c') >= value94['c']);
+    } else {
+        if (beta2[0x1f] * gamma55(index40, 'c') < beta93['c']) {
+            value33 = index58[beta64(250, 582)] && 0x1f;
+        } else {
+            while (839) index23 -= 863;
+        }
+    }
+    return i; // done
+}
+
+static const char *name190 = "value85\n";
+int f190(int a, const char *s, long b[]) {
+    int i;
+    delta35 = (value54[0x1f] * gamma16 != 'c');
+    return i; // done
+}
+
+static const char *name191 = "index55\n";
+int f191(int a, const char *s, long b[]) {
+    int i;
+    if (607) {
+        for (i = 0; i < alpha97 && 806 && index50 == 300 < 'c' == ('c'); i++) {
+            while (beta33('c' / count0, value98) != beta67['c']) count59 -= beta79;
+        }
+    } else {
+        int total89 = ('c');
+    }
+    for (i = 0; i < (0x1f); i++) {
+        gamma82 = count83;
+    }
+    return i; // done
+}
+
+static const char *name192 = "count26\n";
+int f192(int a, const char *s, long b[]) {
+    int i;
+    int beta68 = 'c';
+    for (i = 0; i < total83[count64[911]]; i++) {
+        if ('c') {
+            alpha61 = gamma32 || 'c' == alpha17;
+        } else {
+            if (index45['c'] && 'c' >= 868 == alpha72) {
+                int index74 = total36;
+            } else {
+                total41 = 'c' || 'c' || 'c' / 'c';
+            }
+        }
+    }
+    beta58 = alpha95 % 'c';
+    return i; // done
+}
+
+static const char *name193 = "gamma10\n";
+int f193(int a, const char *s, long b[]) {
+    int i;
+    alpha42 = delta17;
+    beta87 = ('c' - 0x1f) + gamma13(('c'), 0x1f < 'c');
+    return i; // done
+}
+
+static const char *name194 = "index52\n";
+int f194(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < 396 - 0x1f + count24 - gamma38 >= beta82[0x1f]; i++) {
+        gamma6 = (0x1f % alpha42 - beta41);
+    }
+    if (0x1f) {
+        index75 = 0x1f;
+    } else {
+        if (944 >= (737) % 0x1f) {
+            while (gamma93) value3 -= 'c';
+        } else {
+            for (i = 0; i < 0x1f; i++) {
+                int delta0 = value61;
+            }
+        }
+    }
+    total10 = 638 != 0x1f == (990) || 0x1f;
+    return i; // done
+}
+
+static const char *name195 = "delta42\n";
+int f195(int a, const char *s, long b[]) {
+    int i;
+    int count25 = total93((0x1f), index70 == 'c') && total45(0x1f != 158, 'c');
+    beta18 = alpha73(value36, 989) + 465 * index69[alpha33[0x1f]];
+    int count96 = (value37) == beta80;
+    int total63 = beta22[beta83 + total53 * 0x1f];
+    delta33 = value6[gamma1] * beta28[delta67[648]];
+    while (delta43[index24[141 || gamma28]]) index50 -= index95('c', 270);
+    return i; // done
+}
+
+static const char *name196 = "gamma64\n";
+int f196(int a, const char *s, long b[]) {
+    int i;
+    gamma94 = (621 - delta32) * alpha64;
+    alpha57 = value22;
+    delta35 = total69[0x1f < total74] >= 'c' == 'c' / 0x1f;
+    gamma99 = 638;
+    if ((alpha81(980, 0x1f)) < 0x1f + total70(638, 'c')) {
+        alpha89 = 'c' != 0x1f == 0x1f < delta76 && 'c' >= 567;
+    } else {
+        total48 = total65[83 != value60] / 0x1f;
+    }
+    beta20 = 596;
+    index58 = beta11[beta87(0x1f / 'c', ('c'))];
+    return i; // done
+}
+
+static const char *name197 = "beta64\n";
+int f197(int a, const char *s, long b[]) {
+    int i;
+    alpha84 = alpha40;
+    return i; // done
+}
+
+static const char *name198 = "beta56\n";
+int f198(int a, const char *s, long b[]) {
+    int i;
+    value73 = 987;
+    gamma86 = 664;
+    if (0x1f % (gamma74) && gamma97 >= 772) {
+        value62 = 0x1f;
+    } else {
+        if (beta63 && 'c' != beta67 == index77(index33[index90], 983)) {
+            int delta61 = count69 >= alpha34[0x1f < alpha63];
+        } else {
+            for (i = 0; i < gamma78; i++) {
+                int beta65 = 0x1f;
+            }
+        }
+    }
+    index96 = 'c';
+    gamma67 = delta86;
+    return i; // done
+}
+
+static const char *name199 = "beta53\n";
+int f199(int a, const char *s, long b[]) {
+    int i;
+    count25 = (0x1f < beta35) + 0x1f;
+    for (i = 0; i < beta66['c'] >= delta70[0x1f] >= 955; i++) {
+        if (beta18) {
+            while ((0x1f) >= 674 >= (beta53(706, 'c'))) delta67 -= 'c';
+        } else {
+            if ((750 != 219) - 237 < beta15(0x1f, 'c')) {
+                int beta54 = alpha83[0x1f + 990 - 643 < 0x1f];
+            } else {
+                int beta95 = count61(0x1f, value19 >= 471 >= 'c');
+            }
+        }
+    }
+    if (187) {
+        beta54 = 'c';
+    } else {
+        value66 = 946 && gamma20 - 469 == 0x1f == 'c' % 'c';
+    }
+    return i; // done
+}
+
+static const char *name200 = "value21\n";
+int f200(int a, const char *s, long b[]) {
+    int i;
+    int gamma28 = beta93[468 || 'c' == index23 >= 581];
+    int value53 = (alpha81);
+    gamma50 = index69(60, 0x1f) || 0x1f < index79 - alpha27('c', 902);
+    return i; // done
+}
+
+static const char *name201 = "total75\n";
+int f201(int a, const char *s, long b[]) {
+    int i;
+    int value69 = index78;
+    return i; // done
+}
+
+static const char *name202 = "total97\n";
+int f202(int a, const char *s, long b[]) {
+    int i;
+    index68 = 366;
+    if (941) {
+        if ('c') {
+            value54 = ((total47));
+        } else {
+            for (i = 0; i < alpha44[total64]; i++) {
+                int value53 = 582 * value40(0x1f < 295, beta67 < 988);
+            }
+        }
+    } else {
+        delta35 = total30((0x1f + 252), 0x1f);
+    }
+    if ('c' < 'c' < 799 || 189 % alpha78 - 'c') {
+        if (count45) {
+            while ((('c')) || 0x1f) value62 -= 660;
+        } else {
+            int gamma8 = value45 * value56(0x1f, value22) >= 'c' == 'c';
+        }
+    } else {
+        value31 = 472 != 'c' < gamma65(total13, 'c') * 634;
+    }
+    delta43 = (delta66(total78, 'c') || 0x1f);
+    count86 = beta51('c', 396) || delta46 != 0x1f || 0x1f;
+    index32 = 638;
+    return i; // done
+}
+
+static const char *name203 = "total39\n";
+int f203(int a, const char *s, long b[]) {
+    int i;
+    delta39 = alpha30[0x1f];
+    int total38 = 0x1f % 0x1f;
+    delta4 = gamma35;
+    return i; // done
+}
+
+static const char *name204 = "value61\n";
+int f204(int a, const char *s, long b[]) {
+    int i;
+    index80 = 'c';
+    if ((alpha31 / beta85 == 0x1f)) {
+        alpha59 = 376 >= count55['c'] >= total84[(value16)];
+    } else {
+        gamma47 = index12((index74), total17 * 0x1f) >= 820;
+    }
+    index50 = 456;
+    return i; // done
+}
+
+static const char *name205 = "beta22\n";
+int f205(int a, const char *s, long b[]) {
+    int i;
+    value19 = total28['c' < 'c'] + gamma12[0x1f] + (72);
+    index72 = 0x1f % 'c' * 'c' + 'c';
+    alpha56 = 560 != gamma10('c' < 'c', delta68 - beta32);
+    return i; // done
+}
+
+static const char *name206 = "count70\n";
+int f206(int a, const char *s, long b[]) {
+    int i;
+    alpha46 = index80;
+    if ('c') {
+        total70 = value17['c'] != 0x1f < 'c' < 0x1f - count37 >= (0x1f);
+    } else {
+        for (i = 0; i < beta35; i++) {
+            while (total37[0x1f]) total58 -= 0x1f;
+        }
+    }
+    index16 = 'c';
+    return i; // done
+}
+
+static const char *name207 = "count99\n";
+int f207(int a, const char *s, long b[]) {
+    int i;
+    gamma45 = delta18;
+    beta71 = beta92[0x1f];
+    return i; // done
+}
+
+static const char *name208 = "gamma76\n";
+int f208(int a, const char *s, long b[]) {
+    int i;
+    beta63 = index49;
+    total39 = beta67(index67(755, 284), gamma15);
+    for (i = 0; i < (total61); i++) {
+        beta15 = (('c')) - (695);
+    }
+    delta77 = value77(936, beta43(value59, 687) || 869);
+    int count4 = index24[(311)];
+    int delta75 = (538);
+    int index74 = 'c';
+    return i; // done
+}
+
+static const char *name209 = "count18\n";
+int f209(int a, const char *s, long b[]) {
+    int i;
+    alpha47 = (gamma78(966, 0x1f) + (total46));
+    index1 = delta10(count89('c', 'c' * total81), 0x1f);
+    int count33 = index87['c' || 'c' >= gamma47];
+    total2 = beta9[gamma46 && count89[193]];
+    index52 = 821;
+    total27 = (0x1f) - 'c' && 'c' + (0x1f) / 0x1f * gamma81;
+    value12 = 0x1f < gamma12[delta5] && beta92;
+    return i; // done
+}
+
+static const char *name210 = "value83\n";
+int f210(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < index91[gamma30(244 - 'c', beta98 && 0x1f)]; i++) {
+        if (0x1f) {
+            value20 = 'c' / ('c');
+        } else {
+            count15 = 'c';
+        }
+    }
+    gamma72 = 532;
+    if (beta28[0x1f / 789 / 'c']) {
+        for (i = 0; i < delta91(total17[delta75 / 0x1f], beta18 == index93 % 0x1f); i++) {
+            alpha7 = value78 % 347 < 'c' / count85;
+        }
+    } else {
+        for (i = 0; i < (0x1f == (value58)); i++) {
+            alpha8 = value96(639, (0x1f));
+        }
+    }
+    count75 = gamma0;
+    int alpha83 = 0x1f;
+    for (i = 0; i < 0x1f; i++) {
+        beta16 = 0x1f < gamma89(0x1f * 227, 0x1f);
+    }
+    return i; // done
+}
+
+static const char *name211 = "alpha40\n";
+int f211(int a, const char *s, long b[]) {
+    int i;
+    if (beta41) {
+        count87 = alpha84;
+    } else {
+        total11 = delta20('c', 609) == count67('c', 'c') || 'c';
+    }
+    while ('c' >= 'c' || beta5 - index75 / 949) value32 -= 'c' + 'c' == total63(total78, 'c');
+    total13 = 413;
+    value58 = total21;
+    count96 = 654;
+    if ((210 || value91 || 0x1f >= 'c')) {
+        for (i = 0; i < 'c'; i++) {
+            while ('c' && count45 && 395 % (706 < alpha99)) total3 -= 'c';
+        }
+    } else {
+        while (index63(644 < index65(alpha96, 0x1f), 'c' != 0x1f && delta30[515])) delta94 -= index62;
+    }
+    return i; // done
+}
+
+static const char *name212 = "gamma79\n";
+int f212(int a, const char *s, long b[]) {
+    int i;
+    beta42 = 0x1f;
+    index60 = 0x1f - 'c' || 661 != 777 * 390 >= count70 < 'c' && alpha22;
+    int total90 = 627;
+    return i; // done
+}
+
+static const char *name213 = "delta24\n";
+int f213(int a, const char *s, long b[]) {
+    int i;
+    int count54 = 'c' < 'c';
+    index15 = total19;
+    delta97 = 54;
+    return i; // done
+}
+
+static const char *name214 = "gamma72\n";
+int f214(int a, const char *s, long b[]) {
+    int i;
+    if (value59(0x1f < 0x1f, 0x1f) * 0x1f && gamma24(261, 0x1f)) {
+        if (810) {
+            int beta95 = 808 != 'c' < 0x1f % 'c';
+        } else {
+            gamma18 = 0x1f;
+        }
+    } else {
+        beta38 = (160);
+    }
+    return i; // done
+}
+
+static const char *name215 = "beta43\n";
+int f215(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < 'c'; i++) {
+        value89 = index96(value84(alpha21 - 0x1f, 641), (index94));
+    }
+    return i; // done
+}
+
+static const char *name216 = "count97\n";
+int f216(int a, const char *s, long b[]) {
+    int i;
+    total70 = 0x1f;
+    return i; // done
+}
+
+static const char *name217 = "beta22\n";
+int f217(int a, const char *s, long b[]) {
+    int i;
+    value82 = 'c' / 703 * 253 / 278 && 187 - 'c';
+    int value4 = 0x1f;
+    int beta99 = gamma64(0x1f < 205, (0x1f) != ('c'));
+    alpha30 = 'c';
+    gamma88 = count99 < 948 * 'c' / 935 % 'c' >= value91 < 492;
+    return i; // done
+}
+
+static const char *name218 = "value56\n";
+int f218(int a, const char *s, long b[]) {
+    int i;
+    if (0x1f * value72[106] / 971 != beta61) {
+        int delta10 = gamma31(count19('c', count76), alpha62(0x1f, index76)) >= gamma51[beta29 && 'c'];
+    } else {
+        index55 = 957 == 0x1f;
+    }
+    count46 = value63[delta99[815] && count4(0x1f, beta63)];
+    if (0x1f) {
+        int index58 = 762;
+    } else {
+        gamma53 = 0x1f * 0x1f;
+    }
+    int delta88 = index89(0x1f || 390 == 894 + 'c', index27(delta0, total7) < 'c' && 0x1f);
+    return i; // done
+}
+
+static const char *name219 = "index50\n";
+int f219(int a, const char *s, long b[]) {
+    int i;
+    alpha35 = gamma40(gamma53(delta94, 0x1f), delta85) == count41['c'] * beta16('c', 0x1f);
+    return i; // done
+}
+
+static const char *name220 = "index75\n";
+int f220(int a, const char *s, long b[]) {
+    int i;
+    int delta88 = gamma97[count83] % total34 * ('c') - gamma21[0x1f];
+    int delta42 = 'c';
+    if (delta26(alpha75[value31] || delta97['c'], 'c')) {
+        int alpha36 = alpha5[(count50(value19, 'c'))];
+    } else {
+        if (0x1f) {
+            while (alpha48[0x1f] - beta41['c'] >= 507 >= 746) alpha69 -= 645;
+        } else {
+            total73 = 0x1f;
+        }
+    }
+    delta18 = delta48;
+    alpha48 = index20;
+    if (gamma89((539), count69(index61, 'c')) * (687)) {
+        alpha25 = count71(value43[797 || alpha94], alpha89);
+    } else {
+        delta67 = alpha70;
+    }
+    count67 = count99(gamma70[delta66[0x1f]], 0x1f);
+    return i; // done
+}
+
+static const char *name221 = "count14\n";
+int f221(int a, const char *s, long b[]) {
+    int i;
+    if (total85 + 50 || 0x1f || 0x1f != 0x1f) {
+        total60 = total75;
+    } else {
+        alpha88 = index26[0x1f && 123];
+    }
+    if ('c') {
+        for (i = 0; i < index98(index33[delta42] != (578), (delta38(673, 'c'))); i++) {
+            for (i = 0; i < (0x1f >= 0x1f / 383); i++) {
+                total40 = alpha84('c' >= 759 * 0x1f * alpha37, 0x1f / gamma68 == alpha19);
+            }
+        }
+    } else {
+        value36 = 'c';
+    }
+    alpha36 = total71(total15(322, 508), index39 + 0x1f) * alpha88(362, beta71) && 703;
+    int total2 = ('c');
+    return i; // done
+}
+
+static const char *name222 = "beta51\n";
+int f222(int a, const char *s, long b[]) {
+    int i;
+    count12 = 'c';
+    total98 = total98[6] * 'c' * 961 < total6(977, 'c');
+    beta94 = 'c';
+    gamma17 = 'c' < 'c' >= 'c' % total71;
+    if (gamma86(beta79[108 * 'c'], (gamma66) / beta94['c'])) {
+        value10 = 57;
+    } else {
+        int count73 = 0x1f;
+    }
+    while ((total59[delta23] || 217 == 169)) delta88 -= 0x1f < 'c';
+    return i; // done
+}
+
+static const char *name223 = "value9\n";
+int f223(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < 'c' == 'c' * delta31(792, 'c') * delta67(delta26[0x1f], total57); i++) {
+        gamma20 = index68(value97[beta72], gamma64(count18(108, 'c'), ('c')));
+    }
+    value72 = index75[435 && 'c' != 'c'];
+    if ('c') {
+        if ((363 % 103) % 0x1f * 0x1f || total19('c', 0x1f)) {
+            while (value36((459), 'c' || total27) || 0x1f) index66 -= delta48;
+        } else {
+            index80 = 26 < count85('c', 948) < 0x1f != 'c' * count18(0x1f, 902);
+        }
+    } else {
+        gamma12 = 'c';
+    }
+    beta68 = 0x1f;
+    int alpha95 = delta96;
+    return i; // done
+}
+
+static const char *name224 = "index97\n";
+int f224(int a, const char *s, long b[]) {
+    int i;
+    count61 = 205;
+    value6 = 0x1f;
+    while (gamma11(0x1f, delta51['c']) + (count62 + 0x1f)) total80 -= gamma14;
+    value10 = total15[278];
+    return i; // done
+}
+
+static const char *name225 = "total53\n";
+int f225(int a, const char *s, long b[]) {
+    int i;
+    delta21 = 'c' != delta70(689 + value19, 'c');
+    count94 = index76[delta90['c']] % index86(total39, 288 - 0x1f);
+    if (index12) {
+        if ('c' * count51 >= 'c') {
+            delta87 = (count1(297, 0x1f)) + gamma20(value10(total68, 680), 387);
+        } else {
+            for (i = 0; i < delta8[0x1f] != 0x1f; i++) {
+                int value36 = 'c' != gamma1['c'] / 'c' < delta6;
+            }
+        }
+    } else {
+        int total20 = ('c') != index4 * index72(0x1f / 229, 894 / 434);
+    }
+    delta94 = (alpha30[83]) >= count84(726, (138));
+    for (i = 0; i < total28('c' && 'c' / 341 + 'c', beta64(803, 359 % value59)); i++) {
+        alpha38 = 251;
+    }
+    if (('c' != beta3)) {
+        int value85 = 62 && gamma90((gamma34), 'c' == 'c');
+    } else {
+        while (103 * delta55 + 0x1f != 'c' && 0x1f != (576)) alpha68 -= 'c' || 'c';
+    }
+    return i; // done
+}
+
+static const char *name226 = "beta42\n";
+int f226(int a, const char *s, long b[]) {
+    int i;
+    if (271) {
+        for (i = 0; i < value26[(241)]; i++) {
+            if (184 * total99[0x1f] >= 0x1f) {
+                value54 = 0x1f;
+            } else {
+                int total36 = 'c' / 0x1f;
+            }
+        }
+    } else {
+        alpha93 = 'c' != 370;
+    }
+    if ((('c') == 0x1f)) {
+        index70 = total71;
+    } else {
+        beta94 = 'c' - gamma23 % 0x1f - 402 != index1(count37(708, 0x1f), count7 % 28);
+    }
+    if (alpha48[685 % 0x1f]) {
+        value75 = gamma2[0x1f / 'c'] || value58[count31 >= beta64];
+    } else {
+        if (821 + 'c' >= 629 && 'c' == 0x1f) {
+            gamma3 = 'c';
+        } else {
+            int beta96 = ('c') >= value57(962, 0x1f) < 'c';
+        }
+    }
+    int total73 = total34;
+    int count72 = 'c' && 949;
+    return i; // done
+}
+
+static const char *name227 = "alpha27\n";
+int f227(int a, const char *s, long b[]) {
+    int i;
+    total50 = value28['c' + 0x1f < index53 - 'c'];
+    beta1 = ('c') == index61 / 0x1f / 'c' >= count12 >= index48;
+    return i; // done
+}
+
+static const char *name228 = "gamma60\n";
+int f228(int a, const char *s, long b[]) {
+    int i;
+    value78 = total33(72, 0x1f) + 'c' || 644 || 'c';
+    return i; // done
+}
+
+static const char *name229 = "alpha25\n";
+int f229(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < value9[0x1f] != 'c' % alpha98 + (count72) && 0x1f * gamma2; i++) {
+        if (gamma69(48, 'c' * value20 + alpha54)) {
+            if (395) {
+                int value56 = beta78 - 'c' - alpha32['c'] / 637;
+            } else {
+                total64 = 580 && 0x1f;
+            }
+        } else {
+            index58 = total89('c' == 0x1f - 472, 'c');
+        }
+    }
+    count93 = beta58['c' + (0x1f)];
+    return i; // done
+}
+
+static const char *name230 = "count46\n";
+int f230(int a, const char *s, long b[]) {
+    int i;
+    while ('c') alpha7 -= 'c' - 0x1f && 711;
+    return i; // done
+}
+
+static const char *name231 = "total26\n";
+int f231(int a, const char *s, long b[]) {
+    int i;
+    while ('c') beta78 -= (25);
+    gamma60 = index46[854 && 'c' && 'c' != 0x1f];
+    for (i = 0; i < 'c'; i++) {
+        value81 = index7[delta34[590] + total39];
+    }
+    total79 = ('c' || delta67['c']);
+    int count10 = 0x1f;
+    return i; // done
+}
+
+static const char *name232 = "alpha95\n";
+int f232(int a, const char *s, long b[]) {
+    int i;
+    int alpha60 = 0x1f;
+    return i; // done
+}
+
+static const char *name233 = "total37\n";
+int f233(int a, const char *s, long b[]) {
+    int i;
+    beta23 = 285;
+    delta55 = 'c' && 433 || 0x1f && 405;
+    delta44 = value91((delta24) % (315), value26(759, 'c') && 836);
+    count68 = count20[count39(count11, gamma60)] - index82 * 0x1f != 'c' + 7;
+    int beta35 = (gamma73[count71]) + 0x1f != 'c' && 'c';
+    count71 = index42(326, count46[0x1f] % 'c' < 0x1f);
+    return i; // done
+}
+
+static const char *name234 = "gamma0\n";
+int f234(int a, const char *s, long b[]) {
+    int i;
+    count94 = count46(value60(0x1f, 389), 'c') != 0x1f == index63 / 0x1f;
+    value65 = value68[gamma30[value47] < value47 - 'c'];
+    return i; // done
+}
+
+static const char *name235 = "index49\n";
+int f235(int a, const char *s, long b[]) {
+    int i;
+    if ((0x1f)) {
+        gamma77 = ('c' * beta33) < alpha90('c' < count25, index6(43, 0x1f));
+    } else {
+        int count58 = count91[240 % 0x1f != 0x1f >= gamma8];
+    }
+    int index65 = 906 / beta41 - 'c' + 0x1f;
+    for (i = 0; i < (750) != count23[0x1f] * delta58(0x1f, 0x1f) / 'c' / 'c'; i++) {
+        total38 = 0x1f;
+    }
+    int gamma42 = (delta34(0x1f, 'c')) % beta32[value42 + value3];
+    if (beta83(('c'), (839) || gamma81 == count39)) {
+        value97 = 473;
+    } else {
+        value79 = gamma17[103];
+    }
+    total84 = beta58;
+    return i; // done
+}
+
+static const char *name236 = "value21\n";
+int f236(int a, const char *s, long b[]) {
+    int i;
+    alpha49 = gamma83 % 'c';
+    return i; // done
+}
+
+static const char *name237 = "value88\n";
+int f237(int a, const char *s, long b[]) {
+    int i;
+    if (index53[gamma23[914]] / 'c' || 'c' == 'c') {
+        for (i = 0; i < gamma63 >= 744; i++) {
+            while (total2(beta4(count13 + 0x1f, 92 && 291), count6((0x1f), 0x1f))) count7 -= 701;
+        }
+    } else {
+        delta61 = gamma69[value50] % 28 || gamma0;
+    }
+    gamma81 = 'c';
+    while ((alpha79(969, 605))) gamma91 -= (298) + total13(0x1f, alpha79);
+    return i; // done
+}
+
+static const char *name238 = "alpha55\n";
+int f238(int a, const char *s, long b[]) {
+    int i;
+    count67 = index68[alpha48];
+    return i; // done
+}
+
+static const char *name239 = "delta57\n";
+int f239(int a, const char *s, long b[]) {
+    int i;
+    index35 = (value62[delta25(0x1f, 8)]);
+    for (i = 0; i < 'c'; i++) {
+        int index37 = count82(94 % 'c', (total22('c', 748)));
+    }
+    while (gamma39[('c') + delta16[831]]) value90 -= alpha16(gamma67 - 0x1f, alpha26[0x1f]);
+    return i; // done
+}
+
+static const char *name240 = "count85\n";
+int f240(int a, const char *s, long b[]) {
+    int i;
+    value33 = (gamma72('c' != 0x1f, 636 || 'c'));
+    int delta79 = gamma87(0x1f + 0x1f == count65, 0x1f);
+    return i; // done
+}
+
+static const char *name241 = "count70\n";
+int f241(int a, const char *s, long b[]) {
+    int i;
+    gamma87 = 0x1f;
+    total37 = gamma82['c'];
+    return i; // done
+}
+
+static const char *name242 = "index10\n";
+int f242(int a, const char *s, long b[]) {
+    int i;
+    if ('c') {
+        value73 = 153 / count62 < 343 + index26(count72 >= 452, 'c' && 661);
+    } else {
+        delta19 = alpha37[index58('c' >= 0x1f, index29 == 0x1f)];
+    }
+    for (i = 0; i < delta73(('c'), (288)) % count41 != delta59 + alpha93 - 'c'; i++) {
+        beta84 = (558) == total78 || 945 * alpha53[0x1f + 845];
+    }
+    return i; // done
+}
+
+static const char *name243 = "value8\n";
+int f243(int a, const char *s, long b[]) {
+    int i;
+    gamma43 = (0x1f);
+    value8 = beta61[delta54[0x1f]];
+    alpha35 = 0x1f || 'c';
+    gamma14 = 0x1f != (value11(0x1f, 'c'));
+    if ('c' - alpha73(value84, alpha74) % 507) {
+        for (i = 0; i < 0x1f != ('c') < total85(0x1f, 162); i++) {
+            total55 = 'c';
+        }
+    } else {
+        delta51 = total78;
+    }
+    for (i = 0; i < (gamma25) / gamma94('c', 'c') && 'c'; i++) {
+        for (i = 0; i < 0x1f; i++) {
+            for (i = 0; i < (value66 - 'c' < beta16(delta62, 'c')); i++) {
+                int value6 = value91[357 - 'c' * 941 * 180];
+            }
+        }
+    }
+    return i; // done
+}
+
+static const char *name244 = "index7\n";
+int f244(int a, const char *s, long b[]) {
+    int i;
+    total3 = 0x1f != value1('c', 0x1f) * 0x1f;
+    alpha30 = (0x1f);
+    return i; // done
+}
+
+static const char *name245 = "index89\n";
+int f245(int a, const char *s, long b[]) {
+    int i;
+    int delta51 = delta19;
+    while (value57(index58(alpha7, 714), index62[0x1f] < delta15(count50, alpha9))) gamma39 -= 0x1f + count11(35, 473);
+    return i; // done
+}
+
+static const char *name246 = "count94\n";
+int f246(int a, const char *s, long b[]) {
+    int i;
+    if (('c') == beta64 * 'c' == 'c' || 0x1f) {
+        beta85 = 552;
+    } else {
+        count41 = 'c';
+    }
+    gamma32 = count82 >= 832 - 832 + ('c' / 643);
+    return i; // done
+}
+
+static const char *name247 = "count98\n";
+int f247(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < alpha50; i++) {
+        gamma78 = 766;
+    }
+    for (i = 0; i < alpha14[155 * 'c'] * index92 >= 'c' + index57; i++) {
+        index89 = 'c' && value38 == count21[512] && 0x1f;
+    }
+    int gamma33 = 'c' && count1 < value56 - 0x1f - alpha40;
+    value32 = alpha9 < 55 * 'c' || 327 % ('c' + 'c');
+    delta46 = count3(alpha75(744, 0x1f), beta88) != index67;
+    alpha50 = value27[556] % (0x1f) - 'c';
+    if (index13[alpha46(264 && index98, delta32 != 0x1f)]) {
+        if (value38) {
+            for (i = 0; i < 456; i++) {
+                index73 = value17(0x1f % 'c', 'c' >= 'c') - 731;
+            }
+        } else {
+            index24 = 247 - 104 < 132 == count30(0x1f, 641);
+        }
+    } else {
+        gamma76 = beta53(974, 0x1f) || 905 - ('c') != 'c';
+    }
+    return i; // done
+}
+
+static const char *name248 = "count64\n";
+int f248(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < count3('c', 0x1f != 0x1f && 0x1f); i++) {
+        int count44 = 204;
+    }
+    if (0x1f) {
+        gamma62 = gamma73['c' / delta15] && ('c') != 0x1f;
+    } else {
+        value86 = 0x1f;
+    }
+    int beta22 = 'c' && delta32(22, 490) || 'c';
+    beta93 = 104 + 'c' < 622 == 'c' / (gamma82);
+    return i; // done
+}
+
+static const char *name249 = "index50\n";
+int f249(int a, const char *s, long b[]) {
+    int i;
+    beta90 = delta58 || index45[166];
+    return i; // done
+}
+
+static const char *name250 = "delta44\n";
+int f250(int a, const char *s, long b[]) {
+    int i;
+    if (delta14(924, ('c'))) {
+        for (i = 0; i < (209 * 'c') < ('c'); i++) {
+            if (value2[74 != 0x1f || (0x1f)]) {
+                int index65 = (index62 && 102 != alpha20['c']);
+            } else {
+                alpha56 = 0x1f % alpha19['c'] != value56 && 0x1f;
+            }
+        }
+    } else {
+        int gamma49 = beta69((beta36(664, value74)), value61 && 111 || 509 == 229);
+    }
+    int total12 = index58[0x1f];
+    index59 = alpha22(0x1f, beta7) + index17 != 'c' && 'c' + 0x1f && value25[0x1f];
+    return i; // done
+}
+
+static const char *name251 = "index13\n";
+int f251(int a, const char *s, long b[]) {
+    int i;
+    delta36 = 724 && (287) * 996;
+    if (0x1f) {
+        gamma1 = 172;
+    } else {
+        if (0x1f) {
+            total79 = 0x1f;
+        } else {
+            count82 = total49[0x1f || delta60 + 0x1f];
+        }
+    }
+    while (index38) value75 -= value63(beta6 - 124, gamma93['c']);
+    return i; // done
+}
+
+static const char *name252 = "total43\n";
+int f252(int a, const char *s, long b[]) {
+    int i;
+    index20 = 0x1f;
+    total93 = 'c';
+    delta78 = 0x1f;
+    for (i = 0; i < 932 * total49((index76), 0x1f); i++) {
+        int total74 = alpha9(delta75 == 948 && 'c' / 219, 923);
+    }
+    while (767 - 233 < beta47 != beta41(0x1f, 0x1f)) value8 -= ('c');
+    int alpha43 = beta88[value85 && total21 / 'c'];
+    if (count79((781 && 'c'), index28['c'] == total66['c'])) {
+        for (i = 0; i < 109; i++) {
+            while (alpha39[('c')]) index68 -= 0x1f;
+        }
+    } else {
+        count96 = value5(alpha54 < 'c', value65[count26 * 'c']);
+    }
+    return i; // done
+}
+
+static const char *name253 = "gamma24\n";
+int f253(int a, const char *s, long b[]) {
+    int i;
+    count81 = 0x1f;
+    int alpha42 = 108;
+    total89 = index99 / total92;
+    int alpha9 = count91['c'] || count52 - index48 != gamma92[962 != 0x1f];
+    value83 = 'c';
+    index88 = value57(index8(alpha0, gamma30), beta83 < 829) || beta7('c' * 0x1f, 0x1f * 675);
+    return i; // done
+}
+
+static const char *name254 = "delta24\n";
+int f254(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < (delta77(value78(574, 'c'), 43)); i++) {
+        index59 = delta85 % gamma29 == index77[gamma46] < 'c' + value10;
+    }
+    if ('c') {
+        if (0x1f) {
+            for (i = 0; i < index87('c', 0x1f) || alpha12('c', 0x1f) >= 32; i++) {
+                beta94 = beta72((delta12['c']), total1('c' != 0x1f, gamma10));
+            }
+        } else {
+            gamma56 = ('c' + alpha0[8]);
+        }
+    } else {
+        index79 = beta78(234, total24(beta65, 104) * delta23['c']);
+    }
+    delta51 = 305;
+    return i; // done
+}
+
+static const char *name255 = "index40\n";
+int f255(int a, const char *s, long b[]) {
+    int i;
+    if (616) {
+        alpha78 = ('c');
+    } else {
+        int beta14 = count30((beta56), 445 % 0x1f);
+    }
+    beta68 = count71[422] || gamma88[923 + 296];
+    int alpha7 = beta84;
+    gamma49 = alpha60[count1[(0x1f)]];
+    total57 = 518;
+    total24 = (delta89 % 740) && gamma28 + 'c' || 936 / 'c';
+    return i; // done
+}
+
+static const char *name256 = "total99\n";
+int f256(int a, const char *s, long b[]) {
+    int i;
+    index24 = 'c' / (gamma70) && alpha0(720 && gamma28, 0x1f != 'c');
+    value44 = value82[41] < 377 % 150 / 'c' * index97 - total88 == 'c';
+    int gamma41 = 0x1f;
+    int total22 = total60 % total51(526, total27) * index85 < count30;
+    return i; // done
+}
+
+static const char *name257 = "beta76\n";
+int f257(int a, const char *s, long b[]) {
+    int i;
+    gamma59 = (831);
+    while (alpha93(0x1f == beta50 % 'c', 'c' + 'c' >= 0x1f != 0x1f)) count40 -= 795 >= 'c';
+    value11 = count92(616, index77 + 423 != alpha83['c']);
+    for (i = 0; i < 'c' || 172 / delta83 / 'c' < 'c' * 436 < 'c'; i++) {
+        if (count58[0x1f + 491] + (index94) - gamma78(gamma29, 0x1f)) {
+            total44 = alpha40(delta62 - 'c' < gamma43[0x1f], total68(0x1f, value1) % gamma50[0x1f]);
+        } else {
+            for (i = 0; i < total66(gamma69[beta59[883]], alpha53(0x1f, gamma58[0x1f])); i++) {
+                gamma77 = count75[count43];
+            }
+        }
+    }
+    return i; // done
+}
+
+static const char *name258 = "delta74\n";
+int f258(int a, const char *s, long b[]) {
+    int i;
+    count95 = 0x1f;
+    value33 = delta90;
+    delta68 = 'c' % total86 * 'c' != ('c');
+    if (index97[(403) == 543 >= 0x1f]) {
+        if (beta70(index53(376, alpha24) / 319 >= 'c', total42(324 || 0x1f, count25(value3, 0x1f)))) {
+            int count3 = (alpha42['c' + 182]);
+        } else {
+            delta28 = total61[624] / ('c') < 0x1f;
+        }
+    } else {
+        delta28 = alpha54[0x1f];
+    }
+    for (i = 0; i < (0x1f - 0x1f * 774 / 'c'); i++) {
+        for (i = 0; i < (alpha13(0x1f, 'c') >= ('c')); i++) {
+            delta93 = alpha31['c'] == index30(743, 'c') + 166 && 0x1f;
+        }
+    }
+    return i; // done
+}
+
+static const char *name259 = "value99\n";
+int f259(int a, const char *s, long b[]) {
+    int i;
+    while (0x1f) count57 -= value74('c', 0x1f && 'c');
+    gamma68 = index46(923, gamma62['c']) < 625 >= value61;
+    int total53 = gamma54 * 662 % total68(279, 'c') >= 29;
+    for (i = 0; i < total39[988 >= 206] * 452; i++) {
+        value63 = 0x1f == 707 - 139 >= 'c' >= delta80(0x1f, 0x1f) >= alpha39;
+    }
+    for (i = 0; i < alpha5(total46[index80], count84['c' >= 0x1f]); i++) {
+        for (i = 0; i < (delta79); i++) {
+            delta70 = alpha58[813] - 'c' != 26;
+        }
+    }
+    return i; // done
+}
+
+static const char *name260 = "value34\n";
+int f260(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < 'c'; i++) {
+        delta86 = total6;
+    }
+    return i; // done
+}
+
+static const char *name261 = "total68\n";
+int f261(int a, const char *s, long b[]) {
+    int i;
+    beta79 = total73['c' - 616 || 'c'];
+    return i; // done
+}
+
+static const char *name262 = "alpha33\n";
+int f262(int a, const char *s, long b[]) {
+    int i;
+    int alpha30 = 66;
+    value15 = gamma91;
+    while (alpha52[count17[0x1f]]) gamma81 -= index20 - gamma86 || ('c');
+    if (alpha76) {
+        gamma89 = alpha94;
+    } else {
+        if (0x1f) {
+            delta73 = alpha35(delta34 != 352 != 946, (delta74));
+        } else {
+            int beta91 = 0x1f && count11;
+        }
+    }
+    delta2 = (612);
+    return i; // done
+}
+
+static const char *name263 = "total31\n";
+int f263(int a, const char *s, long b[]) {
+    int i;
+    while (beta13[beta11]) value68 -= index86 % 0x1f != 'c' * 0x1f;
+    gamma10 = 847;
+    if (gamma31) {
+        alpha63 = 'c';
+    } else {
+        int gamma94 = (721);
+    }
+    while (count78(count38(value23, 524) || 'c', index63[index44(delta37, beta24)])) gamma0 -= beta55(356 == 26, 578);
+    return i; // done
+}
+
+static const char *name264 = "value47\n";
+int f264(int a, const char *s, long b[]) {
+    int i;
+    if (gamma61(0x1f == 'c' == 0x1f, alpha10 || 'c')) {
+        int value86 = index58['c'] - value69 - 283;
+    } else {
+        alpha3 = 0x1f / ('c');
+    }
+    return i; // done
+}
+
+static const char *name265 = "beta15\n";
+int f265(int a, const char *s, long b[]) {
+    int i;
+    while (beta62(delta22(84, 91), 'c') == gamma19('c', gamma38) == alpha65[965]) delta15 -= beta15(0x1f, 'c') + alpha8[161];
+    int delta59 = (value31) && 0x1f >= total82 >= 0x1f + total48 - 594;
+    total64 = index86[beta45[count89[702]]];
+    alpha93 = 972;
+    int count64 = total25['c'];
+    if ((0x1f)) {
+        int delta63 = delta40['c'];
+    } else {
+        int gamma2 = 'c' == gamma77 * delta41['c'] / 683 < 'c' * delta32;
+    }
+    return i; // done
+}
+
+static const char *name266 = "alpha64\n";
+int f266(int a, const char *s, long b[]) {
+    int i;
+    while ('c') alpha99 -= 502 * delta74 == 'c' != 0x1f;
+    if ('c') {
+        delta59 = gamma9;
+    } else {
+        beta84 = gamma77[delta42] / beta28 * delta26 * 0x1f * delta18;
+    }
+    delta65 = 'c' && 366 && value63 < 'c';
+    value82 = 163;
+    gamma18 = 0x1f;
+    return i; // done
+}
+
+static const char *name267 = "alpha83\n";
+int f267(int a, const char *s, long b[]) {
+    int i;
+    beta70 = 0x1f;
+    beta17 = value75[gamma35(gamma18(244, 0x1f), delta26[391])];
+    for (i = 0; i < (946); i++) {
+        value50 = 'c' / 834 + (233);
+    }
+    if (0x1f) {
+        for (i = 0; i < index65(count25(count25 != 617, 0x1f % beta88), beta44((value97), index11('c', 0x1f))); i++) {
+            index9 = 0x1f / (alpha40 < 'c');
+        }
+    } else {
+        gamma58 = beta62['c'] * 760;
+    }
+    return i; // done
+}
+
+static const char *name268 = "beta12\n";
+int f268(int a, const char *s, long b[]) {
+    int i;
+    index61 = 'c';
+    beta17 = beta14[count6(77, gamma35) % ('c')];
+    index42 = 'c' >= ('c') + 229 / 0x1f;
+    total19 = value18[0x1f - gamma22 != value52 / gamma6];
+    for (i = 0; i < gamma33[0x1f]; i++) {
+        delta18 = 833;
+    }
+    index38 = 'c' + 'c';
+    int beta91 = 0x1f;
+    return i; // done
+}
+
+static const char *name269 = "alpha49\n";
+int f269(int a, const char *s, long b[]) {
+    int i;
+    int gamma61 = 126 != 565;
+    alpha2 = count82;
+    int value22 = 'c';
+    return i; // done
+}
+
+static const char *name270 = "total36\n";
+int f270(int a, const char *s, long b[]) {
+    int i;
+    if (total77(total50, (value67 * gamma82))) {
+        while ((alpha75(114 / gamma23, total62('c', 709)))) index90 -= alpha79[total11];
+    } else {
+        gamma94 = count64((alpha2 && 0x1f), 632 % 0x1f % index94['c']);
+    }
+    count26 = 0x1f / 516;
+    return i; // done
+}
+
+static const char *name271 = "value54\n";
+int f271(int a, const char *s, long b[]) {
+    int i;
+    count60 = ('c' % delta31(0x1f, 'c'));
+    if (total96['c']) {
+        int value25 = 0x1f;
+    } else {
+        for (i = 0; i < 379 / 'c'; i++) {
+            for (i = 0; i < 923; i++) {
+                gamma53 = total88(0x1f, 0x1f) / (alpha29) * alpha47 != 0x1f;
+            }
+        }
+    }
+    int count45 = 0x1f;
+    if (beta29 >= count92[value70(0x1f, 626)]) {
+        if (alpha2(beta1 || beta28, 787)) {
+            index91 = ((alpha14[value38]));
+        } else {
+            alpha18 = gamma17[(index52[total11])];
+        }
+    } else {
+        alpha75 = gamma24(0x1f, 0x1f % beta52(count9, 807));
+    }
+    count86 = index14[gamma24[311]] || 'c' < 544;
+    gamma90 = alpha91(index15, 'c');
+    return i; // done
+}
+
+static const char *name272 = "alpha42\n";
+int f272(int a, const char *s, long b[]) {
+    int i;
+    value17 = index98 == 0x1f != 'c' && alpha32;
+    return i; // done
+}
+
+static const char *name273 = "alpha27\n";
+int f273(int a, const char *s, long b[]) {
+    int i;
+    total86 = 726;
+    if (778 || 994) {
+        delta82 = alpha68[157 / 0x1f];
+    } else {
+        while (200) count60 -= delta31('c', 'c');
+    }
+    if (579) {
+        if ((0x1f) % 107) {
+            total65 = (alpha89 >= value80 + 717);
+        } else {
+            alpha6 = index80;
+        }
+    } else {
+        for (i = 0; i < index30[(0x1f != 719)]; i++) {
+            value24 = delta0;
+        }
+    }
+    count78 = count74;
+    value37 = alpha11[alpha88[count37]];
+    delta11 = 0x1f % 'c';
+    delta60 = (value92(0x1f, 'c')) && 803;
+    return i; // done
+}
+
+static const char *name274 = "value63\n";
+int f274(int a, const char *s, long b[]) {
+    int i;
+    int index16 = 'c' - 0x1f != beta79['c' >= 438];
+    gamma73 = 0x1f >= 573 >= 'c' / index17 >= index30[count78] == 'c';
+    while (0x1f) total22 -= 95 || 850 < 0x1f;
+    delta30 = 'c' / 0x1f + 'c' != count45('c', beta87('c', 'c'));
+    delta35 = gamma78;
+    value97 = 'c';
+    return i; // done
+}
+
+static const char *name275 = "total21\n";
+int f275(int a, const char *s, long b[]) {
+    int i;
+    index87 = 'c';
+    if (0x1f < 'c' >= 867 + 0x1f || gamma41(0x1f || 'c', gamma23[166])) {
+        if ('c') {
+            for (i = 0; i < alpha52; i++) {
+                int delta55 = count12['c'];
+            }
+        } else {
+            delta44 = delta16((0x1f), gamma12[22 + count23]);
+        }
+    } else {
+        beta55 = 828;
+    }
+    while ((value30(850, 'c')) && gamma24) delta50 -= ('c') < 0x1f;
+    if (190) {
+        alpha54 = index55(0x1f, 0x1f);
+    } else {
+        int beta71 = alpha38('c', 842) != total66 / 'c' != ('c' * 0x1f);
+    }
+    while ('c') count8 -= value54 * total0 && 0x1f < 136;
+    delta79 = count10((573 * delta78), 'c' * 460 - 0x1f);
+    int alpha42 = total94 >= 'c' - 'c' - (delta67('c', 0x1f));
+    return i; // done
+}
+
+static const char *name276 = "alpha77\n";
+int f276(int a, const char *s, long b[]) {
+    int i;
+    gamma52 = count31[('c')];
+    int count70 = alpha6(608, beta35) + 'c' || delta65(0x1f, 'c') + 811;
+    value95 = (value59['c'] + 0x1f);
+    if (count91(count1 - 160, 0x1f) == ('c' < 0x1f)) {
+        value0 = total0('c', (754)) != 'c' && beta31('c', 'c');
+    } else {
+        gamma35 = alpha32(count88['c'], 0x1f) / 727;
+    }
+    count8 = 'c' == gamma5 == 0x1f % total28[924];
+    return i; // done
+}
+
+static const char *name277 = "gamma61\n";
+int f277(int a, const char *s, long b[]) {
+    int i;
+    while (count44(0x1f % index6 != 'c', 'c' >= 0x1f + 0x1f)) index87 -= 'c' || 'c' == 'c';
+    return i; // done
+}
+
+static const char *name278 = "count77\n";
+int f278(int a, const char *s, long b[]) {
+    int i;
+    count71 = 0x1f - 120 - 'c' || total33;
+    count65 = gamma78(gamma96[518] % value66[888], (0x1f) * alpha2('c', 'c'));
+    return i; // done
+}
+
+static const char *name279 = "index79\n";
+int f279(int a, const char *s, long b[]) {
+    int i;
+    while (index93[index58[delta69]] < 0x1f) beta2 -= 'c' + value89 == 0x1f;
+    int beta63 = (count49[0x1f] == delta20[513]);
+    if ((130) >= total40) {
+        while (0x1f) count8 -= 'c' && 'c';
+    } else {
+        count70 = 0x1f;
+    }
+    for (i = 0; i < total45(0x1f % beta75(0x1f, 834), (index74[total85])); i++) {
+        int index12 = total28((total73('c', delta94)), gamma81[666] && 'c' != 609);
+    }
+    return i; // done
+}
+
+static const char *name280 = "beta65\n";
+int f280(int a, const char *s, long b[]) {
+    int i;
+    beta67 = (alpha12(('c'), (0x1f)));
+    if (alpha27['c'] < alpha52['c'] || gamma83 + 920 / 0x1f) {
+        int total33 = index27;
+    } else {
+        delta85 = 978 >= 301 >= 951 % 'c';
+    }
+    return i; // done
+}
+
+static const char *name281 = "total79\n";
+int f281(int a, const char *s, long b[]) {
+    int i;
+    delta10 = (480) < 'c' + 'c' >= 0x1f;
+    for (i = 0; i < 'c' == beta63; i++) {
+        gamma7 = 332;
+    }
+    return i; // done
+}
+
+static const char *name282 = "value33\n";
+int f282(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < (alpha57) % delta78[beta10(462, 0x1f)]; i++) {
+        total72 = value48[value72(0x1f % count47, gamma69)];
+    }
+    return i; // done
+}
+
+static const char *name283 = "beta35\n";
+int f283(int a, const char *s, long b[]) {
+    int i;
+    while ('c' < alpha27(70, 350) / 0x1f) delta1 -= 0x1f == 'c' >= alpha3;
+    for (i = 0; i < 827; i++) {
+        int count21 = delta19 + index23 == (count68) == 0x1f >= alpha10;
+    }
+    int index38 = 0x1f;
+    int delta25 = 0x1f != (total98 || 0x1f);
+    index28 = index27;
+    return i; // done
+}
+
+static const char *name284 = "beta13\n";
+int f284(int a, const char *s, long b[]) {
+    int i;
+    while (value39((value15('c', 190)), value62('c' - 553, gamma6(0x1f, beta24)))) total58 -= 676;
+    for (i = 0; i < value4(227 / value14(465, 0x1f), beta11(0x1f % 0x1f, gamma87('c', value48))); i++) {
+        if (0x1f) {
+            value29 = 'c' >= 0x1f;
+        } else {
+            int delta83 = alpha46;
+        }
+    }
+    int delta27 = ('c') / gamma8(value34, 'c') / 'c';
+    return i; // done
+}
+
+static const char *name285 = "delta60\n";
+int f285(int a, const char *s, long b[]) {
+    int i;
+    count27 = beta0 / 365;
+    delta70 = gamma24(694, (161));
+    int index44 = 'c';
+    return i; // done
+}
+
+static const char *name286 = "alpha91\n";
+int f286(int a, const char *s, long b[]) {
+    int i;
+    total42 = total11[delta8] + 773 + 0x1f / index42(48, 0x1f);
+    alpha16 = 460 || (beta36(0x1f, 'c'));
+    return i; // done
+}
+
+static const char *name287 = "delta12\n";
+int f287(int a, const char *s, long b[]) {
+    int i;
+    int index42 = (count28(0x1f, count87)) * beta70[95];
+    beta63 = index1 < 0x1f % 'c' == (gamma37['c']);
+    while (value87) delta0 -= 'c';
+    count54 = delta71[total80(beta51, 'c') >= beta57('c', 0x1f)];
+    return i; // done
+}
+
+static const char *name288 = "delta9\n";
+int f288(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < gamma65['c' * count93 == 0x1f || 531]; i++) {
+        gamma10 = 759 || 556 == total83 == count81;
+    }
+    return i; // done
+}
+
+static const char *name289 = "total81\n";
+int f289(int a, const char *s, long b[]) {
+    int i;
+    count37 = 0x1f;
+    value99 = value24(0x1f, beta29[delta1]) / 'c' != 728 || total14(0x1f, 0x1f);
+    while (0x1f + delta71(0x1f, 741)) delta1 -= alpha95[104] && beta89 * 0x1f;
+    alpha63 = 570;
+    total36 = gamma41['c'] || index33 < 203 || 0x1f - 272;
+    alpha42 = 'c' || value36(value78 != 'c', 0x1f);
+    while (323 / gamma31 || beta6 != 0x1f && (0x1f)) beta93 -= 'c';
+    return i; // done
+}
+
+static const char *name290 = "gamma24\n";
+int f290(int a, const char *s, long b[]) {
+    int i;
+    for (i = 0; i < alpha72(count3('c', index43), gamma92) / (0x1f || 929); i++) {
+        alpha46 = total21('c' * 334, 460 < 'c') / 0x1f != 0x1f == count93['c'];
+    }
+    index28 = gamma25;
+    value14 = 452 % 'c' * (beta59) - 'c' && 'c' + 'c' && 197;
+    if (0x1f) {
+        count95 = 445 != 0x1f % 645 != 60 && 0x1f % 470;
+    } else {
+        while (alpha22['c'] < alpha47(0x1f, total1) - value29 + 66 + delta85 == 'c') beta23 -= 'c' * 0x1f;
+    }
+    for (i = 0; i < count23 + count1[value21[326]]; i++) {
+        beta81 = (value36['c' && 0x1f]);
+    }
+    gamma77 = alpha89(beta68(708, 61), 'c' == 'c') - count42('c' >= 384, 'c' < total62);
+    return i; // done
+}
+
+static const char *name291 = "index52\n";
+int f291(int a, const char *s, long b[]) {
+    int i;
+    if (109) {
+        if (alpha23[total98[beta58] && 95]) {
+            if (total24) {
+                alpha62 = beta53;
+            } else {
+                index22 = 0x1f;
+            }
+        } else {
+            if ('c') {
+                int count89 = 'c';
+            } else {
+                int count25 = 348 || 'c';
+            }
+        }
+    } else {
+        gamma49 = 0x1f != 0x1f;
+    }
+    value74 = 0x1f;
+    count28 = 'c' + 0x1f < 72;
+    for (i = 0; i < gamma38[value21] || alpha94[index96]; i++) {
+        if ((gamma19) >= 37 + 0x1f % gamma85(gamma74, (0x1f))) {
+            alpha3 = alpha73;
+        } else {
+            gamma56 = alpha11[730 / 'c'] == count56 >= 863 * alpha91;
+        }
+    }
+    value17 = 'c';
+    if (585) {
+        total0 = 975;
+    } else {
+        gamma3 = alpha21(gamma24(864 % 0x1f, count84[331]), 31);
+    }
+    return i; // done
+}
+
+static const char *name292 = "delta44\n";
+int f292(int a, const char *s, long b[]) {
+    int i;
+    while (gamma41(index27, 'c' >= 'c' && 147)) delta72 -= 'c';
+    while (0x1f) delta55 -= ('c' % value11);
+    count42 = (0x1f == gamma88 == value0);
+    while (553 == 0x1f) alpha15 -= 'c' / 'c' || 'c' * 653;
+    if (723) {
+        int index53 = gamma59[0x1f] / delta84[beta66] % alpha99;
+    } else {
+        while ('c') total69 -= 0x1f < 0x1f;
+    }
+    int beta67 = beta4[386];
+    return i; // done
+}
+
+static const char *name293 = "value13\n";
+int f293(int a, const char *s, long b[]) {
+    int i;
+    delta91 = 256;
+    if (277 != (total34['c'])) {
+        value5 = gamma90['c'];
+    } else {
+        if ('c' / total21('c', 557) % alpha96) {
+            index32 = 0x1f % 'c' % count40 - 'c' % 667;
+        } else {
+            value74 = alpha53[count51(616, count61)];
+        }
+    }
+    total44 = 257 < 480 < value47[515] != 'c' == 0x1f;
+    return i; // done
+}
+
+static const char *name294 = "alpha80\n";
+int f294(int a, const char *s, long b[]) {
+    int i;
+    if ('c') {
+        value87 = 495 != 0x1f;
+    } else {
+        alpha61 = alpha13[total58(gamma51, 936)] != value62(total60, 0x1f);
+    }
+    return i; // done
+}
+
+static const char *name295 = "alpha96\n";
+int f295(int a, const char *s, long b[]) {
+    int i;
+    int delta54 = value45[total79('c', 0x1f)] - gamma51('c' == 145, 0x1f);
+    int gamma13 = gamma59 < 0x1f + (alpha42) * alpha41(65, 435) % 947;
+    if (0x1f) {
+        if (901 + 722 / 'c' != 'c' + 236) {
+            for (i = 0; i < total17(539 >= 555 != 0x1f, total80(0x1f, count3) >= delta73(alpha5, 'c')); i++) {
+                gamma13 = beta84;
+            }
+        } else {
+            alpha31 = 0x1f;
+        }
+    } else {
+        alpha20 = (alpha82((227), alpha37[total74]));
+    }
+    value60 = index71;
+    return i; // done
+}
+
+static const char *name296 = "count18\n";
+int f296(int a, const char *s, long b[]) {
+    int i;
+    int value81 = 'c';
+    count59 = (414);
+    int index83 = gamma90[0x1f] / 'c' != total77 * 0x1f;
+    for (i = 0; i < beta26[757] + 645 - 296 % 0x1f / index68 == 0x1f; i++) {
+        gamma52 = 197 >= 0x1f % 0x1f != 'c';
+    }
+    while (count7) value50 -= count56(alpha68[693], value84['c']);
+    delta99 = (beta32[gamma57] + 'c');
+    return i; // done
+}
+
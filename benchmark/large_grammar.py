@@ -0,0 +1,142 @@
+# Copyright (c) 2024-2026 Arihiro Yoshida. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+
+# Generates a synthetic PEG grammar with the requested number of rules, and optionally measures
+# the time and the peak memory of PackCC to generate the parser from it, and the time of the C compiler
+# to build the generated parser.
+# The shape of the grammar can be chosen to expose the scaling behavior of the generator,
+# such as long chains of rule references, many left-recursive rule groups, and wide rules
+# with many alternatives, rule variables, captures, and back references.
+
+from typing import Iterator
+import argparse
+import os
+import random
+import subprocess
+import sys
+import tempfile
+import time
+
+
+def generate_chain(n: int, rand: random.Random) -> Iterator[str]:
+    # every rule references the next one, and a few later ones at random
+    for i in range(n):
+        refs: list[str] = ['r' + str(j) if j < n else 'tail' for j in [i + 1, rand.randrange(i + 1, n + 1), rand.randrange(i + 1, n + 1)]]
+        k: int = i % 4
+        if k == 0:
+            yield 'r%d <- x:%s ( y:%s / "k%d" ) { $$ = x + y; } / < [a-z]+ > "%d" { $$ = (int)$1e; }\n' % (i, refs[0], refs[1], i, i)
+        elif k == 1:
+            yield 'r%d <- "a%d" %s* / %s "b" %s?\n' % (i, i, refs[0], refs[1], refs[2])
+        elif k == 2:
+            yield 'r%d <- < "c%d" > $1 &%s / [0-9]+ ~{ $$ = %d; }\n' % (i, i, refs[0], i)
+        else:
+            yield 'r%d <- ( %s / %s )+ { $$ = %d; }\n' % (i, refs[0], refs[1], i)
+
+
+def generate_recursive(n: int, rand: random.Random) -> Iterator[str]:
+    # groups of mutually left-recursive rules chained by nullable prefixes
+    for i in range(0, n, 4):
+        nx: str = 'r' + str(i + 4) if i + 4 < n else 'tail'
+        yield 'r%d <- r%d "+" r%d { $$ = 1; } / r%d\n' % (i, i + 1, i + 2, i + 2)
+        yield 'r%d <- r%d "*" r%d / r%d\n' % (i + 1, i, i + 2, i + 2)
+        yield 'r%d <- r%d? r%d "-" / %s\n' % (i + 2, i + 3, i + 1, nx)
+        yield 'r%d <- ( "n%d" / %s )?\n' % (i + 3, rand.randrange(n), nx)
+
+
+def generate_wide(n: int, rand: random.Random) -> Iterator[str]:
+    # a single rule with as many alternatives as the rules
+    yield 'r0 <- ' + ' / '.join('x%d:tail < "k%d" > $%d { $$ = %d; }' % (i, i, i + 1, rand.randrange(1000)) for i in range(n)) + '\n'
+
+
+GENERATORS = {
+    'chain': generate_chain,
+    'recursive': generate_recursive,
+    'wide': generate_wide,
+}
+
+
+def generate(shape: str, n: int, seed: int) -> Iterator[str]:
+    yield '%prefix "large"\n%value "int"\n\n'
+    yield 'start <- r0 !.\n'
+    yield from GENERATORS[shape](n, random.Random(seed))
+    yield 'tail <- "z" { $$ = 0; }\n'
+
+
+def measure(packcc: str, options: list[str], path: str, runs: int) -> None:
+    import resource  # not available on Windows
+    base: str = os.path.splitext(path)[0]
+    times: list[float] = []
+    for _ in range(runs):
+        t: float = time.perf_counter()
+        subprocess.run([packcc, *options, '-o', base, path], check=True)
+        times.append(time.perf_counter() - t)
+    rss: int = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss  # in kilobytes on Linux, and in bytes on macOS
+    if sys.platform == 'darwin':
+        rss //= 1024
+    size: int = os.path.getsize(base + '.c')
+    times.sort()
+    sys.stderr.write('grammar    %12d bytes\n' % os.path.getsize(path))
+    sys.stderr.write('output     %12d bytes\n' % size)
+    sys.stderr.write('time       %12.1f ms   (min), %.1f ms (median) of %d runs\n' % (times[0] * 1e3, times[len(times) // 2] * 1e3, runs))
+    sys.stderr.write('memory     %12d KB   (peak)\n' % rss)
+
+
+def measure_compilation(cc: str, path: str, runs: int) -> None:
+    base: str = os.path.splitext(path)[0]
+    times: list[float] = []
+    for _ in range(runs):
+        t: float = time.perf_counter()
+        subprocess.run([*cc.split(), '-c', '-O2', '-o', base + '.o', base + '.c'], check=True)
+        times.append(time.perf_counter() - t)
+    times.sort()
+    sys.stderr.write('object     %12d bytes\n' % os.path.getsize(base + '.o'))
+    sys.stderr.write('compile    %12.1f ms   (min), %.1f ms (median) of %d runs\n' % (times[0] * 1e3, times[len(times) // 2] * 1e3, runs))
+
+
+def main() -> None:
+    parser: argparse.ArgumentParser = argparse.ArgumentParser(
+        description='Generate a synthetic grammar with the requested number of rules, and optionally measure PackCC with it.'
+    )
+    parser.add_argument('rules', type=int, help='the number of the rules')
+    parser.add_argument('-s', '--shape', choices=list(GENERATORS), default='chain', help='the shape of the grammar (default: chain)')
+    parser.add_argument('-p', '--packcc', help='the path of the PackCC executable to be measured; the grammar is printed if omitted')
+    parser.add_argument('-b', '--bytecode', action='store_true', help='generate the parser with the option --bytecode')
+    parser.add_argument('-c', '--compile', metavar='CC', help='the C compiler command to build the generated parser with, which is also measured')
+    parser.add_argument('-r', '--runs', type=int, default=3, help='the number of the measured runs (default: 3)')
+    parser.add_argument('--seed', type=int, default=0, help='the seed of the random numbers (default: 0)')
+    args: argparse.Namespace = parser.parse_args()
+    if args.packcc is None:
+        for chunk in generate(args.shape, args.rules, args.seed):
+            sys.stdout.write(chunk)
+        return
+    with tempfile.TemporaryDirectory() as dir:
+        path: str = os.path.join(dir, 'large.peg')
+        with open(path, 'w') as f:
+            for chunk in generate(args.shape, args.rules, args.seed):
+                f.write(chunk)
+        sys.stderr.write('%s: %d rules%s\n' % (args.shape, args.rules, ', bytecode' if args.bytecode else ''))
+        measure(args.packcc, ['--bytecode'] if args.bytecode else [], path, args.runs)
+        if args.compile is not None:
+            measure_compilation(args.compile, path, args.runs)
+
+
+if __name__ == '__main__':
+    main()
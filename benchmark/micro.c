@@ -0,0 +1,281 @@
+/*
+ * Microbenchmarks of the runtime data structures of parsers generated by PackCC
+ *
+ * Copyright (c) 2014, 2019-2026 Arihiro Yoshida. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file includes the source file of the parser generated from micro.peg,
+ * and measures the time per operation of each runtime data structure
+ * with access patterns seen in actual parsing, independently of grammars.
+ */
+
+#include "bench.h"
+
+#define MICRO_RUNS_DEFAULT 10
+#define MICRO_ITERATIONS_DEFAULT 1000000
+#define MICRO_NUM_RULES 16
+
+static const char *g_text = NULL;
+static size_t g_len = 0;
+static size_t g_pos = 0;
+static volatile size_t g_sink = 0; /* prevents the measured operations from being optimized away */
+
+static int micro_getchar(void) {
+    return (g_pos < g_len) ? (int)(unsigned char)g_text[g_pos++] : -1;
+}
+
+#define PCC_GETCHAR(auxil) micro_getchar()
+
+#include "parser.c"
+
+typedef size_t (*micro_function_t)(pcc_context_t *ctx, size_t iterations); /* returns the number of the operations */
+
+typedef struct micro_benchmark_tag {
+    const char *name;
+    micro_function_t function;
+    const char *description;
+} micro_benchmark_t;
+
+static const pcc_rule_t g_rules[MICRO_NUM_RULES] = {
+    pcc_evaluate_rule_w00, pcc_evaluate_rule_w01, pcc_evaluate_rule_w02, pcc_evaluate_rule_w03,
+    pcc_evaluate_rule_w04, pcc_evaluate_rule_w05, pcc_evaluate_rule_w06, pcc_evaluate_rule_w07,
+    pcc_evaluate_rule_w08, pcc_evaluate_rule_w09, pcc_evaluate_rule_w10, pcc_evaluate_rule_w11,
+    pcc_evaluate_rule_w12, pcc_evaluate_rule_w13, pcc_evaluate_rule_w14, pcc_evaluate_rule_w15
+};
+
+static size_t micro_memo_map_narrow(pcc_context_t *ctx, size_t iterations) {
+    pcc_lr_memo_map_t map;
+    size_t i;
+    pcc_lr_memo_map__initialize(ctx, &map);
+    for (i = 0; i < iterations; i++) { /* a rule and the rule it calls are memoized repeatedly at the same position */
+        pcc_lr_memo_map__put(ctx, &map, g_rules[i & 1], pcc_lr_answer__create(ctx, PCC_LR_ANSWER_CHUNK, i));
+        g_sink += (pcc_lr_memo_map__get(ctx, &map, g_rules[(i + 1) & 1]) != NULL) ? 1 : 0;
+    }
+    pcc_lr_memo_map__finalize(ctx, &map);
+    return iterations * 2;
+}
+
+static size_t micro_memo_map_wide(pcc_context_t *ctx, size_t iterations) {
+    const size_t n = iterations / (MICRO_NUM_RULES * 2) + 1;
+    size_t i, j;
+    for (i = 0; i < n; i++) { /* all alternatives are tried at each position, and then looked up with misses */
+        pcc_lr_memo_map_t map;
+        pcc_lr_memo_map__initialize(ctx, &map);
+        for (j = 0; j < MICRO_NUM_RULES; j++) {
+            if (pcc_lr_memo_map__get(ctx, &map, g_rules[j]) == NULL)
+                pcc_lr_memo_map__put(ctx, &map, g_rules[j], pcc_lr_answer__create(ctx, PCC_LR_ANSWER_CHUNK, i));
+        }
+        for (j = MICRO_NUM_RULES; j > 0; j--) {
+            g_sink += (pcc_lr_memo_map__get(ctx, &map, g_rules[j - 1]) != NULL) ? 1 : 0;
+        }
+        pcc_lr_memo_map__finalize(ctx, &map);
+    }
+    return n * MICRO_NUM_RULES * 3;
+}
+
+static size_t micro_memory_recycler(pcc_context_t *ctx, size_t iterations) {
+    void *p[64];
+    size_t i = 0, n = 0;
+    pcc_memory_recycler_t obj;
+    pcc_memory_recycler__initialize(ctx->auxil, &obj, sizeof(pcc_thunk_chunk_t));
+    while (n < iterations) { /* objects are supplied while descending and recycled while backtracking */
+        const size_t k = 1 + (i++ * 7) % 64;
+        size_t j;
+        for (j = 0; j < k; j++) p[j] = pcc_memory_recycler__supply(ctx->auxil, &obj);
+        for (j = k; j > 0; j--) pcc_memory_recycler__recycle(ctx->auxil, &obj, p[j - 1]);
+        n += k * 2;
+    }
+    pcc_memory_recycler__finalize(ctx->auxil, &obj);
+    return n;
+}
+
+static size_t micro_thunk_array(pcc_context_t *ctx, size_t iterations) {
+    pcc_thunk_array_t obj;
+    size_t i;
+    pcc_thunk_array__initialize(ctx, &obj);
+    for (i = 0; i < iterations; i++) { /* thunks are added, and half of them are reverted on each backtracking */
+        pcc_thunk_array__add(ctx, &obj, pcc_thunk__create_leaf(ctx, NULL, 2, 1));
+        if ((i & 7) == 7) pcc_thunk_array__revert(ctx, &obj, obj.n / 2);
+    }
+    pcc_thunk_array__revert(ctx, &obj, 0);
+    pcc_thunk_array__finalize(ctx, &obj);
+    return iterations;
+}
+
+static size_t micro_rule_set(pcc_context_t *ctx, size_t iterations) {
+    pcc_rule_set_t invol, eval;
+    size_t n = 0, i;
+    pcc_rule_set__initialize(ctx->auxil, &invol);
+    pcc_rule_set__initialize(ctx->auxil, &eval);
+    while (n < iterations) { /* the rules involved in deep left recursion are collected and evaluated one by one */
+        for (i = 0; i < MICRO_NUM_RULES; i++) pcc_rule_set__add(ctx->auxil, &invol, g_rules[i]);
+        pcc_rule_set__copy(ctx->auxil, &eval, &invol);
+        for (i = MICRO_NUM_RULES; i > 0; i--) g_sink += pcc_rule_set__remove(ctx->auxil, &eval, g_rules[i - 1]) ? 1 : 0;
+        pcc_rule_set__clear(ctx->auxil, &invol);
+        n += MICRO_NUM_RULES * 3;
+    }
+    pcc_rule_set__finalize(ctx->auxil, &eval);
+    pcc_rule_set__finalize(ctx->auxil, &invol);
+    return n;
+}
+
+static size_t micro_refill_buffer(pcc_context_t *ctx, size_t iterations) {
+    size_t n = 0;
+    g_pos = 0;
+    while (n < iterations && pcc_refill_buffer(ctx, 8) >= 1) { /* the characters are looked ahead and committed per statement */
+        ctx->cur++;
+        n++;
+        if ((n & 63) == 0) pcc_commit_buffer(ctx);
+    }
+    pcc_commit_buffer(ctx);
+    return n;
+}
+
+static size_t micro_get_char_as_utf32(pcc_context_t *ctx, size_t iterations) {
+    size_t n = 0;
+    g_pos = 0;
+    while (n < iterations) {
+        int u = 0;
+        const size_t k = pcc_get_char_as_utf32(ctx, &u);
+        if (k == 0) break;
+        ctx->cur += k;
+        g_sink += (size_t)u;
+        n++;
+        if ((n & 63) == 0) pcc_commit_buffer(ctx);
+    }
+    pcc_commit_buffer(ctx);
+    return n;
+}
+
+static size_t micro_parse_left_recursion(pcc_context_t *ctx, size_t iterations) {
+    size_t n = 0;
+    int ret = 0;
+    g_pos = 0;
+    while (n < iterations && micro_parse(ctx, &ret)) { /* the whole runtime working together */
+        g_sink += (size_t)ret;
+        n++;
+    }
+    return g_pos;
+}
+
+static const micro_benchmark_t g_benchmarks[] = {
+    { "memo_map_narrow", micro_memo_map_narrow, "pcc_lr_memo_map__put/get with 2 rules" },
+    { "memo_map_wide", micro_memo_map_wide, "pcc_lr_memo_map__put/get with 16 rules" },
+    { "memory_recycler", micro_memory_recycler, "pcc_memory_recycler__supply/recycle in LIFO order" },
+    { "thunk_array", micro_thunk_array, "pcc_thunk_array__add/revert with backtracking" },
+    { "rule_set", micro_rule_set, "pcc_rule_set__add/copy/remove with 16 rules" },
+    { "refill_buffer", micro_refill_buffer, "pcc_refill_buffer per character" },
+    { "get_char_as_utf32", micro_get_char_as_utf32, "pcc_get_char_as_utf32 on mixed UTF-8 text" },
+    { "parse_left_recursion", micro_parse_left_recursion, "micro_parse on left-recursive expressions (per byte)" }
+};
+
+static char *micro_create_text(size_t iterations, size_t *len) { /* lines of left-recursive expressions with multibyte comments */
+    static const char *const tail = " \xc3\xa9\xe2\x82\xac\xf0\x9d\x84\x9e\n"; /* U+00E9, U+20AC, and U+1D11E */
+    const size_t l = strlen(tail);
+    char *const p = (char *)malloc(iterations + 64 + l);
+    size_t n = 0;
+    if (p == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    while (n < iterations) {
+        size_t i;
+        for (i = 0; i < 63; i++, n++) p[n] = (i & 1) ? ((i & 2) ? '+' : '-') : (char)('a' + (n / 2) % MICRO_NUM_RULES);
+        memcpy(p + n, tail, l);
+        n += l;
+    }
+    *len = n;
+    return p;
+}
+
+static void micro_print_usage(const char *cmd) {
+    size_t i;
+    fprintf(
+        stderr,
+        "Usage: %s [-r runs] [-n iterations] [benchmark ...]\n"
+        "  -r runs        the number of the measured runs (default: %d)\n"
+        "  -n iterations  the number of the iterations in each run (default: %d)\n"
+        "The benchmarks are below; all of them are run if none is specified.\n",
+        cmd, MICRO_RUNS_DEFAULT, MICRO_ITERATIONS_DEFAULT
+    );
+    for (i = 0; i < sizeof(g_benchmarks) / sizeof(g_benchmarks[0]); i++) {
+        fprintf(stderr, "  %-22s %s\n", g_benchmarks[i].name, g_benchmarks[i].description);
+    }
+}
+
+int main(int argc, char **argv) {
+    const size_t num = sizeof(g_benchmarks) / sizeof(g_benchmarks[0]);
+    size_t runs = MICRO_RUNS_DEFAULT, iterations = MICRO_ITERATIONS_DEFAULT;
+    char selected[sizeof(g_benchmarks) / sizeof(g_benchmarks[0])];
+    pcc_bool_t all = PCC_TRUE;
+    double *v;
+    char *text;
+    size_t len = 0, i, j;
+    int k;
+    memset(selected, 0, sizeof(selected));
+    for (k = 1; k < argc; k++) {
+        if (strcmp(argv[k], "-r") == 0 && k + 1 < argc) {
+            runs = (size_t)atol(argv[++k]);
+        }
+        else if (strcmp(argv[k], "-n") == 0 && k + 1 < argc) {
+            iterations = (size_t)atol(argv[++k]);
+        }
+        else {
+            for (i = 0; i < num; i++) {
+                if (strcmp(argv[k], g_benchmarks[i].name) == 0) break;
+            }
+            if (i >= num) {
+                micro_print_usage(argv[0]);
+                return 1;
+            }
+            selected[i] = 1;
+            all = PCC_FALSE;
+        }
+    }
+    if (runs == 0 || iterations == 0) {
+        micro_print_usage(argv[0]);
+        return 1;
+    }
+    v = (double *)malloc(sizeof(double) * runs);
+    if (v == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+    text = micro_create_text(iterations, &len);
+    g_text = text;
+    g_len = len;
+    fprintf(stderr, "%-22s %lu iterations, %lu runs\n", "benchmark", (unsigned long)iterations, (unsigned long)runs);
+    for (i = 0; i < num; i++) {
+        if (!all && !selected[i]) continue;
+        for (j = 0; j <= runs; j++) { /* the first run is for warming up */
+            micro_context_t *const ctx = micro_create(NULL);
+            const double t = bench_now();
+            const size_t n = g_benchmarks[i].function(ctx, iterations);
+            if (j > 0) v[j - 1] = (bench_now() - t) / (double)((n > 0) ? n : 1);
+            micro_destroy(ctx);
+        }
+        bench_print_statistics(22, g_benchmarks[i].name, v, runs, "ns/op", 1e9);
+    }
+    free(text);
+    free(v);
+    return 0;
+}
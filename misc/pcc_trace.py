@@ -0,0 +1,109 @@
+# Copyright (c) 2024-2026 Arihiro Yoshida. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+
+from typing import BinaryIO, Iterator
+import argparse
+import struct
+import sys
+
+TRACE_MAGIC: bytes = b'PCCTRACE'
+TRACE_VERSION: int = 1
+TRACE_EVENTS: list[str] = ['EVALUATE', 'MATCH', 'NOMATCH']
+
+
+class Trace:
+    def __init__(self, rules: list[str], records: list[tuple[int, int, int, int]], dropped: int) -> None:
+        self.rules: list[str] = rules
+        self.records: list[tuple[int, int, int, int]] = records  # (pos, rule, level, event)
+        self.dropped: int = dropped
+
+
+def read_exactly(f: BinaryIO, n: int) -> bytes:
+    b: bytes = f.read(n)
+    if len(b) != n:
+        raise ValueError('Premature end of trace')
+    return b
+
+
+def read_trace(f: BinaryIO) -> Trace:
+    if read_exactly(f, 8) != TRACE_MAGIC:
+        raise ValueError('Not a trace written by <prefix>_write_trace()')
+    ver, nrules, nrecords, dropped = struct.unpack('<IIQQ', read_exactly(f, 24))
+    if ver != TRACE_VERSION:
+        raise ValueError('Unsupported trace version: ' + str(ver))
+    rules: list[str] = []
+    for _ in range(nrules):
+        (n,) = struct.unpack('<I', read_exactly(f, 4))
+        rules.append(read_exactly(f, n).decode('utf-8', 'replace'))
+    records: list[tuple[int, int, int, int]] = []
+    for _ in range(nrecords):
+        pos, rule, level, event, _r = struct.unpack('<QIHBB', read_exactly(f, 16))
+        records.append((pos, rule, level, event))
+    return Trace(rules, records, dropped)
+
+
+def rule_name(trace: Trace, rule: int) -> str:
+    return trace.rules[rule] if rule < len(trace.rules) else '#' + str(rule)
+
+
+def generate_folded(trace: Trace) -> Iterator[str]:
+    # The stack is reconstructed from the levels, so that the frames evaluated before
+    # the oldest record in the ring buffer are shown as '?'.
+    stack: list[str] = []
+    counts: dict[str, int] = {}
+    for _pos, rule, level, event in trace.records:
+        del stack[level:]
+        if event == 0:
+            stack.extend(['?'] * (level - len(stack)))
+            stack.append(rule_name(trace, rule))
+            key: str = ';'.join(stack)
+            counts[key] = counts.get(key, 0) + 1
+    for key in sorted(counts):
+        yield key + ' ' + str(counts[key])
+
+
+def generate_timeline(trace: Trace) -> Iterator[str]:
+    yield 'index,rule,event,level,pos'
+    for i, (pos, rule, level, event) in enumerate(trace.records, trace.dropped):
+        ev: str = TRACE_EVENTS[event] if event < len(TRACE_EVENTS) else str(event)
+        yield ','.join([str(i), rule_name(trace, rule), ev, str(level), str(pos)])
+
+
+def main() -> None:
+    parser: argparse.ArgumentParser = argparse.ArgumentParser(
+        description='Convert a trace written by <prefix>_write_trace() of a parser generated with --trace.'
+    )
+    parser.add_argument('file', help='the trace file')
+    parser.add_argument(
+        '-m', '--mode', choices=['folded', 'timeline'], default='folded',
+        help='"folded" for folded stacks to be input to flame graph tools (default), "timeline" for CSV of the events'
+    )
+    args: argparse.Namespace = parser.parse_args()
+    with open(args.file, 'rb') as f:
+        trace: Trace = read_trace(f)
+    if trace.dropped > 0:
+        print('Warning: ' + str(trace.dropped) + ' oldest records were overwritten', file=sys.stderr)
+    for line in (generate_folded(trace) if args.mode == 'folded' else generate_timeline(trace)):
+        print(line)
+
+
+if __name__ == '__main__':
+    main()
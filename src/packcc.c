@@ -148,6 +148,9 @@ DECLSPEC_IMPORT HRESULT WINAPI SHGetFolderPathA(HWND hwnd, int csidl, HANDLE hTo
 
 #define VOID_VALUE (~(size_t)0)
 
+#define DFA_STATE_NONE (-1)
+#define DFA_STATE_MAX 1024 /* the maximum number of the states to compile a regular subexpression into an automaton */
+
 #ifdef _WIN64 /* 64-bit Windows including MSVC and MinGW-w64 */
 #define FMT_LU "%llu"
 typedef unsigned long long ulong_t;
@@ -176,22 +179,27 @@ typedef struct file_pos_tag {
     size_t col;  /* the column number (0-based); VOID_VALUE if not available */
 } file_pos_t;
 
-typedef struct stream_tag {
-    FILE *file;       /* the file stream; just a reference */
-    const char *path; /* the file path name */
-    size_t line;      /* the current line number (0-based); line counting is disabled if VOID_VALUE */
-} stream_t;
-
 typedef struct char_array_tag {
     size_t m, n;
     char *p;
 } char_array_t;
 
+typedef struct stream_tag {
+    char_array_t text; /* the output text buffered until it is written to the file at once */
+    const char *path;  /* the file path name */
+    size_t line;       /* the current line number (0-based); line counting is disabled if VOID_VALUE */
+} stream_t;
+
 typedef struct string_array_tag {
     size_t m, n;
     char **p;
 } string_array_t;
 
+typedef struct size_array_tag {
+    size_t m, n;
+    size_t *p;
+} size_array_t;
+
 typedef struct file_info_tag {
     char *path;
     char *version;
@@ -201,6 +209,8 @@ typedef struct file_info_tag {
 typedef struct file_info_map_tag {
     size_t m, n;
     file_info_t *p;
+    size_t d;  /* the bit mask of the hash table size */
+    size_t *h; /* the hash table of the indices in 'p'; VOID_VALUE if empty */
 } file_info_map_t;
 
 typedef struct code_block_tag {
@@ -214,6 +224,30 @@ typedef struct code_block_array_tag {
     code_block_t *p;
 } code_block_array_t;
 
+typedef enum code_flag_tag {
+    CODE_FLAG_NONE = 0,
+    CODE_FLAG_RULE_VARIABLE  = 0x00000001,
+    CODE_FLAG_CAPTS          = 0x00000002,
+    CODE_FLAG_REFERENCE      = 0x00000010,
+    CODE_FLAG_STRING         = 0x00000020,
+    CODE_FLAG_CHARCLASS      = 0x00000040,
+    CODE_FLAG_UTF8_CHARCLASS = 0x00000080,
+    CODE_FLAG_POSITION       = 0x00000100,
+    CODE_FLAG_QUANTITY       = 0x00000200,
+    CODE_FLAG_PREDICATE      = 0x00000400,
+    CODE_FLAG_PROGPRED       = 0x00000800,
+    CODE_FLAG_SEQUENCE       = 0x00001000,
+    CODE_FLAG_ALTERNATE      = 0x00002000,
+    CODE_FLAG_CAPTURE        = 0x00004000,
+    CODE_FLAG_MATCH_CAPT     = 0x00008000,
+    CODE_FLAG_MATCH_MVAR     = 0x00010000,
+    CODE_FLAG_ACTION         = 0x00020000,
+    CODE_FLAG_ERROR          = 0x00040000,
+    CODE_FLAG_RECOGNITION    = 0x00080000,
+    CODE_FLAG_LEFT_RECURSION = 0x00100000,
+    CODE_FLAG_EVALUATION     = 0x00200000
+} code_flag_t;
+
 typedef enum node_type_tag {
     NODE_RULE = 0,
     NODE_REFERENCE,
@@ -255,10 +289,18 @@ typedef struct node_rule_tag {
     node_t *expr;
     int ref; /* mutable under make_rulehash(), link_references(), and unreference_rules_from_unused_rule() */
     bool_t used; /* mutable under mark_rules_if_used() */
+    bool_t nullable; /* mutable under mark_rules_if_nullable() */
+    bool_t regular; /* mutable under mark_rules_if_regular(); the rule can be inlined into deterministic finite automata if true */
+    bool_t eval; /* mutable under mark_rules_if_recognized(); the evaluation function is generated if true */
+    bool_t recog; /* mutable under mark_rules_if_recognized(); the recognition function is generated if true */
+    size_t cycle; /* mutable under mark_rules_if_left_recursive(); the 1-based index of the mutually left-recursive rule group, or 0 if not left-recursive */
+    code_flag_t flags; /* the bitwise flags of the rule and all rules reachable from it; mutable under mark_rules_if_left_recursive() and update_rule_code_flags() */
+    size_t index; /* mutable under parse(); the 0-based index in the rule array after removing unused rules */
     node_const_array_t rvars;
     node_const_array_t capts;
     node_const_array_t codes;
     node_const_array_t preds;
+    node_hash_table_t rvarhash; /* mutable under parse_primary(); the hash table to accelerate access of 'rvars' by identifier */
     file_pos_t fpos;
 } node_rule_t;
 
@@ -290,6 +332,7 @@ typedef struct node_quantity_tag {
 
 typedef struct node_predicate_tag {
     bool_t neg;
+    bool_t recog; /* mutable under mark_rules_if_recognized(); recognition-only code is generated if true */
     node_t *expr;
 } node_predicate_t;
 
@@ -326,6 +369,7 @@ typedef struct node_match_mvar_tag {
 typedef struct node_action_tag {
     code_block_t code;
     size_t index;
+    bool_t eval; /* mutable under mark_rules_if_recognized(); the action function is generated if true */
     node_const_array_t rvars;
     node_const_array_t capts;
 } node_action_t;
@@ -334,6 +378,7 @@ typedef struct node_error_tag {
     node_t *expr;
     code_block_t code;
     size_t index;
+    bool_t eval; /* mutable under mark_rules_if_recognized(); the action function is generated if true */
     node_const_array_t rvars;
     node_const_array_t capts;
 } node_error_t;
@@ -365,29 +410,19 @@ typedef struct options_tag {
     bool_t ascii; /* UTF-8 support is disabled if true  */
     bool_t lines; /* #line directives are output if true */
     bool_t debug; /* debug information is output if true */
+    bool_t recog; /* only the recognition code is output if true */
+    bool_t whole; /* the whole input is read before parsing if true */
+    bool_t feed;  /* the input is fed by the push-style API instead of being read if true */
+    bool_t profile; /* the per-rule profiling counters are output if true */
+    bool_t trace;   /* the trace recorder of the rule evaluation events is output if true */
+    bool_t memory;  /* the API functions to trim the memory pools and to get their statistics are output if true */
+    bool_t bytecode; /* the rules are compiled into bytecode run by an interpreter instead of C code if true */
+    bool_t dfa;      /* the regular subexpressions are compiled into deterministic finite automata if true */
+    size_t units;   /* the number of the C source files among which the rule functions are distributed */
+    const char *runtime; /* the base name of the runtime source and header files shared by parsers, or NULL if the runtime is embedded */
+    const char *export_prefix; /* the prefix replacing 'pcc' in the names of the functions exported by the shared runtime, or NULL if not replaced */
 } options_t;
 
-typedef enum code_flag_tag {
-    CODE_FLAG_NONE = 0,
-    CODE_FLAG_RULE_VARIABLE  = 0x00000001,
-    CODE_FLAG_CAPTS          = 0x00000002,
-    CODE_FLAG_REFERENCE      = 0x00000010,
-    CODE_FLAG_STRING         = 0x00000020,
-    CODE_FLAG_CHARCLASS      = 0x00000040,
-    CODE_FLAG_UTF8_CHARCLASS = 0x00000080,
-    CODE_FLAG_POSITION       = 0x00000100,
-    CODE_FLAG_QUANTITY       = 0x00000200,
-    CODE_FLAG_PREDICATE      = 0x00000400,
-    CODE_FLAG_PROGPRED       = 0x00000800,
-    CODE_FLAG_SEQUENCE       = 0x00001000,
-    CODE_FLAG_ALTERNATE      = 0x00002000,
-    CODE_FLAG_CAPTURE        = 0x00004000,
-    CODE_FLAG_MATCH_CAPT     = 0x00008000,
-    CODE_FLAG_MATCH_MVAR     = 0x00010000,
-    CODE_FLAG_ACTION         = 0x00020000,
-    CODE_FLAG_ERROR          = 0x00040000
-} code_flag_t;
-
 typedef struct subst_entry_tag {
     char *istr; /* the string to be replaced */
     char *ostr; /* the string to be used for replacement */
@@ -407,21 +442,29 @@ struct input_state_tag {
     code_flag_t flags; /* the bitwise flags to control code generation; updated during PEG parsing */
     size_t errnum;     /* the current number of PEG parsing errors */
     size_t linenum;    /* the current line number (0-based) */
-    size_t charnum;    /* the number of characters in the current line that are already flushed (0-based, UTF-8 support if not disabled) */
     size_t linepos;    /* the beginning position in the PEG file of the current line */
+    size_t colline;    /* the beginning position of the line in which the column number was last computed */
+    size_t colpos;     /* the position in the PEG file at which the column number was last computed */
+    size_t colnum;     /* the column number last computed (0-based, UTF-8 support if not disabled) */
     size_t bufpos;     /* the position in the PEG file of the first character currently buffered */
     size_t bufcur;     /* the current parsing position in the character buffer */
-    char_array_t buffer;   /* the character buffer */
+    char_array_t text;     /* the whole content of the PEG file, read at once */
+    char_array_t buffer;   /* the character buffer; the part of the text from 'bufpos', just a reference */
     input_state_t *parent; /* the input state of the parent PEG file that imports the input; just a reference */
 };
 
 typedef struct context_tag {
     char *spath;  /* the path name of the C source file being generated */
     char *hpath;  /* the path name of the C header file being generated */
+    char *ppath;  /* the path name of the private C header file shared by the C source files, or NULL if not split */
+    string_array_t upaths; /* the path names of the C source files other than the main one if split */
+    char *rspath; /* the path name of the C source file of the shared runtime, or NULL if the runtime is embedded */
+    char *rhpath; /* the path name of the C header file of the shared runtime, or NULL if the runtime is embedded */
     char *hid;    /* the macro name for the include guard of the C header file */
     char *vtype;  /* the type name of the data output by the parsing API function (NULL means the default) */
     char *atype;  /* the type name of the user-defined data passed to the parser creation API function (NULL means the default) */
     char *prefix; /* the prefix of the API function names (NULL means the default) */
+    char *split;  /* the name of the rule after whose matches the input text can be split (NULL means no splitting) */
     string_array_t mvars; /* the marker variable identifiers */
     const string_array_t *dirs; /* the path names of directories to search for import files */
     options_t opts;       /* the options */
@@ -439,12 +482,101 @@ typedef struct context_tag {
     code_block_array_t fsource; /* the code fragments after %% directive to be added into the generated source file */
 } context_t;
 
+typedef enum code_mode_tag {
+    CODE_MODE_NORMAL = 0,  /* the code creating thunks in a rule evaluation function */
+    CODE_MODE_PREDICATE,   /* the recognition-only code in a rule evaluation function */
+    CODE_MODE_RECOGNITION  /* the recognition-only code in a rule recognition function */
+} code_mode_t;
+
+typedef enum bytecode_op_tag {
+    BYTECODE_OP_SUCCEED = 0, /* returns true */
+    BYTECODE_OP_FAIL,        /* returns false */
+    BYTECODE_OP_JUMP,        /* (address) jumps unconditionally */
+    BYTECODE_OP_STRING,      /* (offset, length, address) matches a string in the string table */
+    BYTECODE_OP_SET,         /* (offset, address) matches a character in the 256-bit set in the string table */
+    BYTECODE_OP_ANY,         /* (address) matches any character */
+    BYTECODE_OP_UTF8,        /* (offset, count, address) matches a UTF-8 character in the ranges in the range table */
+    BYTECODE_OP_UTF8_NOT,    /* (offset, count, address) matches a UTF-8 character not in the ranges in the range table */
+    BYTECODE_OP_POSITION,    /* (position, address) matches the absolute position */
+    BYTECODE_OP_APPLY,       /* (rule, variable, address) evaluates a rule; the variable is the 1-based rule variable index or 0 */
+    BYTECODE_OP_RECOGNIZE,   /* (rule, cycle, address) recognizes a rule */
+    BYTECODE_OP_SAVE,        /* (slot) saves the current position */
+    BYTECODE_OP_SAVE_THUNKS, /* (slot) saves the number of the thunks */
+    BYTECODE_OP_SAVE_MARKERS, /* saves the marker variables */
+    BYTECODE_OP_RESTORE,     /* (slot) restores the current position */
+    BYTECODE_OP_RESTORE_THUNKS, /* (slot) reverts the thunks */
+    BYTECODE_OP_RESTORE_MARKERS, /* restores the marker variables */
+    BYTECODE_OP_ZERO,        /* (slot) clears the counter */
+    BYTECODE_OP_INCREMENT,   /* (slot) increments the counter */
+    BYTECODE_OP_AT_LEAST,    /* (slot, count, address) jumps if the counter is not less than the count */
+    BYTECODE_OP_UNMOVED,     /* (slot, address) jumps if the current position is the saved one */
+    BYTECODE_OP_CAPTURE,     /* (capture, slot) sets the capture from the saved position to the current one */
+    BYTECODE_OP_MATCH_CAPT,  /* (capture, address) matches the captured string */
+    BYTECODE_OP_MATCH_MVAR,  /* (marker, address) matches the value of the marker variable */
+    BYTECODE_OP_ACTION,      /* (action) adds a thunk of the action */
+    BYTECODE_OP_ERROR,       /* (action) executes the error action immediately */
+    BYTECODE_OP_PREDICATE,   /* (predicate, negation, address) calls the programmable predicate */
+    BYTECODE_OP_COUNT
+} bytecode_op_t;
+
+typedef struct bytecode_op_info_tag {
+    const char *name; /* the enumerator name in the generated code */
+    size_t operands;  /* the number of the operands */
+} bytecode_op_info_t;
+
+typedef struct bytecode_tag {
+    size_array_t code;     /* the instructions, each of which is an operation code followed by its operands */
+    char_array_t strings;  /* the strings and the character sets for the signed 'char' type */
+    char_array_t ustrings; /* the same as 'strings' except the character sets for the unsigned 'char' type */
+    bool_t signedness;     /* 'strings' and 'ustrings' differ if true */
+    size_array_t ranges;   /* the pairs of the first and last code points of the UTF-8 character ranges */
+    size_array_t labels;   /* the code addresses of the labels in the rule being compiled; VOID_VALUE if not placed yet */
+    size_array_t fixups;   /* the code addresses of the label operands in the rule being compiled */
+    size_t chars[256];     /* the offsets of the single characters in 'strings'; VOID_VALUE if not added yet */
+    size_t actions;        /* the action table index of the first action of the rule being compiled */
+    size_t preds;          /* the predicate table index of the first programmable predicate of the rule being compiled */
+    size_t slot;           /* the number of the slots in use */
+    size_t slotm;          /* the maximum number of the slots in use at a time */
+    bool_t used[BYTECODE_OP_COUNT]; /* the operation codes in use */
+    const string_array_t *mvars; /* the marker variable identifiers; just a reference */
+} bytecode_t;
+
+typedef struct dfa_state_tag {
+    int next[256];  /* the next states by the respective bytes; DFA_STATE_NONE if no transition */
+    int first;      /* the state tried first if merged, or DFA_STATE_NONE if not merged */
+    int second;     /* the state tried if the first state has no transition by the byte, if merged */
+    bool_t accept;  /* the match succeeds if no transition is taken, if true */
+    bool_t ordered; /* both of the merged states are tried in parallel, and the first one to succeed takes priority, if true */
+} dfa_state_t;
+
+typedef struct dfa_tag {
+    size_t m, n;
+    dfa_state_t *p;
+} dfa_t;
+
+typedef struct regular_traits_tag {
+    bool_t nullable;         /* can succeed without consuming any character */
+    bool_t infallible;       /* never fails */
+    bool_t committed;        /* never fails after consuming the first character */
+    bool_t trivial;          /* matches a fixed sequence of characters */
+    bool_t ordered;          /* contains an ordered choice whose alternatives are tried in parallel */
+    size_t states;           /* the number of the automaton states to be built, except the final one */
+    unsigned char first[32]; /* the set of the bytes with which the node can start */
+} regular_traits_t;
+
 typedef struct generate_tag {
     stream_t *stream;
     const node_t *rule;
     int label;
     bool_t ascii;
     bool_t mvars;
+    bool_t whole; /* the input buffer is terminated with a sentinel if true */
+    bool_t profile; /* the rule index is passed to the rule application if true */
+    bool_t trace; /* the rule evaluation events are recorded if true */
+    bool_t dfa; /* the regular subexpressions are matched by deterministic finite automata if true */
+    const char *vtype; /* the output value type to which the opaque values of the shared runtime are cast, or NULL if the runtime is embedded */
+    code_mode_t mode;
+    bytecode_t *bytecode; /* the bytecode being compiled, or NULL if C code is generated */
 } generate_t;
 
 typedef enum string_flag_tag {
@@ -469,6 +601,36 @@ typedef enum code_block_kind_tag {
 
 static const char *g_cmdname = "packcc"; /* replaced later with actual one */
 
+static const bytecode_op_info_t g_bytecode_ops[BYTECODE_OP_COUNT] = {
+    { "PCC_OP_SUCCEED", 0 },
+    { "PCC_OP_FAIL", 0 },
+    { "PCC_OP_JUMP", 1 },
+    { "PCC_OP_STRING", 3 },
+    { "PCC_OP_SET", 2 },
+    { "PCC_OP_ANY", 1 },
+    { "PCC_OP_UTF8", 3 },
+    { "PCC_OP_UTF8_NOT", 3 },
+    { "PCC_OP_POSITION", 2 },
+    { "PCC_OP_APPLY", 3 },
+    { "PCC_OP_RECOGNIZE", 3 },
+    { "PCC_OP_SAVE", 1 },
+    { "PCC_OP_SAVE_THUNKS", 1 },
+    { "PCC_OP_SAVE_MARKERS", 0 },
+    { "PCC_OP_RESTORE", 1 },
+    { "PCC_OP_RESTORE_THUNKS", 1 },
+    { "PCC_OP_RESTORE_MARKERS", 0 },
+    { "PCC_OP_ZERO", 1 },
+    { "PCC_OP_INCREMENT", 1 },
+    { "PCC_OP_AT_LEAST", 3 },
+    { "PCC_OP_UNMOVED", 2 },
+    { "PCC_OP_CAPTURE", 2 },
+    { "PCC_OP_MATCH_CAPT", 2 },
+    { "PCC_OP_MATCH_MVAR", 2 },
+    { "PCC_OP_ACTION", 1 },
+    { "PCC_OP_ERROR", 1 },
+    { "PCC_OP_PREDICATE", 3 }
+};
+
 static size_t size__sub(size_t a, size_t b) {
     return (a > b) ? a - b : 0;
 }
@@ -514,13 +676,22 @@ static int fclose_e(FILE *file, const char *path) {
     return r;
 }
 
-static int fgetc_e(FILE *file, const char *path) {
-    const int c = fgetc(file);
-    if (c == EOF && ferror(file)) {
+static size_t fwrite_e(const void *ptr, size_t size, FILE *file, const char *path) {
+    const size_t n = fwrite(ptr, 1, size, file);
+    if (n < size) {
+        print_error("File write error: %s\n", path);
+        exit(2);
+    }
+    return n;
+}
+
+static size_t fread_e(void *ptr, size_t size, FILE *file, const char *path) {
+    const size_t n = fread(ptr, 1, size, file);
+    if (n < size && ferror(file)) {
         print_error("File read error: %s\n", path);
         exit(2);
     }
-    return c;
+    return n;
 }
 
 static void *malloc_e(size_t size) {
@@ -1251,12 +1422,24 @@ static char *add_fileext(const char *path, const char *ext) {
     return s;
 }
 
-static size_t hash_string(const char *str) {
-    size_t i, h = 0;
+static char *insert_before_fileext(const char *path, const char *str) {
+    const char *const p = extract_fileext(path);
+    const size_t m = p - path;
+    const size_t n = strlen(str);
+    const size_t l = strlen(p);
+    char *const s = (char *)malloc_e(m + n + l + 1);
+    memcpy(s, path, m);
+    memcpy(s + m, str, n);
+    memcpy(s + m + n, p, l + 1);
+    return s;
+}
+
+static size_t hash_string(const char *str) { /* FNV-1a */
+    size_t i, h = 2166136261U;
     for (i = 0; str[i]; i++) {
-        h = h * 31 + str[i];
+        h = (h ^ (size_t)(unsigned char)str[i]) * 16777619U;
     }
-    return h;
+    return h ^ (h >> 15); /* for the lower bits used as a table index */
 }
 
 static size_t populate_bits(size_t x) {
@@ -1318,9 +1501,9 @@ static void char_array__clear(char_array_t *obj) {
     obj->n = 0;
 }
 
-static void char_array__add(char_array_t *obj, char ch) {
-    if (obj->m <= obj->n) {
-        const size_t n = obj->n + 1;
+static void char_array__reserve(char_array_t *obj, size_t len) { /* makes room for 'len' more characters */
+    const size_t n = obj->n + len;
+    if (obj->m < n) {
         size_t m = obj->m;
         if (m == 0) m = BUFFER_MIN_SIZE;
         while (m < n && m != 0) m <<= 1;
@@ -1328,7 +1511,12 @@ static void char_array__add(char_array_t *obj, char ch) {
         obj->p = (char *)realloc_e(obj->p, m);
         obj->m = m;
     }
-    obj->p[obj->n++] = ch;
+}
+
+static void char_array__append(char_array_t *obj, const char *str, size_t len) {
+    char_array__reserve(obj, len);
+    if (len > 0) memcpy(obj->p + obj->n, str, len);
+    obj->n += len;
 }
 
 static void char_array__set_chars(char_array_t *obj, const char *str, size_t len) {
@@ -1345,6 +1533,23 @@ static void char_array__set_chars(char_array_t *obj, const char *str, size_t len
     if (n > 0) memcpy(obj->p, str, n);
 }
 
+static void char_array__read_file(char_array_t *obj, FILE *file, const char *path) {
+    for (;;) {
+        size_t n;
+        if (obj->m <= obj->n) {
+            size_t m = obj->m;
+            if (m == 0) m = BUFFER_MIN_SIZE;
+            else m <<= 1;
+            if (m <= obj->n) m = obj->n + BUFFER_MIN_SIZE; /* in case of shift overflow */
+            obj->p = (char *)realloc_e(obj->p, m);
+            obj->m = m;
+        }
+        n = fread_e(obj->p + obj->n, obj->m - obj->n, file, path);
+        if (n == 0) break;
+        obj->n += n;
+    }
+}
+
 static void string_array__initialize(string_array_t *obj) {
     obj->m = 0;
     obj->n = 0;
@@ -1370,6 +1575,29 @@ static void string_array__add(string_array_t *obj, const char *str, size_t len)
     obj->p[obj->n++] = (len == VOID_VALUE) ? strdup_e(str) : strndup_e(str, len);
 }
 
+static void size_array__initialize(size_array_t *obj) {
+    obj->m = 0;
+    obj->n = 0;
+    obj->p = NULL;
+}
+
+static void size_array__finalize(size_array_t *obj) {
+    free(obj->p);
+}
+
+static void size_array__add(size_array_t *obj, size_t value) {
+    if (obj->m <= obj->n) {
+        const size_t n = obj->n + 1;
+        size_t m = obj->m;
+        if (m == 0) m = ARRAY_MIN_SIZE;
+        while (m < n && m != 0) m <<= 1;
+        if (m == 0) m = n; /* in case of shift overflow */
+        obj->p = (size_t *)realloc_e(obj->p, sizeof(size_t) * m);
+        obj->m = m;
+    }
+    obj->p[obj->n++] = value;
+}
+
 static void file_pos__initialize(file_pos_t *obj) {
     obj->path = NULL;
     obj->line = VOID_VALUE;
@@ -1420,6 +1648,18 @@ static bool_t file_id__equals(const file_id_t *id0, const file_id_t *id1) {
 #endif
 }
 
+static size_t file_id__hash(const file_id_t *id) {
+#ifdef _WIN32 /* Windows including MSVC and MinGW */
+    size_t h = (size_t)id->dwVolumeSerialNumber;
+    h = h * 16777619U ^ (size_t)id->nFileIndexHigh;
+    h = h * 16777619U ^ (size_t)id->nFileIndexLow;
+#else
+    size_t h = (size_t)id->st_dev;
+    h = h * 16777619U ^ (size_t)id->st_ino;
+#endif
+    return h ^ (h >> 15);
+}
+
 static void file_info__initialize(file_info_t *obj) {
     obj->path = NULL;
     obj->version = NULL;
@@ -1434,6 +1674,8 @@ static void file_info_map__initialize(file_info_map_t *obj) {
     obj->m = 0;
     obj->n = 0;
     obj->p = NULL;
+    obj->d = 0;
+    obj->h = NULL;
 }
 
 static void file_info_map__finalize(file_info_map_t *obj) {
@@ -1442,14 +1684,38 @@ static void file_info_map__finalize(file_info_map_t *obj) {
         file_info__finalize(&(obj->p[obj->n]));
     }
     free(obj->p);
+    free(obj->h);
+}
+
+static void file_info_map__rehash(file_info_map_t *obj) {
+    size_t i, j;
+    obj->d = populate_bits(obj->n * 4);
+    obj->h = (size_t *)realloc_e(obj->h, sizeof(size_t) * (obj->d + 1));
+    for (j = 0; j <= obj->d; j++) {
+        obj->h[j] = VOID_VALUE;
+    }
+    for (i = 0; i < obj->n; i++) {
+        j = file_id__hash(&(obj->p[i].id)) & obj->d;
+        while (obj->h[j] != VOID_VALUE) {
+            j = (j + 1) & obj->d;
+        }
+        obj->h[j] = i;
+    }
 }
 
 static bool_t file_info_map__get(file_info_map_t *obj, FILE *file, const char *path, size_t *index) {
-    size_t i;
+    size_t i = obj->n;
     file_id_t id;
     file_id__get(file, path, &id);
-    for (i = 0; i < obj->n; i++) {
-        if (file_id__equals(&id, &(obj->p[i].id))) break;
+    if (obj->h) {
+        size_t j = file_id__hash(&id) & obj->d;
+        while (obj->h[j] != VOID_VALUE) {
+            if (file_id__equals(&id, &(obj->p[obj->h[j]].id))) {
+                i = obj->h[j];
+                break;
+            }
+            j = (j + 1) & obj->d;
+        }
     }
     if (i < obj->n) { /* already exists */
         if (index) *index = i;
@@ -1469,6 +1735,14 @@ static bool_t file_info_map__get(file_info_map_t *obj, FILE *file, const char *p
         file_info__initialize(&(obj->p[i]));
         obj->p[i].id = id;
         obj->p[i].path = strdup_e(path);
+        if (obj->n * 2 > obj->d) file_info_map__rehash(obj); /* keeps the load factor below 1/2 */
+        else {
+            size_t j = file_id__hash(&id) & obj->d;
+            while (obj->h[j] != VOID_VALUE) {
+                j = (j + 1) & obj->d;
+            }
+            obj->h[j] = i;
+        }
         if (index) *index = i;
         return FALSE;
     }
@@ -1622,11 +1896,17 @@ static input_state_t *input_state__create(const char *path, FILE *file, input_st
     obj->flags = CODE_FLAG_NONE;
     obj->errnum = 0;
     obj->linenum = 0;
-    obj->charnum = 0;
     obj->linepos = 0;
+    obj->colline = 0;
+    obj->colpos = 0;
+    obj->colnum = 0;
     obj->bufpos = 0;
     obj->bufcur = 0;
-    char_array__initialize(&(obj->buffer));
+    char_array__initialize(&(obj->text));
+    char_array__read_file(&(obj->text), obj->file, obj->path);
+    obj->buffer.m = 0;
+    obj->buffer.n = obj->text.n;
+    obj->buffer.p = obj->text.p;
     obj->parent = parent;
     return obj;
 }
@@ -1635,7 +1915,7 @@ static input_state_t *input_state__destroy(input_state_t *obj) {
     input_state_t *parent;
     if (obj == NULL) return NULL;
     parent = obj->parent;
-    char_array__finalize(&(obj->buffer));
+    char_array__finalize(&(obj->text));
     fclose_e(obj->file, obj->path);
     free(obj->path);
     free(obj);
@@ -1646,32 +1926,32 @@ static bool_t input_state__is_in_imported(const input_state_t *obj) {
     return obj->parent ? TRUE : FALSE;
 }
 
-static size_t input_state__column_number(const input_state_t *obj) { /* 0-based */
-    assert(obj->bufpos + obj->bufcur >= obj->linepos);
-    if (obj->ascii)
-        return obj->charnum + obj->bufcur - size__sub(obj->linepos, obj->bufpos);
+static size_t input_state__column_number(input_state_t *obj) { /* 0-based */
+    /* counts only the characters between the position of the last computation and the current one */
+    const size_t pos = obj->bufpos + obj->bufcur;
+    assert(pos >= obj->linepos);
+    if (obj->ascii) return pos - obj->linepos;
+    if (obj->colline != obj->linepos || obj->colpos < obj->linepos) {
+        obj->colline = obj->linepos;
+        obj->colpos = obj->linepos;
+        obj->colnum = 0;
+    }
+    if (pos >= obj->colpos)
+        obj->colnum += count_characters(obj->text.p, obj->colpos, pos);
     else
-        return obj->charnum + count_characters(
-            obj->buffer.p, size__sub(obj->linepos, obj->bufpos), obj->bufcur
-        );
+        obj->colnum = size__sub(obj->colnum, count_characters(obj->text.p, pos, obj->colpos));
+    obj->colpos = pos;
+    return obj->colnum;
 }
 
-static size_t input_state__refill_buffer(input_state_t *obj, size_t num) {
-    if (obj->buffer.n >= obj->bufcur + num) return obj->buffer.n - obj->bufcur;
-    while (obj->buffer.n < obj->bufcur + num) {
-        const int c = fgetc_e(obj->file, obj->path);
-        if (c == EOF) break;
-        char_array__add(&(obj->buffer), (char)c);
-    }
+static size_t input_state__refill_buffer(input_state_t *obj, size_t num) { /* the whole text is already in the buffer */
     return obj->buffer.n - obj->bufcur;
 }
 
 static void input_state__commit_buffer(input_state_t *obj) {
     assert(obj->buffer.n >= obj->bufcur);
-    if (obj->linepos < obj->bufpos + obj->bufcur)
-        obj->charnum += obj->ascii ? obj->bufcur : count_characters(obj->buffer.p, 0, obj->bufcur);
-    if (obj->bufcur < obj->buffer.n)
-        memmove(obj->buffer.p, obj->buffer.p + obj->bufcur, obj->buffer.n - obj->bufcur);
+    if (obj->bufcur == 0) return;
+    obj->buffer.p += obj->bufcur;
     obj->buffer.n -= obj->bufcur;
     obj->bufpos += obj->bufcur;
     obj->bufcur = 0;
@@ -1687,7 +1967,6 @@ static bool_t input_state__match_eol(input_state_t *obj) {
         case '\n':
             obj->bufcur++;
             obj->linenum++;
-            obj->charnum = 0;
             obj->linepos = obj->bufpos + obj->bufcur;
             return TRUE;
         case '\r':
@@ -1696,7 +1975,6 @@ static bool_t input_state__match_eol(input_state_t *obj) {
                 if (obj->buffer.p[obj->bufcur] == '\n') obj->bufcur++;
             }
             obj->linenum++;
-            obj->charnum = 0;
             obj->linepos = obj->bufpos + obj->bufcur;
             return TRUE;
         }
@@ -1764,7 +2042,11 @@ static bool_t input_state__match_space(input_state_t *obj) {
 
 static bool_t input_state__match_section_line_(input_state_t *obj, const char *head) {
     if (input_state__match_string(obj, head)) {
-        while (!input_state__match_eol(obj) && !input_state__match_eof(obj)) input_state__match_character_any(obj);
+        const char *const p = obj->buffer.p;
+        size_t i = obj->bufcur;
+        while (i < obj->buffer.n && p[i] != '\n' && p[i] != '\r') i++; /* skips the line body at once */
+        obj->bufcur = i;
+        input_state__match_eol(obj);
         return TRUE;
     }
     return FALSE;
@@ -1813,6 +2095,16 @@ static bool_t input_state__match_quotation_(input_state_t *obj, const char *left
                 obj->errnum++;
                 break;
             }
+            {
+                /* skips the characters other than the closing one, backslashes, and EOLs at once */
+                const char *const p = obj->buffer.p;
+                size_t i = obj->bufcur;
+                while (i < obj->buffer.n && p[i] != right[0] && p[i] != '\\' && p[i] != '\n' && p[i] != '\r') i++;
+                if (i > obj->bufcur) {
+                    obj->bufcur = i;
+                    continue;
+                }
+            }
             input_state__match_character(obj, '\\');
             if (input_state__match_eol(obj)) {
                 print_error("%s:" FMT_LU ":" FMT_LU ": Premature EOL in %s\n", obj->path, (ulong_t)(l + 1), (ulong_t)(m + 1), name);
@@ -1982,93 +2274,150 @@ static bool_t input_state__match_footer_start(input_state_t *obj) {
     return input_state__match_string(obj, "%%");
 }
 
-static stream_t stream__wrap(FILE *file, const char *path, size_t line) {
-    stream_t obj;
-    obj.file = file;
-    obj.path = path;
-    obj.line = line;
-    return obj;
+static void stream__initialize(stream_t *obj, const char *path, size_t line) {
+    char_array__initialize(&(obj->text));
+    obj->path = path;
+    obj->line = line;
 }
 
-static int stream__putc(stream_t *obj, int c) {
-    const int r = fputc(c, obj->file);
-    if (r == EOF) {
-        print_error("File write error: %s\n", obj->path);
-        exit(2);
-    }
+static void stream__finalize(stream_t *obj) {
+    char_array__finalize(&(obj->text));
+}
+
+static void stream__count_lines(stream_t *obj, size_t start) {
     if (obj->line != VOID_VALUE) {
-        if (c == '\n') obj->line++;
+        const char *p = obj->text.p + start;
+        const char *const e = obj->text.p + obj->text.n;
+        while (p < e && (p = (const char *)memchr(p, '\n', (size_t)(e - p))) != NULL) {
+            obj->line++;
+            p++;
+        }
     }
-    return r;
 }
 
-static int stream__puts(stream_t *obj, const char *s) {
-    const int r = fputs(s, obj->file);
-    if (r == EOF) {
-        print_error("File write error: %s\n", obj->path);
-        exit(2);
-    }
+static int stream__putc(stream_t *obj, int c) {
+    const char ch = (char)c;
+    char_array__append(&(obj->text), &ch, 1);
     if (obj->line != VOID_VALUE) {
-        size_t i = 0;
-        for (i = 0; s[i]; i++) {
-            if (s[i] == '\n') obj->line++;
-        }
+        if (ch == '\n') obj->line++;
     }
-    return r;
+    return (int)(unsigned char)ch;
+}
+
+static int stream__puts(stream_t *obj, const char *s) {
+    const size_t n = obj->text.n;
+    char_array__append(&(obj->text), s, strlen(s));
+    stream__count_lines(obj, n);
+    return 0;
 }
 
 __attribute__((format(printf, 2, 3)))
 static int stream__printf(stream_t *obj, const char *format, ...) {
-    if (obj->line != VOID_VALUE) {
-#define M 1024
-        char s[M], *p = NULL;
-        int n = 0;
-        size_t l = 0;
+    /* formats directly into the output text, and formats again only if the room is short */
+    const size_t k = obj->text.n;
+    int n = 0;
+    char_array__reserve(&(obj->text), BUFFER_MIN_SIZE);
+    {
+        va_list a;
+        va_start(a, format);
+        n = vsnprintf(obj->text.p + k, obj->text.m - k, format, a);
+        va_end(a);
+        if (n < 0) {
+            print_error("Internal error [%d]\n", __LINE__);
+            exit(2);
+        }
+    }
+    if ((size_t)n >= obj->text.m - k) {
+        char_array__reserve(&(obj->text), (size_t)n + 1);
         {
             va_list a;
             va_start(a, format);
-            n = vsnprintf(NULL, 0, format, a);
+            n = vsnprintf(obj->text.p + k, obj->text.m - k, format, a);
             va_end(a);
-            if (n < 0) {
+            if (n < 0 || (size_t)n >= obj->text.m - k) {
                 print_error("Internal error [%d]\n", __LINE__);
                 exit(2);
             }
-            l = (size_t)n + 1;
         }
-        p = (l > M) ? (char *)malloc_e(l) : s;
-        {
-            va_list a;
-            va_start(a, format);
-            n = vsnprintf(p, l, format, a);
-            va_end(a);
-            if (n < 0 || (size_t)n >= l) {
-                print_error("Internal error [%d]\n", __LINE__);
-                exit(2);
+    }
+    obj->text.n = k + (size_t)n;
+    stream__count_lines(obj, k);
+    return n;
+}
+
+static bool_t stream__flush(stream_t *obj) { /* writes the output text to the file; does nothing if the content of the file is the same */
+    {
+        FILE *const file = fopen(obj->path, "rt");
+        if (file) { /* compares the content piece by piece not to hold the whole file in memory */
+            char s[BUFFER_MIN_SIZE * 16];
+            size_t i = 0, n;
+            bool_t b = TRUE;
+            while (b && (n = fread_e(s, sizeof(s), file, obj->path)) > 0) {
+                if (n > obj->text.n - i || memcmp(s, obj->text.p + i, n) != 0) b = FALSE;
+                i += n;
             }
+            fclose_e(file, obj->path);
+            if (b && i == obj->text.n) return FALSE;
         }
-        stream__puts(obj, p);
-        if (p != s) free(p);
-        return n;
-#undef M
     }
-    else {
-        int n;
-        va_list a;
-        va_start(a, format);
-        n = vfprintf(obj->file, format, a);
-        va_end(a);
-        if (n < 0) {
-            print_error("File write error: %s\n", obj->path);
-            exit(2);
+    {
+        FILE *const file = fopen_wt_e(obj->path);
+        fwrite_e(obj->text.p, obj->text.n, file, obj->path);
+        fclose_e(file, obj->path);
+    }
+    return TRUE;
+}
+
+static void stream__export_functions(stream_t *obj, stream_t *decl, const char *prefix) {
+    /* removes 'static' from the function definitions and declarations, and writes the prototypes of the definitions to 'decl';
+       the macros renaming 'pcc_*' to 'prefix_*' precede the prototypes if 'prefix' is not NULL */
+    char_array_t t;
+    stream_t d;
+    size_t i = 0;
+    char_array__initialize(&t);
+    char_array__reserve(&t, obj->text.n);
+    stream__initialize(&d, NULL, VOID_VALUE);
+    while (i < obj->text.n) {
+        const char *const s = obj->text.p + i;
+        const char *const e = (const char *)memchr(s, '\n', obj->text.n - i);
+        const size_t n = e ? (size_t)(e - s) + 1 : obj->text.n - i;
+        size_t k = 0, h = 0, j;
+        if (n > 7 && strncmp(s, "static ", 7) == 0) {
+            for (h = 7; h < n && s[h] != '(' && s[h] != '='; h++);
+            if (h < n && s[h] == '(') k = 7; /* not a variable */
+        }
+        if (k > 0) {
+            for (j = k; j + 2 < n; j++) {
+                if (s[j] == ')' && s[j + 1] == ' ' && s[j + 2] == '{') {
+                    stream__printf(&d, "%.*s;\n", (int)(j + 1 - k), s + k);
+                    if (prefix) {
+                        size_t l = h;
+                        while (l > k && s[l - 1] != ' ' && s[l - 1] != '*') l--; /* the start of the function name */
+                        if (h - l > 4 && strncmp(s + l, "pcc_", 4) == 0)
+                            stream__printf(decl, "#define %.*s %s_%.*s\n", (int)(h - l), s + l, prefix, (int)(h - l - 4), s + l + 4);
+                    }
+                    break;
+                }
+            }
         }
-        return n;
+        char_array__append(&t, s + k, n - k);
+        i += n;
     }
+    if (prefix) stream__putc(decl, '\n');
+    char_array__append(&(decl->text), d.text.p, d.text.n);
+    stream__finalize(&d);
+    char_array__finalize(&(obj->text));
+    obj->text = t;
 }
 
 static void stream__write_characters(stream_t *obj, char ch, size_t len) {
     size_t i;
     if (len == VOID_VALUE) return; /* for safety */
-    for (i = 0; i < len; i++) stream__putc(obj, ch);
+    char_array__reserve(&(obj->text), len);
+    for (i = 0; i < len; i++) obj->text.p[obj->text.n++] = ch;
+    if (obj->line != VOID_VALUE) {
+        if (ch == '\n') obj->line += len;
+    }
 }
 
 static void stream__write_escaped_string(stream_t *obj, const char *str, size_t len) {
@@ -2565,9 +2914,26 @@ static context_t *create_context(const char *ipath, const char *opath, const str
     ctx->spath = (opath && opath[0]) ? add_fileext(opath, "c") : replace_fileext((ipath && ipath[0]) ? ipath : "-", "c");
     ctx->hpath = (opath && opath[0]) ? add_fileext(opath, "h") : replace_fileext((ipath && ipath[0]) ? ipath : "-", "h");
     ctx->hid = strdup_e(extract_filename(ctx->hpath)); make_header_identifier(ctx->hid);
+    ctx->ppath = NULL;
+    string_array__initialize(&(ctx->upaths));
+    if (opts->units > 1) {
+        size_t i;
+        char s[32];
+        ctx->ppath = insert_before_fileext(ctx->hpath, "_private");
+        for (i = 1; i < opts->units; i++) {
+            char *t;
+            sprintf(s, "_" FMT_LU, (ulong_t)i);
+            t = insert_before_fileext(ctx->spath, s);
+            string_array__add(&(ctx->upaths), t, VOID_VALUE);
+            free(t);
+        }
+    }
+    ctx->rspath = opts->runtime ? add_fileext(opts->runtime, "c") : NULL;
+    ctx->rhpath = opts->runtime ? add_fileext(opts->runtime, "h") : NULL;
     ctx->vtype = NULL;
     ctx->atype = NULL;
     ctx->prefix = NULL;
+    ctx->split = NULL;
     string_array__initialize(&(ctx->mvars));
     ctx->dirs = dirs;
     ctx->opts = *opts;
@@ -2592,10 +2958,15 @@ static void destroy_context(context_t *ctx) {
     if (ctx == NULL) return;
     free(ctx->spath);
     free(ctx->hpath);
+    free(ctx->ppath);
+    string_array__finalize(&(ctx->upaths));
+    free(ctx->rspath);
+    free(ctx->rhpath);
     free(ctx->hid);
     free(ctx->vtype);
     free(ctx->atype);
     free(ctx->prefix);
+    free(ctx->split);
     string_array__finalize(&(ctx->mvars));
     while (ctx->input) ctx->input = input_state__destroy(ctx->input);
     file_info_map__finalize(&(ctx->finfo));
@@ -2619,10 +2990,20 @@ static node_t *create_node(node_type_t type) {
         node->data.rule.expr = NULL;
         node->data.rule.ref = 0;
         node->data.rule.used = FALSE;
+        node->data.rule.nullable = FALSE;
+        node->data.rule.regular = FALSE;
+        node->data.rule.eval = FALSE;
+        node->data.rule.recog = FALSE;
+        node->data.rule.cycle = 0;
+        node->data.rule.flags = CODE_FLAG_NONE;
+        node->data.rule.index = VOID_VALUE;
         node_const_array__initialize(&(node->data.rule.rvars));
         node_const_array__initialize(&(node->data.rule.capts));
         node_const_array__initialize(&(node->data.rule.codes));
         node_const_array__initialize(&(node->data.rule.preds));
+        node->data.rule.rvarhash.d = 0;
+        node->data.rule.rvarhash.m = 0;
+        node->data.rule.rvarhash.p = NULL;
         file_pos__initialize(&(node->data.rule.fpos));
         break;
     case NODE_REFERENCE:
@@ -2647,6 +3028,7 @@ static node_t *create_node(node_type_t type) {
         break;
     case NODE_PREDICATE:
         node->data.predicate.neg = FALSE;
+        node->data.predicate.recog = FALSE;
         node->data.predicate.expr = NULL;
         break;
     case NODE_PROGPRED:
@@ -2676,6 +3058,7 @@ static node_t *create_node(node_type_t type) {
     case NODE_ACTION:
         code_block__initialize(&(node->data.action.code));
         node->data.action.index = VOID_VALUE;
+        node->data.action.eval = FALSE;
         node_const_array__initialize(&(node->data.action.rvars));
         node_const_array__initialize(&(node->data.action.capts));
         break;
@@ -2683,6 +3066,7 @@ static node_t *create_node(node_type_t type) {
         node->data.error.expr = NULL;
         code_block__initialize(&(node->data.error.code));
         node->data.error.index = VOID_VALUE;
+        node->data.error.eval = FALSE;
         node_const_array__initialize(&(node->data.error.rvars));
         node_const_array__initialize(&(node->data.error.capts));
         break;
@@ -2703,6 +3087,7 @@ static void destroy_node(node_t *node) {
         node_const_array__finalize(&(node->data.rule.capts));
         node_const_array__finalize(&(node->data.rule.codes));
         node_const_array__finalize(&(node->data.rule.preds));
+        free((node_t **)node->data.rule.rvarhash.p);
         file_pos__finalize(&(node->data.rule.fpos));
         break;
     case NODE_REFERENCE:
@@ -2868,17 +3253,17 @@ static void link_references(context_t *ctx, node_t *node) {
     }
 }
 
-static void mark_rules_if_used(context_t *ctx, node_t *node) {
+static void mark_rules_if_used_(context_t *ctx, node_t *node, node_const_array_t *rules) {
     if (node == NULL) return;
     switch (node->type) {
     case NODE_RULE:
-        if (!node->data.rule.used) {
-            node->data.rule.used = TRUE;
-            mark_rules_if_used(ctx, node->data.rule.expr);
-        }
-        break;
+        print_error("Internal error [%d]\n", __LINE__);
+        exit(-1);
     case NODE_REFERENCE:
-        mark_rules_if_used(ctx, (node_t *)node->data.reference.rule);
+        if (node->data.reference.rule && !node->data.reference.rule->data.rule.used) {
+            ((node_t *)node->data.reference.rule)->data.rule.used = TRUE;
+            node_const_array__add(rules, node->data.reference.rule); /* not recursive to handle a very long chain of rules */
+        }
         break;
     case NODE_STRING:
         break;
@@ -2887,10 +3272,10 @@ static void mark_rules_if_used(context_t *ctx, node_t *node) {
     case NODE_POSITION:
         break;
     case NODE_QUANTITY:
-        mark_rules_if_used(ctx, node->data.quantity.expr);
+        mark_rules_if_used_(ctx, node->data.quantity.expr, rules);
         break;
     case NODE_PREDICATE:
-        mark_rules_if_used(ctx, node->data.predicate.expr);
+        mark_rules_if_used_(ctx, node->data.predicate.expr, rules);
         break;
     case NODE_PROGPRED:
         break;
@@ -2898,7 +3283,7 @@ static void mark_rules_if_used(context_t *ctx, node_t *node) {
         {
             size_t i;
             for (i = 0; i < node->data.sequence.nodes.n; i++) {
-                mark_rules_if_used(ctx, node->data.sequence.nodes.p[i]);
+                mark_rules_if_used_(ctx, node->data.sequence.nodes.p[i], rules);
             }
         }
         break;
@@ -2906,12 +3291,12 @@ static void mark_rules_if_used(context_t *ctx, node_t *node) {
         {
             size_t i;
             for (i = 0; i < node->data.alternate.nodes.n; i++) {
-                mark_rules_if_used(ctx, node->data.alternate.nodes.p[i]);
+                mark_rules_if_used_(ctx, node->data.alternate.nodes.p[i], rules);
             }
         }
         break;
     case NODE_CAPTURE:
-        mark_rules_if_used(ctx, node->data.capture.expr);
+        mark_rules_if_used_(ctx, node->data.capture.expr, rules);
         break;
     case NODE_MATCH_CAPT:
         break;
@@ -2920,7 +3305,7 @@ static void mark_rules_if_used(context_t *ctx, node_t *node) {
     case NODE_ACTION:
         break;
     case NODE_ERROR:
-        mark_rules_if_used(ctx, node->data.error.expr);
+        mark_rules_if_used_(ctx, node->data.error.expr, rules);
         break;
     default:
         print_error("Internal error [%d]\n", __LINE__);
@@ -2928,6 +3313,18 @@ static void mark_rules_if_used(context_t *ctx, node_t *node) {
     }
 }
 
+static void mark_rules_if_used(context_t *ctx, node_t *rule) {
+    node_const_array_t a; /* the rules to be visited */
+    node_const_array__initialize(&a);
+    rule->data.rule.used = TRUE;
+    node_const_array__add(&a, rule);
+    while (a.n > 0) {
+        const node_t *const r = a.p[--a.n];
+        mark_rules_if_used_(ctx, r->data.rule.expr, &a);
+    }
+    node_const_array__finalize(&a);
+}
+
 static void unreference_rules_from_unused_rule(context_t *ctx, node_t *node) {
     if (node == NULL) return;
     switch (node->type) {
@@ -2986,26 +3383,17 @@ static void unreference_rules_from_unused_rule(context_t *ctx, node_t *node) {
     }
 }
 
-static void verify_rule_variables(context_t *ctx, node_t *node, node_const_array_t *rvars) {
-    node_const_array_t a;
-    const bool_t b = (rvars == NULL) ? TRUE : FALSE;
+static void verify_rule_variables_(context_t *ctx, node_t *node, node_const_array_t *rvars, bool_t *in) {
+    /* 'in' indicates whether each rule variable is in 'rvars' */
     if (node == NULL) return;
-    if (b) {
-        node_const_array__initialize(&a);
-        rvars = &a;
-    }
     switch (node->type) {
     case NODE_RULE:
         print_error("Internal error [%d]\n", __LINE__);
         exit(-1);
     case NODE_REFERENCE:
-        if (node->data.reference.index != VOID_VALUE) {
-            size_t i;
-            for (i = 0; i < rvars->n; i++) {
-                assert(rvars->p[i]->type == NODE_REFERENCE);
-                if (node->data.reference.index == rvars->p[i]->data.reference.index) break;
-            }
-            if (i == rvars->n) node_const_array__add(rvars, node);
+        if (node->data.reference.index != VOID_VALUE && !in[node->data.reference.index]) {
+            in[node->data.reference.index] = TRUE;
+            node_const_array__add(rvars, node);
         }
         break;
     case NODE_STRING:
@@ -3015,10 +3403,10 @@ static void verify_rule_variables(context_t *ctx, node_t *node, node_const_array
     case NODE_POSITION:
         break;
     case NODE_QUANTITY:
-        verify_rule_variables(ctx, node->data.quantity.expr, rvars);
+        verify_rule_variables_(ctx, node->data.quantity.expr, rvars, in);
         break;
     case NODE_PREDICATE:
-        verify_rule_variables(ctx, node->data.predicate.expr, rvars);
+        verify_rule_variables_(ctx, node->data.predicate.expr, rvars, in);
         break;
     case NODE_PROGPRED:
         break;
@@ -3026,31 +3414,33 @@ static void verify_rule_variables(context_t *ctx, node_t *node, node_const_array
         {
             size_t i;
             for (i = 0; i < node->data.sequence.nodes.n; i++) {
-                verify_rule_variables(ctx, node->data.sequence.nodes.p[i], rvars);
+                verify_rule_variables_(ctx, node->data.sequence.nodes.p[i], rvars, in);
             }
         }
         break;
     case NODE_ALTERNATE:
         {
-            size_t i, j, k, m = rvars->n;
-            node_const_array_t v;
+            size_t i, j, m = rvars->n;
+            node_const_array_t v; /* the rule variables found in the alternatives */
             node_const_array__initialize(&v);
-            node_const_array__copy(&v, rvars);
             for (i = 0; i < node->data.alternate.nodes.n; i++) {
-                v.n = m;
-                verify_rule_variables(ctx, node->data.alternate.nodes.p[i], &v);
-                for (j = m; j < v.n; j++) {
-                    for (k = m; k < rvars->n; k++) {
-                        if (v.p[j]->data.reference.index == rvars->p[k]->data.reference.index) break;
-                    }
-                    if (k == rvars->n) node_const_array__add(rvars, v.p[j]);
+                verify_rule_variables_(ctx, node->data.alternate.nodes.p[i], rvars, in);
+                for (j = m; j < rvars->n; j++) {
+                    in[rvars->p[j]->data.reference.index] = FALSE;
+                    node_const_array__add(&v, rvars->p[j]);
                 }
+                rvars->n = m;
+            }
+            for (j = 0; j < v.n; j++) {
+                if (in[v.p[j]->data.reference.index]) continue;
+                in[v.p[j]->data.reference.index] = TRUE;
+                node_const_array__add(rvars, v.p[j]);
             }
             node_const_array__finalize(&v);
         }
         break;
     case NODE_CAPTURE:
-        verify_rule_variables(ctx, node->data.capture.expr, rvars);
+        verify_rule_variables_(ctx, node->data.capture.expr, rvars, in);
         break;
     case NODE_MATCH_CAPT:
         break;
@@ -3061,25 +3451,30 @@ static void verify_rule_variables(context_t *ctx, node_t *node, node_const_array
         break;
     case NODE_ERROR:
         node_const_array__copy(&(node->data.error.rvars), rvars);
-        verify_rule_variables(ctx, node->data.error.expr, rvars);
+        verify_rule_variables_(ctx, node->data.error.expr, rvars, in);
         break;
     default:
         print_error("Internal error [%d]\n", __LINE__);
         exit(-1);
     }
-    if (b) {
-        node_const_array__finalize(&a);
-    }
 }
 
-static void verify_captures(context_t *ctx, node_t *node, node_const_array_t *capts) {
+static void verify_rule_variables(context_t *ctx, const node_rule_t *rule) {
     node_const_array_t a;
-    const bool_t b = (capts == NULL) ? TRUE : FALSE;
-    if (node == NULL) return;
-    if (b) {
-        node_const_array__initialize(&a);
-        capts = &a;
+    bool_t *const in = (bool_t *)malloc_e(sizeof(bool_t) * (rule->rvars.n + 1));
+    size_t i;
+    for (i = 0; i < rule->rvars.n; i++) {
+        in[i] = FALSE;
     }
+    node_const_array__initialize(&a);
+    verify_rule_variables_(ctx, rule->expr, &a, in);
+    node_const_array__finalize(&a);
+    free(in);
+}
+
+static void verify_captures_(context_t *ctx, const node_rule_t *rule, node_t *node, node_const_array_t *capts, bool_t *in) {
+    /* 'in' indicates whether each capture of the rule is in 'capts' */
+    if (node == NULL) return;
     switch (node->type) {
     case NODE_RULE:
         print_error("Internal error [%d]\n", __LINE__);
@@ -3093,10 +3488,10 @@ static void verify_captures(context_t *ctx, node_t *node, node_const_array_t *ca
     case NODE_POSITION:
         break;
     case NODE_QUANTITY:
-        verify_captures(ctx, node->data.quantity.expr, capts);
+        verify_captures_(ctx, rule, node->data.quantity.expr, capts, in);
         break;
     case NODE_PREDICATE:
-        verify_captures(ctx, node->data.predicate.expr, capts);
+        verify_captures_(ctx, rule, node->data.predicate.expr, capts, in);
         break;
     case NODE_PROGPRED:
         node_const_array__copy(&(node->data.progpred.capts), capts);
@@ -3105,38 +3500,39 @@ static void verify_captures(context_t *ctx, node_t *node, node_const_array_t *ca
         {
             size_t i;
             for (i = 0; i < node->data.sequence.nodes.n; i++) {
-                verify_captures(ctx, node->data.sequence.nodes.p[i], capts);
+                verify_captures_(ctx, rule, node->data.sequence.nodes.p[i], capts, in);
             }
         }
         break;
     case NODE_ALTERNATE:
         {
             size_t i, j, m = capts->n;
-            node_const_array_t v;
+            node_const_array_t v; /* the captures found in the alternatives */
             node_const_array__initialize(&v);
-            node_const_array__copy(&v, capts);
             for (i = 0; i < node->data.alternate.nodes.n; i++) {
-                v.n = m;
-                verify_captures(ctx, node->data.alternate.nodes.p[i], &v);
-                for (j = m; j < v.n; j++) {
-                    node_const_array__add(capts, v.p[j]);
+                verify_captures_(ctx, rule, node->data.alternate.nodes.p[i], capts, in);
+                for (j = m; j < capts->n; j++) {
+                    in[capts->p[j]->data.capture.index] = FALSE;
+                    node_const_array__add(&v, capts->p[j]);
                 }
+                capts->n = m;
+            }
+            for (j = 0; j < v.n; j++) {
+                in[v.p[j]->data.capture.index] = TRUE;
+                node_const_array__add(capts, v.p[j]);
             }
             node_const_array__finalize(&v);
         }
         break;
     case NODE_CAPTURE:
-        verify_captures(ctx, node->data.capture.expr, capts);
+        verify_captures_(ctx, rule, node->data.capture.expr, capts, in);
+        in[node->data.capture.index] = TRUE;
         node_const_array__add(capts, node);
         break;
     case NODE_MATCH_CAPT:
         {
-            size_t i;
-            for (i = 0; i < capts->n; i++) {
-                assert(capts->p[i]->type == NODE_CAPTURE);
-                if (node->data.match_capt.index == capts->p[i]->data.capture.index) break;
-            }
-            if (i >= capts->n && node->data.match_capt.index != VOID_VALUE) {
+            const size_t i = node->data.match_capt.index;
+            if (i != VOID_VALUE && (i >= rule->capts.n || !in[i])) {
                 print_error(
                     "%s:" FMT_LU ":" FMT_LU ": Capture " FMT_LU " not available at this position\n",
                     node->data.match_capt.fpos.path,
@@ -3154,15 +3550,25 @@ static void verify_captures(context_t *ctx, node_t *node, node_const_array_t *ca
         break;
     case NODE_ERROR:
         node_const_array__copy(&(node->data.error.capts), capts);
-        verify_captures(ctx, node->data.error.expr, capts);
+        verify_captures_(ctx, rule, node->data.error.expr, capts, in);
         break;
     default:
         print_error("Internal error [%d]\n", __LINE__);
         exit(-1);
     }
-    if (b) {
-        node_const_array__finalize(&a);
+}
+
+static void verify_captures(context_t *ctx, const node_rule_t *rule) {
+    node_const_array_t a;
+    bool_t *const in = (bool_t *)malloc_e(sizeof(bool_t) * (rule->capts.n + 1));
+    size_t i;
+    for (i = 0; i < rule->capts.n; i++) {
+        in[i] = FALSE;
     }
+    node_const_array__initialize(&a);
+    verify_captures_(ctx, rule, rule->expr, &a, in);
+    node_const_array__finalize(&a);
+    free(in);
 }
 
 static void verify_marker_variables(context_t *ctx, const node_t *node) {
@@ -3236,71 +3642,81 @@ static void verify_marker_variables(context_t *ctx, const node_t *node) {
     }
 }
 
-static void set_code_flags(context_t *ctx, const node_t *node) {
+static bool_t is_automaton_node(const node_t *node, bool_t ascii);
+
+static void set_code_flags(const context_t *ctx, code_flag_t *flags, const node_t *node) {
     if (node == NULL) return;
+    if (ctx->opts.dfa && is_automaton_node(node, ctx->opts.ascii)) { /* the automaton matches single bytes without decoding UTF-8 */
+        *flags |= CODE_FLAG_STRING | CODE_FLAG_CHARCLASS;
+        return;
+    }
     switch (node->type) {
     case NODE_RULE:
         print_error("Internal error [%d]\n", __LINE__);
         exit(-1);
     case NODE_REFERENCE:
-        ctx->flags |= CODE_FLAG_REFERENCE;
+        *flags |= CODE_FLAG_REFERENCE;
+        if (node->data.reference.index != VOID_VALUE)
+            *flags |= CODE_FLAG_RULE_VARIABLE;
+        if (node->data.reference.rule)
+            *flags |= node->data.reference.rule->data.rule.flags;
         break;
     case NODE_STRING:
-        ctx->flags |= CODE_FLAG_STRING;
+        *flags |= CODE_FLAG_STRING;
         break;
     case NODE_CHARCLASS:
-        ctx->flags |= CODE_FLAG_CHARCLASS;
+        *flags |= CODE_FLAG_CHARCLASS;
         if (!ctx->opts.ascii)
-            ctx->flags |= CODE_FLAG_UTF8_CHARCLASS;
+            *flags |= CODE_FLAG_UTF8_CHARCLASS;
         break;
     case NODE_POSITION:
-        ctx->flags |= CODE_FLAG_POSITION;
+        *flags |= CODE_FLAG_POSITION;
         break;
     case NODE_QUANTITY:
-        set_code_flags(ctx, node->data.quantity.expr);
-        ctx->flags |= CODE_FLAG_QUANTITY;
+        set_code_flags(ctx, flags, node->data.quantity.expr);
+        *flags |= CODE_FLAG_QUANTITY;
         break;
     case NODE_PREDICATE:
-        ctx->flags |= CODE_FLAG_PREDICATE;
-        set_code_flags(ctx, node->data.predicate.expr);
+        *flags |= CODE_FLAG_PREDICATE;
+        set_code_flags(ctx, flags, node->data.predicate.expr);
         break;
     case NODE_PROGPRED:
-        ctx->flags |= CODE_FLAG_PROGPRED;
+        *flags |= CODE_FLAG_PROGPRED;
         break;
     case NODE_SEQUENCE:
-        ctx->flags |= CODE_FLAG_SEQUENCE;
+        *flags |= CODE_FLAG_SEQUENCE;
         {
             size_t i;
             for (i = 0; i < node->data.sequence.nodes.n; i++) {
-                set_code_flags(ctx, node->data.sequence.nodes.p[i]);
+                set_code_flags(ctx, flags, node->data.sequence.nodes.p[i]);
             }
         }
         break;
     case NODE_ALTERNATE:
-        ctx->flags |= CODE_FLAG_ALTERNATE;
+        *flags |= CODE_FLAG_ALTERNATE;
         {
             size_t i;
             for (i = 0; i < node->data.alternate.nodes.n; i++) {
-                set_code_flags(ctx, node->data.alternate.nodes.p[i]);
+                set_code_flags(ctx, flags, node->data.alternate.nodes.p[i]);
             }
         }
         break;
     case NODE_CAPTURE:
-        ctx->flags |= CODE_FLAG_CAPTURE;
-        set_code_flags(ctx, node->data.capture.expr);
+        *flags |= CODE_FLAG_CAPTURE;
+        set_code_flags(ctx, flags, node->data.capture.expr);
         break;
     case NODE_MATCH_CAPT:
-        ctx->flags |= CODE_FLAG_MATCH_CAPT;
+        *flags |= CODE_FLAG_MATCH_CAPT;
         break;
     case NODE_MATCH_MVAR:
-        ctx->flags |= CODE_FLAG_MATCH_MVAR;
+        *flags |= CODE_FLAG_MATCH_MVAR;
         break;
     case NODE_ACTION:
-        ctx->flags |= CODE_FLAG_ACTION;
+        *flags |= CODE_FLAG_ACTION;
         break;
     case NODE_ERROR:
-        ctx->flags |= CODE_FLAG_ERROR;
-        set_code_flags(ctx, node->data.error.expr);
+        *flags |= CODE_FLAG_ERROR;
+        set_code_flags(ctx, flags, node->data.error.expr);
         break;
     default:
         print_error("Internal error [%d]\n", __LINE__);
@@ -3308,1482 +3724,3748 @@ static void set_code_flags(context_t *ctx, const node_t *node) {
     }
 }
 
-static void update_code_flags(context_t *ctx, const node_rule_t *rule) {
+static void update_code_flags(const context_t *ctx, code_flag_t *flags, const node_rule_t *rule) {
     if (rule->rvars.n > 0)
-        ctx->flags |= CODE_FLAG_RULE_VARIABLE;
+        *flags |= CODE_FLAG_RULE_VARIABLE;
     if (rule->capts.n > 0)
-        ctx->flags |= CODE_FLAG_CAPTS;
-    set_code_flags(ctx, rule->expr);
-}
-
-static void dump_escaped_string(const char *str, size_t len) {
-    char s[5];
-    size_t i;
-    if (str == NULL) {
-        fprintf(stdout, "null");
-        return;
-    }
-    for (i = 0; (len == VOID_VALUE) ? (str[i] != '\0') : (i < len); i++) {
-        fprintf(stdout, "%s", escape_character(str[i], &s));
-    }
-}
-
-static void dump_integer_value(size_t value) {
-    if (value == VOID_VALUE) {
-        fprintf(stdout, "void");
-    }
-    else {
-        fprintf(stdout, FMT_LU, (ulong_t)value);
-    }
+        *flags |= CODE_FLAG_CAPTS;
+    set_code_flags(ctx, flags, rule->expr);
 }
 
-static void dump_node(context_t *ctx, const node_t *node, const int indent) {
-    if (node == NULL) return;
+static bool_t check_if_factorable(const node_t *node) { /* TRUE if free of actions, captures, variables, and programmable predicates */
+    if (node == NULL) return TRUE;
     switch (node->type) {
     case NODE_RULE:
-        fprintf(
-            stdout, "%*sRule(name:'%s', ref:%d, vars.len:" FMT_LU ", capts.len:" FMT_LU ", codes.len:" FMT_LU ", preds.len:" FMT_LU ") {\n",
-            indent, "", node->data.rule.name, node->data.rule.ref,
-            (ulong_t)node->data.rule.rvars.n, (ulong_t)node->data.rule.capts.n,
-            (ulong_t)node->data.rule.codes.n, (ulong_t)node->data.rule.preds.n
-        );
-        dump_node(ctx, node->data.rule.expr, indent + 2);
-        fprintf(stdout, "%*s}\n", indent, "");
-        break;
+        print_error("Internal error [%d]\n", __LINE__);
+        exit(-1);
+    case NODE_REFERENCE:
+        return (node->data.reference.rvar == NULL) ? TRUE : FALSE;
+    case NODE_STRING:
+        return TRUE;
+    case NODE_CHARCLASS:
+        return TRUE;
+    case NODE_POSITION:
+        return TRUE;
+    case NODE_QUANTITY:
+        return check_if_factorable(node->data.quantity.expr);
+    case NODE_PREDICATE:
+        return check_if_factorable(node->data.predicate.expr);
+    case NODE_PROGPRED:
+        return FALSE;
+    case NODE_SEQUENCE:
+        {
+            size_t i;
+            for (i = 0; i < node->data.sequence.nodes.n; i++) {
+                if (!check_if_factorable(node->data.sequence.nodes.p[i])) return FALSE;
+            }
+        }
+        return TRUE;
+    case NODE_ALTERNATE:
+        {
+            size_t i;
+            for (i = 0; i < node->data.alternate.nodes.n; i++) {
+                if (!check_if_factorable(node->data.alternate.nodes.p[i])) return FALSE;
+            }
+        }
+        return TRUE;
+    case NODE_CAPTURE:
+        return FALSE;
+    case NODE_MATCH_CAPT:
+        return FALSE;
+    case NODE_MATCH_MVAR:
+        return FALSE;
+    case NODE_ACTION:
+        return FALSE;
+    case NODE_ERROR:
+        return FALSE;
+    default:
+        print_error("Internal error [%d]\n", __LINE__);
+        exit(-1);
+    }
+}
+
+static bool_t check_if_equivalent(const node_t *node1, const node_t *node2) {
+    if (node1 == NULL || node2 == NULL) return (node1 == node2) ? TRUE : FALSE;
+    if (node1->type != node2->type) return FALSE;
+    switch (node1->type) {
+    case NODE_RULE:
+        print_error("Internal error [%d]\n", __LINE__);
+        exit(-1);
+    case NODE_REFERENCE:
+        return (
+            node1->data.reference.rvar == NULL && node2->data.reference.rvar == NULL &&
+            strcmp(node1->data.reference.name, node2->data.reference.name) == 0
+        ) ? TRUE : FALSE;
+    case NODE_STRING:
+        return (
+            node1->data.string.value.n == node2->data.string.value.n &&
+            (node1->data.string.value.n == 0 || memcmp(node1->data.string.value.p, node2->data.string.value.p, node1->data.string.value.n) == 0)
+        ) ? TRUE : FALSE;
+    case NODE_CHARCLASS:
+        return (
+            node1->data.charclass.value.n == node2->data.charclass.value.n &&
+            (node1->data.charclass.value.n == 0 || memcmp(node1->data.charclass.value.p, node2->data.charclass.value.p, node1->data.charclass.value.n) == 0)
+        ) ? TRUE : FALSE;
+    case NODE_POSITION:
+        return (node1->data.position.value == node2->data.position.value) ? TRUE : FALSE;
+    case NODE_QUANTITY:
+        return (
+            node1->data.quantity.min == node2->data.quantity.min &&
+            node1->data.quantity.max == node2->data.quantity.max &&
+            check_if_equivalent(node1->data.quantity.expr, node2->data.quantity.expr)
+        ) ? TRUE : FALSE;
+    case NODE_PREDICATE:
+        return (
+            node1->data.predicate.neg == node2->data.predicate.neg &&
+            check_if_equivalent(node1->data.predicate.expr, node2->data.predicate.expr)
+        ) ? TRUE : FALSE;
+    case NODE_PROGPRED:
+        return FALSE;
+    case NODE_SEQUENCE:
+        {
+            size_t i;
+            if (node1->data.sequence.nodes.n != node2->data.sequence.nodes.n) return FALSE;
+            for (i = 0; i < node1->data.sequence.nodes.n; i++) {
+                if (!check_if_equivalent(node1->data.sequence.nodes.p[i], node2->data.sequence.nodes.p[i])) return FALSE;
+            }
+        }
+        return TRUE;
+    case NODE_ALTERNATE:
+        {
+            size_t i;
+            if (node1->data.alternate.nodes.n != node2->data.alternate.nodes.n) return FALSE;
+            for (i = 0; i < node1->data.alternate.nodes.n; i++) {
+                if (!check_if_equivalent(node1->data.alternate.nodes.p[i], node2->data.alternate.nodes.p[i])) return FALSE;
+            }
+        }
+        return TRUE;
+    case NODE_CAPTURE:
+        return FALSE;
+    case NODE_MATCH_CAPT:
+        return FALSE;
+    case NODE_MATCH_MVAR:
+        return FALSE;
+    case NODE_ACTION:
+        return FALSE;
+    case NODE_ERROR:
+        return FALSE;
+    default:
+        print_error("Internal error [%d]\n", __LINE__);
+        exit(-1);
+    }
+}
+
+static size_t get_alternative_length(const node_t *node) {
+    return (node->type == NODE_SEQUENCE) ? node->data.sequence.nodes.n : 1;
+}
+
+static node_t *get_alternative_element(node_t *node, size_t index) {
+    return (node->type == NODE_SEQUENCE) ? node->data.sequence.nodes.p[index] : node;
+}
+
+static void factor_alternatives(context_t *ctx, node_t **node) {
+    node_t *const n = *node;
+    if (n == NULL) return;
+    switch (n->type) {
+    case NODE_RULE:
+        factor_alternatives(ctx, &(n->data.rule.expr));
+        break;
     case NODE_REFERENCE:
-        fprintf(stdout, "%*sReference(var:'%s', index:", indent, "", node->data.reference.rvar);
-        dump_integer_value(node->data.reference.index);
-        fprintf(
-            stdout, ", name:'%s', rule:'%s')\n", node->data.reference.name,
-            (node->data.reference.rule) ? node->data.reference.rule->data.rule.name : NULL
-        );
         break;
     case NODE_STRING:
-        fprintf(stdout, "%*sString(value:'", indent, "");
-        dump_escaped_string(node->data.string.value.p, node->data.string.value.n);
-        fprintf(stdout, "')\n");
         break;
     case NODE_CHARCLASS:
-        fprintf(stdout, "%*sCharclass(value:'", indent, "");
-        dump_escaped_string(node->data.charclass.value.p, node->data.charclass.value.n);
-        fprintf(stdout, "')\n");
         break;
     case NODE_POSITION:
-        fprintf(stdout, "%*sPosition(value:" FMT_LU ")\n", indent, "", (ulong_t)node->data.position.value);
         break;
     case NODE_QUANTITY:
-        fprintf(stdout, "%*sQuantity(min:%d, max:%d) {\n", indent, "", node->data.quantity.min, node->data.quantity.max);
-        dump_node(ctx, node->data.quantity.expr, indent + 2);
-        fprintf(stdout, "%*s}\n", indent, "");
+        factor_alternatives(ctx, &(n->data.quantity.expr));
         break;
     case NODE_PREDICATE:
-        fprintf(stdout, "%*sPredicate(neg:%d) {\n", indent, "", node->data.predicate.neg);
-        dump_node(ctx, node->data.predicate.expr, indent + 2);
-        fprintf(stdout, "%*s}\n", indent, "");
+        factor_alternatives(ctx, &(n->data.predicate.expr));
         break;
     case NODE_PROGPRED:
-        fprintf(stdout, "%*sProgrammable Predicate(index:", indent, "");
-        dump_integer_value(node->data.progpred.index);
-        fprintf(stdout, ", neg:%d, code:{", node->data.progpred.neg);
-        dump_escaped_string(node->data.progpred.code.text, VOID_VALUE);
-        fprintf(stdout, "}, capts:");
-        if (node->data.progpred.capts.n > 0) {
-            size_t i;
-            fprintf(stdout, "\n");
-            for (i = 0; i < node->data.progpred.capts.n; i++) {
-                fprintf(stdout, "%*s$" FMT_LU "\n", indent + 2, "", (ulong_t)(node->data.progpred.capts.p[i]->data.capture.index + 1));
-            }
-            fprintf(stdout, "%*s)\n", indent, "");
-        }
-        else {
-            fprintf(stdout, "none)\n");
-        }
         break;
     case NODE_SEQUENCE:
-        fprintf(
-            stdout, "%*sSequence(max:" FMT_LU ", len:" FMT_LU ") {\n",
-            indent, "", (ulong_t)node->data.sequence.nodes.m, (ulong_t)node->data.sequence.nodes.n
-        );
         {
             size_t i;
-            for (i = 0; i < node->data.sequence.nodes.n; i++) {
-                dump_node(ctx, node->data.sequence.nodes.p[i], indent + 2);
+            for (i = 0; i < n->data.sequence.nodes.n; i++) {
+                factor_alternatives(ctx, &(n->data.sequence.nodes.p[i]));
             }
         }
-        fprintf(stdout, "%*s}\n", indent, "");
         break;
     case NODE_ALTERNATE:
-        fprintf(
-            stdout, "%*sAlternate(max:" FMT_LU ", len:" FMT_LU ") {\n",
-            indent, "", (ulong_t)node->data.alternate.nodes.m, (ulong_t)node->data.alternate.nodes.n
-        );
         {
-            size_t i;
-            for (i = 0; i < node->data.alternate.nodes.n; i++) {
-                dump_node(ctx, node->data.alternate.nodes.p[i], indent + 2);
+            node_array_t *const a = &(n->data.alternate.nodes);
+            size_t i, j, k;
+            for (i = 0; i < a->n; i++) {
+                factor_alternatives(ctx, &(a->p[i]));
+            }
+            for (i = 0, j = 0; i < a->n; i = k) {
+                /* finds the consecutive alternatives starting with the same element, each keeping at least one element after the prefix */
+                size_t l = get_alternative_length(a->p[i]) - 1; /* the maximum length of the common prefix */
+                const node_t *const e = (l > 0 && check_if_factorable(get_alternative_element(a->p[i], 0))) ? get_alternative_element(a->p[i], 0) : NULL;
+                for (k = i + 1; e && k < a->n; k++) {
+                    const size_t m = get_alternative_length(a->p[k]);
+                    if (m < 2 || !check_if_equivalent(e, get_alternative_element(a->p[k], 0))) break;
+                    if (l > m - 1) l = m - 1;
+                }
+                if (k - i < 2) {
+                    a->p[j++] = a->p[i];
+                    continue;
+                }
+                {
+                    node_t *const s = create_node(NODE_SEQUENCE);
+                    node_t *const t = create_node(NODE_ALTERNATE);
+                    size_t h, q;
+                    for (h = 1; h < l; h++) {
+                        const node_t *const f = get_alternative_element(a->p[i], h);
+                        if (!check_if_factorable(f)) break;
+                        for (q = i + 1; q < k; q++) {
+                            if (!check_if_equivalent(f, get_alternative_element(a->p[q], h))) break;
+                        }
+                        if (q < k) break;
+                    }
+                    for (q = 0; q < h; q++) {
+                        node_array__add(&(s->data.sequence.nodes), a->p[i]->data.sequence.nodes.p[q]);
+                    }
+                    for (q = i; q < k; q++) {
+                        node_t *const r = a->p[q];
+                        node_array_t *const b = &(r->data.sequence.nodes);
+                        size_t x;
+                        if (q > i) {
+                            for (x = 0; x < h; x++) {
+                                unreference_rules_from_unused_rule(ctx, b->p[x]);
+                                destroy_node(b->p[x]);
+                            }
+                        }
+                        for (x = h; x < b->n; x++) {
+                            b->p[x - h] = b->p[x];
+                        }
+                        b->n -= h;
+                        if (b->n == 1) {
+                            node_array__add(&(t->data.alternate.nodes), b->p[0]);
+                            b->n = 0;
+                            destroy_node(r);
+                        }
+                        else {
+                            node_array__add(&(t->data.alternate.nodes), r);
+                        }
+                    }
+                    node_array__add(&(s->data.sequence.nodes), t);
+                    factor_alternatives(ctx, &(s->data.sequence.nodes.p[h])); /* the remaining parts can share shorter prefixes */
+                    a->p[j++] = s;
+                }
+            }
+            a->n = j;
+            if (a->n == 1) {
+                *node = a->p[0];
+                a->n = 0;
+                destroy_node(n);
             }
         }
-        fprintf(stdout, "%*s}\n", indent, "");
         break;
     case NODE_CAPTURE:
-        fprintf(stdout, "%*sCapture(index:", indent, "");
-        dump_integer_value(node->data.capture.index);
-        fprintf(stdout, ") {\n");
-        dump_node(ctx, node->data.capture.expr, indent + 2);
-        fprintf(stdout, "%*s}\n", indent, "");
+        factor_alternatives(ctx, &(n->data.capture.expr));
         break;
     case NODE_MATCH_CAPT:
-        fprintf(stdout, "%*sMatch Captured(index:", indent, "");
-        dump_integer_value(node->data.match_capt.index);
-        fprintf(stdout, ")\n");
         break;
     case NODE_MATCH_MVAR:
-        fprintf(stdout, "%*sMatch Maker Variable(name:'%s')\n", indent, "", node->data.match_mvar.name);
         break;
     case NODE_ACTION:
-        fprintf(stdout, "%*sAction(index:", indent, "");
-        dump_integer_value(node->data.action.index);
-        fprintf(stdout, ", code:{");
-        dump_escaped_string(node->data.action.code.text, VOID_VALUE);
-        fprintf(stdout, "}, vars:");
-        if (node->data.action.rvars.n + node->data.action.capts.n > 0) {
-            size_t i;
-            fprintf(stdout, "\n");
-            for (i = 0; i < node->data.action.rvars.n; i++) {
-                fprintf(stdout, "%*s'%s'\n", indent + 2, "", node->data.action.rvars.p[i]->data.reference.rvar);
-            }
-            for (i = 0; i < node->data.action.capts.n; i++) {
-                fprintf(stdout, "%*s$" FMT_LU "\n", indent + 2, "", (ulong_t)(node->data.action.capts.p[i]->data.capture.index + 1));
-            }
-            fprintf(stdout, "%*s)\n", indent, "");
-        }
-        else {
-            fprintf(stdout, "none)\n");
-        }
         break;
     case NODE_ERROR:
-        fprintf(stdout, "%*sError(index:", indent, "");
-        dump_integer_value(node->data.error.index);
-        fprintf(stdout, ", code:{");
-        dump_escaped_string(node->data.error.code.text, VOID_VALUE);
-        fprintf(stdout, "}, vars:\n");
+        factor_alternatives(ctx, &(n->data.error.expr));
+        break;
+    default:
+        print_error("Internal error [%d]\n", __LINE__);
+        exit(-1);
+    }
+}
+
+static const node_t *find_split_rule(const context_t *ctx) {
+    size_t i;
+    for (i = 0; i < ctx->rules.n; i++) {
+        if (strcmp(ctx->rules.p[i]->data.rule.name, ctx->split) == 0) return ctx->rules.p[i];
+    }
+    return NULL;
+}
+
+static bool_t check_if_splittable(const node_t *node) { /* TRUE if a nonempty string literal or an alternation of them */
+    if (node->type == NODE_STRING) return (node->data.string.value.n > 0) ? TRUE : FALSE;
+    if (node->type == NODE_ALTERNATE) {
+        size_t i;
+        for (i = 0; i < node->data.alternate.nodes.n; i++) {
+            const node_t *const n = node->data.alternate.nodes.p[i];
+            if (n->type != NODE_STRING || n->data.string.value.n == 0) return FALSE;
+        }
+        return TRUE;
+    }
+    return FALSE;
+}
+
+static bool_t check_if_nullable(const node_t *node) {
+    if (node == NULL) return TRUE;
+    switch (node->type) {
+    case NODE_RULE:
+        print_error("Internal error [%d]\n", __LINE__);
+        exit(-1);
+    case NODE_REFERENCE:
+        return (node->data.reference.rule && node->data.reference.rule->data.rule.nullable) ? TRUE : FALSE;
+    case NODE_STRING:
+        return (node->data.string.value.n == 0) ? TRUE : FALSE;
+    case NODE_CHARCLASS:
+        return FALSE;
+    case NODE_POSITION:
+        return TRUE;
+    case NODE_QUANTITY:
+        return (node->data.quantity.min <= 0 || check_if_nullable(node->data.quantity.expr)) ? TRUE : FALSE;
+    case NODE_PREDICATE:
+        return TRUE;
+    case NODE_PROGPRED:
+        return TRUE;
+    case NODE_SEQUENCE:
         {
             size_t i;
-            for (i = 0; i < node->data.error.rvars.n; i++) {
-                fprintf(stdout, "%*s'%s'\n", indent + 2, "", node->data.error.rvars.p[i]->data.reference.rvar);
+            for (i = 0; i < node->data.sequence.nodes.n; i++) {
+                if (!check_if_nullable(node->data.sequence.nodes.p[i])) return FALSE;
             }
-            for (i = 0; i < node->data.error.capts.n; i++) {
-                fprintf(stdout, "%*s$" FMT_LU "\n", indent + 2, "", (ulong_t)(node->data.error.capts.p[i]->data.capture.index + 1));
+        }
+        return TRUE;
+    case NODE_ALTERNATE:
+        {
+            size_t i;
+            for (i = 0; i < node->data.alternate.nodes.n; i++) {
+                if (check_if_nullable(node->data.alternate.nodes.p[i])) return TRUE;
             }
         }
-        fprintf(stdout, "%*s) {\n", indent, "");
-        dump_node(ctx, node->data.error.expr, indent + 2);
-        fprintf(stdout, "%*s}\n", indent, "");
-        break;
+        return FALSE;
+    case NODE_CAPTURE:
+        return check_if_nullable(node->data.capture.expr);
+    case NODE_MATCH_CAPT:
+        return TRUE;
+    case NODE_MATCH_MVAR:
+        return TRUE;
+    case NODE_ACTION:
+        return TRUE;
+    case NODE_ERROR:
+        return check_if_nullable(node->data.error.expr);
     default:
-        print_error("%*sInternal error [%d]\n", indent, "", __LINE__);
+        print_error("Internal error [%d]\n", __LINE__);
         exit(-1);
     }
 }
 
-static node_t *parse_expression(input_state_t *input, node_t *rule);
-
-static node_t *parse_primary(input_state_t *input, node_t *rule) {
-    const size_t p = input->bufcur;
-    const size_t l = input->linenum;
-    const size_t m = input_state__column_number(input);
-    const size_t n = input->charnum;
-    const size_t o = input->linepos;
-    node_t *n_p = NULL;
-    if (input_state__match_identifier(input)) {
-        const size_t q = input->bufcur;
-        size_t r = VOID_VALUE, s = VOID_VALUE;
-        input_state__match_spaces(input);
-        if (input_state__match_character(input, ':')) {
-            input_state__match_spaces(input);
-            r = input->bufcur;
-            if (!input_state__match_identifier(input)) goto EXCEPTION;
-            s = input->bufcur;
-            input_state__match_spaces(input);
-        }
-        if (input_state__match_string(input, "<-")) goto EXCEPTION;
-        n_p = create_node(NODE_REFERENCE);
-        if (r == VOID_VALUE) {
-            assert(q >= p);
-            n_p->data.reference.rvar = NULL;
-            n_p->data.reference.index = VOID_VALUE;
-            n_p->data.reference.name = strndup_e(input->buffer.p + p, q - p);
-        }
-        else {
-            assert(s != VOID_VALUE); /* s should have a valid value when r has a valid value */
-            assert(q >= p);
-            n_p->data.reference.rvar = strndup_e(input->buffer.p + p, q - p);
-            if (n_p->data.reference.rvar[0] == '_') {
-                print_error(
-                    "%s:" FMT_LU ":" FMT_LU ": Leading underscore in rule variable identifier '%s'\n",
-                    input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), n_p->data.reference.rvar
-                );
-                input->errnum++;
+static void collect_references(const node_t *node, node_const_array_t *refs, bool_t left) {
+    /* collects the rules referenced by the expression; only those at the leftmost positions if 'left' is true */
+    if (node == NULL) return;
+    switch (node->type) {
+    case NODE_RULE:
+        print_error("Internal error [%d]\n", __LINE__);
+        exit(-1);
+    case NODE_REFERENCE:
+        if (node->data.reference.rule) node_const_array__add(refs, node->data.reference.rule);
+        break;
+    case NODE_STRING:
+        break;
+    case NODE_CHARCLASS:
+        break;
+    case NODE_POSITION:
+        break;
+    case NODE_QUANTITY:
+        collect_references(node->data.quantity.expr, refs, left);
+        break;
+    case NODE_PREDICATE:
+        collect_references(node->data.predicate.expr, refs, left);
+        break;
+    case NODE_PROGPRED:
+        break;
+    case NODE_SEQUENCE:
+        {
+            size_t i;
+            for (i = 0; i < node->data.sequence.nodes.n; i++) {
+                collect_references(node->data.sequence.nodes.p[i], refs, left);
+                if (left && !check_if_nullable(node->data.sequence.nodes.p[i])) break;
             }
-            if (strncmp(n_p->data.reference.rvar, "pcc_", 4) == 0) {
-                print_error(
-                    "%s:" FMT_LU ":" FMT_LU ": Starting with 'pcc_' in rule variable identifier '%s'\n",
-                    input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), n_p->data.reference.rvar
-                );
-                input->errnum++;
+        }
+        break;
+    case NODE_ALTERNATE:
+        {
+            size_t i;
+            for (i = 0; i < node->data.alternate.nodes.n; i++) {
+                collect_references(node->data.alternate.nodes.p[i], refs, left);
             }
-            if (strncmp(n_p->data.reference.rvar, "PCC_", 4) == 0) {
-                print_error(
-                    "%s:" FMT_LU ":" FMT_LU ": Starting with 'PCC_' in rule variable identifier '%s'\n",
-                    input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), n_p->data.reference.rvar
-                );
-                input->errnum++;
+        }
+        break;
+    case NODE_CAPTURE:
+        collect_references(node->data.capture.expr, refs, left);
+        break;
+    case NODE_MATCH_CAPT:
+        break;
+    case NODE_MATCH_MVAR:
+        break;
+    case NODE_ACTION:
+        break;
+    case NODE_ERROR:
+        collect_references(node->data.error.expr, refs, left);
+        break;
+    default:
+        print_error("Internal error [%d]\n", __LINE__);
+        exit(-1);
+    }
+}
+
+static node_const_array_t *create_rule_graph(const context_t *ctx, bool_t left) {
+    /* the i-th element is the array of the rules referenced by the i-th rule */
+    node_const_array_t *const g = (node_const_array_t *)malloc_e(sizeof(node_const_array_t) * (ctx->rules.n + 1));
+    size_t i;
+    for (i = 0; i < ctx->rules.n; i++) {
+        node_const_array__initialize(&(g[i]));
+        collect_references(ctx->rules.p[i]->data.rule.expr, &(g[i]), left);
+    }
+    return g;
+}
+
+static void destroy_rule_graph(const context_t *ctx, node_const_array_t *g) {
+    size_t i;
+    for (i = 0; i < ctx->rules.n; i++) {
+        node_const_array__finalize(&(g[i]));
+    }
+    free(g);
+}
+
+static size_t find_rule_components(const context_t *ctx, const node_const_array_t *g, size_t *comp) {
+    /* Tarjan's algorithm without recursion; the strongly connected components are numbered in reverse topological order,
+       that is, every component reachable from a component has a smaller number */
+    const size_t n = ctx->rules.n;
+    size_t *const order = (size_t *)malloc_e(sizeof(size_t) * (n * 5 + 1));
+    size_t *const low = order + n;
+    size_t *const next = low + n;  /* the index of the next edge to be visited */
+    size_t *const path = next + n; /* the rules being visited */
+    size_t *const stack = path + n;
+    size_t i, k = 0, t = 0, np = 0, ns = 0;
+    for (i = 0; i < n; i++) {
+        order[i] = VOID_VALUE;
+        comp[i] = VOID_VALUE;
+    }
+    for (i = 0; i < n; i++) {
+        if (order[i] != VOID_VALUE) continue;
+        order[i] = low[i] = t++;
+        next[i] = 0;
+        path[np++] = i;
+        stack[ns++] = i;
+        while (np > 0) {
+            const size_t v = path[np - 1];
+            if (next[v] < g[v].n) {
+                const size_t w = g[v].p[next[v]++]->data.rule.index;
+                if (order[w] == VOID_VALUE) {
+                    order[w] = low[w] = t++;
+                    next[w] = 0;
+                    path[np++] = w;
+                    stack[ns++] = w;
+                }
+                else if (comp[w] == VOID_VALUE && low[v] > order[w]) {
+                    low[v] = order[w];
+                }
             }
-            {
-                size_t i;
-                for (i = 0; i < rule->data.rule.rvars.n; i++) {
-                    assert(rule->data.rule.rvars.p[i]->type == NODE_REFERENCE);
-                    if (strcmp(n_p->data.reference.rvar, rule->data.rule.rvars.p[i]->data.reference.rvar) == 0) break;
+            else {
+                np--;
+                if (low[v] == order[v]) {
+                    size_t w;
+                    do {
+                        w = stack[--ns];
+                        comp[w] = k;
+                    } while (w != v);
+                    k++;
                 }
-                if (i == rule->data.rule.rvars.n) node_const_array__add(&(rule->data.rule.rvars), n_p);
-                n_p->data.reference.index = i;
+                if (np > 0 && low[path[np - 1]] > low[v]) low[path[np - 1]] = low[v];
             }
-            assert(s >= r);
-            n_p->data.reference.name = strndup_e(input->buffer.p + r, s - r);
         }
-        file_pos__set(&(n_p->data.reference.fpos), input->path, l, m);
     }
-    else if (input_state__match_character(input, '(')) {
-        input_state__match_spaces(input);
-        n_p = parse_expression(input, rule);
-        if (n_p == NULL) goto EXCEPTION;
-        if (!input_state__match_character(input, ')')) goto EXCEPTION;
-        input_state__match_spaces(input);
+    free(order);
+    return k;
+}
+
+static void mark_rules_if_nullable(context_t *ctx) {
+    /* rechecks only the rules referencing a rule newly found nullable */
+    node_const_array_t *const g = create_rule_graph(ctx, FALSE);
+    node_const_array_t *const h = (node_const_array_t *)malloc_e(sizeof(node_const_array_t) * (ctx->rules.n + 1)); /* the reversed graph */
+    node_const_array_t a; /* the rules newly found nullable */
+    size_t i, j;
+    for (i = 0; i < ctx->rules.n; i++) {
+        node_const_array__initialize(&(h[i]));
     }
-    else if (input_state__match_character(input, '<')) {
-        input_state__match_spaces(input);
-        n_p = create_node(NODE_CAPTURE);
-        n_p->data.capture.index = rule->data.rule.capts.n;
-        node_const_array__add(&(rule->data.rule.capts), n_p);
-        n_p->data.capture.expr = parse_expression(input, rule);
-        if (n_p->data.capture.expr == NULL || !input_state__match_character(input, '>')) {
-            rule->data.rule.capts.n = n_p->data.capture.index;
-            goto EXCEPTION;
+    for (i = 0; i < ctx->rules.n; i++) {
+        for (j = 0; j < g[i].n; j++) {
+            node_const_array__add(&(h[g[i].p[j]->data.rule.index]), ctx->rules.p[i]);
         }
-        input_state__match_spaces(input);
     }
-    else if (input_state__match_character(input, '$')) {
-        size_t p;
-        input_state__match_spaces(input);
-        p = input->bufcur;
-        if (input_state__match_number(input)) {
-            const size_t q = input->bufcur;
-            char *s;
-            input_state__match_spaces(input);
-            n_p = create_node(NODE_MATCH_CAPT);
-            assert(q >= p);
-            s = strndup_e(input->buffer.p + p, q - p);
-            n_p->data.match_capt.index = string_to_size_t(s);
-            if (n_p->data.match_capt.index == VOID_VALUE) {
-                print_error("%s:" FMT_LU ":" FMT_LU ": Invalid unsigned number '%s'\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), s);
-                input->errnum++;
-            }
-            else if (n_p->data.match_capt.index == 0) {
-                print_error("%s:" FMT_LU ":" FMT_LU ": 0 not allowed\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
-                input->errnum++;
-            }
-            else if (s[0] == '0') {
-                print_error("%s:" FMT_LU ":" FMT_LU ": 0-prefixed number not allowed\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
-                input->errnum++;
-                n_p->data.match_capt.index = 0;
-            }
-            free(s);
-            if (n_p->data.match_capt.index > 0 && n_p->data.match_capt.index != VOID_VALUE) {
-                n_p->data.match_capt.index--;
-                file_pos__set(&(n_p->data.match_capt.fpos), input->path, l, m);
-            }
-        }
-        else {
-            goto EXCEPTION;
+    node_const_array__initialize(&a);
+    for (i = 0; i < ctx->rules.n; i++) {
+        node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
+        if (!rule->nullable && check_if_nullable(rule->expr)) {
+            rule->nullable = TRUE;
+            node_const_array__add(&a, ctx->rules.p[i]);
         }
     }
-    else if (input_state__match_character(input, '@')) {
-        size_t p;
-        input_state__match_spaces(input);
-        p = input->bufcur;
-        if (input_state__match_identifier(input)) {
-            const size_t q = input->bufcur;
-            input_state__match_spaces(input);
-            n_p = create_node(NODE_MATCH_MVAR);
-            assert(q >= p);
-            n_p->data.match_mvar.name = strndup_e(input->buffer.p + p, q - p);
-            file_pos__set(&(n_p->data.match_mvar.fpos), input->path, l, m);
-        }
-        else {
-            goto EXCEPTION;
+    while (a.n > 0) {
+        const node_const_array_t *const r = &(h[a.p[--a.n]->data.rule.index]);
+        for (j = 0; j < r->n; j++) {
+            node_rule_t *const rule = &(((node_t *)r->p[j])->data.rule);
+            if (!rule->nullable && check_if_nullable(rule->expr)) {
+                rule->nullable = TRUE;
+                node_const_array__add(&a, r->p[j]);
+            }
         }
     }
-    else if (input_state__match_character(input, '^')) {
-        input_state__match_spaces(input);
-        n_p = create_node(NODE_POSITION);
-        n_p->data.position.value = 0;
+    node_const_array__finalize(&a);
+    destroy_rule_graph(ctx, h);
+    destroy_rule_graph(ctx, g);
+}
+
+static void mark_rules_if_left_recursive(context_t *ctx) {
+    /* the left-recursive rules are those in the cycles of the graph of the references at the leftmost positions,
+       and the mutually left-recursive rules are those in the same strongly connected component of the graph */
+    node_const_array_t *const g = create_rule_graph(ctx, TRUE);
+    size_t *const comp = (size_t *)malloc_e(sizeof(size_t) * (ctx->rules.n * 3 + 1));
+    size_t *const size = comp + ctx->rules.n;  /* the number of the rules in each component */
+    size_t *const cycle = size + ctx->rules.n; /* the 1-based index of each group of the mutually left-recursive rules */
+    const size_t n = find_rule_components(ctx, g, comp);
+    size_t i, j, k = 0;
+    for (i = 0; i < n; i++) {
+        size[i] = 0;
+        cycle[i] = 0;
     }
-    else if (input_state__match_character(input, '.')) {
-        input_state__match_spaces(input);
-        n_p = create_node(NODE_CHARCLASS);
-        char_array__clear(&(n_p->data.charclass.value));
+    for (i = 0; i < ctx->rules.n; i++) {
+        size[comp[i]]++;
     }
-    else if (input_state__match_character_class(input)) {
-        const size_t q = input->bufcur;
-        input_state__match_spaces(input);
-        n_p = create_node(NODE_CHARCLASS);
-        char_array__set_chars(&(n_p->data.charclass.value), input->buffer.p + p + 1, q - p - 2);
-        if (n_p->data.charclass.value.n == 0) {
-            print_error("%s:" FMT_LU ":" FMT_LU ": Character missing\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
-            input->errnum++;
-        }
-        if (!unescape_string(n_p->data.charclass.value.p, &(n_p->data.charclass.value.n), TRUE)) {
-            print_error("%s:" FMT_LU ":" FMT_LU ": Illegal escape sequence\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
-            input->errnum++;
-        }
-        if (!input->ascii && !is_valid_utf8_string(n_p->data.charclass.value.p, n_p->data.charclass.value.n)) {
-            print_error("%s:" FMT_LU ":" FMT_LU ": Invalid UTF-8 string\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
-            input->errnum++;
-        }
+    for (i = 0; i < ctx->rules.n; i++) {
+        node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
+        bool_t b = (size[comp[i]] > 1) ? TRUE : FALSE;
+        for (j = 0; !b && j < g[i].n; j++) {
+            if (g[i].p[j] == ctx->rules.p[i]) b = TRUE;
+        }
+        if (!b) continue;
+        rule->flags |= CODE_FLAG_LEFT_RECURSION;
+        if (cycle[comp[i]] == 0) cycle[comp[i]] = ++k;
+        rule->cycle = cycle[comp[i]];
+    }
+    free(comp);
+    destroy_rule_graph(ctx, g);
+}
+
+static bool_t get_regular_traits(const node_t *node, bool_t ascii, regular_traits_t *traits);
+static bool_t are_exclusive_nodes(const node_t *node1, const node_t *node2, bool_t ascii);
+
+static void mark_rules_if_regular(context_t *ctx) {
+    /* the regular rules are the non-recursive ones that can be matched by automata, and are checked in reverse topological order
+       since the references to the regular rules are regular */
+    node_const_array_t *const g = create_rule_graph(ctx, FALSE);
+    size_t *const comp = (size_t *)malloc_e(sizeof(size_t) * (ctx->rules.n * 3 + 1));
+    size_t *const size = comp + ctx->rules.n;  /* the number of the rules in each component */
+    size_t *const index = size + ctx->rules.n; /* the index of a rule in each component */
+    const size_t n = find_rule_components(ctx, g, comp);
+    size_t i, j, k;
+    for (k = 0; k < n; k++) {
+        size[k] = 0;
     }
-    else if (input_state__match_quotation_single(input) || input_state__match_quotation_double(input)) {
-        const size_t q = input->bufcur;
-        input_state__match_spaces(input);
-        n_p = create_node(NODE_STRING);
-        char_array__set_chars(&(n_p->data.string.value), input->buffer.p + p + 1, q - p - 2);
-        if (!unescape_string(n_p->data.string.value.p, &(n_p->data.string.value.n), FALSE)) {
-            print_error("%s:" FMT_LU ":" FMT_LU ": Illegal escape sequence\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
-            input->errnum++;
-        }
-        if (!input->ascii && !is_valid_utf8_string(n_p->data.string.value.p, n_p->data.string.value.n)) {
-            print_error("%s:" FMT_LU ":" FMT_LU ": Invalid UTF-8 string\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
-            input->errnum++;
-        }
+    for (i = 0; i < ctx->rules.n; i++) {
+        size[comp[i]]++;
+        index[comp[i]] = i;
+    }
+    for (k = 0; k < n; k++) { /* every component reachable from the k-th component is already processed */
+        regular_traits_t t;
+        if (size[k] > 1) continue;
+        i = index[k];
+        for (j = 0; j < g[i].n; j++) {
+            if (g[i].p[j] == ctx->rules.p[i]) break;
+        }
+        if (j < g[i].n) continue;
+        if (ctx->rules.p[i]->data.rule.expr == NULL) continue;
+        ctx->rules.p[i]->data.rule.regular = get_regular_traits(ctx->rules.p[i]->data.rule.expr, ctx->opts.ascii, &t);
+    }
+    free(comp);
+    destroy_rule_graph(ctx, g);
+}
+
+static void update_rule_code_flags(context_t *ctx) {
+    /* the flags of a rule include those of all rules reachable from it, which are shared within each strongly connected component */
+    node_const_array_t *const g = create_rule_graph(ctx, FALSE);
+    size_t *const comp = (size_t *)malloc_e(sizeof(size_t) * (ctx->rules.n * 3 + 1));
+    size_t *const head = comp + ctx->rules.n; /* the first rule in each component */
+    size_t *const next = head + ctx->rules.n; /* the next rule in the same component */
+    const size_t n = find_rule_components(ctx, g, comp);
+    size_t i, j;
+    for (i = 0; i < n; i++) {
+        head[i] = VOID_VALUE;
     }
-    else if (input_state__match_code_block(input)) {
-        const size_t q = input->bufcur;
-        input_state__match_spaces(input);
-        n_p = create_node(NODE_ACTION);
-        n_p->data.action.code.text = strndup_e(input->buffer.p + p + 1, q - p - 2);
-        n_p->data.action.code.len = find_trailing_spaces_in_string(n_p->data.action.code.text, 0, q - p - 2);
-        file_pos__set(&(n_p->data.action.code.fpos), input->path, l, m + 1); /* `+ 1`: to skip the heading '{' */
-        n_p->data.action.index = rule->data.rule.codes.n;
-        node_const_array__add(&(rule->data.rule.codes), n_p);
+    for (i = ctx->rules.n; i > 0; i--) {
+        next[i - 1] = head[comp[i - 1]];
+        head[comp[i - 1]] = i - 1;
     }
-    else {
-        goto EXCEPTION;
+    for (i = 0; i < n; i++) { /* every component reachable from the i-th component is already processed */
+        code_flag_t f = CODE_FLAG_NONE;
+        for (j = head[i]; j != VOID_VALUE; j = next[j]) {
+            const node_rule_t *const rule = &(ctx->rules.p[j]->data.rule);
+            code_flag_t e = rule->flags;
+            update_code_flags(ctx, &e, rule);
+            f |= e;
+        }
+        for (j = head[i]; j != VOID_VALUE; j = next[j]) {
+            ctx->rules.p[j]->data.rule.flags = f;
+        }
     }
-    return n_p;
+    free(comp);
+    destroy_rule_graph(ctx, g);
+}
 
-EXCEPTION:;
-    destroy_node(n_p);
-    input->bufcur = p;
-    input->linenum = l;
-    input->charnum = n;
-    input->linepos = o;
-    return NULL;
+static bool_t check_if_recognizable(const context_t *ctx, const node_t *node, bool_t neg) {
+    code_flag_t f = CODE_FLAG_NONE;
+    set_code_flags(ctx, &f, node);
+    /* the recognition-only code cannot skip any code with side effects or code depending on thunks */
+    if (f & (CODE_FLAG_PROGPRED | CODE_FLAG_MATCH_CAPT | CODE_FLAG_MATCH_MVAR | CODE_FLAG_ERROR | CODE_FLAG_LEFT_RECURSION)) return FALSE;
+    /* the actions under a positive predicate are to be executed */
+    if (!neg && (f & (CODE_FLAG_RULE_VARIABLE | CODE_FLAG_ACTION))) return FALSE;
+    return TRUE;
 }
 
-static node_t *parse_term(input_state_t *input, node_t *rule) {
-    const size_t p = input->bufcur;
-    const size_t l = input->linenum;
-    const size_t n = input->charnum;
-    const size_t o = input->linepos;
-    node_t *n_p = NULL;
-    node_t *n_q = NULL;
-    node_t *n_r = NULL;
-    node_t *n_t = NULL;
-    const char t = input_state__match_character(input, '&') ? '&' : input_state__match_character(input, '!') ? '!' : '\0';
-    if (t) {
-        size_t p, l, m;
-        input_state__match_spaces(input);
-        p = input->bufcur;
-        l = input->linenum;
-        m = input_state__column_number(input);
-        if (input_state__match_code_block(input)) {
-            const size_t q = input->bufcur;
-            input_state__match_spaces(input);
-            n_p = create_node(NODE_PROGPRED);
-            n_p->data.progpred.neg = (t == '!') ? TRUE : FALSE;
-            n_p->data.progpred.code.text = strndup_e(input->buffer.p + p + 1, q - p - 2);
-            n_p->data.progpred.code.len = find_trailing_spaces_in_string(n_p->data.progpred.code.text, 0, q - p - 2);
-            file_pos__set(&n_p->data.progpred.code.fpos, input->path, l, m + 1); /* `+ 1`: to skip the heading '{' */
-            n_p->data.progpred.index = rule->data.rule.preds.n;
-            node_const_array__add(&(rule->data.rule.preds), n_p);
-        }
-    }
-    if (n_p == NULL) {
-        n_p = parse_primary(input, rule);
-        if (n_p == NULL) goto EXCEPTION;
-        if (input_state__match_character(input, '*')) {
-            input_state__match_spaces(input);
-            n_q = create_node(NODE_QUANTITY);
-            n_q->data.quantity.min = 0;
-            n_q->data.quantity.max = -1;
-            n_q->data.quantity.expr = n_p;
-        }
-        else if (input_state__match_character(input, '+')) {
-            input_state__match_spaces(input);
-            n_q = create_node(NODE_QUANTITY);
-            n_q->data.quantity.min = 1;
-            n_q->data.quantity.max = -1;
-            n_q->data.quantity.expr = n_p;
-        }
-        else if (input_state__match_character(input, '?')) {
-            input_state__match_spaces(input);
-            n_q = create_node(NODE_QUANTITY);
-            n_q->data.quantity.min = 0;
-            n_q->data.quantity.max = 1;
-            n_q->data.quantity.expr = n_p;
+static void mark_rule_if_evaluated(context_t *ctx, node_t *rule) {
+    /* the flags of the code only for evaluation are set for the rules to be evaluated */
+    rule->data.rule.eval = TRUE;
+    if (rule->data.rule.rvars.n > 0)
+        ctx->flags |= CODE_FLAG_RULE_VARIABLE;
+    if (rule->data.rule.capts.n > 0)
+        ctx->flags |= CODE_FLAG_CAPTS;
+}
+
+static void mark_rules_if_recognized_(context_t *ctx, node_t *node, bool_t recog, node_const_array_t *rules) {
+    if (node == NULL) return;
+    if (ctx->opts.dfa && is_automaton_node(node, ctx->opts.ascii)) return; /* the rules referenced in the automaton are inlined */
+    switch (node->type) {
+    case NODE_RULE:
+        print_error("Internal error [%d]\n", __LINE__);
+        exit(-1);
+    case NODE_REFERENCE:
+        if (node->data.reference.rule == NULL) break;
+        /* not recursive to handle a very long chain of rules */
+        if (recog) {
+            node_t *const r = (node_t *)node->data.reference.rule;
+            if (r->data.rule.recog) break;
+            r->data.rule.recog = TRUE;
+            ctx->flags |= CODE_FLAG_RECOGNITION;
+            if (r->data.rule.cycle > 0) ctx->flags |= CODE_FLAG_LEFT_RECURSION; /* the seed growing is needed in recognition */
+            node_const_array__add(&(rules[1]), r);
         }
         else {
-            n_q = n_p;
+            node_t *const r = (node_t *)node->data.reference.rule;
+            if (r->data.rule.eval) break;
+            mark_rule_if_evaluated(ctx, r);
+            node_const_array__add(&(rules[0]), r);
         }
-        switch (t) {
-        case '&':
-            n_r = create_node(NODE_PREDICATE);
-            n_r->data.predicate.neg = FALSE;
-            n_r->data.predicate.expr = n_q;
-            break;
-        case '!':
-            n_r = create_node(NODE_PREDICATE);
-            n_r->data.predicate.neg = TRUE;
-            n_r->data.predicate.expr = n_q;
-            break;
-        default:
-            n_r = n_q;
+        if (!recog && node->data.reference.index != VOID_VALUE)
+            ctx->flags |= CODE_FLAG_RULE_VARIABLE;
+        break;
+    case NODE_STRING:
+        break;
+    case NODE_CHARCLASS:
+        break;
+    case NODE_POSITION:
+        break;
+    case NODE_QUANTITY:
+        mark_rules_if_recognized_(ctx, node->data.quantity.expr, recog, rules);
+        break;
+    case NODE_PREDICATE:
+        node->data.predicate.recog = check_if_recognizable(ctx, node->data.predicate.expr, node->data.predicate.neg);
+        mark_rules_if_recognized_(ctx, node->data.predicate.expr, (recog || node->data.predicate.recog) ? TRUE : FALSE, rules);
+        break;
+    case NODE_PROGPRED:
+        break;
+    case NODE_SEQUENCE:
+        {
+            size_t i;
+            for (i = 0; i < node->data.sequence.nodes.n; i++) {
+                mark_rules_if_recognized_(ctx, node->data.sequence.nodes.p[i], recog, rules);
+            }
         }
-    }
-    else {
-        n_r = n_q = n_p;
-    }
-    if (input_state__match_character(input, '~')) {
-        size_t p, l, m;
-        input_state__match_spaces(input);
-        p = input->bufcur;
-        l = input->linenum;
-        m = input_state__column_number(input);
-        if (input_state__match_code_block(input)) {
-            const size_t q = input->bufcur;
-            input_state__match_spaces(input);
-            n_t = create_node(NODE_ERROR);
-            n_t->data.error.expr = n_r;
-            n_t->data.error.code.text = strndup_e(input->buffer.p + p + 1, q - p - 2);
-            n_t->data.error.code.len = find_trailing_spaces_in_string(n_t->data.error.code.text, 0, q - p - 2);
-            file_pos__set(&(n_t->data.error.code.fpos), input->path, l, m + 1); /* `+ 1`: to skip the heading '{' */
-            n_t->data.error.index = rule->data.rule.codes.n;
-            node_const_array__add(&(rule->data.rule.codes), n_t);
+        break;
+    case NODE_ALTERNATE:
+        {
+            size_t i;
+            for (i = 0; i < node->data.alternate.nodes.n; i++) {
+                mark_rules_if_recognized_(ctx, node->data.alternate.nodes.p[i], recog, rules);
+            }
         }
-        else {
-            goto EXCEPTION;
+        break;
+    case NODE_CAPTURE:
+        if (!recog)
+            ctx->flags |= CODE_FLAG_CAPTURE;
+        mark_rules_if_recognized_(ctx, node->data.capture.expr, recog, rules);
+        break;
+    case NODE_MATCH_CAPT:
+        break;
+    case NODE_MATCH_MVAR:
+        break;
+    case NODE_ACTION:
+        if (!recog) {
+            node->data.action.eval = TRUE;
+            ctx->flags |= CODE_FLAG_ACTION;
         }
+        break;
+    case NODE_ERROR:
+        if (!recog) {
+            node->data.error.eval = TRUE;
+            ctx->flags |= CODE_FLAG_ERROR;
+        }
+        mark_rules_if_recognized_(ctx, node->data.error.expr, recog, rules);
+        break;
+    default:
+        print_error("Internal error [%d]\n", __LINE__);
+        exit(-1);
     }
-    else {
-        n_t = n_r;
-    }
-    return n_t;
+}
 
-EXCEPTION:;
-    destroy_node(n_r);
-    input->bufcur = p;
-    input->linenum = l;
-    input->charnum = n;
-    input->linepos = o;
-    return NULL;
+static void mark_rules_if_recognized(context_t *ctx, node_t *node, bool_t recog) {
+    node_const_array_t a[2]; /* the rules to be visited for evaluation and those for recognition */
+    node_const_array__initialize(&(a[0]));
+    node_const_array__initialize(&(a[1]));
+    mark_rules_if_recognized_(ctx, node, recog, a);
+    for (;;) {
+        const size_t k = (a[1].n > 0) ? 1 : 0;
+        const node_t *r;
+        if (a[k].n == 0) break;
+        r = a[k].p[--a[k].n];
+        mark_rules_if_recognized_(ctx, r->data.rule.expr, k ? TRUE : FALSE, a);
+    }
+    node_const_array__finalize(&(a[0]));
+    node_const_array__finalize(&(a[1]));
 }
 
-static node_t *parse_sequence(input_state_t *input, node_t *rule) {
-    const size_t p = input->bufcur;
-    const size_t l = input->linenum;
-    const size_t n = input->charnum;
-    const size_t o = input->linepos;
-    node_array_t *a_t = NULL;
-    node_t *n_t = NULL;
-    node_t *n_u = NULL;
-    node_t *n_s = NULL;
-    n_t = parse_term(input, rule);
-    if (n_t == NULL) goto EXCEPTION;
-    n_u = parse_term(input, rule);
-    if (n_u != NULL) {
-        n_s = create_node(NODE_SEQUENCE);
-        a_t = &(n_s->data.sequence.nodes);
-        node_array__add(a_t, n_t);
-        node_array__add(a_t, n_u);
-        while ((n_t = parse_term(input, rule)) != NULL) {
-            node_array__add(a_t, n_t);
-        }
+static void dump_escaped_string(const char *str, size_t len) {
+    char s[5];
+    size_t i;
+    if (str == NULL) {
+        fprintf(stdout, "null");
+        return;
     }
-    else {
-        n_s = n_t;
+    for (i = 0; (len == VOID_VALUE) ? (str[i] != '\0') : (i < len); i++) {
+        fprintf(stdout, "%s", escape_character(str[i], &s));
     }
-    return n_s;
-
-EXCEPTION:;
-    input->bufcur = p;
-    input->linenum = l;
-    input->charnum = n;
-    input->linepos = o;
-    return NULL;
 }
 
-static node_t *parse_expression(input_state_t *input, node_t *rule) {
-    const size_t p = input->bufcur;
-    const size_t l = input->linenum;
-    const size_t n = input->charnum;
-    const size_t o = input->linepos;
-    size_t q;
-    node_array_t *a_s = NULL;
-    node_t *n_s = NULL;
-    node_t *n_e = NULL;
-    n_s = parse_sequence(input, rule);
-    if (n_s == NULL) goto EXCEPTION;
-    q = input->bufcur;
-    if (input_state__match_character(input, '/')) {
-        input->bufcur = q;
-        n_e = create_node(NODE_ALTERNATE);
-        a_s = &(n_e->data.alternate.nodes);
-        node_array__add(a_s, n_s);
-        while (input_state__match_character(input, '/')) {
-            input_state__match_spaces(input);
-            n_s = parse_sequence(input, rule);
-            if (n_s == NULL) goto EXCEPTION;
-            node_array__add(a_s, n_s);
-        }
+static void dump_integer_value(size_t value) {
+    if (value == VOID_VALUE) {
+        fprintf(stdout, "void");
     }
     else {
-        n_e = n_s;
+        fprintf(stdout, FMT_LU, (ulong_t)value);
     }
-    return n_e;
-
-EXCEPTION:;
-    destroy_node(n_e);
-    input->bufcur = p;
-    input->linenum = l;
-    input->charnum = n;
-    input->linepos = o;
-    return NULL;
-}
-
-static node_t *parse_rule(input_state_t *input) {
-    const size_t p = input->bufcur;
-    const size_t l = input->linenum;
-    const size_t m = input_state__column_number(input);
-    const size_t n = input->charnum;
-    const size_t o = input->linepos;
-    size_t q;
-    node_t *n_r = NULL;
-    if (!input_state__match_identifier(input)) goto EXCEPTION;
-    q = input->bufcur;
-    input_state__match_spaces(input);
-    if (!input_state__match_string(input, "<-")) goto EXCEPTION;
-    input_state__match_spaces(input);
-    n_r = create_node(NODE_RULE);
-    n_r->data.rule.expr = parse_expression(input, n_r);
-    if (n_r->data.rule.expr == NULL) goto EXCEPTION;
-    assert(q >= p);
-    n_r->data.rule.name = strndup_e(input->buffer.p + p, q - p);
-    file_pos__set(&(n_r->data.rule.fpos), input->path, l, m);
-    return n_r;
-
-EXCEPTION:;
-    destroy_node(n_r);
-    input->bufcur = p;
-    input->linenum = l;
-    input->charnum = n;
-    input->linepos = o;
-    return NULL;
-}
-
-static const char *get_value_type(context_t *ctx) {
-    return (ctx->vtype && ctx->vtype[0]) ? ctx->vtype : "int";
-}
-
-static const char *get_auxil_type(context_t *ctx) {
-    return (ctx->atype && ctx->atype[0]) ? ctx->atype : "void *";
-}
-
-static const char *get_prefix(context_t *ctx) {
-    return (ctx->prefix && ctx->prefix[0]) ? ctx->prefix : "pcc";
-}
-
-static void dump_options(context_t *ctx) {
-    fprintf(stdout, "value_type: '%s'\n", get_value_type(ctx));
-    fprintf(stdout, "auxil_type: '%s'\n", get_auxil_type(ctx));
-    fprintf(stdout, "prefix: '%s'\n", get_prefix(ctx));
 }
 
-static bool_t parse_and_check_version_(input_state_t *input, const char *version, bool_t *valid) {
-    bool_t v = TRUE;
-    bool_t f = TRUE;
-    for (;;) {
-        int o = -1;
-        {
-            const size_t l = input->linenum;
-            const size_t m = input_state__column_number(input);
-            if (input_state__match_string(input, "==")) {
-                o = 0;
-            }
-            else if (input_state__match_string(input, "!=")) {
-                o = 1;
-            }
-            else if (input_state__match_string(input, "<=")) {
-                o = 2;
-            }
-            else if (input_state__match_string(input, ">=")) {
-                o = 3;
-            }
-            else if (input_state__match_string(input, "<")) {
-                o = 4;
-            }
-            else if (input_state__match_string(input, ">")) {
-                o = 5;
-            }
-            else {
-                if (!f) {
-                    print_error("%s:" FMT_LU ":" FMT_LU ": Illegal operator syntax\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
-                    input->errnum++;
-                }
-                return FALSE;
+static void dump_node(context_t *ctx, const node_t *node, const int indent) {
+    if (node == NULL) return;
+    switch (node->type) {
+    case NODE_RULE:
+        fprintf(
+            stdout, "%*sRule(name:'%s', ref:%d, vars.len:" FMT_LU ", capts.len:" FMT_LU ", codes.len:" FMT_LU ", preds.len:" FMT_LU ") {\n",
+            indent, "", node->data.rule.name, node->data.rule.ref,
+            (ulong_t)node->data.rule.rvars.n, (ulong_t)node->data.rule.capts.n,
+            (ulong_t)node->data.rule.codes.n, (ulong_t)node->data.rule.preds.n
+        );
+        dump_node(ctx, node->data.rule.expr, indent + 2);
+        fprintf(stdout, "%*s}\n", indent, "");
+        break;
+    case NODE_REFERENCE:
+        fprintf(stdout, "%*sReference(var:'%s', index:", indent, "", node->data.reference.rvar);
+        dump_integer_value(node->data.reference.index);
+        fprintf(
+            stdout, ", name:'%s', rule:'%s')\n", node->data.reference.name,
+            (node->data.reference.rule) ? node->data.reference.rule->data.rule.name : NULL
+        );
+        break;
+    case NODE_STRING:
+        fprintf(stdout, "%*sString(value:'", indent, "");
+        dump_escaped_string(node->data.string.value.p, node->data.string.value.n);
+        fprintf(stdout, "')\n");
+        break;
+    case NODE_CHARCLASS:
+        fprintf(stdout, "%*sCharclass(value:'", indent, "");
+        dump_escaped_string(node->data.charclass.value.p, node->data.charclass.value.n);
+        fprintf(stdout, "')\n");
+        break;
+    case NODE_POSITION:
+        fprintf(stdout, "%*sPosition(value:" FMT_LU ")\n", indent, "", (ulong_t)node->data.position.value);
+        break;
+    case NODE_QUANTITY:
+        fprintf(stdout, "%*sQuantity(min:%d, max:%d) {\n", indent, "", node->data.quantity.min, node->data.quantity.max);
+        dump_node(ctx, node->data.quantity.expr, indent + 2);
+        fprintf(stdout, "%*s}\n", indent, "");
+        break;
+    case NODE_PREDICATE:
+        fprintf(stdout, "%*sPredicate(neg:%d) {\n", indent, "", node->data.predicate.neg);
+        dump_node(ctx, node->data.predicate.expr, indent + 2);
+        fprintf(stdout, "%*s}\n", indent, "");
+        break;
+    case NODE_PROGPRED:
+        fprintf(stdout, "%*sProgrammable Predicate(index:", indent, "");
+        dump_integer_value(node->data.progpred.index);
+        fprintf(stdout, ", neg:%d, code:{", node->data.progpred.neg);
+        dump_escaped_string(node->data.progpred.code.text, VOID_VALUE);
+        fprintf(stdout, "}, capts:");
+        if (node->data.progpred.capts.n > 0) {
+            size_t i;
+            fprintf(stdout, "\n");
+            for (i = 0; i < node->data.progpred.capts.n; i++) {
+                fprintf(stdout, "%*s$" FMT_LU "\n", indent + 2, "", (ulong_t)(node->data.progpred.capts.p[i]->data.capture.index + 1));
             }
-            input_state__match_spaces(input);
+            fprintf(stdout, "%*s)\n", indent, "");
+        }
+        else {
+            fprintf(stdout, "none)\n");
         }
+        break;
+    case NODE_SEQUENCE:
+        fprintf(
+            stdout, "%*sSequence(max:" FMT_LU ", len:" FMT_LU ") {\n",
+            indent, "", (ulong_t)node->data.sequence.nodes.m, (ulong_t)node->data.sequence.nodes.n
+        );
         {
-            const size_t p = input->bufcur;
-            const size_t l = input->linenum;
-            const size_t m = input_state__column_number(input);
-            if (!input_state__match_version(input)) {
-                print_error("%s:" FMT_LU ":" FMT_LU ": Illegal version syntax\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
-                input->errnum++;
-                return FALSE;
+            size_t i;
+            for (i = 0; i < node->data.sequence.nodes.n; i++) {
+                dump_node(ctx, node->data.sequence.nodes.p[i], indent + 2);
             }
-            input_state__match_spaces(input);
-            const int c = compare_versions(version ? version : IMPLICIT_VERSION, input->buffer.p + p);
-            switch (o) {
-            case 0: if (c != 0) v = FALSE; break;
-            case 1: if (c == 0) v = FALSE; break;
-            case 2: if (c > 0) v = FALSE; break;
-            case 3: if (c < 0) v = FALSE; break;
-            case 4: if (c >= 0) v = FALSE; break;
-            case 5: if (c <= 0) v = FALSE; break;
-            default: v = FALSE; /* in case */
+        }
+        fprintf(stdout, "%*s}\n", indent, "");
+        break;
+    case NODE_ALTERNATE:
+        fprintf(
+            stdout, "%*sAlternate(max:" FMT_LU ", len:" FMT_LU ") {\n",
+            indent, "", (ulong_t)node->data.alternate.nodes.m, (ulong_t)node->data.alternate.nodes.n
+        );
+        {
+            size_t i;
+            for (i = 0; i < node->data.alternate.nodes.n; i++) {
+                dump_node(ctx, node->data.alternate.nodes.p[i], indent + 2);
             }
         }
-        f = FALSE;
-        if (input_state__match_character(input, ',')) {
-            input_state__match_spaces(input);
+        fprintf(stdout, "%*s}\n", indent, "");
+        break;
+    case NODE_CAPTURE:
+        fprintf(stdout, "%*sCapture(index:", indent, "");
+        dump_integer_value(node->data.capture.index);
+        fprintf(stdout, ") {\n");
+        dump_node(ctx, node->data.capture.expr, indent + 2);
+        fprintf(stdout, "%*s}\n", indent, "");
+        break;
+    case NODE_MATCH_CAPT:
+        fprintf(stdout, "%*sMatch Captured(index:", indent, "");
+        dump_integer_value(node->data.match_capt.index);
+        fprintf(stdout, ")\n");
+        break;
+    case NODE_MATCH_MVAR:
+        fprintf(stdout, "%*sMatch Maker Variable(name:'%s')\n", indent, "", node->data.match_mvar.name);
+        break;
+    case NODE_ACTION:
+        fprintf(stdout, "%*sAction(index:", indent, "");
+        dump_integer_value(node->data.action.index);
+        fprintf(stdout, ", code:{");
+        dump_escaped_string(node->data.action.code.text, VOID_VALUE);
+        fprintf(stdout, "}, vars:");
+        if (node->data.action.rvars.n + node->data.action.capts.n > 0) {
+            size_t i;
+            fprintf(stdout, "\n");
+            for (i = 0; i < node->data.action.rvars.n; i++) {
+                fprintf(stdout, "%*s'%s'\n", indent + 2, "", node->data.action.rvars.p[i]->data.reference.rvar);
+            }
+            for (i = 0; i < node->data.action.capts.n; i++) {
+                fprintf(stdout, "%*s$" FMT_LU "\n", indent + 2, "", (ulong_t)(node->data.action.capts.p[i]->data.capture.index + 1));
+            }
+            fprintf(stdout, "%*s)\n", indent, "");
         }
         else {
-            break;
+            fprintf(stdout, "none)\n");
         }
-    }
-    if (valid) *valid = v;
-    return TRUE;
-}
-
-static bool_t parse_directive_block_(input_state_t *input, const char *name, code_block_array_t *output1, code_block_array_t *output2) {
-    if (!input_state__match_string(input, name)) return FALSE;
-    input_state__match_spaces(input);
-    {
-        const size_t p = input->bufcur;
-        const size_t l = input->linenum;
-        const size_t m = input_state__column_number(input);
-        if (input_state__match_code_block(input)) {
-            const size_t q = input->bufcur;
-            input_state__match_spaces(input);
-            if (output1 != NULL) {
-                code_block_t *const c = code_block_array__create_entry(output1);
-                c->text = strndup_e(input->buffer.p + p + 1, q - p - 2);
-                c->len = q - p - 2;
-                file_pos__set(&(c->fpos), input->path, l, m + 1); /* `+ 1`: to skip the heading '{' */
+        break;
+    case NODE_ERROR:
+        fprintf(stdout, "%*sError(index:", indent, "");
+        dump_integer_value(node->data.error.index);
+        fprintf(stdout, ", code:{");
+        dump_escaped_string(node->data.error.code.text, VOID_VALUE);
+        fprintf(stdout, "}, vars:\n");
+        {
+            size_t i;
+            for (i = 0; i < node->data.error.rvars.n; i++) {
+                fprintf(stdout, "%*s'%s'\n", indent + 2, "", node->data.error.rvars.p[i]->data.reference.rvar);
             }
-            if (output2 != NULL) {
-                code_block_t *const c = code_block_array__create_entry(output2);
-                c->text = strndup_e(input->buffer.p + p + 1, q - p - 2);
-                c->len = q - p - 2;
-                file_pos__set(&(c->fpos), input->path, l, m + 1); /* `+ 1`: to skip the heading '{' */
+            for (i = 0; i < node->data.error.capts.n; i++) {
+                fprintf(stdout, "%*s$" FMT_LU "\n", indent + 2, "", (ulong_t)(node->data.error.capts.p[i]->data.capture.index + 1));
             }
         }
-        else {
-            print_error("%s:" FMT_LU ":" FMT_LU ": Illegal %s syntax\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), name);
-            input->errnum++;
-        }
+        fprintf(stdout, "%*s) {\n", indent, "");
+        dump_node(ctx, node->data.error.expr, indent + 2);
+        fprintf(stdout, "%*s}\n", indent, "");
+        break;
+    default:
+        print_error("%*sInternal error [%d]\n", indent, "", __LINE__);
+        exit(-1);
     }
-    return TRUE;
 }
 
-static bool_t parse_directive_identifier_(input_state_t *input, const char *name, char **output) {
-    if (!input_state__match_string(input, name)) return FALSE;
-    input_state__match_spaces(input);
-    {
-        const size_t p = input->bufcur;
-        const size_t l = input->linenum;
-        const size_t m = input_state__column_number(input);
-        if (input_state__match_identifier(input)) {
-            const size_t q = input->bufcur;
-            input_state__match_spaces(input);
-            if (output) *output = strndup_e(input->buffer.p + p, q - p);
+static size_t add_rule_variable(node_t *rule, const node_t *node) {
+    /* returns the index of the rule variable, adding the reference node to the rule variables if the identifier is new */
+    node_rule_t *const r = &(rule->data.rule);
+    node_hash_table_t *const h = &(r->rvarhash);
+    size_t i, j;
+    if ((r->rvars.n + 1) * 2 > h->m) { /* keeps the load factor below 1/2 */
+        h->d = populate_bits(r->rvars.n * 4 + 3);
+        h->m = h->d + 1;
+        h->p = (const node_t **)realloc_e((node_t **)h->p, sizeof(const node_t *) * h->m);
+        for (j = 0; j < h->m; j++) {
+            h->p[j] = NULL;
         }
-        else {
-            print_error("%s:" FMT_LU ":" FMT_LU ": Illegal %s syntax\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), name);
-            input->errnum++;
+        for (i = 0; i < r->rvars.n; i++) {
+            j = hash_string(r->rvars.p[i]->data.reference.rvar) & h->d;
+            while (h->p[j] != NULL) {
+                j = (j + 1) & h->d;
+            }
+            h->p[j] = r->rvars.p[i];
         }
     }
-    return TRUE;
+    j = hash_string(node->data.reference.rvar) & h->d;
+    while (h->p[j] != NULL) {
+        assert(h->p[j]->type == NODE_REFERENCE);
+        if (strcmp(node->data.reference.rvar, h->p[j]->data.reference.rvar) == 0) return h->p[j]->data.reference.index;
+        j = (j + 1) & h->d;
+    }
+    h->p[j] = node;
+    node_const_array__add(&(r->rvars), node);
+    return r->rvars.n - 1;
 }
 
-static bool_t parse_directive_string_(input_state_t *input, const char *name, char **output, string_flag_t mode) {
+static node_t *parse_expression(input_state_t *input, node_t *rule);
+
+static node_t *parse_primary(input_state_t *input, node_t *rule) {
+    const size_t p = input->bufcur;
     const size_t l = input->linenum;
     const size_t m = input_state__column_number(input);
-    if (!input_state__match_string(input, name)) return FALSE;
-    input_state__match_spaces(input);
-    {
-        char *s = NULL;
-        const size_t p = input->bufcur;
-        const size_t lv = input->linenum;
-        const size_t mv = input_state__column_number(input);
-        size_t q;
-        if (input_state__match_quotation_single(input) || input_state__match_quotation_double(input)) {
-            q = input->bufcur;
+    const size_t o = input->linepos;
+    node_t *n_p = NULL;
+    if (input_state__match_identifier(input)) {
+        const size_t q = input->bufcur;
+        size_t r = VOID_VALUE, s = VOID_VALUE;
+        input_state__match_spaces(input);
+        if (input_state__match_character(input, ':')) {
+            input_state__match_spaces(input);
+            r = input->bufcur;
+            if (!input_state__match_identifier(input)) goto EXCEPTION;
+            s = input->bufcur;
             input_state__match_spaces(input);
-            s = strndup_e(input->buffer.p + p + 1, q - p - 2);
-            if (!unescape_string(s, NULL, FALSE)) {
-                print_error("%s:" FMT_LU ":" FMT_LU ": Illegal escape sequence\n", input->path, (ulong_t)(lv + 1), (ulong_t)(mv + 1));
-                input->errnum++;
-            }
         }
-        else {
-            print_error("%s:" FMT_LU ":" FMT_LU ": Illegal %s syntax\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), name);
-            input->errnum++;
+        if (input_state__match_string(input, "<-")) goto EXCEPTION;
+        n_p = create_node(NODE_REFERENCE);
+        if (r == VOID_VALUE) {
+            assert(q >= p);
+            n_p->data.reference.rvar = NULL;
+            n_p->data.reference.index = VOID_VALUE;
+            n_p->data.reference.name = strndup_e(input->buffer.p + p, q - p);
         }
-        if (s != NULL) {
-            string_flag_t f = STRING_FLAG_NONE;
-            bool_t b = TRUE;
-            remove_leading_spaces(s);
-            remove_trailing_spaces(s);
-            assert((mode & ~0x7) == 0);
-            if ((mode & STRING_FLAG_NOTEMPTY) && !is_filled_string(s)) {
-                print_error("%s:" FMT_LU ":" FMT_LU ": Empty string\n", input->path, (ulong_t)(lv + 1), (ulong_t)(mv + 1));
-                input->errnum++;
-                f |= STRING_FLAG_NOTEMPTY;
-            }
-            if ((mode & STRING_FLAG_NOTVOID) && strcmp(s, "void") == 0) {
-                print_error("%s:" FMT_LU ":" FMT_LU ": 'void' not allowed\n", input->path, (ulong_t)(lv + 1), (ulong_t)(mv + 1));
+        else {
+            assert(s != VOID_VALUE); /* s should have a valid value when r has a valid value */
+            assert(q >= p);
+            n_p->data.reference.rvar = strndup_e(input->buffer.p + p, q - p);
+            if (n_p->data.reference.rvar[0] == '_') {
+                print_error(
+                    "%s:" FMT_LU ":" FMT_LU ": Leading underscore in rule variable identifier '%s'\n",
+                    input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), n_p->data.reference.rvar
+                );
                 input->errnum++;
-                f |= STRING_FLAG_NOTVOID;
-            }
-            if ((mode & STRING_FLAG_IDENTIFIER) && !is_identifier_string(s)) {
-                if (!(f & STRING_FLAG_NOTEMPTY)) {
-                    print_error("%s:" FMT_LU ":" FMT_LU ": Invalid identifier\n", input->path, (ulong_t)(lv + 1), (ulong_t)(mv + 1));
-                    input->errnum++;
-                }
-                f |= STRING_FLAG_IDENTIFIER;
             }
-            if (output == NULL) {
-                print_error("%s:" FMT_LU ":" FMT_LU ": Definition of %s not allowed\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), name);
+            if (strncmp(n_p->data.reference.rvar, "pcc_", 4) == 0) {
+                print_error(
+                    "%s:" FMT_LU ":" FMT_LU ": Starting with 'pcc_' in rule variable identifier '%s'\n",
+                    input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), n_p->data.reference.rvar
+                );
                 input->errnum++;
-                b = FALSE;
             }
-            else if (*output != NULL) {
-                print_error("%s:" FMT_LU ":" FMT_LU ": Multiple definitions of %s\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), name);
+            if (strncmp(n_p->data.reference.rvar, "PCC_", 4) == 0) {
+                print_error(
+                    "%s:" FMT_LU ":" FMT_LU ": Starting with 'PCC_' in rule variable identifier '%s'\n",
+                    input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), n_p->data.reference.rvar
+                );
                 input->errnum++;
-                b = FALSE;
-            }
-            if (f == STRING_FLAG_NONE && b) {
-                assert(output != NULL);
-                *output = s;
-            }
-            else {
-                free(s);
             }
+            n_p->data.reference.index = add_rule_variable(rule, n_p);
+            assert(s >= r);
+            n_p->data.reference.name = strndup_e(input->buffer.p + r, s - r);
         }
+        file_pos__set(&(n_p->data.reference.fpos), input->path, l, m);
     }
-    return TRUE;
-}
-
-static bool_t parse_directive_version_(input_state_t *input, const char *name, char **output) {
-    const size_t l = input->linenum;
-    const size_t m = input_state__column_number(input);
-    if (!input_state__match_string(input, name)) return FALSE;
-    input_state__match_spaces(input);
-    {
-        char *s = NULL;
-        const size_t p = input->bufcur;
-        const size_t lv = input->linenum;
-        const size_t mv = input_state__column_number(input);
-        if (input_state__match_version(input)) {
+    else if (input_state__match_character(input, '(')) {
+        input_state__match_spaces(input);
+        n_p = parse_expression(input, rule);
+        if (n_p == NULL) goto EXCEPTION;
+        if (!input_state__match_character(input, ')')) goto EXCEPTION;
+        input_state__match_spaces(input);
+    }
+    else if (input_state__match_character(input, '<')) {
+        input_state__match_spaces(input);
+        n_p = create_node(NODE_CAPTURE);
+        n_p->data.capture.index = rule->data.rule.capts.n;
+        node_const_array__add(&(rule->data.rule.capts), n_p);
+        n_p->data.capture.expr = parse_expression(input, rule);
+        if (n_p->data.capture.expr == NULL || !input_state__match_character(input, '>')) {
+            rule->data.rule.capts.n = n_p->data.capture.index;
+            goto EXCEPTION;
+        }
+        input_state__match_spaces(input);
+    }
+    else if (input_state__match_character(input, '$')) {
+        size_t p;
+        input_state__match_spaces(input);
+        p = input->bufcur;
+        if (input_state__match_number(input)) {
             const size_t q = input->bufcur;
+            char *s;
             input_state__match_spaces(input);
+            n_p = create_node(NODE_MATCH_CAPT);
+            assert(q >= p);
             s = strndup_e(input->buffer.p + p, q - p);
-        }
-        else {
-            print_error("%s:" FMT_LU ":" FMT_LU ": Illegal %s syntax\n", input->path, (ulong_t)(lv + 1), (ulong_t)(mv + 1), name);
-            input->errnum++;
-        }
-        if (s != NULL) {
-            bool_t b = TRUE;
-            if (output == NULL) {
-                print_error("%s:" FMT_LU ":" FMT_LU ": Definition of %s not allowed\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), name);
+            n_p->data.match_capt.index = string_to_size_t(s);
+            if (n_p->data.match_capt.index == VOID_VALUE) {
+                print_error("%s:" FMT_LU ":" FMT_LU ": Invalid unsigned number '%s'\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), s);
                 input->errnum++;
-                b = FALSE;
             }
-            else if (*output != NULL) {
-                print_error("%s:" FMT_LU ":" FMT_LU ": Multiple definitions of %s\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), name);
+            else if (n_p->data.match_capt.index == 0) {
+                print_error("%s:" FMT_LU ":" FMT_LU ": 0 not allowed\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
                 input->errnum++;
-                b = FALSE;
             }
-            if (b) {
-                assert(output != NULL);
-                *output = s;
+            else if (s[0] == '0') {
+                print_error("%s:" FMT_LU ":" FMT_LU ": 0-prefixed number not allowed\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
+                input->errnum++;
+                n_p->data.match_capt.index = 0;
             }
-            else {
-                free(s);
+            free(s);
+            if (n_p->data.match_capt.index > 0 && n_p->data.match_capt.index != VOID_VALUE) {
+                n_p->data.match_capt.index--;
+                file_pos__set(&(n_p->data.match_capt.fpos), input->path, l, m);
             }
         }
+        else {
+            goto EXCEPTION;
+        }
     }
-    return TRUE;
-}
-
-static bool_t parse_directive_marker_(input_state_t *input, const char *name, string_array_t *output) {
-    if (!input_state__match_string(input, name)) return FALSE;
-    for (;;) {
-        input_state__match_spaces(input);
-        if (!input_state__match_character(input, '@')) break;
+    else if (input_state__match_character(input, '@')) {
+        size_t p;
         input_state__match_spaces(input);
-        {
-            const size_t p = input->bufcur;
-            const size_t l = input->linenum;
-            const size_t m = input_state__column_number(input);
-            if (!input_state__match_identifier(input)) {
-                print_error("%s:" FMT_LU ":" FMT_LU ": Illegal marker variable identifier\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
-                input->errnum++;
-                break;
-            }
-            else {
-                const size_t q = input->bufcur;
-                size_t i;
-                for (i = 0; i < output->n; i++) {
-                    if (strncmp(output->p[i], input->buffer.p + p, q - p) == 0) break;
-                }
-                if (i < output->n) {
-                    print_error(
-                        "%s:" FMT_LU ":" FMT_LU ": Duplicate marker variable identifier '%s'\n",
-                        input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), output->p[i]
-                    );
-                    input->errnum++;
-                }
-                else {
-                    string_array__add(output, input->buffer.p + p, q - p);
-                }
-                if (output->p[i][0] == '_') {
-                    print_error(
-                        "%s:" FMT_LU ":" FMT_LU ": Leading underscore in marker variable identifier '%s'\n",
-                        input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), output->p[i]
-                    );
-                    input->errnum++;
-                }
-                if (strncmp(output->p[i], "pcc_", 4) == 0) {
-                    print_error(
-                        "%s:" FMT_LU ":" FMT_LU ": Starting with 'pcc_' in marker variable identifier '%s'\n",
-                        input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), output->p[i]
-                    );
-                    input->errnum++;
-                }
-                if (strncmp(output->p[i], "PCC_", 4) == 0) {
-                    print_error(
-                        "%s:" FMT_LU ":" FMT_LU ": Starting with 'PCC_' in marker variable identifier '%s'\n",
-                        input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), output->p[i]
-                    );
-                    input->errnum++;
-                }
-            }
+        p = input->bufcur;
+        if (input_state__match_identifier(input)) {
+            const size_t q = input->bufcur;
+            input_state__match_spaces(input);
+            n_p = create_node(NODE_MATCH_MVAR);
+            assert(q >= p);
+            n_p->data.match_mvar.name = strndup_e(input->buffer.p + p, q - p);
+            file_pos__set(&(n_p->data.match_mvar.fpos), input->path, l, m);
+        }
+        else {
+            goto EXCEPTION;
         }
     }
-    return TRUE;
-}
-
-static bool_t parse_footer_(input_state_t *input, code_block_array_t *output) {
-    if (!input_state__match_footer_start(input)) return FALSE;
-    {
-        const size_t p = input->bufcur;
-        const size_t l = input->linenum;
-        const size_t m = input_state__column_number(input);
-        while (!input_state__match_eof(input)) input_state__match_character_any(input);
-        {
-            const size_t q = input->bufcur;
-            code_block_t *const c = code_block_array__create_entry(output);
-            c->text = strndup_e(input->buffer.p + p, q - p);
-            c->len = q - p;
-            file_pos__set(&(c->fpos), input->path, l, m);
+    else if (input_state__match_character(input, '^')) {
+        input_state__match_spaces(input);
+        n_p = create_node(NODE_POSITION);
+        n_p->data.position.value = 0;
+    }
+    else if (input_state__match_character(input, '.')) {
+        input_state__match_spaces(input);
+        n_p = create_node(NODE_CHARCLASS);
+        char_array__clear(&(n_p->data.charclass.value));
+    }
+    else if (input_state__match_character_class(input)) {
+        const size_t q = input->bufcur;
+        input_state__match_spaces(input);
+        n_p = create_node(NODE_CHARCLASS);
+        char_array__set_chars(&(n_p->data.charclass.value), input->buffer.p + p + 1, q - p - 2);
+        if (n_p->data.charclass.value.n == 0) {
+            print_error("%s:" FMT_LU ":" FMT_LU ": Character missing\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
+            input->errnum++;
+        }
+        if (!unescape_string(n_p->data.charclass.value.p, &(n_p->data.charclass.value.n), TRUE)) {
+            print_error("%s:" FMT_LU ":" FMT_LU ": Illegal escape sequence\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
+            input->errnum++;
+        }
+        if (!input->ascii && !is_valid_utf8_string(n_p->data.charclass.value.p, n_p->data.charclass.value.n)) {
+            print_error("%s:" FMT_LU ":" FMT_LU ": Invalid UTF-8 string\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
+            input->errnum++;
         }
     }
-    return TRUE;
+    else if (input_state__match_quotation_single(input) || input_state__match_quotation_double(input)) {
+        const size_t q = input->bufcur;
+        input_state__match_spaces(input);
+        n_p = create_node(NODE_STRING);
+        char_array__set_chars(&(n_p->data.string.value), input->buffer.p + p + 1, q - p - 2);
+        if (!unescape_string(n_p->data.string.value.p, &(n_p->data.string.value.n), FALSE)) {
+            print_error("%s:" FMT_LU ":" FMT_LU ": Illegal escape sequence\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
+            input->errnum++;
+        }
+        if (!input->ascii && !is_valid_utf8_string(n_p->data.string.value.p, n_p->data.string.value.n)) {
+            print_error("%s:" FMT_LU ":" FMT_LU ": Invalid UTF-8 string\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
+            input->errnum++;
+        }
+    }
+    else if (input_state__match_code_block(input)) {
+        const size_t q = input->bufcur;
+        input_state__match_spaces(input);
+        n_p = create_node(NODE_ACTION);
+        n_p->data.action.code.text = strndup_e(input->buffer.p + p + 1, q - p - 2);
+        n_p->data.action.code.len = find_trailing_spaces_in_string(n_p->data.action.code.text, 0, q - p - 2);
+        file_pos__set(&(n_p->data.action.code.fpos), input->path, l, m + 1); /* `+ 1`: to skip the heading '{' */
+        n_p->data.action.index = rule->data.rule.codes.n;
+        node_const_array__add(&(rule->data.rule.codes), n_p);
+    }
+    else {
+        goto EXCEPTION;
+    }
+    return n_p;
+
+EXCEPTION:;
+    destroy_node(n_p);
+    input->bufcur = p;
+    input->linenum = l;
+    input->linepos = o;
+    return NULL;
+}
+
+static node_t *parse_term(input_state_t *input, node_t *rule) {
+    const size_t p = input->bufcur;
+    const size_t l = input->linenum;
+    const size_t o = input->linepos;
+    node_t *n_p = NULL;
+    node_t *n_q = NULL;
+    node_t *n_r = NULL;
+    node_t *n_t = NULL;
+    const char t = input_state__match_character(input, '&') ? '&' : input_state__match_character(input, '!') ? '!' : '\0';
+    if (t) {
+        size_t p, l, m;
+        input_state__match_spaces(input);
+        p = input->bufcur;
+        l = input->linenum;
+        m = input_state__column_number(input);
+        if (input_state__match_code_block(input)) {
+            const size_t q = input->bufcur;
+            input_state__match_spaces(input);
+            n_p = create_node(NODE_PROGPRED);
+            n_p->data.progpred.neg = (t == '!') ? TRUE : FALSE;
+            n_p->data.progpred.code.text = strndup_e(input->buffer.p + p + 1, q - p - 2);
+            n_p->data.progpred.code.len = find_trailing_spaces_in_string(n_p->data.progpred.code.text, 0, q - p - 2);
+            file_pos__set(&n_p->data.progpred.code.fpos, input->path, l, m + 1); /* `+ 1`: to skip the heading '{' */
+            n_p->data.progpred.index = rule->data.rule.preds.n;
+            node_const_array__add(&(rule->data.rule.preds), n_p);
+        }
+    }
+    if (n_p == NULL) {
+        n_p = parse_primary(input, rule);
+        if (n_p == NULL) goto EXCEPTION;
+        if (input_state__match_character(input, '*')) {
+            input_state__match_spaces(input);
+            n_q = create_node(NODE_QUANTITY);
+            n_q->data.quantity.min = 0;
+            n_q->data.quantity.max = -1;
+            n_q->data.quantity.expr = n_p;
+        }
+        else if (input_state__match_character(input, '+')) {
+            input_state__match_spaces(input);
+            n_q = create_node(NODE_QUANTITY);
+            n_q->data.quantity.min = 1;
+            n_q->data.quantity.max = -1;
+            n_q->data.quantity.expr = n_p;
+        }
+        else if (input_state__match_character(input, '?')) {
+            input_state__match_spaces(input);
+            n_q = create_node(NODE_QUANTITY);
+            n_q->data.quantity.min = 0;
+            n_q->data.quantity.max = 1;
+            n_q->data.quantity.expr = n_p;
+        }
+        else {
+            n_q = n_p;
+        }
+        switch (t) {
+        case '&':
+            n_r = create_node(NODE_PREDICATE);
+            n_r->data.predicate.neg = FALSE;
+            n_r->data.predicate.expr = n_q;
+            break;
+        case '!':
+            n_r = create_node(NODE_PREDICATE);
+            n_r->data.predicate.neg = TRUE;
+            n_r->data.predicate.expr = n_q;
+            break;
+        default:
+            n_r = n_q;
+        }
+    }
+    else {
+        n_r = n_q = n_p;
+    }
+    if (input_state__match_character(input, '~')) {
+        size_t p, l, m;
+        input_state__match_spaces(input);
+        p = input->bufcur;
+        l = input->linenum;
+        m = input_state__column_number(input);
+        if (input_state__match_code_block(input)) {
+            const size_t q = input->bufcur;
+            input_state__match_spaces(input);
+            n_t = create_node(NODE_ERROR);
+            n_t->data.error.expr = n_r;
+            n_t->data.error.code.text = strndup_e(input->buffer.p + p + 1, q - p - 2);
+            n_t->data.error.code.len = find_trailing_spaces_in_string(n_t->data.error.code.text, 0, q - p - 2);
+            file_pos__set(&(n_t->data.error.code.fpos), input->path, l, m + 1); /* `+ 1`: to skip the heading '{' */
+            n_t->data.error.index = rule->data.rule.codes.n;
+            node_const_array__add(&(rule->data.rule.codes), n_t);
+        }
+        else {
+            goto EXCEPTION;
+        }
+    }
+    else {
+        n_t = n_r;
+    }
+    return n_t;
+
+EXCEPTION:;
+    destroy_node(n_r);
+    input->bufcur = p;
+    input->linenum = l;
+    input->linepos = o;
+    return NULL;
+}
+
+static node_t *parse_sequence(input_state_t *input, node_t *rule) {
+    const size_t p = input->bufcur;
+    const size_t l = input->linenum;
+    const size_t o = input->linepos;
+    node_array_t *a_t = NULL;
+    node_t *n_t = NULL;
+    node_t *n_u = NULL;
+    node_t *n_s = NULL;
+    n_t = parse_term(input, rule);
+    if (n_t == NULL) goto EXCEPTION;
+    n_u = parse_term(input, rule);
+    if (n_u != NULL) {
+        n_s = create_node(NODE_SEQUENCE);
+        a_t = &(n_s->data.sequence.nodes);
+        node_array__add(a_t, n_t);
+        node_array__add(a_t, n_u);
+        while ((n_t = parse_term(input, rule)) != NULL) {
+            node_array__add(a_t, n_t);
+        }
+    }
+    else {
+        n_s = n_t;
+    }
+    return n_s;
+
+EXCEPTION:;
+    input->bufcur = p;
+    input->linenum = l;
+    input->linepos = o;
+    return NULL;
+}
+
+static node_t *parse_expression(input_state_t *input, node_t *rule) {
+    const size_t p = input->bufcur;
+    const size_t l = input->linenum;
+    const size_t o = input->linepos;
+    size_t q;
+    node_array_t *a_s = NULL;
+    node_t *n_s = NULL;
+    node_t *n_e = NULL;
+    n_s = parse_sequence(input, rule);
+    if (n_s == NULL) goto EXCEPTION;
+    q = input->bufcur;
+    if (input_state__match_character(input, '/')) {
+        input->bufcur = q;
+        n_e = create_node(NODE_ALTERNATE);
+        a_s = &(n_e->data.alternate.nodes);
+        node_array__add(a_s, n_s);
+        while (input_state__match_character(input, '/')) {
+            input_state__match_spaces(input);
+            n_s = parse_sequence(input, rule);
+            if (n_s == NULL) goto EXCEPTION;
+            node_array__add(a_s, n_s);
+        }
+    }
+    else {
+        n_e = n_s;
+    }
+    return n_e;
+
+EXCEPTION:;
+    destroy_node(n_e);
+    input->bufcur = p;
+    input->linenum = l;
+    input->linepos = o;
+    return NULL;
+}
+
+static node_t *parse_rule(input_state_t *input) {
+    const size_t p = input->bufcur;
+    const size_t l = input->linenum;
+    const size_t m = input_state__column_number(input);
+    const size_t o = input->linepos;
+    size_t q;
+    node_t *n_r = NULL;
+    if (!input_state__match_identifier(input)) goto EXCEPTION;
+    q = input->bufcur;
+    input_state__match_spaces(input);
+    if (!input_state__match_string(input, "<-")) goto EXCEPTION;
+    input_state__match_spaces(input);
+    n_r = create_node(NODE_RULE);
+    n_r->data.rule.expr = parse_expression(input, n_r);
+    if (n_r->data.rule.expr == NULL) goto EXCEPTION;
+    assert(q >= p);
+    n_r->data.rule.name = strndup_e(input->buffer.p + p, q - p);
+    file_pos__set(&(n_r->data.rule.fpos), input->path, l, m);
+    return n_r;
+
+EXCEPTION:;
+    destroy_node(n_r);
+    input->bufcur = p;
+    input->linenum = l;
+    input->linepos = o;
+    return NULL;
+}
+
+static const char *get_value_type(context_t *ctx) {
+    return (ctx->vtype && ctx->vtype[0]) ? ctx->vtype : "int";
+}
+
+static const char *get_auxil_type(context_t *ctx) {
+    return (ctx->atype && ctx->atype[0]) ? ctx->atype : "void *";
+}
+
+static const char *get_prefix(context_t *ctx) {
+    return (ctx->prefix && ctx->prefix[0]) ? ctx->prefix : "pcc";
+}
+
+static void dump_options(context_t *ctx) {
+    fprintf(stdout, "value_type: '%s'\n", get_value_type(ctx));
+    fprintf(stdout, "auxil_type: '%s'\n", get_auxil_type(ctx));
+    fprintf(stdout, "prefix: '%s'\n", get_prefix(ctx));
+}
+
+static bool_t parse_and_check_version_(input_state_t *input, const char *version, bool_t *valid) {
+    bool_t v = TRUE;
+    bool_t f = TRUE;
+    for (;;) {
+        int o = -1;
+        {
+            const size_t l = input->linenum;
+            const size_t m = input_state__column_number(input);
+            if (input_state__match_string(input, "==")) {
+                o = 0;
+            }
+            else if (input_state__match_string(input, "!=")) {
+                o = 1;
+            }
+            else if (input_state__match_string(input, "<=")) {
+                o = 2;
+            }
+            else if (input_state__match_string(input, ">=")) {
+                o = 3;
+            }
+            else if (input_state__match_string(input, "<")) {
+                o = 4;
+            }
+            else if (input_state__match_string(input, ">")) {
+                o = 5;
+            }
+            else {
+                if (!f) {
+                    print_error("%s:" FMT_LU ":" FMT_LU ": Illegal operator syntax\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
+                    input->errnum++;
+                }
+                return FALSE;
+            }
+            input_state__match_spaces(input);
+        }
+        {
+            const size_t p = input->bufcur;
+            const size_t l = input->linenum;
+            const size_t m = input_state__column_number(input);
+            if (!input_state__match_version(input)) {
+                print_error("%s:" FMT_LU ":" FMT_LU ": Illegal version syntax\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
+                input->errnum++;
+                return FALSE;
+            }
+            input_state__match_spaces(input);
+            const int c = compare_versions(version ? version : IMPLICIT_VERSION, input->buffer.p + p);
+            switch (o) {
+            case 0: if (c != 0) v = FALSE; break;
+            case 1: if (c == 0) v = FALSE; break;
+            case 2: if (c > 0) v = FALSE; break;
+            case 3: if (c < 0) v = FALSE; break;
+            case 4: if (c >= 0) v = FALSE; break;
+            case 5: if (c <= 0) v = FALSE; break;
+            default: v = FALSE; /* in case */
+            }
+        }
+        f = FALSE;
+        if (input_state__match_character(input, ',')) {
+            input_state__match_spaces(input);
+        }
+        else {
+            break;
+        }
+    }
+    if (valid) *valid = v;
+    return TRUE;
+}
+
+static bool_t parse_directive_block_(input_state_t *input, const char *name, code_block_array_t *output1, code_block_array_t *output2) {
+    if (!input_state__match_string(input, name)) return FALSE;
+    input_state__match_spaces(input);
+    {
+        const size_t p = input->bufcur;
+        const size_t l = input->linenum;
+        const size_t m = input_state__column_number(input);
+        if (input_state__match_code_block(input)) {
+            const size_t q = input->bufcur;
+            input_state__match_spaces(input);
+            if (output1 != NULL) {
+                code_block_t *const c = code_block_array__create_entry(output1);
+                c->text = strndup_e(input->buffer.p + p + 1, q - p - 2);
+                c->len = q - p - 2;
+                file_pos__set(&(c->fpos), input->path, l, m + 1); /* `+ 1`: to skip the heading '{' */
+            }
+            if (output2 != NULL) {
+                code_block_t *const c = code_block_array__create_entry(output2);
+                c->text = strndup_e(input->buffer.p + p + 1, q - p - 2);
+                c->len = q - p - 2;
+                file_pos__set(&(c->fpos), input->path, l, m + 1); /* `+ 1`: to skip the heading '{' */
+            }
+        }
+        else {
+            print_error("%s:" FMT_LU ":" FMT_LU ": Illegal %s syntax\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), name);
+            input->errnum++;
+        }
+    }
+    return TRUE;
+}
+
+static bool_t parse_directive_identifier_(input_state_t *input, const char *name, char **output) {
+    if (!input_state__match_string(input, name)) return FALSE;
+    input_state__match_spaces(input);
+    {
+        const size_t p = input->bufcur;
+        const size_t l = input->linenum;
+        const size_t m = input_state__column_number(input);
+        if (input_state__match_identifier(input)) {
+            const size_t q = input->bufcur;
+            input_state__match_spaces(input);
+            if (output) *output = strndup_e(input->buffer.p + p, q - p);
+        }
+        else {
+            print_error("%s:" FMT_LU ":" FMT_LU ": Illegal %s syntax\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), name);
+            input->errnum++;
+        }
+    }
+    return TRUE;
+}
+
+static bool_t parse_directive_string_(input_state_t *input, const char *name, char **output, string_flag_t mode) {
+    const size_t l = input->linenum;
+    const size_t m = input_state__column_number(input);
+    if (!input_state__match_string(input, name)) return FALSE;
+    input_state__match_spaces(input);
+    {
+        char *s = NULL;
+        const size_t p = input->bufcur;
+        const size_t lv = input->linenum;
+        const size_t mv = input_state__column_number(input);
+        size_t q;
+        if (input_state__match_quotation_single(input) || input_state__match_quotation_double(input)) {
+            q = input->bufcur;
+            input_state__match_spaces(input);
+            s = strndup_e(input->buffer.p + p + 1, q - p - 2);
+            if (!unescape_string(s, NULL, FALSE)) {
+                print_error("%s:" FMT_LU ":" FMT_LU ": Illegal escape sequence\n", input->path, (ulong_t)(lv + 1), (ulong_t)(mv + 1));
+                input->errnum++;
+            }
+        }
+        else {
+            print_error("%s:" FMT_LU ":" FMT_LU ": Illegal %s syntax\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), name);
+            input->errnum++;
+        }
+        if (s != NULL) {
+            string_flag_t f = STRING_FLAG_NONE;
+            bool_t b = TRUE;
+            remove_leading_spaces(s);
+            remove_trailing_spaces(s);
+            assert((mode & ~0x7) == 0);
+            if ((mode & STRING_FLAG_NOTEMPTY) && !is_filled_string(s)) {
+                print_error("%s:" FMT_LU ":" FMT_LU ": Empty string\n", input->path, (ulong_t)(lv + 1), (ulong_t)(mv + 1));
+                input->errnum++;
+                f |= STRING_FLAG_NOTEMPTY;
+            }
+            if ((mode & STRING_FLAG_NOTVOID) && strcmp(s, "void") == 0) {
+                print_error("%s:" FMT_LU ":" FMT_LU ": 'void' not allowed\n", input->path, (ulong_t)(lv + 1), (ulong_t)(mv + 1));
+                input->errnum++;
+                f |= STRING_FLAG_NOTVOID;
+            }
+            if ((mode & STRING_FLAG_IDENTIFIER) && !is_identifier_string(s)) {
+                if (!(f & STRING_FLAG_NOTEMPTY)) {
+                    print_error("%s:" FMT_LU ":" FMT_LU ": Invalid identifier\n", input->path, (ulong_t)(lv + 1), (ulong_t)(mv + 1));
+                    input->errnum++;
+                }
+                f |= STRING_FLAG_IDENTIFIER;
+            }
+            if (output == NULL) {
+                print_error("%s:" FMT_LU ":" FMT_LU ": Definition of %s not allowed\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), name);
+                input->errnum++;
+                b = FALSE;
+            }
+            else if (*output != NULL) {
+                print_error("%s:" FMT_LU ":" FMT_LU ": Multiple definitions of %s\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), name);
+                input->errnum++;
+                b = FALSE;
+            }
+            if (f == STRING_FLAG_NONE && b) {
+                assert(output != NULL);
+                *output = s;
+            }
+            else {
+                free(s);
+            }
+        }
+    }
+    return TRUE;
+}
+
+static bool_t parse_directive_version_(input_state_t *input, const char *name, char **output) {
+    const size_t l = input->linenum;
+    const size_t m = input_state__column_number(input);
+    if (!input_state__match_string(input, name)) return FALSE;
+    input_state__match_spaces(input);
+    {
+        char *s = NULL;
+        const size_t p = input->bufcur;
+        const size_t lv = input->linenum;
+        const size_t mv = input_state__column_number(input);
+        if (input_state__match_version(input)) {
+            const size_t q = input->bufcur;
+            input_state__match_spaces(input);
+            s = strndup_e(input->buffer.p + p, q - p);
+        }
+        else {
+            print_error("%s:" FMT_LU ":" FMT_LU ": Illegal %s syntax\n", input->path, (ulong_t)(lv + 1), (ulong_t)(mv + 1), name);
+            input->errnum++;
+        }
+        if (s != NULL) {
+            bool_t b = TRUE;
+            if (output == NULL) {
+                print_error("%s:" FMT_LU ":" FMT_LU ": Definition of %s not allowed\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), name);
+                input->errnum++;
+                b = FALSE;
+            }
+            else if (*output != NULL) {
+                print_error("%s:" FMT_LU ":" FMT_LU ": Multiple definitions of %s\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), name);
+                input->errnum++;
+                b = FALSE;
+            }
+            if (b) {
+                assert(output != NULL);
+                *output = s;
+            }
+            else {
+                free(s);
+            }
+        }
+    }
+    return TRUE;
+}
+
+static bool_t parse_directive_marker_(input_state_t *input, const char *name, string_array_t *output) {
+    if (!input_state__match_string(input, name)) return FALSE;
+    for (;;) {
+        input_state__match_spaces(input);
+        if (!input_state__match_character(input, '@')) break;
+        input_state__match_spaces(input);
+        {
+            const size_t p = input->bufcur;
+            const size_t l = input->linenum;
+            const size_t m = input_state__column_number(input);
+            if (!input_state__match_identifier(input)) {
+                print_error("%s:" FMT_LU ":" FMT_LU ": Illegal marker variable identifier\n", input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
+                input->errnum++;
+                break;
+            }
+            else {
+                const size_t q = input->bufcur;
+                size_t i;
+                for (i = 0; i < output->n; i++) {
+                    if (strncmp(output->p[i], input->buffer.p + p, q - p) == 0) break;
+                }
+                if (i < output->n) {
+                    print_error(
+                        "%s:" FMT_LU ":" FMT_LU ": Duplicate marker variable identifier '%s'\n",
+                        input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), output->p[i]
+                    );
+                    input->errnum++;
+                }
+                else {
+                    string_array__add(output, input->buffer.p + p, q - p);
+                }
+                if (output->p[i][0] == '_') {
+                    print_error(
+                        "%s:" FMT_LU ":" FMT_LU ": Leading underscore in marker variable identifier '%s'\n",
+                        input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), output->p[i]
+                    );
+                    input->errnum++;
+                }
+                if (strncmp(output->p[i], "pcc_", 4) == 0) {
+                    print_error(
+                        "%s:" FMT_LU ":" FMT_LU ": Starting with 'pcc_' in marker variable identifier '%s'\n",
+                        input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), output->p[i]
+                    );
+                    input->errnum++;
+                }
+                if (strncmp(output->p[i], "PCC_", 4) == 0) {
+                    print_error(
+                        "%s:" FMT_LU ":" FMT_LU ": Starting with 'PCC_' in marker variable identifier '%s'\n",
+                        input->path, (ulong_t)(l + 1), (ulong_t)(m + 1), output->p[i]
+                    );
+                    input->errnum++;
+                }
+            }
+        }
+    }
+    return TRUE;
+}
+
+static bool_t parse_footer_(input_state_t *input, code_block_array_t *output) {
+    if (!input_state__match_footer_start(input)) return FALSE;
+    {
+        const size_t p = input->bufcur;
+        const size_t l = input->linenum;
+        const size_t m = input_state__column_number(input);
+        while (!input_state__match_eof(input)) input_state__match_character_any(input);
+        {
+            const size_t q = input->bufcur;
+            code_block_t *const c = code_block_array__create_entry(output);
+            c->text = strndup_e(input->buffer.p + p, q - p);
+            c->len = q - p;
+            file_pos__set(&(c->fpos), input->path, l, m);
+        }
+    }
+    return TRUE;
+}
+
+static size_t parse_file_(context_t *ctx) {
+    size_t iinfo;
+    if (ctx->input == NULL) return VOID_VALUE;
+    if (file_info_map__get(&(ctx->finfo), ctx->input->file, ctx->input->path, &iinfo)) return iinfo; /* already imported */
+    {
+        const bool_t imp = input_state__is_in_imported(ctx->input);
+        bool_t b = TRUE;
+        input_state__match_spaces(ctx->input);
+        for (;;) {
+            char *s = NULL;
+            size_t l, m, o;
+            if (input_state__match_eof(ctx->input) || parse_footer_(ctx->input, &(ctx->fsource))) break;
+            l = ctx->input->linenum;
+            m = input_state__column_number(ctx->input);
+            o = ctx->input->linepos;
+            if (parse_directive_string_(ctx->input, "%import", &s, STRING_FLAG_NOTEMPTY)) {
+                size_t ii = VOID_VALUE;
+                bool_t v;
+                if (s) {
+                    if (is_absolute_path(s)) {
+                        FILE *const file = fopen(s, "rb");
+                        if (file) {
+                            ctx->input = input_state__create(s, file, ctx->input, &(ctx->opts));
+                            ii = parse_file_(ctx);
+                            ctx->input = input_state__destroy(ctx->input);
+                        }
+                        else {
+                            if (errno != ENOENT) {
+                                print_error(
+                                    "%s:" FMT_LU ":" FMT_LU ": Cannot open file to read: %s\n",
+                                    ctx->input->path, (ulong_t)(l + 1), (ulong_t)(m + 1),
+                                    s
+                                );
+                            }
+                            else {
+                                print_error(
+                                    "%s:" FMT_LU ":" FMT_LU ": File not found: %s\n",
+                                    ctx->input->path, (ulong_t)(l + 1), (ulong_t)(m + 1),
+                                    s
+                                );
+                            }
+                            ctx->input->errnum++;
+                        }
+                    }
+                    else {
+                        size_t i = 0;
+                        char *path = replace_filename(ctx->input->path, s);
+                        FILE *file = fopen(path, "rb");
+                        while (file == NULL) {
+                            if (errno != ENOENT) {
+                                print_error(
+                                    "%s:" FMT_LU ":" FMT_LU ": Cannot open file to read: %s\n",
+                                    ctx->input->path, (ulong_t)(l + 1), (ulong_t)(m + 1),
+                                    path
+                                );
+                                ctx->input->errnum++;
+                                break;
+                            }
+                            if (i >= ctx->dirs->n) {
+                                print_error(
+                                    "%s:" FMT_LU ":" FMT_LU ": File not found: %s\n",
+                                    ctx->input->path, (ulong_t)(l + 1), (ulong_t)(m + 1),
+                                    s
+                                );
+                                ctx->input->errnum++;
+                                break;
+                            }
+                            free(path);
+                            path = add_filename(ctx->dirs->p[i++], s);
+                            file = fopen(path, "rb");
+                        }
+                        if (file) {
+                            ctx->input = input_state__create(path, file, ctx->input, &(ctx->opts));
+                            ii = parse_file_(ctx);
+                            ctx->input = input_state__destroy(ctx->input);
+                        }
+                        free(path);
+                    }
+                }
+                if (ii != VOID_VALUE && parse_and_check_version_(ctx->input, ctx->finfo.p[ii].version, &v) && !v) {
+                    print_error(
+                        "%s:" FMT_LU ":" FMT_LU ": Version not matched: %s\n",
+                        ctx->input->path, (ulong_t)(l + 1), (ulong_t)(m + 1),
+                        s
+                    );
+                    ctx->input->errnum++;
+                }
+                free(s);
+                b = TRUE;
+            }
+            else if (parse_directive_identifier_(ctx->input, "%requires", &s)) {
+                if (strcmp(s, "packcc") == 0) {
+                    bool_t v;
+                    if (!parse_and_check_version_(ctx->input, PACKCC_VERSION, &v)) {
+                        print_error(
+                            "%s:" FMT_LU ":" FMT_LU ": Version constraints missing: %s\n",
+                            ctx->input->path, (ulong_t)(l + 1), (ulong_t)(m + 1),
+                            s
+                        );
+                        ctx->input->errnum++;
+                    }
+                    else if (!v) {
+                        print_error(
+                            "%s:" FMT_LU ":" FMT_LU ": Version not matched: %s\n",
+                            ctx->input->path, (ulong_t)(l + 1), (ulong_t)(m + 1),
+                            s
+                        );
+                        ctx->input->errnum++;
+                    }
+                }
+                else {
+                    print_error(
+                        "%s:" FMT_LU ":" FMT_LU ": Invalid name: %s\n",
+                        ctx->input->path, (ulong_t)(l + 1), (ulong_t)(m + 1),
+                        s
+                    );
+                    ctx->input->errnum++;
+                }
+                free(s);
+                b = TRUE;
+            }
+            else if (
+                parse_directive_version_(ctx->input, "%version", &(ctx->finfo.p[iinfo].version)) ||
+                parse_directive_block_(ctx->input, "%earlysource", &(ctx->esource), NULL) ||
+                parse_directive_block_(ctx->input, "%earlyheader", &(ctx->eheader), NULL) ||
+                parse_directive_block_(ctx->input, "%earlycommon", &(ctx->esource), &(ctx->eheader)) ||
+                parse_directive_block_(ctx->input, "%source", &(ctx->source), NULL) ||
+                parse_directive_block_(ctx->input, "%header", &(ctx->header), NULL) ||
+                parse_directive_block_(ctx->input, "%common", &(ctx->source), &(ctx->header)) ||
+                parse_directive_string_(ctx->input, "%value", imp ? NULL : &(ctx->vtype), STRING_FLAG_NOTEMPTY | STRING_FLAG_NOTVOID) ||
+                parse_directive_string_(ctx->input, "%auxil", imp ? NULL : &(ctx->atype), STRING_FLAG_NOTEMPTY | STRING_FLAG_NOTVOID) ||
+                parse_directive_string_(ctx->input, "%prefix", imp ? NULL : &(ctx->prefix), STRING_FLAG_NOTEMPTY | STRING_FLAG_IDENTIFIER) ||
+                parse_directive_string_(ctx->input, "%split", imp ? NULL : &(ctx->split), STRING_FLAG_NOTEMPTY | STRING_FLAG_IDENTIFIER) ||
+                parse_directive_marker_(ctx->input, "%marker", &(ctx->mvars))
+            ) {
+                b = TRUE;
+            }
+            else if (input_state__match_character(ctx->input, '%')) {
+                print_error("%s:" FMT_LU ":" FMT_LU ": Invalid directive\n", ctx->input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
+                ctx->input->errnum++;
+                input_state__match_identifier(ctx->input);
+                input_state__match_spaces(ctx->input);
+                b = TRUE;
+            }
+            else {
+                node_t *const n_r = parse_rule(ctx->input);
+                if (n_r == NULL) {
+                    if (b) {
+                        print_error("%s:" FMT_LU ":" FMT_LU ": Illegal rule syntax\n", ctx->input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
+                        ctx->input->errnum++;
+                        b = FALSE;
+                    }
+                    ctx->input->linenum = l;
+                    ctx->input->linepos = o;
+                    if (!input_state__match_identifier(ctx->input) && !input_state__match_spaces(ctx->input)) input_state__match_character_any(ctx->input);
+                    continue;
+                }
+                node_array__add(&(ctx->rules), n_r);
+                b = TRUE;
+            }
+            input_state__commit_buffer(ctx->input);
+        }
+        input_state__commit_buffer(ctx->input);
+    }
+    ctx->errnum += ctx->input->errnum;
+    ctx->flags |= ctx->input->flags;
+    return iinfo;
+}
+
+static bool_t parse(context_t *ctx) {
+    parse_file_(ctx);
+    make_rulehash(ctx);
+    {
+        size_t i;
+        for (i = 0; i < ctx->rules.n; i++) {
+            node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
+            if (rule->ref < 0) {
+                print_error(
+                    "%s:" FMT_LU ":" FMT_LU ": Multiple definitions of rule: '%s'\n",
+                    rule->fpos.path, (ulong_t)(rule->fpos.line + 1), (ulong_t)(rule->fpos.col + 1),
+                    rule->name
+                );
+                ctx->errnum++;
+                continue;
+            }
+            link_references(ctx, rule->expr);
+        }
+    }
+    if (ctx->rules.n > 0)
+        mark_rules_if_used(ctx, ctx->rules.p[0]);
+    {
+        size_t i;
+        for (i = 0; i < ctx->rules.n; i++) {
+            if (!ctx->rules.p[i]->data.rule.used)
+                unreference_rules_from_unused_rule(ctx, ctx->rules.p[i]);
+        }
+    }
+    {
+        size_t i, j;
+        for (i = 0, j = 0; i < ctx->rules.n; i++) {
+            if (!ctx->rules.p[i]->data.rule.used) {
+                destroy_node(ctx->rules.p[i]);
+            }
+            else {
+                ctx->rules.p[i]->data.rule.index = j;
+                ctx->rules.p[j++] = ctx->rules.p[i];
+            }
+        }
+        ctx->rules.n = j;
+    }
+    {
+        size_t i;
+        for (i = 0; i < ctx->rules.n; i++) {
+            const node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
+            verify_rule_variables(ctx, rule);
+            verify_captures(ctx, rule);
+            verify_marker_variables(ctx, rule->expr);
+            update_code_flags(ctx, &(ctx->flags), rule);
+            if (ctx->opts.recog) {
+                code_flag_t f = CODE_FLAG_NONE;
+                set_code_flags(ctx, &f, rule->expr);
+                if (f & (CODE_FLAG_PROGPRED | CODE_FLAG_MATCH_CAPT | CODE_FLAG_MATCH_MVAR)) {
+                    print_error(
+                        "%s:" FMT_LU ":" FMT_LU ": Programmable predicate, capture reference, or marker variable in recognition mode: '%s'\n",
+                        rule->fpos.path, (ulong_t)(rule->fpos.line + 1), (ulong_t)(rule->fpos.col + 1),
+                        rule->name
+                    );
+                    ctx->errnum++;
+                }
+            }
+        }
+    }
+    if (ctx->errnum == 0 && ctx->mvars.n == 0) { /* the marker variables could make the matching depend on the state outside rules */
+        size_t i;
+        for (i = 0; i < ctx->rules.n; i++) {
+            factor_alternatives(ctx, ctx->rules.p + i);
+        }
+    }
+    if (ctx->split) {
+        const node_t *const node = find_split_rule(ctx);
+        if (node == NULL) {
+            print_error("Undefined or unused split rule: '%s'\n", ctx->split);
+            ctx->errnum++;
+        }
+        else if (!check_if_splittable(node->data.rule.expr)) {
+            print_error(
+                "%s:" FMT_LU ":" FMT_LU ": Split rule not consisting of nonempty string literals: '%s'\n",
+                node->data.rule.fpos.path, (ulong_t)(node->data.rule.fpos.line + 1), (ulong_t)(node->data.rule.fpos.col + 1),
+                node->data.rule.name
+            );
+            ctx->errnum++;
+        }
+    }
+    if (ctx->opts.runtime) { /* the marker variables would make the runtime data structures depend on the grammar */
+        size_t i;
+        for (i = 0; i < ctx->mvars.n; i++) {
+            print_error("Marker variable with shared runtime: '@%s'\n", ctx->mvars.p[i]);
+            ctx->errnum++;
+        }
+    }
+    mark_rules_if_nullable(ctx);
+    mark_rules_if_left_recursive(ctx);
+    if (ctx->opts.dfa) mark_rules_if_regular(ctx);
+    update_rule_code_flags(ctx);
+    /* the flags of the code only for evaluation are set again from the code not only recognized */
+    ctx->flags &= ~(CODE_FLAG_RULE_VARIABLE | CODE_FLAG_CAPTS | CODE_FLAG_CAPTURE | CODE_FLAG_ACTION | CODE_FLAG_ERROR);
+    if (ctx->rules.n > 0) {
+        node_rule_t *const rule = &(ctx->rules.p[0]->data.rule);
+        if (ctx->opts.recog) { /* no code for actions, captures, and rule variables is generated */
+            rule->recog = TRUE;
+            ctx->flags |= CODE_FLAG_RECOGNITION;
+            if (rule->cycle > 0) ctx->flags |= CODE_FLAG_LEFT_RECURSION;
+            mark_rules_if_recognized(ctx, rule->expr, TRUE);
+        }
+        else {
+            mark_rule_if_evaluated(ctx, ctx->rules.p[0]);
+            ctx->flags |= CODE_FLAG_EVALUATION;
+            mark_rules_if_recognized(ctx, rule->expr, FALSE);
+        }
+    }
+    if (ctx->opts.debug) {
+        size_t i;
+        for (i = 0; i < ctx->rules.n; i++) {
+            dump_node(ctx, ctx->rules.p[i], 0);
+        }
+        dump_options(ctx);
+    }
+    return (ctx->errnum == 0) ? TRUE : FALSE;
+}
+
+static bool_t is_charclass_excluding_nul(const char_array_t *value) {
+    size_t i;
+    if (value->n == 0 || value->p[0] == '^') return FALSE;
+    for (i = 0; i < value->n; i++) {
+        if (value->p[i] == '\\' && i + 1 < value->n) i++;
+        if (value->p[i] == '\0') return FALSE;
+        if (i + 2 < value->n && value->p[i + 1] == '-') {
+            /* a reversed range can include NUL if 'char' is signed */
+            if ((unsigned char)value->p[i] > (unsigned char)value->p[i + 2]) return FALSE;
+            i += 2;
+        }
+    }
+    return TRUE;
+}
+
+static void get_charclass_bitmaps(const char_array_t *value, unsigned char s[32], unsigned char u[32]) {
+    /* the characters are compared as 'char' in the C code, so the sets depend on whether 'char' is signed */
+    const bool_t a = (value->n > 1 && value->p[0] == '^') ? TRUE : FALSE;
+    size_t i, j;
+    memset(s, 0, 32);
+    memset(u, 0, 32);
+    if (value->n == 0) { /* any character */
+        memset(s, 0xff, 32);
+        memset(u, 0xff, 32);
+        return;
+    }
+    for (i = a ? 1 : 0; i < value->n; i++) {
+        int c0, c1;
+        if (value->p[i] == '\\' && i + 1 < value->n) i++;
+        c0 = c1 = (int)(unsigned char)value->p[i];
+        if (i + 2 < value->n && value->p[i + 1] == '-') {
+            c1 = (int)(unsigned char)value->p[i + 2];
+            i += 2;
+        }
+        for (j = 0; j < 256; j++) {
+            const int c = (int)j;
+            if (c >= c0 && c <= c1) u[j >> 3] |= (unsigned char)(1 << (j & 7));
+            if (
+                ((c < 0x80) ? c : c - 0x100) >= ((c0 < 0x80) ? c0 : c0 - 0x100) &&
+                ((c < 0x80) ? c : c - 0x100) <= ((c1 < 0x80) ? c1 : c1 - 0x100)
+            ) s[j >> 3] |= (unsigned char)(1 << (j & 7));
+        }
+    }
+    if (a) {
+        for (j = 0; j < 32; j++) {
+            s[j] = (unsigned char)~s[j];
+            u[j] = (unsigned char)~u[j];
+        }
+    }
+}
+
+static void generate_rule_index_argument(generate_t *gen, const node_t *rule) {
+    if (gen->profile) stream__printf(gen->stream, FMT_LU ", ", (ulong_t)rule->data.rule.index);
+}
+
+static void generate_trace_call(generate_t *gen, const char *event, const char *pos) {
+    if (gen->trace) stream__printf(gen->stream, "    pcc_trace(ctx, " FMT_LU ", %s, %s);\n", (ulong_t)gen->rule->data.rule.index, event, pos);
+}
+
+static code_reach_t generate_matching_string_code(generate_t *gen, const char_array_t *value, int onfail, size_t indent, bool_t bare) {
+    if (value->n > 0) {
+        /* the sentinel stops the comparison before the buffer end unless the string contains NUL */
+        const bool_t c = (gen->whole && memchr(value->p, '\0', value->n) == NULL) ? TRUE : FALSE;
+        char s[5];
+        if (value->n > 1) {
+            size_t i;
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__puts(gen->stream, "if (\n");
+            for (i = 0; i < value->n; i++) {
+                stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+                if (c) {
+                    stream__printf(
+                        gen->stream,
+                        "(ctx->buffer.p + ctx->cur)[" FMT_LU "] != '%s'%s\n",
+                        (ulong_t)i, escape_character(value->p[i], &s), (i < value->n - 1) ? " ||" : ""
+                    );
+                }
+                else {
+                    stream__printf(
+                        gen->stream,
+                        "pcc_refill_buffer(ctx, " FMT_LU ") < " FMT_LU " || (ctx->buffer.p + ctx->cur)[" FMT_LU "] != '%s'%s\n",
+                        (ulong_t)i + 1, (ulong_t)i + 1, (ulong_t)i, escape_character(value->p[i], &s), (i < value->n - 1) ? " ||" : ""
+                    );
+                }
+            }
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__printf(gen->stream, ") goto L%04d;\n", onfail);
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__printf(gen->stream, "ctx->cur += " FMT_LU ";\n", (ulong_t)(value->n));
+            return CODE_REACH_BOTH;
+        }
+        else if (c) {
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__printf(gen->stream, "if (ctx->buffer.p[ctx->cur] != '%s') goto L%04d;\n", escape_character(value->p[0], &s), onfail);
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__puts(gen->stream, "ctx->cur++;\n");
+            return CODE_REACH_BOTH;
+        }
+        else {
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__puts(gen->stream, "if (\n");
+            stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+            stream__puts(gen->stream, "pcc_refill_buffer(ctx, 1) < 1 ||\n");
+            stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+            stream__printf(gen->stream, "ctx->buffer.p[ctx->cur] != '%s'\n", escape_character(value->p[0], &s));
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__printf(gen->stream, ") goto L%04d;\n", onfail);
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__puts(gen->stream, "ctx->cur++;\n");
+            return CODE_REACH_BOTH;
+        }
+    }
+    else {
+        /* no code to generate */
+        return CODE_REACH_ALWAYS_SUCCEED;
+    }
+}
+
+static code_reach_t generate_matching_charclass_code(generate_t *gen, const char_array_t *value, int onfail, size_t indent, bool_t bare) {
+    assert(gen->ascii);
+    if (value->n > 0) {
+        /* the sentinel never matches unless the character class can match NUL */
+        const bool_t c = (gen->whole && is_charclass_excluding_nul(value)) ? TRUE : FALSE;
+        char s[5], t[5];
+        if (value->n > 1) {
+            const bool_t a = (value->p[0] == '^') ? TRUE : FALSE;
+            size_t i = a ? 1 : 0;
+            if (i + 1 == value->n) { /* fulfilled only if a == TRUE */
+                stream__write_characters(gen->stream, ' ', indent);
+                stream__puts(gen->stream, "if (\n");
+                stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+                stream__puts(gen->stream, "pcc_refill_buffer(ctx, 1) < 1 ||\n");
+                stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+                stream__printf(gen->stream, "ctx->buffer.p[ctx->cur] == '%s'\n", escape_character(value->p[i], &s));
+                stream__write_characters(gen->stream, ' ', indent);
+                stream__printf(gen->stream, ") goto L%04d;\n", onfail);
+                stream__write_characters(gen->stream, ' ', indent);
+                stream__puts(gen->stream, "ctx->cur++;\n");
+                return CODE_REACH_BOTH;
+            }
+            else {
+                if (!bare) {
+                    stream__write_characters(gen->stream, ' ', indent);
+                    stream__puts(gen->stream, "{\n");
+                    indent += INDENT_UNIT;
+                }
+                stream__write_characters(gen->stream, ' ', indent);
+                stream__puts(gen->stream, "char c;\n");
+                if (!c) {
+                    stream__write_characters(gen->stream, ' ', indent);
+                    stream__printf(gen->stream, "if (pcc_refill_buffer(ctx, 1) < 1) goto L%04d;\n", onfail);
+                }
+                stream__write_characters(gen->stream, ' ', indent);
+                stream__puts(gen->stream, "c = ctx->buffer.p[ctx->cur];\n");
+                if (i + 3 == value->n && value->p[i] != '\\' && value->p[i + 1] == '-') {
+                    stream__write_characters(gen->stream, ' ', indent);
+                    stream__printf(
+                        gen->stream,
+                        a ? "if (c >= '%s' && c <= '%s') goto L%04d;\n"
+                          : "if (!(c >= '%s' && c <= '%s')) goto L%04d;\n",
+                        escape_character(value->p[i], &s), escape_character(value->p[i + 2], &t), onfail
+                    );
+                }
+                else {
+                    stream__write_characters(gen->stream, ' ', indent);
+                    stream__puts(gen->stream, a ? "if (\n" : "if (!(\n");
+                    for (; i < value->n; i++) {
+                        stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+                        if (value->p[i] == '\\' && i + 1 < value->n) i++;
+                        if (i + 2 < value->n && value->p[i + 1] == '-') {
+                            stream__printf(
+                                gen->stream, "(c >= '%s' && c <= '%s')%s\n",
+                                escape_character(value->p[i], &s), escape_character(value->p[i + 2], &t), (i + 3 == value->n) ? "" : " ||"
+                            );
+                            i += 2;
+                        }
+                        else {
+                            stream__printf(
+                                gen->stream, "c == '%s'%s\n",
+                                escape_character(value->p[i], &s), (i + 1 == value->n) ? "" : " ||"
+                            );
+                        }
+                    }
+                    stream__write_characters(gen->stream, ' ', indent);
+                    stream__printf(gen->stream, a ? ") goto L%04d;\n" : ")) goto L%04d;\n", onfail);
+                }
+                stream__write_characters(gen->stream, ' ', indent);
+                stream__puts(gen->stream, "ctx->cur++;\n");
+                if (!bare) {
+                    indent -= INDENT_UNIT;
+                    stream__write_characters(gen->stream, ' ', indent);
+                    stream__puts(gen->stream, "}\n");
+                }
+                return CODE_REACH_BOTH;
+            }
+        }
+        else if (c) {
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__printf(gen->stream, "if (ctx->buffer.p[ctx->cur] != '%s') goto L%04d;\n", escape_character(value->p[0], &s), onfail);
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__puts(gen->stream, "ctx->cur++;\n");
+            return CODE_REACH_BOTH;
+        }
+        else {
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__puts(gen->stream, "if (\n");
+            stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+            stream__puts(gen->stream, "pcc_refill_buffer(ctx, 1) < 1 ||\n");
+            stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+            stream__printf(gen->stream, "ctx->buffer.p[ctx->cur] != '%s'\n", escape_character(value->p[0], &s));
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__printf(gen->stream, ") goto L%04d;\n", onfail);
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__puts(gen->stream, "ctx->cur++;\n");
+            return CODE_REACH_BOTH;
+        }
+    }
+    else {
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__printf(gen->stream, "if (pcc_refill_buffer(ctx, 1) < 1) goto L%04d;\n", onfail);
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "ctx->cur++;\n");
+        return CODE_REACH_BOTH;
+    }
+}
+
+static code_reach_t generate_matching_utf8_charclass_code(generate_t *gen, const char_array_t *value, int onfail, size_t indent, bool_t bare) {
+    const bool_t a = (value->n > 0 && value->p[0] == '^') ? TRUE : FALSE;
+    size_t i = a ? 1 : 0;
+    if (!bare) {
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "{\n");
+        indent += INDENT_UNIT;
+    }
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(gen->stream, "int u;\n");
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(
+        gen->stream,
+        "const size_t n = (ctx->cur < ctx->buffer.n && (u = (int)(unsigned char)ctx->buffer.p[ctx->cur]) < 0x80) ? 1 : /* ASCII */\n"
+    );
+    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+    stream__puts(gen->stream, "pcc_get_char_as_utf32(ctx, &u);\n");
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__printf(gen->stream, "if (n == 0) goto L%04d;\n", onfail);
+    if (value->n > 0 && !(a && value->n == 1)) { /* not '.' or '[^]' */
+        int u0 = 0;
+        bool_t r = FALSE;
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, a ? "if (\n" : "if (!(\n");
+        while (i < value->n) {
+            int u = 0;
+            if (value->p[i] == '\\' && i + 1 < value->n) i++;
+            i += utf8_to_utf32(value->p + i, &u);
+            if (r) { /* character range */
+                stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+                stream__printf(gen->stream, "(u >= 0x%06x && u <= 0x%06x)%s\n", u0, u, (i < value->n) ? " ||" : "");
+                u0 = 0;
+                r = FALSE;
+            }
+            else if (
+                value->p[i] != '-' ||
+                i == value->n - 1 /* the individual '-' character is valid when it is at the first or the last position */
+            ) { /* single character */
+                stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+                stream__printf(gen->stream, "u == 0x%06x%s\n", u, (i < value->n) ? " ||" : "");
+                u0 = 0;
+                r = FALSE;
+            }
+            else {
+                assert(value->p[i] == '-');
+                i++;
+                u0 = u;
+                r = TRUE;
+            }
+        }
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__printf(gen->stream, a ? ") goto L%04d;\n" : ")) goto L%04d;\n", onfail);
+    }
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(gen->stream, "ctx->cur += n;\n");
+    if (!bare) {
+        indent -= INDENT_UNIT;
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "}\n");
+    }
+    return CODE_REACH_BOTH;
+}
+
+static code_reach_t generate_position_code(generate_t *gen, size_t value, int onfail, size_t indent, bool_t bare) {
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__printf(gen->stream, "if (ctx->pos + ctx->cur != " FMT_LU ") goto L%04d;\n", value, onfail);
+    return CODE_REACH_BOTH;
+}
+
+static bool_t get_charclass_bytes(const char_array_t *value, bool_t ascii, unsigned char set[32]) {
+    /* gets the set of the bytes if the character class matches single bytes regardless of whether 'char' is signed */
+    unsigned char u[32];
+    size_t i;
+    if (!ascii) { /* only ASCII characters are single bytes in UTF-8 */
+        if (value->n == 0 || value->p[0] == '^') return FALSE;
+        for (i = 0; i < value->n; i++) {
+            if ((unsigned char)value->p[i] >= 0x80) return FALSE;
+        }
+    }
+    get_charclass_bitmaps(value, set, u);
+    return (memcmp(set, u, 32) == 0) ? TRUE : FALSE;
+}
+
+static bool_t get_first_bytes(const node_t *node, bool_t ascii, unsigned char set[32]) {
+    /* adds the bytes with which the node can start to the set, and returns whether the node is nullable */
+    switch (node->type) {
+    case NODE_STRING:
+        if (node->data.string.value.n == 0) return TRUE;
+        {
+            const unsigned char c = (unsigned char)node->data.string.value.p[0];
+            set[c >> 3] |= (unsigned char)(1 << (c & 7));
+        }
+        return FALSE;
+    case NODE_CHARCLASS:
+        {
+            unsigned char s[32];
+            size_t i;
+            if (get_charclass_bytes(&(node->data.charclass.value), ascii, s)) {
+                for (i = 0; i < 32; i++) set[i] |= s[i];
+            }
+            return FALSE;
+        }
+    case NODE_REFERENCE:
+        if (node->data.reference.rule == NULL || !node->data.reference.rule->data.rule.regular) return FALSE; /* never inlined */
+        return get_first_bytes(node->data.reference.rule->data.rule.expr, ascii, set);
+    case NODE_QUANTITY:
+        return (get_first_bytes(node->data.quantity.expr, ascii, set) || node->data.quantity.min == 0) ? TRUE : FALSE;
+    case NODE_SEQUENCE:
+        {
+            const node_array_t *const nodes = &(node->data.sequence.nodes);
+            size_t i;
+            for (i = 0; i < nodes->n; i++) {
+                if (!get_first_bytes(nodes->p[i], ascii, set)) return FALSE;
+            }
+            return TRUE;
+        }
+    case NODE_ALTERNATE:
+        {
+            const node_array_t *const nodes = &(node->data.alternate.nodes);
+            bool_t b = FALSE;
+            size_t i;
+            for (i = 0; i < nodes->n; i++) {
+                if (get_first_bytes(nodes->p[i], ascii, set)) b = TRUE;
+            }
+            return b;
+        }
+    default:
+        return FALSE;
+    }
+}
+
+static bool_t is_regular_node(const node_t *node, bool_t ascii, const regular_traits_t *follow, regular_traits_t *traits) {
+    /* checks if the node can be matched by a deterministic finite automaton with the same result as the PEG semantics;
+     * the automaton never backtracks except to the last accepting position, so any subexpression that can be left
+     * after consuming characters is required to be committed to succeed then, unless the PEG backtracks to the same
+     * position, that is, what follows it up to the end of the automaton, given by 'follow', is nullable and never
+     * starts with the characters the subexpression can start with; the alternatives of a choice not committed are
+     * tried in parallel, which is allowed only if what follows the choice never fails, since the choice is never
+     * tried again after what follows it fails in the PEG semantics, or if no input can have prefixes matched by two of
+     * the alternatives, since then the other alternatives fail anyway */
+    size_t i;
+    memset(traits->first, 0, 32);
+    traits->ordered = FALSE;
+    switch (node->type) {
+    case NODE_REFERENCE:
+        /* the regular rules are inlined, since the rule application without captures and actions has no effect */
+        if (node->data.reference.rvar != NULL || node->data.reference.rule == NULL || !node->data.reference.rule->data.rule.regular) return FALSE;
+        return is_regular_node(node->data.reference.rule->data.rule.expr, ascii, follow, traits);
+    case NODE_STRING:
+        traits->nullable = (node->data.string.value.n == 0) ? TRUE : FALSE;
+        traits->infallible = traits->nullable;
+        traits->committed = (node->data.string.value.n <= 1) ? TRUE : FALSE;
+        traits->trivial = TRUE;
+        traits->states = node->data.string.value.n;
+        get_first_bytes(node, ascii, traits->first);
+        return TRUE;
+    case NODE_CHARCLASS:
+        traits->nullable = FALSE;
+        traits->infallible = FALSE;
+        traits->committed = TRUE;
+        traits->trivial = TRUE;
+        traits->states = 1;
+        return get_charclass_bytes(&(node->data.charclass.value), ascii, traits->first);
+    case NODE_QUANTITY:
+        {
+            const int min = node->data.quantity.min, max = node->data.quantity.max;
+            regular_traits_t f = *follow, t;
+            if (min < 0 || min > 1 || (max >= 0 && max != 1)) return FALSE;
+            if (max < 0) get_first_bytes(node->data.quantity.expr, ascii, f.first); /* followed by the next iteration */
+            if (!is_regular_node(node->data.quantity.expr, ascii, &f, &t)) return FALSE;
+            if (t.nullable) return FALSE; /* an iteration without consuming characters is not a transition */
+            if (min > 0 && max == 1) {
+                *traits = t;
+                return TRUE;
+            }
+            if (!t.committed) {
+                if (!follow->nullable) return FALSE;
+                for (i = 0; i < 32; i++) {
+                    if (t.first[i] & follow->first[i]) return FALSE;
+                }
+            }
+            traits->nullable = (min == 0) ? TRUE : FALSE;
+            traits->infallible = traits->nullable;
+            traits->committed = t.committed;
+            traits->trivial = FALSE;
+            traits->ordered = t.ordered;
+            traits->states = t.states + ((max < 0 || min == 0) ? 1 : 0);
+            memcpy(traits->first, t.first, 32);
+            return TRUE;
+        }
+    case NODE_SEQUENCE:
+        {
+            const node_array_t *const nodes = &(node->data.sequence.nodes);
+            regular_traits_t f = *follow; /* the traits of what follows the element */
+            traits->nullable = TRUE;
+            traits->infallible = TRUE;
+            traits->committed = TRUE;
+            traits->trivial = TRUE;
+            traits->states = 0;
+            for (i = nodes->n; i > 0; i--) {
+                regular_traits_t t;
+                size_t b;
+                if (!is_regular_node(nodes->p[i - 1], ascii, &f, &t)) return FALSE;
+                for (b = 0; b < 32; b++) {
+                    f.first[b] = (unsigned char)(t.first[b] | (t.nullable ? f.first[b] : 0));
+                    traits->first[b] = (unsigned char)(t.first[b] | (t.nullable ? traits->first[b] : 0));
+                }
+                if (!t.nullable) {
+                    traits->nullable = FALSE;
+                    f.nullable = FALSE;
+                }
+                if (!t.infallible) {
+                    traits->infallible = FALSE;
+                    f.infallible = FALSE;
+                    if (i > 1) traits->committed = FALSE;
+                }
+                if (!t.committed) traits->committed = FALSE;
+                if (!t.trivial) traits->trivial = FALSE;
+                if (t.ordered) traits->ordered = TRUE;
+                traits->states += t.states;
+            }
+            return TRUE;
+        }
+    case NODE_ALTERNATE:
+        {
+            const node_array_t *const nodes = &(node->data.alternate.nodes);
+            traits->committed = TRUE;
+            traits->states = 0;
+            for (i = 0; i < nodes->n; i++) {
+                regular_traits_t t;
+                size_t b;
+                if (!is_regular_node(nodes->p[i], ascii, follow, &t)) return FALSE;
+                if (i + 1 < nodes->n) {
+                    if (t.nullable) return FALSE; /* the following alternatives would never be tried */
+                    if (!t.committed) { /* the alternative is not always chosen by the first character */
+                        traits->committed = FALSE;
+                        traits->ordered = TRUE;
+                    }
+                    traits->states += t.states + 1;
+                }
+                else {
+                    traits->nullable = t.nullable;
+                    traits->infallible = t.infallible;
+                    if (!t.committed) traits->committed = FALSE;
+                    traits->states += t.states;
+                }
+                if (t.ordered) traits->ordered = TRUE;
+                for (b = 0; b < 32; b++) traits->first[b] |= t.first[b];
+            }
+            traits->trivial = FALSE;
+            if (!traits->committed && !follow->infallible) { /* no alternative tried in parallel may be left for what follows */
+                for (i = 0; i + 1 < nodes->n; i++) {
+                    regular_traits_t t;
+                    size_t j;
+                    get_regular_traits(nodes->p[i], ascii, &t);
+                    if (t.committed) continue;
+                    for (j = i + 1; j < nodes->n; j++) {
+                        if (!are_exclusive_nodes(nodes->p[i], nodes->p[j], ascii)) return FALSE;
+                    }
+                }
+            }
+            return TRUE;
+        }
+    default:
+        return FALSE;
+    }
+}
+
+static bool_t get_regular_traits(const node_t *node, bool_t ascii, regular_traits_t *traits) {
+    /* gets the traits of the node matched by an automaton as a whole, which nothing follows */
+    regular_traits_t f;
+    f.nullable = TRUE;
+    f.infallible = TRUE;
+    f.committed = TRUE;
+    f.trivial = TRUE;
+    f.ordered = FALSE;
+    f.states = 0;
+    memset(f.first, 0, 32);
+    return is_regular_node(node, ascii, &f, traits);
+}
+
+static void dfa__initialize(dfa_t *obj) {
+    obj->m = 0;
+    obj->n = 0;
+    obj->p = NULL;
+}
+
+static void dfa__finalize(dfa_t *obj) {
+    free(obj->p);
+}
+
+static int dfa__add_state(dfa_t *obj, int first, int second) {
+    size_t i;
+    if (obj->m <= obj->n) {
+        const size_t n = obj->n + 1;
+        size_t m = obj->m;
+        if (m == 0) m = ARRAY_MIN_SIZE;
+        while (m < n && m != 0) m <<= 1;
+        if (m == 0) m = n; /* in case of shift overflow */
+        obj->p = (dfa_state_t *)realloc_e(obj->p, sizeof(dfa_state_t) * m);
+        obj->m = m;
+    }
+    for (i = 0; i < 256; i++) obj->p[obj->n].next[i] = DFA_STATE_NONE;
+    obj->p[obj->n].first = first;
+    obj->p[obj->n].second = second;
+    obj->p[obj->n].accept = FALSE;
+    obj->p[obj->n].ordered = FALSE;
+    return (int)(obj->n++);
+}
+
+static int dfa__build(dfa_t *obj, const node_t *node, bool_t ascii, int next) {
+    /* adds the states matching the node and then continuing to the given state, and returns the initial one;
+     * the choices are represented by merged states, which take the transitions of the first states in priority,
+     * or try both of the states in parallel for the alternatives not committed */
+    switch (node->type) {
+    case NODE_REFERENCE:
+        return dfa__build(obj, node->data.reference.rule->data.rule.expr, ascii, next);
+    case NODE_STRING:
+        {
+            const char_array_t *const value = &(node->data.string.value);
+            size_t i;
+            for (i = value->n; i > 0; i--) {
+                const int s = dfa__add_state(obj, DFA_STATE_NONE, DFA_STATE_NONE);
+                obj->p[s].next[(unsigned char)value->p[i - 1]] = next;
+                next = s;
+            }
+            return next;
+        }
+    case NODE_CHARCLASS:
+        {
+            const int s = dfa__add_state(obj, DFA_STATE_NONE, DFA_STATE_NONE);
+            unsigned char b[32];
+            size_t i;
+            get_charclass_bytes(&(node->data.charclass.value), ascii, b);
+            for (i = 0; i < 256; i++) {
+                if (b[i >> 3] & (1 << (i & 7))) obj->p[s].next[i] = next;
+            }
+            return s;
+        }
+    case NODE_QUANTITY:
+        if (node->data.quantity.max < 0) {
+            const int l = dfa__add_state(obj, DFA_STATE_NONE, DFA_STATE_NONE); /* the state to repeat or leave */
+            const int s = dfa__build(obj, node->data.quantity.expr, ascii, l);
+            obj->p[l].first = s;
+            obj->p[l].second = next;
+            return (node->data.quantity.min > 0) ? s : l;
+        }
+        else {
+            const int s = dfa__build(obj, node->data.quantity.expr, ascii, next);
+            return (node->data.quantity.min > 0) ? s : dfa__add_state(obj, s, next);
+        }
+    case NODE_SEQUENCE:
+        {
+            const node_array_t *const nodes = &(node->data.sequence.nodes);
+            size_t i;
+            for (i = nodes->n; i > 0; i--) {
+                next = dfa__build(obj, nodes->p[i - 1], ascii, next);
+            }
+            return next;
+        }
+    case NODE_ALTERNATE:
+        {
+            const node_array_t *const nodes = &(node->data.alternate.nodes);
+            int s = dfa__build(obj, nodes->p[nodes->n - 1], ascii, next);
+            size_t i;
+            for (i = nodes->n - 1; i > 0; i--) {
+                regular_traits_t t;
+                get_regular_traits(nodes->p[i - 1], ascii, &t);
+                s = dfa__add_state(obj, dfa__build(obj, nodes->p[i - 1], ascii, next), s);
+                obj->p[s].ordered = t.committed ? FALSE : TRUE;
+            }
+            return s;
+        }
+    default:
+        print_error("Internal error [%d]\n", __LINE__);
+        exit(-1);
+    }
 }
 
-static size_t parse_file_(context_t *ctx) {
-    size_t iinfo;
-    if (ctx->input == NULL) return VOID_VALUE;
-    if (file_info_map__get(&(ctx->finfo), ctx->input->file, ctx->input->path, &iinfo)) return iinfo; /* already imported */
+static bool_t dfa__accepts(const dfa_t *obj, int s) {
+    while (obj->p[s].first != DFA_STATE_NONE) {
+        if (dfa__accepts(obj, obj->p[s].first)) return TRUE;
+        s = obj->p[s].second;
+    }
+    return obj->p[s].accept;
+}
+
+static bool_t dfa__moves(const dfa_t *obj, int s, size_t b) {
+    while (obj->p[s].first != DFA_STATE_NONE) {
+        const int f = obj->p[s].first;
+        if (!obj->p[s].ordered && dfa__accepts(obj, f)) return dfa__moves(obj, f, b);
+        if (dfa__moves(obj, f, b)) return TRUE;
+        s = obj->p[s].second;
+    }
+    return (obj->p[s].next[b] != DFA_STATE_NONE) ? TRUE : FALSE;
+}
+
+static void dfa__expand(const dfa_t *obj, int s, size_array_t *set, size_t start) {
+    /* adds the state to the set of the states in order of priority, which begins at the start index, expanding the states tried in parallel */
+    size_t i;
+    while (obj->p[s].ordered) {
+        dfa__expand(obj, obj->p[s].first, set, start);
+        s = obj->p[s].second;
+    }
+    for (i = start; i < set->n; i++) {
+        if (set->p[i] == (size_t)s) return; /* the state with lower priority is redundant */
+    }
+    size_array__add(set, (size_t)s);
+}
+
+static void dfa__move(const dfa_t *obj, int s, size_t b, size_array_t *set, size_t start) {
+    /* adds the states reached from the state by the byte to the set; the first of the merged states not tried in parallel
+       takes priority if it can accept or move */
+    while (obj->p[s].first != DFA_STATE_NONE) {
+        const int f = obj->p[s].first;
+        if (!obj->p[s].ordered && (dfa__accepts(obj, f) || dfa__moves(obj, f, b))) {
+            s = f;
+            continue;
+        }
+        if (obj->p[s].ordered) dfa__move(obj, f, b, set, start);
+        s = obj->p[s].second;
+    }
+    if (obj->p[s].next[b] != DFA_STATE_NONE) dfa__expand(obj, obj->p[s].next[b], set, start);
+}
+
+static bool_t dfa__cut(const dfa_t *obj, size_array_t *set, size_t start) {
+    /* discards the states with lower priority than the first accepting one, since the match is decided unless any state
+       with higher priority succeeds later, and returns whether any state accepts */
+    size_t i;
+    for (i = start; i < set->n; i++) {
+        if (dfa__accepts(obj, (int)set->p[i])) {
+            set->n = i + 1;
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static bool_t dfa__determinize(const dfa_t *obj, int start, int split, dfa_t *out) {
+    /* converts the states into the deterministic states, each of which is a set of the states in order of priority,
+     * and returns FALSE if the number of the deterministic states exceeds the limit; unless 'split' is DFA_STATE_NONE,
+     * no states are discarded, and FALSE is returned also if any set has an accepting state numbered less than 'split'
+     * together with a state numbered not less than it, or vice versa */
+    size_array_t sets, heads; /* the concatenated sets of the states, and the start indices of the respective sets */
+    size_t i, j, b;
+    bool_t r = TRUE;
+    size_array__initialize(&sets);
+    size_array__initialize(&heads);
+    size_array__add(&heads, 0);
+    dfa__expand(obj, start, &sets, 0);
+    if (split == DFA_STATE_NONE) dfa__cut(obj, &sets, 0);
+    for (i = 0; r && i < heads.n; i++) {
+        const size_t h = heads.p[i], n = ((i + 1 < heads.n) ? heads.p[i + 1] : sets.n) - h;
+        const int s = dfa__add_state(out, DFA_STATE_NONE, DFA_STATE_NONE);
+        out->p[s].accept = dfa__accepts(obj, (int)sets.p[h + n - 1]); /* only the last state can accept if cut */
+        if (split != DFA_STATE_NONE) {
+            bool_t a[2] = { FALSE, FALSE }, p[2] = { FALSE, FALSE }; /* whether any state accepts, and is present, on each side */
+            for (j = 0; j < n; j++) {
+                const int k = ((int)sets.p[h + j] < split) ? 0 : 1;
+                p[k] = TRUE;
+                if (dfa__accepts(obj, (int)sets.p[h + j])) a[k] = TRUE;
+            }
+            if ((a[0] && p[1]) || (a[1] && p[0])) {
+                r = FALSE;
+                break;
+            }
+        }
+        for (b = 0; b < 256; b++) {
+            const size_t e = sets.n;
+            for (j = 0; j < n; j++) dfa__move(obj, (int)sets.p[h + j], b, &sets, e);
+            if (sets.n == e) continue;
+            if (split == DFA_STATE_NONE) dfa__cut(obj, &sets, e);
+            for (j = 0; j < heads.n; j++) { /* the same states in the same order */
+                const size_t h2 = heads.p[j], n2 = ((j + 1 < heads.n) ? heads.p[j + 1] : e) - h2;
+                if (n2 == sets.n - e && memcmp(sets.p + h2, sets.p + e, sizeof(size_t) * n2) == 0) break;
+            }
+            if (j < heads.n) {
+                sets.n = e;
+            }
+            else if (heads.n >= DFA_STATE_MAX) {
+                r = FALSE;
+                break;
+            }
+            else {
+                size_array__add(&heads, e);
+            }
+            out->p[s].next[b] = (int)j;
+        }
+    }
+    size_array__finalize(&heads);
+    size_array__finalize(&sets);
+    return r;
+}
+
+static bool_t are_exclusive_nodes(const node_t *node1, const node_t *node2, bool_t ascii) {
+    /* checks if no input can have prefixes matched by the respective regular nodes, by running them in parallel */
+    dfa_t a, d;
+    bool_t b;
+    int s1, s2, m;
+    dfa__initialize(&a);
+    dfa__initialize(&d);
+    s1 = dfa__add_state(&a, DFA_STATE_NONE, DFA_STATE_NONE);
+    a.p[s1].accept = TRUE;
+    s1 = dfa__build(&a, node1, ascii, s1);
+    m = (int)a.n; /* the states of the first node are numbered less than this */
+    s2 = dfa__add_state(&a, DFA_STATE_NONE, DFA_STATE_NONE);
+    a.p[s2].accept = TRUE;
+    s2 = dfa__build(&a, node2, ascii, s2);
+    s1 = dfa__add_state(&a, s1, s2);
+    a.p[s1].ordered = TRUE;
+    b = dfa__determinize(&a, s1, m, &d);
+    dfa__finalize(&a);
+    dfa__finalize(&d);
+    return b;
+}
+
+static bool_t is_automaton_node(const node_t *node, bool_t ascii) {
+    /* checks if the node is to be matched by a deterministic finite automaton, which is worthless for a fixed sequence of characters */
+    regular_traits_t t;
+    if (node->type == NODE_STRING || node->type == NODE_CHARCLASS) return FALSE;
+    if (!get_regular_traits(node, ascii, &t) || t.trivial || t.states >= DFA_STATE_MAX) return FALSE;
+    if (t.ordered) { /* the states tried in parallel can make the automaton too large */
+        dfa_t a, d;
+        bool_t b;
+        dfa__initialize(&a);
+        dfa__initialize(&d);
+        {
+            const int e = dfa__add_state(&a, DFA_STATE_NONE, DFA_STATE_NONE);
+            a.p[e].accept = TRUE;
+            b = dfa__determinize(&a, dfa__build(&a, node, ascii, e), DFA_STATE_NONE, &d);
+        }
+        dfa__finalize(&a);
+        dfa__finalize(&d);
+        return b;
+    }
+    return TRUE;
+}
+
+static code_reach_t generate_dfa_code(generate_t *gen, const node_t *node, int onfail, size_t indent, bool_t bare) {
+    /* the automaton remembers the last accepting position, and the buffer is refilled byte by byte */
+    dfa_t dfa, det; /* the states built from the node, and the deterministic states numbered from 1 in the generated code */
+    size_t classes[256], reps[256]; /* the byte classes, and the representative bytes of the respective classes */
+    size_t k = 0, i, j, b;
+    bool_t c = FALSE; /* the end of the input is checked if true */
+    bool_t a;         /* the initial state accepts if true */
+    dfa__initialize(&dfa);
+    dfa__initialize(&det);
     {
-        const bool_t imp = input_state__is_in_imported(ctx->input);
-        bool_t b = TRUE;
-        input_state__match_spaces(ctx->input);
-        for (;;) {
-            char *s = NULL;
-            size_t l, m, n, o;
-            if (input_state__match_eof(ctx->input) || parse_footer_(ctx->input, &(ctx->fsource))) break;
-            l = ctx->input->linenum;
-            m = input_state__column_number(ctx->input);
-            n = ctx->input->charnum;
-            o = ctx->input->linepos;
-            if (parse_directive_string_(ctx->input, "%import", &s, STRING_FLAG_NOTEMPTY)) {
-                size_t ii = VOID_VALUE;
-                bool_t v;
-                if (s) {
-                    if (is_absolute_path(s)) {
-                        FILE *const file = fopen(s, "rb");
-                        if (file) {
-                            ctx->input = input_state__create(s, file, ctx->input, &(ctx->opts));
-                            ii = parse_file_(ctx);
-                            ctx->input = input_state__destroy(ctx->input);
-                        }
-                        else {
-                            if (errno != ENOENT) {
-                                print_error(
-                                    "%s:" FMT_LU ":" FMT_LU ": Cannot open file to read: %s\n",
-                                    ctx->input->path, (ulong_t)(l + 1), (ulong_t)(m + 1),
-                                    s
-                                );
-                            }
-                            else {
-                                print_error(
-                                    "%s:" FMT_LU ":" FMT_LU ": File not found: %s\n",
-                                    ctx->input->path, (ulong_t)(l + 1), (ulong_t)(m + 1),
-                                    s
-                                );
-                            }
-                            ctx->input->errnum++;
-                        }
-                    }
-                    else {
-                        size_t i = 0;
-                        char *path = replace_filename(ctx->input->path, s);
-                        FILE *file = fopen(path, "rb");
-                        while (file == NULL) {
-                            if (errno != ENOENT) {
-                                print_error(
-                                    "%s:" FMT_LU ":" FMT_LU ": Cannot open file to read: %s\n",
-                                    ctx->input->path, (ulong_t)(l + 1), (ulong_t)(m + 1),
-                                    path
-                                );
-                                ctx->input->errnum++;
-                                break;
-                            }
-                            if (i >= ctx->dirs->n) {
-                                print_error(
-                                    "%s:" FMT_LU ":" FMT_LU ": File not found: %s\n",
-                                    ctx->input->path, (ulong_t)(l + 1), (ulong_t)(m + 1),
-                                    s
-                                );
-                                ctx->input->errnum++;
-                                break;
-                            }
-                            free(path);
-                            path = add_filename(ctx->dirs->p[i++], s);
-                            file = fopen(path, "rb");
-                        }
-                        if (file) {
-                            ctx->input = input_state__create(path, file, ctx->input, &(ctx->opts));
-                            ii = parse_file_(ctx);
-                            ctx->input = input_state__destroy(ctx->input);
-                        }
-                        free(path);
-                    }
+        const int e = dfa__add_state(&dfa, DFA_STATE_NONE, DFA_STATE_NONE);
+        dfa.p[e].accept = TRUE;
+        dfa__determinize(&dfa, dfa__build(&dfa, node, gen->ascii, e), DFA_STATE_NONE, &det);
+    }
+    for (b = 0; b < 256; b++) {
+        for (j = 0; j < k; j++) {
+            for (i = 0; i < det.n; i++) {
+                if (det.p[i].next[b] != det.p[i].next[reps[j]]) break;
+            }
+            if (i == det.n) break;
+        }
+        if (j == k) reps[k++] = b;
+        classes[b] = j;
+    }
+    for (i = 0; i < det.n; i++) {
+        if (det.p[i].next[0] != DFA_STATE_NONE) c = TRUE;
+    }
+    if (!gen->whole) c = TRUE; /* the sentinel stops the automaton unless NUL has a transition */
+    a = det.p[0].accept;
+    if (!bare) {
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "{\n");
+        indent += INDENT_UNIT;
+    }
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(gen->stream, "static const unsigned char x[256] = { /* the byte classes */\n");
+    for (b = 0; b < 256; b++) {
+        if (b % 16 == 0) stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+        stream__printf(gen->stream, FMT_LU "%s", (ulong_t)classes[b], (b == 255) ? "\n" : (b % 16 == 15) ? ",\n" : ", ");
+    }
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(gen->stream, "};\n");
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__printf(
+        gen->stream,
+        "static const unsigned %s y[" FMT_LU "][" FMT_LU "] = { /* the acceptance and the next states by the byte classes */\n",
+        (det.n < 256) ? "char" : "short", (ulong_t)det.n, (ulong_t)(k + 1)
+    );
+    for (i = 0; i < det.n; i++) {
+        const dfa_state_t *const s = &(det.p[i]);
+        stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+        stream__printf(gen->stream, "{ %d", s->accept ? 1 : 0);
+        for (j = 0; j < k; j++) {
+            const int t = s->next[reps[j]];
+            stream__printf(gen->stream, ", " FMT_LU, (ulong_t)((t != DFA_STATE_NONE) ? (size_t)t + 1 : 0));
+        }
+        stream__printf(gen->stream, " }%s\n", (i + 1 < det.n) ? "," : "");
+    }
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(gen->stream, "};\n");
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(gen->stream, "size_t i = 0, j = 0; /* the lengths of the scanned and the accepted characters */\n");
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(gen->stream, a ? "int s = 1;\n" : "int s = 1, a = 0;\n");
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(gen->stream, "for (;;) {\n");
+    if (c) {
+        stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+        stream__puts(gen->stream, "if (pcc_refill_buffer(ctx, i + 1) < i + 1) break;\n");
+    }
+    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+    stream__puts(gen->stream, "s = y[s - 1][1 + x[(unsigned char)ctx->buffer.p[ctx->cur + i]]];\n");
+    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+    stream__puts(gen->stream, "if (s == 0) break;\n");
+    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+    stream__puts(gen->stream, "i++;\n");
+    if (a) {
+        stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+        stream__puts(gen->stream, "if (y[s - 1][0]) j = i;\n");
+    }
+    else {
+        stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+        stream__puts(gen->stream, "if (y[s - 1][0]) {\n");
+        stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT * 2);
+        stream__puts(gen->stream, "j = i;\n");
+        stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT * 2);
+        stream__puts(gen->stream, "a = 1;\n");
+        stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+        stream__puts(gen->stream, "}\n");
+    }
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(gen->stream, "}\n");
+    if (!a) {
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__printf(gen->stream, "if (!a) goto L%04d;\n", onfail);
+    }
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(gen->stream, "ctx->cur += j;\n");
+    if (!bare) {
+        indent -= INDENT_UNIT;
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "}\n");
+    }
+    dfa__finalize(&det);
+    dfa__finalize(&dfa);
+    return a ? CODE_REACH_ALWAYS_SUCCEED : CODE_REACH_BOTH;
+}
+
+static code_reach_t generate_code(generate_t *gen, const node_t *node, int onfail, size_t indent, bool_t bare);
+
+static code_reach_t generate_quantifying_code(generate_t *gen, const node_t *expr, int min, int max, int onfail, size_t indent, bool_t bare) {
+    if (max > 1 || max < 0) {
+        code_reach_t r;
+        if (!bare) {
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__puts(gen->stream, "{\n");
+            indent += INDENT_UNIT;
+        }
+        if (min > 0) {
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__puts(gen->stream, "const size_t p0 = ctx->cur;\n");
+            if (gen->mode == CODE_MODE_NORMAL) {
+                stream__write_characters(gen->stream, ' ', indent);
+                stream__puts(gen->stream, "const size_t n0 = chunk->thunks.n;\n");
+            }
+        }
+        if (max < 0) {
+            if (min > 0) {
+                stream__write_characters(gen->stream, ' ', indent);
+                stream__puts(gen->stream, "int i;\n");
+                stream__write_characters(gen->stream, ' ', indent);
+                stream__puts(gen->stream, "for (i = 0;; i++) {\n");
+            }
+            else {
+                stream__write_characters(gen->stream, ' ', indent);
+                stream__puts(gen->stream, "for (;;) {\n");
+            }
+        }
+        else {
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__puts(gen->stream, "int i;\n");
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__printf(gen->stream, "for (i = 0; i < %d; i++) {\n", max);
+        }
+        stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+        stream__puts(gen->stream, "const size_t p = ctx->cur;\n");
+        if (gen->mode == CODE_MODE_NORMAL) {
+            stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+            stream__puts(gen->stream, "MARK_VAR_AS_USED\n");
+            stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+            stream__puts(gen->stream, "const size_t n = chunk->thunks.n;\n");
+        }
+        {
+            const int l = ++gen->label;
+            r = generate_code(gen, expr, l, indent + INDENT_UNIT, FALSE);
+            stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+            stream__puts(gen->stream, "if (ctx->cur == p) break;\n");
+            if (r != CODE_REACH_ALWAYS_SUCCEED) {
+                stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+                stream__puts(gen->stream, "continue;\n");
+                stream__write_characters(gen->stream, ' ', indent);
+                stream__printf(gen->stream, "L%04d:;\n", l);
+                stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+                stream__puts(gen->stream, "ctx->cur = p;\n");
+                if (gen->mvars) {
+                    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+                    stream__puts(gen->stream, "pcc_marker_variable_set_record__restore(ctx->auxil, &(ctx->mvars), ctx->pos + ctx->cur);\n");
                 }
-                if (ii != VOID_VALUE && parse_and_check_version_(ctx->input, ctx->finfo.p[ii].version, &v) && !v) {
-                    print_error(
-                        "%s:" FMT_LU ":" FMT_LU ": Version not matched: %s\n",
-                        ctx->input->path, (ulong_t)(l + 1), (ulong_t)(m + 1),
-                        s
-                    );
-                    ctx->input->errnum++;
+                if (gen->mode == CODE_MODE_NORMAL) {
+                    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+                    stream__puts(gen->stream, "pcc_thunk_array__revert(ctx, &(chunk->thunks), n);\n");
                 }
-                free(s);
-                b = TRUE;
+                stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+                stream__puts(gen->stream, "break;\n");
             }
-            else if (parse_directive_identifier_(ctx->input, "%requires", &s)) {
-                if (strcmp(s, "packcc") == 0) {
-                    bool_t v;
-                    if (!parse_and_check_version_(ctx->input, PACKCC_VERSION, &v)) {
-                        print_error(
-                            "%s:" FMT_LU ":" FMT_LU ": Version constraints missing: %s\n",
-                            ctx->input->path, (ulong_t)(l + 1), (ulong_t)(m + 1),
-                            s
-                        );
-                        ctx->input->errnum++;
+        }
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "}\n");
+        if (min > 0) {
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__printf(gen->stream, "if (i < %d) {\n", min);
+            stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+            stream__puts(gen->stream, "ctx->cur = p0;\n");
+            if (gen->mvars) {
+                stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+                stream__puts(gen->stream, "pcc_marker_variable_set_record__restore(ctx->auxil, &(ctx->mvars), ctx->pos + ctx->cur);\n");
+            }
+            if (gen->mode == CODE_MODE_NORMAL) {
+                stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+                stream__puts(gen->stream, "pcc_thunk_array__revert(ctx, &(chunk->thunks), n0);\n");
+            }
+            stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+            stream__printf(gen->stream, "goto L%04d;\n", onfail);
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__puts(gen->stream, "}\n");
+        }
+        if (!bare) {
+            indent -= INDENT_UNIT;
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__puts(gen->stream, "}\n");
+        }
+        return (min > 0) ? ((r == CODE_REACH_ALWAYS_FAIL) ? CODE_REACH_ALWAYS_FAIL : CODE_REACH_BOTH) : CODE_REACH_ALWAYS_SUCCEED;
+    }
+    else if (max == 1) {
+        if (min > 0) {
+            return generate_code(gen, expr, onfail, indent, bare);
+        }
+        else {
+            if (!bare) {
+                stream__write_characters(gen->stream, ' ', indent);
+                stream__puts(gen->stream, "{\n");
+                indent += INDENT_UNIT;
+            }
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__puts(gen->stream, "MARK_VAR_AS_USED\n");
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__puts(gen->stream, "const size_t p = ctx->cur;\n");
+            if (gen->mode == CODE_MODE_NORMAL) {
+                stream__write_characters(gen->stream, ' ', indent);
+                stream__puts(gen->stream, "MARK_VAR_AS_USED\n");
+                stream__write_characters(gen->stream, ' ', indent);
+                stream__puts(gen->stream, "const size_t n = chunk->thunks.n;\n");
+            }
+            {
+                const int l = ++gen->label;
+                if (generate_code(gen, expr, l, indent, FALSE) != CODE_REACH_ALWAYS_SUCCEED) {
+                    const int m = ++gen->label;
+                    stream__write_characters(gen->stream, ' ', indent);
+                    stream__printf(gen->stream, "goto L%04d;\n", m);
+                    if (indent > INDENT_UNIT) stream__write_characters(gen->stream, ' ', indent - INDENT_UNIT);
+                    stream__printf(gen->stream, "L%04d:;\n", l);
+                    stream__write_characters(gen->stream, ' ', indent);
+                    stream__puts(gen->stream, "ctx->cur = p;\n");
+                    if (gen->mvars) {
+                        stream__write_characters(gen->stream, ' ', indent);
+                        stream__puts(gen->stream, "pcc_marker_variable_set_record__restore(ctx->auxil, &(ctx->mvars), ctx->pos + ctx->cur);\n");
                     }
-                    else if (!v) {
-                        print_error(
-                            "%s:" FMT_LU ":" FMT_LU ": Version not matched: %s\n",
-                            ctx->input->path, (ulong_t)(l + 1), (ulong_t)(m + 1),
-                            s
-                        );
-                        ctx->input->errnum++;
+                    if (gen->mode == CODE_MODE_NORMAL) {
+                        stream__write_characters(gen->stream, ' ', indent);
+                        stream__puts(gen->stream, "pcc_thunk_array__revert(ctx, &(chunk->thunks), n);\n");
                     }
+                    if (indent > INDENT_UNIT) stream__write_characters(gen->stream, ' ', indent - INDENT_UNIT);
+                    stream__printf(gen->stream, "L%04d:;\n", m);
                 }
-                else {
-                    print_error(
-                        "%s:" FMT_LU ":" FMT_LU ": Invalid name: %s\n",
-                        ctx->input->path, (ulong_t)(l + 1), (ulong_t)(m + 1),
-                        s
-                    );
-                    ctx->input->errnum++;
-                }
-                free(s);
-                b = TRUE;
             }
-            else if (
-                parse_directive_version_(ctx->input, "%version", &(ctx->finfo.p[iinfo].version)) ||
-                parse_directive_block_(ctx->input, "%earlysource", &(ctx->esource), NULL) ||
-                parse_directive_block_(ctx->input, "%earlyheader", &(ctx->eheader), NULL) ||
-                parse_directive_block_(ctx->input, "%earlycommon", &(ctx->esource), &(ctx->eheader)) ||
-                parse_directive_block_(ctx->input, "%source", &(ctx->source), NULL) ||
-                parse_directive_block_(ctx->input, "%header", &(ctx->header), NULL) ||
-                parse_directive_block_(ctx->input, "%common", &(ctx->source), &(ctx->header)) ||
-                parse_directive_string_(ctx->input, "%value", imp ? NULL : &(ctx->vtype), STRING_FLAG_NOTEMPTY | STRING_FLAG_NOTVOID) ||
-                parse_directive_string_(ctx->input, "%auxil", imp ? NULL : &(ctx->atype), STRING_FLAG_NOTEMPTY | STRING_FLAG_NOTVOID) ||
-                parse_directive_string_(ctx->input, "%prefix", imp ? NULL : &(ctx->prefix), STRING_FLAG_NOTEMPTY | STRING_FLAG_IDENTIFIER) ||
-                parse_directive_marker_(ctx->input, "%marker", &(ctx->mvars))
-            ) {
-                b = TRUE;
+            if (!bare) {
+                indent -= INDENT_UNIT;
+                stream__write_characters(gen->stream, ' ', indent);
+                stream__puts(gen->stream, "}\n");
+            }
+            return CODE_REACH_ALWAYS_SUCCEED;
+        }
+    }
+    else {
+        /* no code to generate */
+        return CODE_REACH_ALWAYS_SUCCEED;
+    }
+}
+
+static code_reach_t generate_predicating_code(generate_t *gen, const node_t *expr, bool_t neg, bool_t recog, int onfail, size_t indent, bool_t bare) {
+    const code_mode_t mode = gen->mode;
+    code_reach_t r;
+    if (recog && gen->mode == CODE_MODE_NORMAL) gen->mode = CODE_MODE_PREDICATE;
+    if (!bare) {
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "{\n");
+        indent += INDENT_UNIT;
+    }
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(gen->stream, "const size_t p = ctx->cur;\n");
+    if (neg) {
+        const int l = ++gen->label;
+        r = generate_code(gen, expr, l, indent, FALSE);
+        if (r != CODE_REACH_ALWAYS_FAIL) {
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__puts(gen->stream, "ctx->cur = p;\n");
+            if (gen->mvars) {
+                stream__write_characters(gen->stream, ' ', indent);
+                stream__puts(gen->stream, "pcc_marker_variable_set_record__restore(ctx->auxil, &(ctx->mvars), ctx->pos + ctx->cur);\n");
+            }
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__printf(gen->stream, "goto L%04d;\n", onfail);
+        }
+        if (r != CODE_REACH_ALWAYS_SUCCEED) {
+            if (indent > INDENT_UNIT) stream__write_characters(gen->stream, ' ', indent - INDENT_UNIT);
+            stream__printf(gen->stream, "L%04d:;\n", l);
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__puts(gen->stream, "ctx->cur = p;\n");
+            if (gen->mvars) {
+                stream__write_characters(gen->stream, ' ', indent);
+                stream__puts(gen->stream, "pcc_marker_variable_set_record__restore(ctx->auxil, &(ctx->mvars), ctx->pos + ctx->cur);\n");
+            }
+        }
+        switch (r) {
+        case CODE_REACH_ALWAYS_SUCCEED: r = CODE_REACH_ALWAYS_FAIL; break;
+        case CODE_REACH_ALWAYS_FAIL: r = CODE_REACH_ALWAYS_SUCCEED; break;
+        case CODE_REACH_BOTH: break;
+        }
+    }
+    else {
+        const int l = ++gen->label;
+        const int m = ++gen->label;
+        r = generate_code(gen, expr, l, indent, FALSE);
+        if (r != CODE_REACH_ALWAYS_FAIL) {
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__puts(gen->stream, "ctx->cur = p;\n");
+            if (gen->mvars) {
+                stream__write_characters(gen->stream, ' ', indent);
+                stream__puts(gen->stream, "pcc_marker_variable_set_record__restore(ctx->auxil, &(ctx->mvars), ctx->pos + ctx->cur);\n");
+            }
+        }
+        if (r == CODE_REACH_BOTH) {
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__printf(gen->stream, "goto L%04d;\n", m);
+        }
+        if (r != CODE_REACH_ALWAYS_SUCCEED) {
+            if (indent > INDENT_UNIT) stream__write_characters(gen->stream, ' ', indent - INDENT_UNIT);
+            stream__printf(gen->stream, "L%04d:;\n", l);
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__puts(gen->stream, "ctx->cur = p;\n");
+            if (gen->mvars) {
+                stream__write_characters(gen->stream, ' ', indent);
+                stream__puts(gen->stream, "pcc_marker_variable_set_record__restore(ctx->auxil, &(ctx->mvars), ctx->pos + ctx->cur);\n");
+            }
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__printf(gen->stream, "goto L%04d;\n", onfail);
+        }
+        if (r == CODE_REACH_BOTH) {
+            if (indent > INDENT_UNIT) stream__write_characters(gen->stream, ' ', indent - INDENT_UNIT);
+            stream__printf(gen->stream, "L%04d:;\n", m);
+        }
+    }
+    if (!bare) {
+        indent -= INDENT_UNIT;
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "}\n");
+    }
+    gen->mode = mode;
+    return r;
+}
+
+static code_reach_t generate_progpred_code(generate_t *gen, size_t index, bool_t neg, int onfail, size_t indent, bool_t bare) {
+    if (!bare) {
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "{\n");
+        indent += INDENT_UNIT;
+    }
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__printf(gen->stream, "int r = %s;\n", neg ? "0" : "1");
+    if (gen->mvars) {
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "pcc_marker_variable_set_record__save(ctx->auxil, &(ctx->mvars), ctx->pos + ctx->cur);\n");
+    }
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(gen->stream, "ctx->capt0.range.start = chunk->pos;\n");
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(gen->stream, "ctx->capt0.range.end = ctx->cur;\n");
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(gen->stream, "pcc_char_array__resize(ctx->auxil, &(ctx->capt0.string), 0);\n");
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__printf(
+        gen->stream, "pcc_predicate_%s_" FMT_LU "(ctx, chunk, &r);\n",
+        gen->rule->data.rule.name, (ulong_t)index
+    );
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__printf(gen->stream, "if (%sr) goto L%04d;\n", neg ? "" : "!", onfail);
+    if (!bare) {
+        indent -= INDENT_UNIT;
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "}\n");
+    }
+    return CODE_REACH_BOTH;
+}
+
+static code_reach_t generate_sequential_code(generate_t *gen, const node_array_t *nodes, int onfail, size_t indent, bool_t bare) {
+    bool_t b = FALSE;
+    size_t i;
+    for (i = 0; i < nodes->n; i++) {
+        switch (generate_code(gen, nodes->p[i], onfail, indent, FALSE)) {
+        case CODE_REACH_ALWAYS_FAIL:
+            if (i + 1 < nodes->n) {
+                stream__write_characters(gen->stream, ' ', indent);
+                stream__puts(gen->stream, "/* unreachable codes omitted */\n");
+            }
+            return CODE_REACH_ALWAYS_FAIL;
+        case CODE_REACH_ALWAYS_SUCCEED:
+            break;
+        default:
+            b = TRUE;
+        }
+    }
+    return b ? CODE_REACH_BOTH : CODE_REACH_ALWAYS_SUCCEED;
+}
+
+static code_reach_t generate_alternative_code(generate_t *gen, const node_array_t *nodes, int onfail, size_t indent, bool_t bare) {
+    bool_t b = FALSE;
+    int m = ++gen->label;
+    size_t i;
+    if (!bare) {
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "{\n");
+        indent += INDENT_UNIT;
+    }
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(gen->stream, "const size_t p = ctx->cur;\n");
+    if (gen->mode == CODE_MODE_NORMAL) {
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "const size_t n = chunk->thunks.n;\n");
+    }
+    for (i = 0; i < nodes->n; i++) {
+        const bool_t c = (i + 1 < nodes->n) ? TRUE : FALSE;
+        const int l = ++gen->label;
+        switch (generate_code(gen, nodes->p[i], l, indent, FALSE)) {
+        case CODE_REACH_ALWAYS_SUCCEED:
+            if (c) {
+                stream__write_characters(gen->stream, ' ', indent);
+                stream__puts(gen->stream, "/* unreachable codes omitted */\n");
             }
-            else if (input_state__match_character(ctx->input, '%')) {
-                print_error("%s:" FMT_LU ":" FMT_LU ": Invalid directive\n", ctx->input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
-                ctx->input->errnum++;
-                input_state__match_identifier(ctx->input);
-                input_state__match_spaces(ctx->input);
-                b = TRUE;
+            if (b) {
+                if (indent > INDENT_UNIT) stream__write_characters(gen->stream, ' ', indent - INDENT_UNIT);
+                stream__printf(gen->stream, "L%04d:;\n", m);
             }
-            else {
-                node_t *const n_r = parse_rule(ctx->input);
-                if (n_r == NULL) {
-                    if (b) {
-                        print_error("%s:" FMT_LU ":" FMT_LU ": Illegal rule syntax\n", ctx->input->path, (ulong_t)(l + 1), (ulong_t)(m + 1));
-                        ctx->input->errnum++;
-                        b = FALSE;
-                    }
-                    ctx->input->linenum = l;
-                    ctx->input->charnum = n;
-                    ctx->input->linepos = o;
-                    if (!input_state__match_identifier(ctx->input) && !input_state__match_spaces(ctx->input)) input_state__match_character_any(ctx->input);
-                    continue;
-                }
-                node_array__add(&(ctx->rules), n_r);
-                b = TRUE;
+            if (!bare) {
+                indent -= INDENT_UNIT;
+                stream__write_characters(gen->stream, ' ', indent);
+                stream__puts(gen->stream, "}\n");
             }
-            input_state__commit_buffer(ctx->input);
+            return CODE_REACH_ALWAYS_SUCCEED;
+        case CODE_REACH_ALWAYS_FAIL:
+            break;
+        default:
+            b = TRUE;
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__printf(gen->stream, "goto L%04d;\n", m);
+        }
+        if (indent > INDENT_UNIT) stream__write_characters(gen->stream, ' ', indent - INDENT_UNIT);
+        stream__printf(gen->stream, "L%04d:;\n", l);
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "ctx->cur = p;\n");
+        if (gen->mvars) {
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__puts(gen->stream, "pcc_marker_variable_set_record__restore(ctx->auxil, &(ctx->mvars), ctx->pos + ctx->cur);\n");
+        }
+        if (gen->mode == CODE_MODE_NORMAL) {
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__puts(gen->stream, "pcc_thunk_array__revert(ctx, &(chunk->thunks), n);\n");
+        }
+        if (!c) {
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__printf(gen->stream, "goto L%04d;\n", onfail);
         }
-        input_state__commit_buffer(ctx->input);
     }
-    ctx->errnum += ctx->input->errnum;
-    ctx->flags |= ctx->input->flags;
-    return iinfo;
+    if (b) {
+        if (indent > INDENT_UNIT) stream__write_characters(gen->stream, ' ', indent - INDENT_UNIT);
+        stream__printf(gen->stream, "L%04d:;\n", m);
+    }
+    if (!bare) {
+        indent -= INDENT_UNIT;
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "}\n");
+    }
+    return b ? CODE_REACH_BOTH : CODE_REACH_ALWAYS_FAIL;
 }
 
-static bool_t parse(context_t *ctx) {
-    parse_file_(ctx);
-    make_rulehash(ctx);
+static code_reach_t generate_capturing_code(generate_t *gen, const node_t *expr, size_t index, int onfail, size_t indent, bool_t bare) {
+    code_reach_t r;
+    if (gen->mode == CODE_MODE_RECOGNITION) return generate_code(gen, expr, onfail, indent, bare);
+    if (!bare) {
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "{\n");
+        indent += INDENT_UNIT;
+    }
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(gen->stream, "const size_t p = ctx->cur;\n");
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(gen->stream, "size_t q;\n");
+    r = generate_code(gen, expr, onfail, indent, FALSE);
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(gen->stream, "q = ctx->cur;\n");
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__printf(gen->stream, "chunk->capts.p[" FMT_LU "].range.start = p;\n", (ulong_t)index);
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__printf(gen->stream, "chunk->capts.p[" FMT_LU "].range.end = q;\n", (ulong_t)index);
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__printf(gen->stream, "pcc_char_array__resize(ctx->auxil, &(chunk->capts.p[" FMT_LU "].string), 0);\n", (ulong_t)index);
+    if (!bare) {
+        indent -= INDENT_UNIT;
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "}\n");
+    }
+    return r;
+}
+
+static code_reach_t generate_matching_capt_code(generate_t *gen, size_t index, int onfail, size_t indent, bool_t bare) {
+    if (!bare) {
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "{\n");
+        indent += INDENT_UNIT;
+    }
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__printf(
+        gen->stream, "const size_t n = chunk->capts.p[" FMT_LU "].range.end - chunk->capts.p[" FMT_LU "].range.start;\n",
+        (ulong_t)index, (ulong_t)index
+    );
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(gen->stream, "if (n > 0) {\n");
+    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+    stream__printf(gen->stream, "const size_t k = chunk->capts.p[" FMT_LU "].range.start;\n", (ulong_t)index);
+    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+    stream__puts(gen->stream, "size_t i;\n");
+    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+    stream__puts(gen->stream, "for (i = 0; i < n; i++) {\n");
+    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT * 2);
+    stream__printf(
+        gen->stream,
+        "if (pcc_refill_buffer(ctx, i + 1) < i + 1 || (ctx->buffer.p + ctx->cur)[i] != (ctx->buffer.p + k)[i]) goto L%04d;\n",
+        onfail
+    );
+    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+    stream__puts(gen->stream, "}\n");
+    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+    stream__puts(gen->stream, "ctx->cur += n;\n");
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(gen->stream, "}\n");
+    if (!bare) {
+        indent -= INDENT_UNIT;
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "}\n");
+    }
+    return CODE_REACH_BOTH;
+}
+
+static code_reach_t generate_matching_mvar_code(generate_t *gen, const char *name, int onfail, size_t indent, bool_t bare) {
+    if (!bare) {
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "{\n");
+        indent += INDENT_UNIT;
+    }
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__printf(gen->stream, "const size_t n0 = ctx->mvars.curr.set.%s.curr.string.n;\n", name);
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(gen->stream, "if (n0 > 1) {\n");
+    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+    stream__puts(gen->stream, "const size_t n = n0 - 1;\n");
+    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+    stream__printf(gen->stream, "const char *const q = ctx->mvars.curr.set.%s.curr.string.p;\n", name);
+    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+    stream__puts(gen->stream, "size_t i;\n");
+    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+    stream__puts(gen->stream, "for (i = 0; i < n; i++) {\n");
+    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT * 2);
+    stream__printf(
+        gen->stream,
+        "if (pcc_refill_buffer(ctx, i + 1) < i + 1 || (ctx->buffer.p + ctx->cur)[i] != q[i]) goto L%04d;\n",
+        onfail
+    );
+    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+    stream__puts(gen->stream, "}\n");
+    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+    stream__puts(gen->stream, "ctx->cur += n;\n");
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__puts(gen->stream, "}\n");
+    if (!bare) {
+        indent -= INDENT_UNIT;
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "}\n");
+    }
+    return CODE_REACH_BOTH;
+}
+
+static code_reach_t generate_thunking_action_code(
+    generate_t *gen, size_t index, const node_const_array_t *rvars, const node_const_array_t *capts, bool_t error, int onfail, size_t indent, bool_t bare
+) {
+    assert(gen->rule->type == NODE_RULE);
+    if (gen->mode != CODE_MODE_NORMAL) {
+        /* no code to generate */
+        return CODE_REACH_ALWAYS_SUCCEED;
+    }
+    if (!bare) {
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "{\n");
+        indent += INDENT_UNIT;
+    }
+    if (error) {
+        stream__write_characters(gen->stream, ' ', indent);
+        if (gen->vtype)
+            stream__printf(gen->stream, "%s%snull;\n", gen->vtype, is_pointer_type(gen->vtype) ? "" : " ");
+        else
+            stream__puts(gen->stream, "pcc_value_t null;\n");
+    }
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__printf(
+        gen->stream, "pcc_thunk_t *const thunk = pcc_thunk__create_leaf(ctx, pcc_action_%s_" FMT_LU ", " FMT_LU ", " FMT_LU ");\n",
+        gen->rule->data.rule.name, (ulong_t)index, (ulong_t)gen->rule->data.rule.rvars.n, (ulong_t)gen->rule->data.rule.capts.n
+    );
+    if (gen->profile) {
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__printf(gen->stream, "ctx->profile[" FMT_LU "].thunks++;\n", (ulong_t)gen->rule->data.rule.index);
+    }
     {
         size_t i;
-        for (i = 0; i < ctx->rules.n; i++) {
-            node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
-            if (rule->ref < 0) {
-                print_error(
-                    "%s:" FMT_LU ":" FMT_LU ": Multiple definitions of rule: '%s'\n",
-                    rule->fpos.path, (ulong_t)(rule->fpos.line + 1), (ulong_t)(rule->fpos.col + 1),
-                    rule->name
+        for (i = 0; i < rvars->n; i++) {
+            assert(rvars->p[i]->type == NODE_REFERENCE);
+            stream__write_characters(gen->stream, ' ', indent);
+            if (gen->vtype) {
+                stream__printf(
+                    gen->stream, "thunk->data.leaf.values.p[" FMT_LU "] = &(((%s%s*)chunk->values.p)[" FMT_LU "]);\n",
+                    (ulong_t)rvars->p[i]->data.reference.index, gen->vtype, is_pointer_type(gen->vtype) ? "" : " ",
+                    (ulong_t)rvars->p[i]->data.reference.index
+                );
+            }
+            else {
+                stream__printf(
+                    gen->stream, "thunk->data.leaf.values.p[" FMT_LU "] = &(chunk->values.p[" FMT_LU "]);\n",
+                    (ulong_t)rvars->p[i]->data.reference.index, (ulong_t)rvars->p[i]->data.reference.index
                 );
-                ctx->errnum++;
-                continue;
             }
-            link_references(ctx, rule->expr);
         }
-    }
-    if (ctx->rules.n > 0)
-        mark_rules_if_used(ctx, ctx->rules.p[0]);
-    {
-        size_t i;
-        for (i = 0; i < ctx->rules.n; i++) {
-            if (!ctx->rules.p[i]->data.rule.used)
-                unreference_rules_from_unused_rule(ctx, ctx->rules.p[i]);
+        for (i = 0; i < capts->n; i++) {
+            assert(capts->p[i]->type == NODE_CAPTURE);
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__printf(
+                gen->stream, "thunk->data.leaf.capts.p[" FMT_LU "] = &(chunk->capts.p[" FMT_LU "]);\n",
+                (ulong_t)capts->p[i]->data.capture.index, (ulong_t)capts->p[i]->data.capture.index
+            );
         }
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "thunk->data.leaf.capt0.range.start = chunk->pos;\n");
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "thunk->data.leaf.capt0.range.end = ctx->cur;\n");
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "pcc_char_array__resize(ctx->auxil, &(thunk->data.leaf.capt0.string), 0);\n");
+    }
+    if (gen->mvars) {
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "pcc_marker_value_set__copy_from(ctx->auxil, &(thunk->data.leaf.mvars), &(ctx->mvars.curr.set));\n");
+    }
+    if (error) {
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, gen->vtype ? "memset(&null, 0, sizeof(null)); /* in case */\n" : "memset(&null, 0, sizeof(pcc_value_t)); /* in case */\n");
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "thunk->data.leaf.action(ctx, thunk, &null);\n");
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "pcc_thunk__destroy(ctx, thunk);\n");
     }
-    {
-        size_t i, j;
-        for (i = 0, j = 0; i < ctx->rules.n; i++) {
-            if (!ctx->rules.p[i]->data.rule.used)
-                destroy_node(ctx->rules.p[i]);
-            else
-                ctx->rules.p[j++] = ctx->rules.p[i];
-        }
-        ctx->rules.n = j;
+    else {
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "pcc_thunk_array__add(ctx, &(chunk->thunks), thunk);\n");
     }
-    {
-        size_t i;
-        for (i = 0; i < ctx->rules.n; i++) {
-            const node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
-            verify_rule_variables(ctx, rule->expr, NULL);
-            verify_captures(ctx, rule->expr, NULL);
-            verify_marker_variables(ctx, rule->expr);
-            update_code_flags(ctx, rule);
-        }
+    if (!bare) {
+        indent -= INDENT_UNIT;
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "}\n");
     }
-    if (ctx->opts.debug) {
-        size_t i;
-        for (i = 0; i < ctx->rules.n; i++) {
-            dump_node(ctx, ctx->rules.p[i], 0);
-        }
-        dump_options(ctx);
+    return CODE_REACH_ALWAYS_SUCCEED;
+}
+
+static code_reach_t generate_thunking_error_code(
+    generate_t *gen, const node_t *expr, size_t index, const node_const_array_t *rvars, const node_const_array_t *capts, int onfail, size_t indent, bool_t bare
+) {
+    code_reach_t r;
+    const int l = ++gen->label;
+    const int m = ++gen->label;
+    assert(gen->rule->type == NODE_RULE);
+    if (!bare) {
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "{\n");
+        indent += INDENT_UNIT;
     }
-    return (ctx->errnum == 0) ? TRUE : FALSE;
+    r = generate_code(gen, expr, l, indent, TRUE);
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__printf(gen->stream, "goto L%04d;\n", m);
+    if (indent > INDENT_UNIT) stream__write_characters(gen->stream, ' ', indent - INDENT_UNIT);
+    stream__printf(gen->stream, "L%04d:;\n", l);
+    generate_thunking_action_code(gen, index, rvars, capts, TRUE, l, indent, FALSE);
+    stream__write_characters(gen->stream, ' ', indent);
+    stream__printf(gen->stream, "goto L%04d;\n", onfail);
+    if (indent > INDENT_UNIT) stream__write_characters(gen->stream, ' ', indent - INDENT_UNIT);
+    stream__printf(gen->stream, "L%04d:;\n", m);
+    if (!bare) {
+        indent -= INDENT_UNIT;
+        stream__write_characters(gen->stream, ' ', indent);
+        stream__puts(gen->stream, "}\n");
+    }
+    return r;
 }
 
-static code_reach_t generate_matching_string_code(generate_t *gen, const char_array_t *value, int onfail, size_t indent, bool_t bare) {
-    if (value->n > 0) {
-        char s[5];
-        if (value->n > 1) {
-            size_t i;
+static code_reach_t generate_code(generate_t *gen, const node_t *node, int onfail, size_t indent, bool_t bare) {
+    if (node == NULL) {
+        print_error("Internal error [%d]\n", __LINE__);
+        exit(-1);
+    }
+    if (gen->dfa && is_automaton_node(node, gen->ascii)) return generate_dfa_code(gen, node, onfail, indent, bare);
+    switch (node->type) {
+    case NODE_RULE:
+        print_error("Internal error [%d]\n", __LINE__);
+        exit(-1);
+    case NODE_REFERENCE:
+        if (gen->mode != CODE_MODE_NORMAL) {
             stream__write_characters(gen->stream, ' ', indent);
-            stream__puts(gen->stream, "if (\n");
-            for (i = 0; i < value->n; i++) {
-                stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
+            stream__printf(gen->stream, "if (!pcc_recognize_rule(ctx, pcc_recognize_rule_%s, ", node->data.reference.name);
+            generate_rule_index_argument(gen, node->data.reference.rule);
+            stream__printf(
+                gen->stream, FMT_LU ")) goto L%04d;\n",
+                (ulong_t)node->data.reference.rule->data.rule.cycle, onfail
+            );
+        }
+        else if (node->data.reference.index != VOID_VALUE) {
+            stream__write_characters(gen->stream, ' ', indent);
+            stream__printf(gen->stream, "if (!pcc_apply_rule(ctx, pcc_evaluate_rule_%s, ", node->data.reference.name);
+            generate_rule_index_argument(gen, node->data.reference.rule);
+            if (gen->vtype) {
                 stream__printf(
-                    gen->stream,
-                    "pcc_refill_buffer(ctx, " FMT_LU ") < " FMT_LU " || (ctx->buffer.p + ctx->cur)[" FMT_LU "] != '%s'%s\n",
-                    (ulong_t)i + 1, (ulong_t)i + 1, (ulong_t)i, escape_character(value->p[i], &s), (i < value->n - 1) ? " ||" : ""
+                    gen->stream, "&(chunk->thunks), &(((%s%s*)chunk->values.p)[" FMT_LU "]))) goto L%04d;\n",
+                    gen->vtype, is_pointer_type(gen->vtype) ? "" : " ", (ulong_t)node->data.reference.index, onfail
+                );
+            }
+            else {
+                stream__printf(
+                    gen->stream, "&(chunk->thunks), &(chunk->values.p[" FMT_LU "]))) goto L%04d;\n",
+                    (ulong_t)node->data.reference.index, onfail
                 );
             }
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__printf(gen->stream, ") goto L%04d;\n", onfail);
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__printf(gen->stream, "ctx->cur += " FMT_LU ";\n", (ulong_t)(value->n));
-            return CODE_REACH_BOTH;
         }
         else {
             stream__write_characters(gen->stream, ' ', indent);
-            stream__puts(gen->stream, "if (\n");
-            stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-            stream__puts(gen->stream, "pcc_refill_buffer(ctx, 1) < 1 ||\n");
-            stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-            stream__printf(gen->stream, "ctx->buffer.p[ctx->cur] != '%s'\n", escape_character(value->p[0], &s));
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__printf(gen->stream, ") goto L%04d;\n", onfail);
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__puts(gen->stream, "ctx->cur++;\n");
-            return CODE_REACH_BOTH;
+            stream__printf(gen->stream, "if (!pcc_apply_rule(ctx, pcc_evaluate_rule_%s, ", node->data.reference.name);
+            generate_rule_index_argument(gen, node->data.reference.rule);
+            stream__printf(gen->stream, "&(chunk->thunks), NULL)) goto L%04d;\n", onfail);
+        }
+        return CODE_REACH_BOTH;
+    case NODE_STRING:
+        return generate_matching_string_code(gen, &(node->data.string.value), onfail, indent, bare);
+    case NODE_CHARCLASS:
+        return gen->ascii ?
+               generate_matching_charclass_code(gen, &(node->data.charclass.value), onfail, indent, bare) :
+               generate_matching_utf8_charclass_code(gen, &(node->data.charclass.value), onfail, indent, bare);
+    case NODE_POSITION:
+        return generate_position_code(gen, node->data.position.value, onfail, indent, bare);
+    case NODE_QUANTITY:
+        return generate_quantifying_code(gen, node->data.quantity.expr, node->data.quantity.min, node->data.quantity.max, onfail, indent, bare);
+    case NODE_PREDICATE:
+        return generate_predicating_code(
+            gen, node->data.predicate.expr, node->data.predicate.neg, node->data.predicate.recog, onfail, indent, bare
+        );
+    case NODE_PROGPRED:
+        return generate_progpred_code(gen, node->data.progpred.index, node->data.progpred.neg, onfail, indent, bare);
+    case NODE_SEQUENCE:
+        return generate_sequential_code(gen, &(node->data.sequence.nodes), onfail, indent, bare);
+    case NODE_ALTERNATE:
+        return generate_alternative_code(gen, &(node->data.alternate.nodes), onfail, indent, bare);
+    case NODE_CAPTURE:
+        return generate_capturing_code(gen, node->data.capture.expr, node->data.capture.index, onfail, indent, bare);
+    case NODE_MATCH_CAPT:
+        return generate_matching_capt_code(gen, node->data.match_capt.index, onfail, indent, bare);
+    case NODE_MATCH_MVAR:
+        return generate_matching_mvar_code(gen, node->data.match_mvar.name, onfail, indent, bare);
+    case NODE_ACTION:
+        return generate_thunking_action_code(
+            gen, node->data.action.index, &(node->data.action.rvars), &(node->data.action.capts), FALSE, onfail, indent, bare
+        );
+    case NODE_ERROR:
+        if (gen->mode != CODE_MODE_NORMAL) {
+            /* the error action is not executed in recognition */
+            return generate_code(gen, node->data.error.expr, onfail, indent, bare);
         }
+        return generate_thunking_error_code(
+            gen, node->data.error.expr, node->data.error.index, &(node->data.error.rvars), &(node->data.error.capts), onfail, indent, bare
+        );
+    default:
+        print_error("Internal error [%d]\n", __LINE__);
+        exit(-1);
     }
-    else {
-        /* no code to generate */
-        return CODE_REACH_ALWAYS_SUCCEED;
+}
+
+static void bytecode__initialize(bytecode_t *obj, const string_array_t *mvars) {
+    size_t i;
+    size_array__initialize(&(obj->code));
+    char_array__initialize(&(obj->strings));
+    char_array__initialize(&(obj->ustrings));
+    obj->signedness = FALSE;
+    size_array__initialize(&(obj->ranges));
+    size_array__initialize(&(obj->labels));
+    size_array__initialize(&(obj->fixups));
+    for (i = 0; i < 256; i++) obj->chars[i] = VOID_VALUE;
+    obj->actions = 0;
+    obj->preds = 0;
+    obj->slot = 0;
+    obj->slotm = 0;
+    for (i = 0; i < BYTECODE_OP_COUNT; i++) obj->used[i] = FALSE;
+    obj->used[BYTECODE_OP_FAIL] = TRUE; /* also the target of the unused operation codes */
+    obj->mvars = mvars;
+}
+
+static void bytecode__finalize(bytecode_t *obj) {
+    size_array__finalize(&(obj->fixups));
+    size_array__finalize(&(obj->labels));
+    size_array__finalize(&(obj->ranges));
+    char_array__finalize(&(obj->ustrings));
+    char_array__finalize(&(obj->strings));
+    size_array__finalize(&(obj->code));
+}
+
+static void bytecode__add_op(bytecode_t *obj, bytecode_op_t op) {
+    obj->used[op] = TRUE;
+    size_array__add(&(obj->code), (size_t)op);
+}
+
+static void bytecode__add_operand(bytecode_t *obj, size_t value) {
+    size_array__add(&(obj->code), value);
+}
+
+static void bytecode__add_label_operand(bytecode_t *obj, int label) {
+    size_array__add(&(obj->fixups), obj->code.n);
+    size_array__add(&(obj->code), (size_t)label);
+}
+
+static void bytecode__place_label(bytecode_t *obj, int label) {
+    while (obj->labels.n <= (size_t)label) size_array__add(&(obj->labels), VOID_VALUE);
+    obj->labels.p[label] = obj->code.n;
+}
+
+static void bytecode__resolve_labels(bytecode_t *obj) {
+    size_t i;
+    for (i = 0; i < obj->fixups.n; i++) {
+        size_t *const p = &(obj->code.p[obj->fixups.p[i]]);
+        if (*p >= obj->labels.n || obj->labels.p[*p] == VOID_VALUE) {
+            print_error("Internal error [%d]\n", __LINE__);
+            exit(-1);
+        }
+        *p = obj->labels.p[*p];
     }
+    obj->fixups.n = 0;
+    obj->labels.n = 0;
 }
 
-static code_reach_t generate_matching_charclass_code(generate_t *gen, const char_array_t *value, int onfail, size_t indent, bool_t bare) {
-    assert(gen->ascii);
-    if (value->n > 0) {
-        char s[5], t[5];
-        if (value->n > 1) {
-            const bool_t a = (value->p[0] == '^') ? TRUE : FALSE;
-            size_t i = a ? 1 : 0;
-            if (i + 1 == value->n) { /* fulfilled only if a == TRUE */
-                stream__write_characters(gen->stream, ' ', indent);
-                stream__puts(gen->stream, "if (\n");
-                stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-                stream__puts(gen->stream, "pcc_refill_buffer(ctx, 1) < 1 ||\n");
-                stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-                stream__printf(gen->stream, "ctx->buffer.p[ctx->cur] == '%s'\n", escape_character(value->p[i], &s));
-                stream__write_characters(gen->stream, ' ', indent);
-                stream__printf(gen->stream, ") goto L%04d;\n", onfail);
-                stream__write_characters(gen->stream, ' ', indent);
-                stream__puts(gen->stream, "ctx->cur++;\n");
-                return CODE_REACH_BOTH;
-            }
-            else {
-                if (!bare) {
-                    stream__write_characters(gen->stream, ' ', indent);
-                    stream__puts(gen->stream, "{\n");
-                    indent += INDENT_UNIT;
-                }
-                stream__write_characters(gen->stream, ' ', indent);
-                stream__puts(gen->stream, "char c;\n");
-                stream__write_characters(gen->stream, ' ', indent);
-                stream__printf(gen->stream, "if (pcc_refill_buffer(ctx, 1) < 1) goto L%04d;\n", onfail);
-                stream__write_characters(gen->stream, ' ', indent);
-                stream__puts(gen->stream, "c = ctx->buffer.p[ctx->cur];\n");
-                if (i + 3 == value->n && value->p[i] != '\\' && value->p[i + 1] == '-') {
-                    stream__write_characters(gen->stream, ' ', indent);
-                    stream__printf(
-                        gen->stream,
-                        a ? "if (c >= '%s' && c <= '%s') goto L%04d;\n"
-                          : "if (!(c >= '%s' && c <= '%s')) goto L%04d;\n",
-                        escape_character(value->p[i], &s), escape_character(value->p[i + 2], &t), onfail
-                    );
-                }
-                else {
-                    stream__write_characters(gen->stream, ' ', indent);
-                    stream__puts(gen->stream, a ? "if (\n" : "if (!(\n");
-                    for (; i < value->n; i++) {
-                        stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-                        if (value->p[i] == '\\' && i + 1 < value->n) i++;
-                        if (i + 2 < value->n && value->p[i + 1] == '-') {
-                            stream__printf(
-                                gen->stream, "(c >= '%s' && c <= '%s')%s\n",
-                                escape_character(value->p[i], &s), escape_character(value->p[i + 2], &t), (i + 3 == value->n) ? "" : " ||"
-                            );
-                            i += 2;
-                        }
-                        else {
-                            stream__printf(
-                                gen->stream, "c == '%s'%s\n",
-                                escape_character(value->p[i], &s), (i + 1 == value->n) ? "" : " ||"
-                            );
-                        }
-                    }
-                    stream__write_characters(gen->stream, ' ', indent);
-                    stream__printf(gen->stream, a ? ") goto L%04d;\n" : ")) goto L%04d;\n", onfail);
-                }
-                stream__write_characters(gen->stream, ' ', indent);
-                stream__puts(gen->stream, "ctx->cur++;\n");
-                if (!bare) {
-                    indent -= INDENT_UNIT;
-                    stream__write_characters(gen->stream, ' ', indent);
-                    stream__puts(gen->stream, "}\n");
-                }
-                return CODE_REACH_BOTH;
-            }
+static size_t bytecode__acquire_slot(bytecode_t *obj) {
+    const size_t k = obj->slot++;
+    if (obj->slotm < obj->slot) obj->slotm = obj->slot;
+    return k;
+}
+
+static size_t bytecode__add_string(bytecode_t *obj, const char *str, size_t len) {
+    const size_t k = obj->strings.n;
+    if (len == 1) {
+        const size_t c = (size_t)(unsigned char)str[0];
+        if (obj->chars[c] != VOID_VALUE) return obj->chars[c];
+        obj->chars[c] = k;
+    }
+    char_array__append(&(obj->strings), str, len);
+    char_array__append(&(obj->ustrings), str, len);
+    return k;
+}
+
+static size_t bytecode__add_charclass_set(bytecode_t *obj, const char_array_t *value) {
+    const size_t k = obj->strings.n;
+    unsigned char s[32], u[32];
+    size_t j;
+    assert(value->n > 1);
+    get_charclass_bitmaps(value, s, u);
+    for (j = 0; j < 32; j++) {
+        if (s[j] != u[j]) obj->signedness = TRUE;
+        char_array__append(&(obj->strings), (const char *)&(s[j]), 1);
+        char_array__append(&(obj->ustrings), (const char *)&(u[j]), 1);
+    }
+    return k;
+}
+
+static size_t bytecode__add_utf8_ranges(bytecode_t *obj, const char_array_t *value, size_t *count) {
+    const size_t k = obj->ranges.n;
+    const bool_t a = (value->n > 0 && value->p[0] == '^') ? TRUE : FALSE;
+    size_t i = a ? 1 : 0;
+    int u0 = 0;
+    bool_t r = FALSE;
+    while (i < value->n) {
+        int u = 0;
+        if (value->p[i] == '\\' && i + 1 < value->n) i++;
+        i += utf8_to_utf32(value->p + i, &u);
+        if (r) { /* character range */
+            size_array__add(&(obj->ranges), (size_t)u0);
+            size_array__add(&(obj->ranges), (size_t)u);
+            u0 = 0;
+            r = FALSE;
         }
-        else {
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__puts(gen->stream, "if (\n");
-            stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-            stream__puts(gen->stream, "pcc_refill_buffer(ctx, 1) < 1 ||\n");
-            stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-            stream__printf(gen->stream, "ctx->buffer.p[ctx->cur] != '%s'\n", escape_character(value->p[0], &s));
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__printf(gen->stream, ") goto L%04d;\n", onfail);
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__puts(gen->stream, "ctx->cur++;\n");
-            return CODE_REACH_BOTH;
+        else if (
+            value->p[i] != '-' ||
+            i == value->n - 1 /* the individual '-' character is valid when it is at the first or the last position */
+        ) { /* single character */
+            size_array__add(&(obj->ranges), (size_t)u);
+            size_array__add(&(obj->ranges), (size_t)u);
+            u0 = 0;
+            r = FALSE;
+        }
+        else {
+            assert(value->p[i] == '-');
+            i++;
+            u0 = u;
+            r = TRUE;
         }
     }
-    else {
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__printf(gen->stream, "if (pcc_refill_buffer(ctx, 1) < 1) goto L%04d;\n", onfail);
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "ctx->cur++;\n");
+    *count = (obj->ranges.n - k) / 2;
+    return k;
+}
+
+static void generate_jumping_bytecode(generate_t *gen, bytecode_op_t op, int label) {
+    bytecode__add_op(gen->bytecode, op);
+    bytecode__add_label_operand(gen->bytecode, label);
+}
+
+static size_t generate_saving_bytecode(generate_t *gen, bytecode_op_t op) {
+    const size_t k = bytecode__acquire_slot(gen->bytecode);
+    bytecode__add_op(gen->bytecode, op);
+    bytecode__add_operand(gen->bytecode, k);
+    return k;
+}
+
+static void generate_restoring_bytecode(generate_t *gen, size_t pos, size_t thunks) {
+    bytecode__add_op(gen->bytecode, BYTECODE_OP_RESTORE);
+    bytecode__add_operand(gen->bytecode, pos);
+    if (gen->mvars) bytecode__add_op(gen->bytecode, BYTECODE_OP_RESTORE_MARKERS);
+    if (thunks != VOID_VALUE) {
+        bytecode__add_op(gen->bytecode, BYTECODE_OP_RESTORE_THUNKS);
+        bytecode__add_operand(gen->bytecode, thunks);
+    }
+}
+
+static code_reach_t generate_matching_string_bytecode(generate_t *gen, const char_array_t *value, int onfail) {
+    if (value->n > 0) {
+        const size_t k = bytecode__add_string(gen->bytecode, value->p, value->n);
+        bytecode__add_op(gen->bytecode, BYTECODE_OP_STRING);
+        bytecode__add_operand(gen->bytecode, k);
+        bytecode__add_operand(gen->bytecode, value->n);
+        bytecode__add_label_operand(gen->bytecode, onfail);
         return CODE_REACH_BOTH;
     }
+    else {
+        /* no code to generate */
+        return CODE_REACH_ALWAYS_SUCCEED;
+    }
 }
 
-static code_reach_t generate_matching_utf8_charclass_code(generate_t *gen, const char_array_t *value, int onfail, size_t indent, bool_t bare) {
-    const bool_t a = (value->n > 0 && value->p[0] == '^') ? TRUE : FALSE;
-    size_t i = a ? 1 : 0;
-    if (!bare) {
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "{\n");
-        indent += INDENT_UNIT;
+static code_reach_t generate_matching_charclass_bytecode(generate_t *gen, const char_array_t *value, int onfail) {
+    assert(gen->ascii);
+    if (value->n > 1) {
+        const size_t k = bytecode__add_charclass_set(gen->bytecode, value);
+        bytecode__add_op(gen->bytecode, BYTECODE_OP_SET);
+        bytecode__add_operand(gen->bytecode, k);
+        bytecode__add_label_operand(gen->bytecode, onfail);
+        return CODE_REACH_BOTH;
     }
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__puts(gen->stream, "int u;\n");
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__puts(gen->stream, "const size_t n = pcc_get_char_as_utf32(ctx, &u);\n");
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__printf(gen->stream, "if (n == 0) goto L%04d;\n", onfail);
-    if (value->n > 0 && !(a && value->n == 1)) { /* not '.' or '[^]' */
-        int u0 = 0;
-        bool_t r = FALSE;
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, a ? "if (\n" : "if (!(\n");
-        while (i < value->n) {
-            int u = 0;
-            if (value->p[i] == '\\' && i + 1 < value->n) i++;
-            i += utf8_to_utf32(value->p + i, &u);
-            if (r) { /* character range */
-                stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-                stream__printf(gen->stream, "(u >= 0x%06x && u <= 0x%06x)%s\n", u0, u, (i < value->n) ? " ||" : "");
-                u0 = 0;
-                r = FALSE;
-            }
-            else if (
-                value->p[i] != '-' ||
-                i == value->n - 1 /* the individual '-' character is valid when it is at the first or the last position */
-            ) { /* single character */
-                stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-                stream__printf(gen->stream, "u == 0x%06x%s\n", u, (i < value->n) ? " ||" : "");
-                u0 = 0;
-                r = FALSE;
-            }
-            else {
-                assert(value->p[i] == '-');
-                i++;
-                u0 = u;
-                r = TRUE;
-            }
-        }
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__printf(gen->stream, a ? ") goto L%04d;\n" : ")) goto L%04d;\n", onfail);
+    else if (value->n > 0) {
+        return generate_matching_string_bytecode(gen, value, onfail);
     }
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__puts(gen->stream, "ctx->cur += n;\n");
-    if (!bare) {
-        indent -= INDENT_UNIT;
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "}\n");
+    else {
+        generate_jumping_bytecode(gen, BYTECODE_OP_ANY, onfail);
+        return CODE_REACH_BOTH;
     }
+}
+
+static code_reach_t generate_matching_utf8_charclass_bytecode(generate_t *gen, const char_array_t *value, int onfail) {
+    const bool_t a = (value->n > 0 && value->p[0] == '^') ? TRUE : FALSE;
+    size_t n = 0;
+    const size_t k = bytecode__add_utf8_ranges(gen->bytecode, value, &n);
+    bytecode__add_op(gen->bytecode, (a && n > 0) ? BYTECODE_OP_UTF8_NOT : BYTECODE_OP_UTF8); /* no ranges mean any character */
+    bytecode__add_operand(gen->bytecode, k);
+    bytecode__add_operand(gen->bytecode, n);
+    bytecode__add_label_operand(gen->bytecode, onfail);
     return CODE_REACH_BOTH;
 }
 
-static code_reach_t generate_position_code(generate_t *gen, size_t value, int onfail, size_t indent, bool_t bare) {
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__printf(gen->stream, "if (ctx->pos + ctx->cur != " FMT_LU ") goto L%04d;\n", value, onfail);
+static code_reach_t generate_position_bytecode(generate_t *gen, size_t value, int onfail) {
+    bytecode__add_op(gen->bytecode, BYTECODE_OP_POSITION);
+    bytecode__add_operand(gen->bytecode, value);
+    bytecode__add_label_operand(gen->bytecode, onfail);
     return CODE_REACH_BOTH;
 }
 
-static code_reach_t generate_code(generate_t *gen, const node_t *node, int onfail, size_t indent, bool_t bare);
+static code_reach_t generate_bytecode(generate_t *gen, const node_t *node, int onfail);
 
-static code_reach_t generate_quantifying_code(generate_t *gen, const node_t *expr, int min, int max, int onfail, size_t indent, bool_t bare) {
+static code_reach_t generate_quantifying_bytecode(generate_t *gen, const node_t *expr, int min, int max, int onfail) {
+    bytecode_t *const bc = gen->bytecode;
     if (max > 1 || max < 0) {
+        const size_t s = bc->slot;
+        const size_t p0 = (min > 0) ? generate_saving_bytecode(gen, BYTECODE_OP_SAVE) : VOID_VALUE;
+        const size_t n0 = (min > 0 && gen->mode == CODE_MODE_NORMAL) ? generate_saving_bytecode(gen, BYTECODE_OP_SAVE_THUNKS) : VOID_VALUE;
+        const size_t i = (min > 0 || max >= 0) ? generate_saving_bytecode(gen, BYTECODE_OP_ZERO) : VOID_VALUE;
+        const size_t p = bytecode__acquire_slot(bc);
+        const size_t n = (gen->mode == CODE_MODE_NORMAL) ? bytecode__acquire_slot(bc) : VOID_VALUE;
+        const int l = ++gen->label;
+        const int m = ++gen->label;
+        const int d = ++gen->label;
         code_reach_t r;
-        if (!bare) {
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__puts(gen->stream, "{\n");
-            indent += INDENT_UNIT;
-        }
-        if (min > 0) {
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__puts(gen->stream, "const size_t p0 = ctx->cur;\n");
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__puts(gen->stream, "const size_t n0 = chunk->thunks.n;\n");
-        }
-        if (max < 0) {
-            if (min > 0) {
-                stream__write_characters(gen->stream, ' ', indent);
-                stream__puts(gen->stream, "int i;\n");
-                stream__write_characters(gen->stream, ' ', indent);
-                stream__puts(gen->stream, "for (i = 0;; i++) {\n");
-            }
-            else {
-                stream__write_characters(gen->stream, ' ', indent);
-                stream__puts(gen->stream, "for (;;) {\n");
+        bytecode__place_label(bc, l);
+        if (max >= 0) {
+            bytecode__add_op(bc, BYTECODE_OP_AT_LEAST);
+            bytecode__add_operand(bc, i);
+            bytecode__add_operand(bc, (size_t)max);
+            bytecode__add_label_operand(bc, d);
+        }
+        bytecode__add_op(bc, BYTECODE_OP_SAVE);
+        bytecode__add_operand(bc, p);
+        if (n != VOID_VALUE) {
+            bytecode__add_op(bc, BYTECODE_OP_SAVE_THUNKS);
+            bytecode__add_operand(bc, n);
+        }
+        r = generate_bytecode(gen, expr, m);
+        if (r != CODE_REACH_ALWAYS_FAIL) {
+            bytecode__add_op(bc, BYTECODE_OP_UNMOVED);
+            bytecode__add_operand(bc, p);
+            bytecode__add_label_operand(bc, d);
+            if (i != VOID_VALUE) {
+                bytecode__add_op(bc, BYTECODE_OP_INCREMENT);
+                bytecode__add_operand(bc, i);
             }
+            generate_jumping_bytecode(gen, BYTECODE_OP_JUMP, l);
         }
-        else {
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__puts(gen->stream, "int i;\n");
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__printf(gen->stream, "for (i = 0; i < %d; i++) {\n", max);
-        }
-        stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-        stream__puts(gen->stream, "const size_t p = ctx->cur;\n");
-        stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-        stream__puts(gen->stream, "MARK_VAR_AS_USED\n");
-        stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-        stream__puts(gen->stream, "const size_t n = chunk->thunks.n;\n");
-        {
-            const int l = ++gen->label;
-            r = generate_code(gen, expr, l, indent + INDENT_UNIT, FALSE);
-            stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-            stream__puts(gen->stream, "if (ctx->cur == p) break;\n");
-            if (r != CODE_REACH_ALWAYS_SUCCEED) {
-                stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-                stream__puts(gen->stream, "continue;\n");
-                stream__write_characters(gen->stream, ' ', indent);
-                stream__printf(gen->stream, "L%04d:;\n", l);
-                stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-                stream__puts(gen->stream, "ctx->cur = p;\n");
-                if (gen->mvars) {
-                    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-                    stream__puts(gen->stream, "pcc_marker_variable_set_record__restore(ctx->auxil, &(ctx->mvars), ctx->pos + ctx->cur);\n");
-                }
-                stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-                stream__puts(gen->stream, "pcc_thunk_array__revert(ctx, &(chunk->thunks), n);\n");
-                stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-                stream__puts(gen->stream, "break;\n");
-            }
+        if (r != CODE_REACH_ALWAYS_SUCCEED) {
+            bytecode__place_label(bc, m);
+            generate_restoring_bytecode(gen, p, n);
         }
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "}\n");
+        bytecode__place_label(bc, d);
         if (min > 0) {
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__printf(gen->stream, "if (i < %d) {\n", min);
-            stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-            stream__puts(gen->stream, "ctx->cur = p0;\n");
-            if (gen->mvars) {
-                stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-                stream__puts(gen->stream, "pcc_marker_variable_set_record__restore(ctx->auxil, &(ctx->mvars), ctx->pos + ctx->cur);\n");
-            }
-            stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-            stream__puts(gen->stream, "pcc_thunk_array__revert(ctx, &(chunk->thunks), n0);\n");
-            stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-            stream__printf(gen->stream, "goto L%04d;\n", onfail);
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__puts(gen->stream, "}\n");
-        }
-        if (!bare) {
-            indent -= INDENT_UNIT;
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__puts(gen->stream, "}\n");
-        }
+            const int e = ++gen->label;
+            bytecode__add_op(bc, BYTECODE_OP_AT_LEAST);
+            bytecode__add_operand(bc, i);
+            bytecode__add_operand(bc, (size_t)min);
+            bytecode__add_label_operand(bc, e);
+            generate_restoring_bytecode(gen, p0, n0);
+            generate_jumping_bytecode(gen, BYTECODE_OP_JUMP, onfail);
+            bytecode__place_label(bc, e);
+        }
+        bc->slot = s;
         return (min > 0) ? ((r == CODE_REACH_ALWAYS_FAIL) ? CODE_REACH_ALWAYS_FAIL : CODE_REACH_BOTH) : CODE_REACH_ALWAYS_SUCCEED;
     }
     else if (max == 1) {
         if (min > 0) {
-            return generate_code(gen, expr, onfail, indent, bare);
+            return generate_bytecode(gen, expr, onfail);
         }
         else {
-            if (!bare) {
-                stream__write_characters(gen->stream, ' ', indent);
-                stream__puts(gen->stream, "{\n");
-                indent += INDENT_UNIT;
-            }
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__puts(gen->stream, "MARK_VAR_AS_USED\n");
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__puts(gen->stream, "const size_t p = ctx->cur;\n");
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__puts(gen->stream, "MARK_VAR_AS_USED\n");
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__puts(gen->stream, "const size_t n = chunk->thunks.n;\n");
-            {
-                const int l = ++gen->label;
-                if (generate_code(gen, expr, l, indent, FALSE) != CODE_REACH_ALWAYS_SUCCEED) {
-                    const int m = ++gen->label;
-                    stream__write_characters(gen->stream, ' ', indent);
-                    stream__printf(gen->stream, "goto L%04d;\n", m);
-                    if (indent > INDENT_UNIT) stream__write_characters(gen->stream, ' ', indent - INDENT_UNIT);
-                    stream__printf(gen->stream, "L%04d:;\n", l);
-                    stream__write_characters(gen->stream, ' ', indent);
-                    stream__puts(gen->stream, "ctx->cur = p;\n");
-                    if (gen->mvars) {
-                        stream__write_characters(gen->stream, ' ', indent);
-                        stream__puts(gen->stream, "pcc_marker_variable_set_record__restore(ctx->auxil, &(ctx->mvars), ctx->pos + ctx->cur);\n");
-                    }
-                    stream__write_characters(gen->stream, ' ', indent);
-                    stream__puts(gen->stream, "pcc_thunk_array__revert(ctx, &(chunk->thunks), n);\n");
-                    if (indent > INDENT_UNIT) stream__write_characters(gen->stream, ' ', indent - INDENT_UNIT);
-                    stream__printf(gen->stream, "L%04d:;\n", m);
-                }
-            }
-            if (!bare) {
-                indent -= INDENT_UNIT;
-                stream__write_characters(gen->stream, ' ', indent);
-                stream__puts(gen->stream, "}\n");
-            }
+            const size_t s = bc->slot;
+            const size_t p = generate_saving_bytecode(gen, BYTECODE_OP_SAVE);
+            const size_t n = (gen->mode == CODE_MODE_NORMAL) ? generate_saving_bytecode(gen, BYTECODE_OP_SAVE_THUNKS) : VOID_VALUE;
+            const int l = ++gen->label;
+            if (generate_bytecode(gen, expr, l) != CODE_REACH_ALWAYS_SUCCEED) {
+                const int m = ++gen->label;
+                generate_jumping_bytecode(gen, BYTECODE_OP_JUMP, m);
+                bytecode__place_label(bc, l);
+                generate_restoring_bytecode(gen, p, n);
+                bytecode__place_label(bc, m);
+            }
+            bc->slot = s;
             return CODE_REACH_ALWAYS_SUCCEED;
         }
     }
@@ -4793,37 +7475,24 @@ static code_reach_t generate_quantifying_code(generate_t *gen, const node_t *exp
     }
 }
 
-static code_reach_t generate_predicating_code(generate_t *gen, const node_t *expr, bool_t neg, int onfail, size_t indent, bool_t bare) {
+static code_reach_t generate_predicating_bytecode(generate_t *gen, const node_t *expr, bool_t neg, bool_t recog, int onfail) {
+    bytecode_t *const bc = gen->bytecode;
+    const code_mode_t mode = gen->mode;
+    const size_t s = bc->slot;
+    size_t p;
     code_reach_t r;
-    if (!bare) {
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "{\n");
-        indent += INDENT_UNIT;
-    }
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__puts(gen->stream, "const size_t p = ctx->cur;\n");
+    if (recog && gen->mode == CODE_MODE_NORMAL) gen->mode = CODE_MODE_PREDICATE;
+    p = generate_saving_bytecode(gen, BYTECODE_OP_SAVE);
     if (neg) {
         const int l = ++gen->label;
-        r = generate_code(gen, expr, l, indent, FALSE);
+        r = generate_bytecode(gen, expr, l);
         if (r != CODE_REACH_ALWAYS_FAIL) {
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__puts(gen->stream, "ctx->cur = p;\n");
-            if (gen->mvars) {
-                stream__write_characters(gen->stream, ' ', indent);
-                stream__puts(gen->stream, "pcc_marker_variable_set_record__restore(ctx->auxil, &(ctx->mvars), ctx->pos + ctx->cur);\n");
-            }
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__printf(gen->stream, "goto L%04d;\n", onfail);
+            generate_restoring_bytecode(gen, p, VOID_VALUE);
+            generate_jumping_bytecode(gen, BYTECODE_OP_JUMP, onfail);
         }
         if (r != CODE_REACH_ALWAYS_SUCCEED) {
-            if (indent > INDENT_UNIT) stream__write_characters(gen->stream, ' ', indent - INDENT_UNIT);
-            stream__printf(gen->stream, "L%04d:;\n", l);
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__puts(gen->stream, "ctx->cur = p;\n");
-            if (gen->mvars) {
-                stream__write_characters(gen->stream, ' ', indent);
-                stream__puts(gen->stream, "pcc_marker_variable_set_record__restore(ctx->auxil, &(ctx->mvars), ctx->pos + ctx->cur);\n");
-            }
+            bytecode__place_label(bc, l);
+            generate_restoring_bytecode(gen, p, VOID_VALUE);
         }
         switch (r) {
         case CODE_REACH_ALWAYS_SUCCEED: r = CODE_REACH_ALWAYS_FAIL; break;
@@ -4834,87 +7503,42 @@ static code_reach_t generate_predicating_code(generate_t *gen, const node_t *exp
     else {
         const int l = ++gen->label;
         const int m = ++gen->label;
-        r = generate_code(gen, expr, l, indent, FALSE);
+        r = generate_bytecode(gen, expr, l);
         if (r != CODE_REACH_ALWAYS_FAIL) {
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__puts(gen->stream, "ctx->cur = p;\n");
-            if (gen->mvars) {
-                stream__write_characters(gen->stream, ' ', indent);
-                stream__puts(gen->stream, "pcc_marker_variable_set_record__restore(ctx->auxil, &(ctx->mvars), ctx->pos + ctx->cur);\n");
-            }
+            generate_restoring_bytecode(gen, p, VOID_VALUE);
         }
         if (r == CODE_REACH_BOTH) {
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__printf(gen->stream, "goto L%04d;\n", m);
+            generate_jumping_bytecode(gen, BYTECODE_OP_JUMP, m);
         }
         if (r != CODE_REACH_ALWAYS_SUCCEED) {
-            if (indent > INDENT_UNIT) stream__write_characters(gen->stream, ' ', indent - INDENT_UNIT);
-            stream__printf(gen->stream, "L%04d:;\n", l);
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__puts(gen->stream, "ctx->cur = p;\n");
-            if (gen->mvars) {
-                stream__write_characters(gen->stream, ' ', indent);
-                stream__puts(gen->stream, "pcc_marker_variable_set_record__restore(ctx->auxil, &(ctx->mvars), ctx->pos + ctx->cur);\n");
-            }
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__printf(gen->stream, "goto L%04d;\n", onfail);
-        }
-        if (r == CODE_REACH_BOTH) {
-            if (indent > INDENT_UNIT) stream__write_characters(gen->stream, ' ', indent - INDENT_UNIT);
-            stream__printf(gen->stream, "L%04d:;\n", m);
-        }
-    }
-    if (!bare) {
-        indent -= INDENT_UNIT;
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "}\n");
+            bytecode__place_label(bc, l);
+            generate_restoring_bytecode(gen, p, VOID_VALUE);
+            generate_jumping_bytecode(gen, BYTECODE_OP_JUMP, onfail);
+        }
+        if (r == CODE_REACH_BOTH) {
+            bytecode__place_label(bc, m);
+        }
     }
+    bc->slot = s;
+    gen->mode = mode;
     return r;
 }
 
-static code_reach_t generate_progpred_code(generate_t *gen, size_t index, bool_t neg, int onfail, size_t indent, bool_t bare) {
-    if (!bare) {
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "{\n");
-        indent += INDENT_UNIT;
-    }
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__printf(gen->stream, "int r = %s;\n", neg ? "0" : "1");
-    if (gen->mvars) {
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "pcc_marker_variable_set_record__save(ctx->auxil, &(ctx->mvars), ctx->pos + ctx->cur);\n");
-    }
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__puts(gen->stream, "ctx->capt0.range.start = chunk->pos;\n");
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__puts(gen->stream, "ctx->capt0.range.end = ctx->cur;\n");
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__puts(gen->stream, "pcc_char_array__resize(ctx->auxil, &(ctx->capt0.string), 0);\n");
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__printf(
-        gen->stream, "pcc_predicate_%s_" FMT_LU "(ctx, chunk, &r);\n",
-        gen->rule->data.rule.name, (ulong_t)index
-    );
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__printf(gen->stream, "if (%sr) goto L%04d;\n", neg ? "" : "!", onfail);
-    if (!bare) {
-        indent -= INDENT_UNIT;
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "}\n");
-    }
+static code_reach_t generate_progpred_bytecode(generate_t *gen, size_t index, bool_t neg, int onfail) {
+    if (gen->mvars) bytecode__add_op(gen->bytecode, BYTECODE_OP_SAVE_MARKERS);
+    bytecode__add_op(gen->bytecode, BYTECODE_OP_PREDICATE);
+    bytecode__add_operand(gen->bytecode, gen->bytecode->preds + index);
+    bytecode__add_operand(gen->bytecode, neg ? 1 : 0);
+    bytecode__add_label_operand(gen->bytecode, onfail);
     return CODE_REACH_BOTH;
 }
 
-static code_reach_t generate_sequential_code(generate_t *gen, const node_array_t *nodes, int onfail, size_t indent, bool_t bare) {
+static code_reach_t generate_sequential_bytecode(generate_t *gen, const node_array_t *nodes, int onfail) {
     bool_t b = FALSE;
     size_t i;
     for (i = 0; i < nodes->n; i++) {
-        switch (generate_code(gen, nodes->p[i], onfail, indent, FALSE)) {
+        switch (generate_bytecode(gen, nodes->p[i], onfail)) {
         case CODE_REACH_ALWAYS_FAIL:
-            if (i + 1 < nodes->n) {
-                stream__write_characters(gen->stream, ' ', indent);
-                stream__puts(gen->stream, "/* unreachable codes omitted */\n");
-            }
             return CODE_REACH_ALWAYS_FAIL;
         case CODE_REACH_ALWAYS_SUCCEED:
             break;
@@ -4925,335 +7549,1033 @@ static code_reach_t generate_sequential_code(generate_t *gen, const node_array_t
     return b ? CODE_REACH_BOTH : CODE_REACH_ALWAYS_SUCCEED;
 }
 
-static code_reach_t generate_alternative_code(generate_t *gen, const node_array_t *nodes, int onfail, size_t indent, bool_t bare) {
+static code_reach_t generate_alternative_bytecode(generate_t *gen, const node_array_t *nodes, int onfail) {
+    bytecode_t *const bc = gen->bytecode;
+    const size_t s = bc->slot;
+    const size_t p = generate_saving_bytecode(gen, BYTECODE_OP_SAVE);
+    const size_t n = (gen->mode == CODE_MODE_NORMAL) ? generate_saving_bytecode(gen, BYTECODE_OP_SAVE_THUNKS) : VOID_VALUE;
     bool_t b = FALSE;
     int m = ++gen->label;
     size_t i;
-    if (!bare) {
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "{\n");
-        indent += INDENT_UNIT;
-    }
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__puts(gen->stream, "const size_t p = ctx->cur;\n");
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__puts(gen->stream, "const size_t n = chunk->thunks.n;\n");
     for (i = 0; i < nodes->n; i++) {
-        const bool_t c = (i + 1 < nodes->n) ? TRUE : FALSE;
         const int l = ++gen->label;
-        switch (generate_code(gen, nodes->p[i], l, indent, FALSE)) {
+        switch (generate_bytecode(gen, nodes->p[i], l)) {
         case CODE_REACH_ALWAYS_SUCCEED:
-            if (c) {
-                stream__write_characters(gen->stream, ' ', indent);
-                stream__puts(gen->stream, "/* unreachable codes omitted */\n");
-            }
-            if (b) {
-                if (indent > INDENT_UNIT) stream__write_characters(gen->stream, ' ', indent - INDENT_UNIT);
-                stream__printf(gen->stream, "L%04d:;\n", m);
-            }
-            if (!bare) {
-                indent -= INDENT_UNIT;
-                stream__write_characters(gen->stream, ' ', indent);
-                stream__puts(gen->stream, "}\n");
-            }
+            if (b) bytecode__place_label(bc, m);
+            bc->slot = s;
             return CODE_REACH_ALWAYS_SUCCEED;
         case CODE_REACH_ALWAYS_FAIL:
             break;
         default:
             b = TRUE;
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__printf(gen->stream, "goto L%04d;\n", m);
+            generate_jumping_bytecode(gen, BYTECODE_OP_JUMP, m);
         }
-        if (indent > INDENT_UNIT) stream__write_characters(gen->stream, ' ', indent - INDENT_UNIT);
-        stream__printf(gen->stream, "L%04d:;\n", l);
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "ctx->cur = p;\n");
-        if (gen->mvars) {
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__puts(gen->stream, "pcc_marker_variable_set_record__restore(ctx->auxil, &(ctx->mvars), ctx->pos + ctx->cur);\n");
+        bytecode__place_label(bc, l);
+        generate_restoring_bytecode(gen, p, n);
+        if (i + 1 == nodes->n) generate_jumping_bytecode(gen, BYTECODE_OP_JUMP, onfail);
+    }
+    if (b) bytecode__place_label(bc, m);
+    bc->slot = s;
+    return b ? CODE_REACH_BOTH : CODE_REACH_ALWAYS_FAIL;
+}
+
+static code_reach_t generate_capturing_bytecode(generate_t *gen, const node_t *expr, size_t index, int onfail) {
+    bytecode_t *const bc = gen->bytecode;
+    const size_t s = bc->slot;
+    size_t p;
+    code_reach_t r;
+    if (gen->mode == CODE_MODE_RECOGNITION) return generate_bytecode(gen, expr, onfail);
+    p = generate_saving_bytecode(gen, BYTECODE_OP_SAVE);
+    r = generate_bytecode(gen, expr, onfail);
+    bytecode__add_op(bc, BYTECODE_OP_CAPTURE);
+    bytecode__add_operand(bc, index);
+    bytecode__add_operand(bc, p);
+    bc->slot = s;
+    return r;
+}
+
+static code_reach_t generate_matching_capt_bytecode(generate_t *gen, size_t index, int onfail) {
+    bytecode__add_op(gen->bytecode, BYTECODE_OP_MATCH_CAPT);
+    bytecode__add_operand(gen->bytecode, index);
+    bytecode__add_label_operand(gen->bytecode, onfail);
+    return CODE_REACH_BOTH;
+}
+
+static code_reach_t generate_matching_mvar_bytecode(generate_t *gen, const char *name, int onfail) {
+    size_t i;
+    for (i = 0; i < gen->bytecode->mvars->n; i++) {
+        if (strcmp(gen->bytecode->mvars->p[i], name) == 0) break;
+    }
+    assert(i < gen->bytecode->mvars->n);
+    bytecode__add_op(gen->bytecode, BYTECODE_OP_MATCH_MVAR);
+    bytecode__add_operand(gen->bytecode, i);
+    bytecode__add_label_operand(gen->bytecode, onfail);
+    return CODE_REACH_BOTH;
+}
+
+static code_reach_t generate_thunking_error_bytecode(generate_t *gen, const node_t *expr, size_t index, int onfail) {
+    const int l = ++gen->label;
+    const int m = ++gen->label;
+    const code_reach_t r = generate_bytecode(gen, expr, l);
+    if (r != CODE_REACH_ALWAYS_FAIL) generate_jumping_bytecode(gen, BYTECODE_OP_JUMP, m);
+    if (r != CODE_REACH_ALWAYS_SUCCEED) {
+        bytecode__place_label(gen->bytecode, l);
+        bytecode__add_op(gen->bytecode, BYTECODE_OP_ERROR);
+        bytecode__add_operand(gen->bytecode, gen->bytecode->actions + index);
+        generate_jumping_bytecode(gen, BYTECODE_OP_JUMP, onfail);
+    }
+    bytecode__place_label(gen->bytecode, m);
+    return r;
+}
+
+static code_reach_t generate_bytecode(generate_t *gen, const node_t *node, int onfail) {
+    /* compiles the node in the same way as generate_code() */
+    if (node == NULL) {
+        print_error("Internal error [%d]\n", __LINE__);
+        exit(-1);
+    }
+    switch (node->type) {
+    case NODE_RULE:
+        print_error("Internal error [%d]\n", __LINE__);
+        exit(-1);
+    case NODE_REFERENCE:
+        if (gen->mode != CODE_MODE_NORMAL) {
+            bytecode__add_op(gen->bytecode, BYTECODE_OP_RECOGNIZE);
+            bytecode__add_operand(gen->bytecode, node->data.reference.rule->data.rule.index);
+            bytecode__add_operand(gen->bytecode, node->data.reference.rule->data.rule.cycle);
         }
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "pcc_thunk_array__revert(ctx, &(chunk->thunks), n);\n");
-        if (!c) {
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__printf(gen->stream, "goto L%04d;\n", onfail);
+        else {
+            bytecode__add_op(gen->bytecode, BYTECODE_OP_APPLY);
+            bytecode__add_operand(gen->bytecode, node->data.reference.rule->data.rule.index);
+            bytecode__add_operand(gen->bytecode, (node->data.reference.index != VOID_VALUE) ? node->data.reference.index + 1 : 0);
         }
+        bytecode__add_label_operand(gen->bytecode, onfail);
+        return CODE_REACH_BOTH;
+    case NODE_STRING:
+        return generate_matching_string_bytecode(gen, &(node->data.string.value), onfail);
+    case NODE_CHARCLASS:
+        return gen->ascii ?
+               generate_matching_charclass_bytecode(gen, &(node->data.charclass.value), onfail) :
+               generate_matching_utf8_charclass_bytecode(gen, &(node->data.charclass.value), onfail);
+    case NODE_POSITION:
+        return generate_position_bytecode(gen, node->data.position.value, onfail);
+    case NODE_QUANTITY:
+        return generate_quantifying_bytecode(gen, node->data.quantity.expr, node->data.quantity.min, node->data.quantity.max, onfail);
+    case NODE_PREDICATE:
+        return generate_predicating_bytecode(gen, node->data.predicate.expr, node->data.predicate.neg, node->data.predicate.recog, onfail);
+    case NODE_PROGPRED:
+        return generate_progpred_bytecode(gen, node->data.progpred.index, node->data.progpred.neg, onfail);
+    case NODE_SEQUENCE:
+        return generate_sequential_bytecode(gen, &(node->data.sequence.nodes), onfail);
+    case NODE_ALTERNATE:
+        return generate_alternative_bytecode(gen, &(node->data.alternate.nodes), onfail);
+    case NODE_CAPTURE:
+        return generate_capturing_bytecode(gen, node->data.capture.expr, node->data.capture.index, onfail);
+    case NODE_MATCH_CAPT:
+        return generate_matching_capt_bytecode(gen, node->data.match_capt.index, onfail);
+    case NODE_MATCH_MVAR:
+        return generate_matching_mvar_bytecode(gen, node->data.match_mvar.name, onfail);
+    case NODE_ACTION:
+        if (gen->mode == CODE_MODE_NORMAL) {
+            bytecode__add_op(gen->bytecode, BYTECODE_OP_ACTION);
+            bytecode__add_operand(gen->bytecode, gen->bytecode->actions + node->data.action.index);
+        }
+        return CODE_REACH_ALWAYS_SUCCEED;
+    case NODE_ERROR:
+        if (gen->mode != CODE_MODE_NORMAL) {
+            /* the error action is not executed in recognition */
+            return generate_bytecode(gen, node->data.error.expr, onfail);
+        }
+        return generate_thunking_error_bytecode(gen, node->data.error.expr, node->data.error.index, onfail);
+    default:
+        print_error("Internal error [%d]\n", __LINE__);
+        exit(-1);
     }
-    if (b) {
-        if (indent > INDENT_UNIT) stream__write_characters(gen->stream, ' ', indent - INDENT_UNIT);
-        stream__printf(gen->stream, "L%04d:;\n", m);
-    }
-    if (!bare) {
-        indent -= INDENT_UNIT;
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "}\n");
+}
+
+static size_t generate_rule_bytecode(generate_t *gen) {
+    /* compiles the rule, and returns its code address */
+    bytecode_t *const bc = gen->bytecode;
+    const size_t k = bc->code.n;
+    if (generate_bytecode(gen, gen->rule->data.rule.expr, 0) != CODE_REACH_ALWAYS_FAIL) bytecode__add_op(bc, BYTECODE_OP_SUCCEED);
+    bytecode__place_label(bc, 0);
+    bytecode__add_op(bc, BYTECODE_OP_FAIL);
+    bytecode__resolve_labels(bc);
+    return k;
+}
+
+static void generate_bytecode_strings(stream_t *stream, const char_array_t *strings) {
+    char s[5];
+    size_t i;
+    for (i = 0; i < strings->n; i++) {
+        stream__printf(stream, "%s'%s',", (i % 16 == 0) ? "    " : " ", escape_character(strings->p[i], &s));
+        if (i % 16 == 15 || i + 1 == strings->n) stream__puts(stream, "\n");
     }
-    return b ? CODE_REACH_BOTH : CODE_REACH_ALWAYS_FAIL;
 }
 
-static code_reach_t generate_capturing_code(generate_t *gen, const node_t *expr, size_t index, int onfail, size_t indent, bool_t bare) {
-    code_reach_t r;
-    if (!bare) {
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "{\n");
-        indent += INDENT_UNIT;
+static void generate_bytecode_rules(context_t *ctx, stream_t *stream, const char *vt, const char *ax) {
+    /* compiles the rules into bytecode, and generates the interpreter and the rule functions calling it */
+    const bool_t vp = is_pointer_type(vt);
+    const char *const vs = vp ? "" : " ";
+    bytecode_t bc;
+    size_array_t entries; /* the code addresses of the evaluation and the recognition of the respective rules */
+    bool_t eval = FALSE, recog = FALSE, rvars = FALSE, capts = FALSE;
+    size_t i, j, k, m = 0;
+    if (ctx->rules.n == 0) return; /* no interpreter is needed */
+    bytecode__initialize(&bc, &(ctx->mvars));
+    size_array__initialize(&entries);
+    for (i = 0; i < ctx->rules.n; i++) {
+        const node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
+        generate_t g;
+        g.stream = stream;
+        g.rule = ctx->rules.p[i];
+        g.ascii = ctx->opts.ascii;
+        g.whole = ctx->opts.whole;
+        g.profile = ctx->opts.profile;
+        g.trace = ctx->opts.trace;
+        g.dfa = FALSE;
+        g.vtype = ctx->opts.runtime ? vt : NULL;
+        g.bytecode = &bc;
+        if (rule->eval) {
+            g.label = 0;
+            g.mvars = (ctx->mvars.n > 0) ? TRUE : FALSE;
+            g.mode = CODE_MODE_NORMAL;
+            size_array__add(&entries, generate_rule_bytecode(&g));
+            eval = TRUE;
+            if (rule->rvars.n > 0) rvars = TRUE;
+            if (rule->capts.n > 0) capts = TRUE;
+        }
+        else {
+            size_array__add(&entries, VOID_VALUE);
+        }
+        if (rule->recog) {
+            g.label = 0;
+            g.mvars = FALSE; /* no marker variables are updated in recognition */
+            g.mode = CODE_MODE_RECOGNITION;
+            size_array__add(&entries, generate_rule_bytecode(&g));
+            recog = TRUE;
+        }
+        else {
+            size_array__add(&entries, VOID_VALUE);
+        }
+        if (rule->eval) {
+            bc.actions += rule->codes.n;
+            bc.preds += rule->preds.n;
+        }
     }
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__puts(gen->stream, "const size_t p = ctx->cur;\n");
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__puts(gen->stream, "size_t q;\n");
-    r = generate_code(gen, expr, onfail, indent, FALSE);
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__puts(gen->stream, "q = ctx->cur;\n");
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__printf(gen->stream, "chunk->capts.p[" FMT_LU "].range.start = p;\n", (ulong_t)index);
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__printf(gen->stream, "chunk->capts.p[" FMT_LU "].range.end = q;\n", (ulong_t)index);
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__printf(gen->stream, "pcc_char_array__resize(ctx->auxil, &(chunk->capts.p[" FMT_LU "].string), 0);\n", (ulong_t)index);
-    if (!bare) {
-        indent -= INDENT_UNIT;
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "}\n");
+    for (i = 0; i < bc.code.n; i++) {
+        if (m < bc.code.p[i]) m = bc.code.p[i];
+    }
+    stream__printf(
+        stream,
+        "typedef unsigned %s pcc_code_t;\n"
+        "\n"
+        "typedef enum pcc_opcode_tag {\n",
+        (m <= 0xff) ? "char" : (m <= 0xffff) ? "short" : "long"
+    );
+    for (i = 0; i < BYTECODE_OP_COUNT; i++) {
+        stream__printf(stream, "    %s%s%s\n", g_bytecode_ops[i].name, (i == 0) ? " = 0" : "", (i + 1 < BYTECODE_OP_COUNT) ? "," : "");
+    }
+    stream__puts(
+        stream,
+        "} pcc_opcode_t;\n"
+        "\n"
+        "typedef struct pcc_code_rule_tag {\n"
+        "    const char *name;\n"
+        "    size_t evaluation;  /* the code address of the evaluation */\n"
+        "    size_t recognition; /* the code address of the recognition */\n"
+        "    size_t values;      /* the number of the rule variables */\n"
+        "    size_t capts;       /* the number of the captures */\n"
+        "} pcc_code_rule_t;\n"
+        "\n"
+    );
+    if (ctx->rules.n > 0) {
+        stream__printf(
+            stream,
+            "static const pcc_code_rule_t pcc_code_rules[" FMT_LU "] = {\n",
+            (ulong_t)ctx->rules.n
+        );
+        for (i = 0; i < ctx->rules.n; i++) {
+            const node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
+            stream__printf(
+                stream,
+                "    { \"%s\", " FMT_LU ", " FMT_LU ", " FMT_LU ", " FMT_LU " }%s\n",
+                rule->name,
+                (ulong_t)((entries.p[i * 2] != VOID_VALUE) ? entries.p[i * 2] : 0),
+                (ulong_t)((entries.p[i * 2 + 1] != VOID_VALUE) ? entries.p[i * 2 + 1] : 0),
+                (ulong_t)rule->rvars.n, (ulong_t)rule->capts.n,
+                (i + 1 < ctx->rules.n) ? "," : ""
+            );
+        }
+        stream__puts(
+            stream,
+            "};\n"
+            "\n"
+        );
+        stream__printf(
+            stream,
+            "static const pcc_code_t pcc_code[" FMT_LU "] = {\n",
+            (ulong_t)bc.code.n
+        );
+        i = 0;
+        k = 0; /* the entries are in ascending order of the code addresses */
+        while (i < bc.code.n) {
+            const bytecode_op_info_t *const o = &(g_bytecode_ops[bc.code.p[i]]);
+            while (k < entries.n && (entries.p[k] == VOID_VALUE || entries.p[k] < i)) k++;
+            if (k < entries.n && entries.p[k] == i) {
+                stream__printf(
+                    stream, "    /* the %s of the rule '%s' */\n",
+                    (k % 2 == 0) ? "evaluation" : "recognition", ctx->rules.p[k / 2]->data.rule.name
+                );
+            }
+            stream__printf(stream, "    /* " FMT_LU " */ %s,", (ulong_t)i, o->name);
+            for (j = 1; j <= o->operands; j++) {
+                stream__printf(stream, " " FMT_LU ",", (ulong_t)bc.code.p[i + j]);
+            }
+            stream__puts(stream, "\n");
+            i += o->operands + 1;
+        }
+        stream__puts(
+            stream,
+            "};\n"
+            "\n"
+        );
+    }
+    if (bc.strings.n > 0) {
+        if (bc.signedness) {
+            stream__puts(
+                stream,
+                "#include <limits.h>\n"
+                "\n"
+                "#if CHAR_MIN < 0 /* the character sets depend on the signedness of 'char' */\n"
+            );
+        }
+        stream__printf(
+            stream,
+            "static const char pcc_code_strings[" FMT_LU "] = {\n",
+            (ulong_t)bc.strings.n
+        );
+        generate_bytecode_strings(stream, &(bc.strings));
+        stream__puts(
+            stream,
+            "};\n"
+        );
+        if (bc.signedness) {
+            stream__printf(
+                stream,
+                "#else\n"
+                "static const char pcc_code_strings[" FMT_LU "] = {\n",
+                (ulong_t)bc.ustrings.n
+            );
+            generate_bytecode_strings(stream, &(bc.ustrings));
+            stream__puts(
+                stream,
+                "};\n"
+                "#endif\n"
+            );
+        }
+        stream__puts(
+            stream,
+            "\n"
+        );
+    }
+    if (bc.ranges.n > 0) {
+        stream__printf(
+            stream,
+            "static const int pcc_code_ranges[" FMT_LU "] = {\n",
+            (ulong_t)bc.ranges.n
+        );
+        for (i = 0; i < bc.ranges.n; i += 2) {
+            stream__printf(stream, "    0x%06x, 0x%06x,\n", (int)bc.ranges.p[i], (int)bc.ranges.p[i + 1]);
+        }
+        stream__puts(
+            stream,
+            "};\n"
+            "\n"
+        );
+    }
+    if (bc.used[BYTECODE_OP_APPLY]) {
+        stream__printf(
+            stream,
+            "static const pcc_rule_t pcc_code_evaluators[" FMT_LU "] = {\n",
+            (ulong_t)ctx->rules.n
+        );
+        for (i = 0; i < ctx->rules.n; i++) {
+            const node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
+            if (rule->eval)
+                stream__printf(stream, "    pcc_evaluate_rule_%s%s\n", rule->name, (i + 1 < ctx->rules.n) ? "," : "");
+            else
+                stream__printf(stream, "    NULL%s\n", (i + 1 < ctx->rules.n) ? "," : "");
+        }
+        stream__puts(
+            stream,
+            "};\n"
+            "\n"
+        );
+    }
+    if (bc.used[BYTECODE_OP_RECOGNIZE]) {
+        stream__printf(
+            stream,
+            "static const pcc_recognizer_t pcc_code_recognizers[" FMT_LU "] = {\n",
+            (ulong_t)ctx->rules.n
+        );
+        for (i = 0; i < ctx->rules.n; i++) {
+            const node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
+            if (rule->recog)
+                stream__printf(stream, "    pcc_recognize_rule_%s%s\n", rule->name, (i + 1 < ctx->rules.n) ? "," : "");
+            else
+                stream__printf(stream, "    NULL%s\n", (i + 1 < ctx->rules.n) ? "," : "");
+        }
+        stream__puts(
+            stream,
+            "};\n"
+            "\n"
+        );
+    }
+    if (bc.used[BYTECODE_OP_ACTION] || bc.used[BYTECODE_OP_ERROR]) {
+        stream__printf(
+            stream,
+            "static const pcc_action_t pcc_code_actions[" FMT_LU "] = {\n",
+            (ulong_t)bc.actions
+        );
+        for (i = 0, m = 0; i < ctx->rules.n; i++) {
+            const node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
+            if (!rule->eval) continue;
+            for (j = 0; j < rule->codes.n; j++) {
+                const node_t *const c = rule->codes.p[j];
+                if ((c->type == NODE_ACTION) ? c->data.action.eval : c->data.error.eval)
+                    stream__printf(stream, "    pcc_action_%s_" FMT_LU "%s\n", rule->name, (ulong_t)j, (++m < bc.actions) ? "," : "");
+                else /* not called by any code */
+                    stream__printf(stream, "    NULL%s\n", (++m < bc.actions) ? "," : "");
+            }
+        }
+        stream__puts(
+            stream,
+            "};\n"
+            "\n"
+        );
     }
-    return r;
-}
-
-static code_reach_t generate_matching_capt_code(generate_t *gen, size_t index, int onfail, size_t indent, bool_t bare) {
-    if (!bare) {
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "{\n");
-        indent += INDENT_UNIT;
+    if (bc.used[BYTECODE_OP_PREDICATE]) {
+        stream__printf(
+            stream,
+            "static void (*const pcc_code_predicates[" FMT_LU "])(pcc_context_t *, pcc_thunk_chunk_t *, int *) = {\n",
+            (ulong_t)bc.preds
+        );
+        for (i = 0, m = 0; i < ctx->rules.n; i++) {
+            const node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
+            if (!rule->eval) continue;
+            for (j = 0; j < rule->preds.n; j++) {
+                stream__printf(stream, "    pcc_predicate_%s_" FMT_LU "%s\n", rule->name, (ulong_t)j, (++m < bc.preds) ? "," : "");
+            }
+        }
+        stream__puts(
+            stream,
+            "};\n"
+            "\n"
+        );
     }
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__printf(
-        gen->stream, "const size_t n = chunk->capts.p[" FMT_LU "].range.end - chunk->capts.p[" FMT_LU "].range.start;\n",
-        (ulong_t)index, (ulong_t)index
-    );
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__puts(gen->stream, "if (n > 0) {\n");
-    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-    stream__printf(gen->stream, "const size_t k = chunk->capts.p[" FMT_LU "].range.start;\n", (ulong_t)index);
-    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-    stream__puts(gen->stream, "size_t i;\n");
-    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-    stream__puts(gen->stream, "for (i = 0; i < n; i++) {\n");
-    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT * 2);
-    stream__printf(
-        gen->stream,
-        "if (pcc_refill_buffer(ctx, i + 1) < i + 1 || (ctx->buffer.p + ctx->cur)[i] != (ctx->buffer.p + k)[i]) goto L%04d;\n",
-        onfail
-    );
-    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-    stream__puts(gen->stream, "}\n");
-    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-    stream__puts(gen->stream, "ctx->cur += n;\n");
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__puts(gen->stream, "}\n");
-    if (!bare) {
-        indent -= INDENT_UNIT;
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "}\n");
+    if (bc.used[BYTECODE_OP_MATCH_MVAR]) {
+        stream__puts(
+            stream,
+            "static const pcc_char_array_t *pcc_code_marker(pcc_context_t *ctx, size_t index) {\n"
+            "    switch (index) {\n"
+        );
+        for (i = 0; i < ctx->mvars.n; i++) {
+            stream__printf(
+                stream,
+                "    case " FMT_LU ": return &(ctx->mvars.curr.set.%s.curr.string);\n",
+                (ulong_t)i, ctx->mvars.p[i]
+            );
+        }
+        stream__puts(
+            stream,
+            "    default: return NULL;\n"
+            "    }\n"
+            "}\n"
+            "\n"
+        );
     }
-    return CODE_REACH_BOTH;
-}
-
-static code_reach_t generate_matching_mvar_code(generate_t *gen, const char *name, int onfail, size_t indent, bool_t bare) {
-    if (!bare) {
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "{\n");
-        indent += INDENT_UNIT;
+    if (bc.used[BYTECODE_OP_ACTION] || bc.used[BYTECODE_OP_ERROR]) {
+        stream__puts(
+            stream,
+            "static pcc_thunk_t *pcc_code_create_thunk(pcc_context_t *ctx, pcc_thunk_chunk_t *chunk, size_t rule, size_t action) {\n"
+            "    const pcc_code_rule_t *const r = &(pcc_code_rules[rule]);\n"
+            "    pcc_thunk_t *const thunk = pcc_thunk__create_leaf(ctx, pcc_code_actions[action], r->values, r->capts);\n"
+        );
+        if (rvars || capts) {
+            stream__puts(
+                stream,
+                "    size_t i;\n"
+            );
+        }
+        if (ctx->opts.profile) {
+            stream__puts(
+                stream,
+                "    ctx->profile[rule].thunks++;\n"
+            );
+        }
+        if (rvars) {
+            if (ctx->opts.runtime) {
+                stream__printf(
+                    stream,
+                    "    for (i = 0; i < r->values; i++) thunk->data.leaf.values.p[i] = &(((%s%s*)chunk->values.p)[i]);\n",
+                    vt, vs
+                );
+            }
+            else {
+                stream__puts(
+                    stream,
+                    "    for (i = 0; i < r->values; i++) thunk->data.leaf.values.p[i] = &(chunk->values.p[i]);\n"
+                );
+            }
+        }
+        if (capts) {
+            stream__puts(
+                stream,
+                "    for (i = 0; i < r->capts; i++) thunk->data.leaf.capts.p[i] = &(chunk->capts.p[i]);\n"
+            );
+        }
+        stream__puts(
+            stream,
+            "    thunk->data.leaf.capt0.range.start = chunk->pos;\n"
+            "    thunk->data.leaf.capt0.range.end = ctx->cur;\n"
+            "    pcc_char_array__resize(ctx->auxil, &(thunk->data.leaf.capt0.string), 0);\n"
+        );
+        if (ctx->mvars.n > 0) {
+            stream__puts(
+                stream,
+                "    pcc_marker_value_set__copy_from(ctx->auxil, &(thunk->data.leaf.mvars), &(ctx->mvars.curr.set));\n"
+            );
+        }
+        stream__puts(
+            stream,
+            "    return thunk;\n"
+            "}\n"
+            "\n"
+        );
     }
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__printf(gen->stream, "const size_t n0 = ctx->mvars.curr.set.%s.curr.string.n;\n", name);
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__puts(gen->stream, "if (n0 > 1) {\n");
-    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-    stream__puts(gen->stream, "const size_t n = n0 - 1;\n");
-    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-    stream__printf(gen->stream, "const char *const q = ctx->mvars.curr.set.%s.curr.string.p;\n", name);
-    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-    stream__puts(gen->stream, "size_t i;\n");
-    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-    stream__puts(gen->stream, "for (i = 0; i < n; i++) {\n");
-    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT * 2);
-    stream__printf(
-        gen->stream,
-        "if (pcc_refill_buffer(ctx, i + 1) < i + 1 || (ctx->buffer.p + ctx->cur)[i] != q[i]) goto L%04d;\n",
-        onfail
+    stream__puts(
+        stream,
+        "#if defined(__GNUC__) && !defined(PCC_NO_THREADED_DISPATCH)\n"
+        "#define PCC_THREADED_DISPATCH /* dispatches with the addresses of the labels, a GCC extension */\n"
+        "#endif\n"
+        "\n"
+        "#ifdef PCC_THREADED_DISPATCH\n"
+        "#define PCC_CASE(op) L_##op:\n"
+        "#define PCC_NEXT __extension__ ({ goto *labels[pcc_code[pc++]]; })\n"
+        "#else\n"
+        "#define PCC_CASE(op) case op:\n"
+        "#define PCC_NEXT continue\n"
+        "#endif\n"
+        "\n"
+        "static pcc_bool_t pcc_execute_code(pcc_context_t *ctx, pcc_thunk_chunk_t *chunk, size_t rule, size_t pc) {\n"
+        "#ifdef PCC_THREADED_DISPATCH\n"
+        "    static void *const labels[] = {\n"
     );
-    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-    stream__puts(gen->stream, "}\n");
-    stream__write_characters(gen->stream, ' ', indent + INDENT_UNIT);
-    stream__puts(gen->stream, "ctx->cur += n;\n");
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__puts(gen->stream, "}\n");
-    if (!bare) {
-        indent -= INDENT_UNIT;
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "}\n");
-    }
-    return CODE_REACH_BOTH;
-}
-
-static code_reach_t generate_thunking_action_code(
-    generate_t *gen, size_t index, const node_const_array_t *rvars, const node_const_array_t *capts, bool_t error, int onfail, size_t indent, bool_t bare
-) {
-    assert(gen->rule->type == NODE_RULE);
-    if (!bare) {
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "{\n");
-        indent += INDENT_UNIT;
+    for (i = 0; i < BYTECODE_OP_COUNT; i++) {
+        stream__printf(
+            stream, "        __extension__ &&L_%s%s\n",
+            g_bytecode_ops[bc.used[i] ? i : BYTECODE_OP_FAIL].name, (i + 1 < BYTECODE_OP_COUNT) ? "," : ""
+        );
     }
-    if (error) {
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "pcc_value_t null;\n");
+    stream__puts(
+        stream,
+        "    };\n"
+        "#endif\n"
+    );
+    if (bc.slotm > 0) {
+        stream__printf(
+            stream,
+            "    size_t s[" FMT_LU "]; /* the slots to save the positions, the numbers of the thunks, and the counters */\n",
+            (ulong_t)bc.slotm
+        );
     }
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__printf(
-        gen->stream, "pcc_thunk_t *const thunk = pcc_thunk__create_leaf(ctx, pcc_action_%s_" FMT_LU ", " FMT_LU ", " FMT_LU ");\n",
-        gen->rule->data.rule.name, (ulong_t)index, (ulong_t)gen->rule->data.rule.rvars.n, (ulong_t)gen->rule->data.rule.capts.n
+    stream__puts(
+        stream,
+        "#ifdef PCC_THREADED_DISPATCH\n"
+        "    PCC_NEXT;\n"
+        "#else\n"
+        "    for (;;) switch (pcc_code[pc++]) {\n"
+        "#endif\n"
+    );
+    for (i = 0; i < BYTECODE_OP_COUNT; i++) {
+        if (!bc.used[i]) continue;
+        stream__printf(stream, "    PCC_CASE(%s) {\n", g_bytecode_ops[i].name);
+        switch ((bytecode_op_t)i) {
+        case BYTECODE_OP_SUCCEED:
+            stream__puts(
+                stream,
+                "        return PCC_TRUE;\n"
+            );
+            break;
+        case BYTECODE_OP_FAIL:
+            stream__puts(
+                stream,
+                "        return PCC_FALSE;\n"
+            );
+            break;
+        case BYTECODE_OP_JUMP:
+            stream__puts(
+                stream,
+                "        pc = pcc_code[pc];\n"
+                "        PCC_NEXT;\n"
+            );
+            break;
+        case BYTECODE_OP_STRING:
+            stream__puts(
+                stream,
+                "        const char *const q = pcc_code_strings + pcc_code[pc];\n"
+                "        const size_t n = pcc_code[pc + 1];\n"
+                "        size_t i;\n"
+                "        for (i = 0; i < n; i++) {\n"
+                "            if (pcc_refill_buffer(ctx, i + 1) < i + 1 || (ctx->buffer.p + ctx->cur)[i] != q[i]) break;\n"
+                "        }\n"
+                "        if (i < n) {\n"
+                "            pc = pcc_code[pc + 2];\n"
+                "            PCC_NEXT;\n"
+                "        }\n"
+                "        ctx->cur += n;\n"
+                "        pc += 3;\n"
+                "        PCC_NEXT;\n"
+            );
+            break;
+        case BYTECODE_OP_SET:
+            stream__puts(
+                stream,
+                "        const char *const q = pcc_code_strings + pcc_code[pc];\n"
+                "        unsigned int c;\n"
+                "        if (pcc_refill_buffer(ctx, 1) < 1) {\n"
+                "            pc = pcc_code[pc + 1];\n"
+                "            PCC_NEXT;\n"
+                "        }\n"
+                "        c = (unsigned int)(unsigned char)ctx->buffer.p[ctx->cur];\n"
+                "        if (!((unsigned int)(unsigned char)q[c >> 3] & (1U << (c & 7)))) {\n"
+                "            pc = pcc_code[pc + 1];\n"
+                "            PCC_NEXT;\n"
+                "        }\n"
+                "        ctx->cur++;\n"
+                "        pc += 2;\n"
+                "        PCC_NEXT;\n"
+            );
+            break;
+        case BYTECODE_OP_ANY:
+            stream__puts(
+                stream,
+                "        if (pcc_refill_buffer(ctx, 1) < 1) {\n"
+                "            pc = pcc_code[pc];\n"
+                "            PCC_NEXT;\n"
+                "        }\n"
+                "        ctx->cur++;\n"
+                "        pc += 1;\n"
+                "        PCC_NEXT;\n"
+            );
+            break;
+        case BYTECODE_OP_UTF8:
+        case BYTECODE_OP_UTF8_NOT:
+            stream__printf(
+                stream,
+                "        const int *const q = %s;\n"
+                "        const size_t m = pcc_code[pc + 1];\n"
+                "        int u;\n"
+                "        const size_t n = (ctx->cur < ctx->buffer.n && (u = (int)(unsigned char)ctx->buffer.p[ctx->cur]) < 0x80) ? 1 : /* ASCII */\n"
+                "            pcc_get_char_as_utf32(ctx, &u);\n"
+                "        size_t i;\n"
+                "        if (n == 0) {\n"
+                "            pc = pcc_code[pc + 2];\n"
+                "            PCC_NEXT;\n"
+                "        }\n"
+                "        for (i = 0; i < m; i++) {\n"
+                "            if (u >= q[i * 2] && u <= q[i * 2 + 1]) break;\n"
+                "        }\n"
+                "        if (%s) {\n"
+                "            pc = pcc_code[pc + 2];\n"
+                "            PCC_NEXT;\n"
+                "        }\n"
+                "        ctx->cur += n;\n"
+                "        pc += 3;\n"
+                "        PCC_NEXT;\n",
+                (bc.ranges.n > 0) ? "pcc_code_ranges + pcc_code[pc]" : "NULL", /* only any characters are matched if no ranges */
+                (i == BYTECODE_OP_UTF8) ? "i == m && m > 0" : "i < m"
+            );
+            break;
+        case BYTECODE_OP_POSITION:
+            stream__puts(
+                stream,
+                "        if (ctx->pos + ctx->cur != pcc_code[pc]) {\n"
+                "            pc = pcc_code[pc + 1];\n"
+                "            PCC_NEXT;\n"
+                "        }\n"
+                "        pc += 2;\n"
+                "        PCC_NEXT;\n"
+            );
+            break;
+        case BYTECODE_OP_APPLY:
+            stream__puts(
+                stream,
+                "        const size_t v = pcc_code[pc + 1];\n"
+            );
+            if (ctx->opts.runtime) {
+                stream__printf(
+                    stream,
+                    "        if (!pcc_apply_rule(ctx, pcc_code_evaluators[pcc_code[pc]], %s&(chunk->thunks), (v > 0) ? &(((%s%s*)chunk->values.p)[v - 1]) : NULL)) {\n",
+                    ctx->opts.profile ? "pcc_code[pc], " : "", vt, vs
+                );
+            }
+            else {
+                stream__printf(
+                    stream,
+                    "        if (!pcc_apply_rule(ctx, pcc_code_evaluators[pcc_code[pc]], %s&(chunk->thunks), (v > 0) ? &(chunk->values.p[v - 1]) : NULL)) {\n",
+                    ctx->opts.profile ? "pcc_code[pc], " : ""
+                );
+            }
+            stream__puts(
+                stream,
+                "            pc = pcc_code[pc + 2];\n"
+                "            PCC_NEXT;\n"
+                "        }\n"
+                "        pc += 3;\n"
+                "        PCC_NEXT;\n"
+            );
+            break;
+        case BYTECODE_OP_RECOGNIZE:
+            stream__printf(
+                stream,
+                "        if (!pcc_recognize_rule(ctx, pcc_code_recognizers[pcc_code[pc]], %spcc_code[pc + 1])) {\n"
+                "            pc = pcc_code[pc + 2];\n"
+                "            PCC_NEXT;\n"
+                "        }\n"
+                "        pc += 3;\n"
+                "        PCC_NEXT;\n",
+                ctx->opts.profile ? "pcc_code[pc], " : ""
+            );
+            break;
+        case BYTECODE_OP_SAVE:
+            stream__puts(
+                stream,
+                "        s[pcc_code[pc++]] = ctx->cur;\n"
+                "        PCC_NEXT;\n"
+            );
+            break;
+        case BYTECODE_OP_SAVE_THUNKS:
+            stream__puts(
+                stream,
+                "        s[pcc_code[pc++]] = chunk->thunks.n;\n"
+                "        PCC_NEXT;\n"
+            );
+            break;
+        case BYTECODE_OP_SAVE_MARKERS:
+            stream__puts(
+                stream,
+                "        pcc_marker_variable_set_record__save(ctx->auxil, &(ctx->mvars), ctx->pos + ctx->cur);\n"
+                "        PCC_NEXT;\n"
+            );
+            break;
+        case BYTECODE_OP_RESTORE:
+            stream__puts(
+                stream,
+                "        ctx->cur = s[pcc_code[pc++]];\n"
+                "        PCC_NEXT;\n"
+            );
+            break;
+        case BYTECODE_OP_RESTORE_THUNKS:
+            stream__puts(
+                stream,
+                "        pcc_thunk_array__revert(ctx, &(chunk->thunks), s[pcc_code[pc++]]);\n"
+                "        PCC_NEXT;\n"
+            );
+            break;
+        case BYTECODE_OP_RESTORE_MARKERS:
+            stream__puts(
+                stream,
+                "        pcc_marker_variable_set_record__restore(ctx->auxil, &(ctx->mvars), ctx->pos + ctx->cur);\n"
+                "        PCC_NEXT;\n"
+            );
+            break;
+        case BYTECODE_OP_ZERO:
+            stream__puts(
+                stream,
+                "        s[pcc_code[pc++]] = 0;\n"
+                "        PCC_NEXT;\n"
+            );
+            break;
+        case BYTECODE_OP_INCREMENT:
+            stream__puts(
+                stream,
+                "        s[pcc_code[pc++]]++;\n"
+                "        PCC_NEXT;\n"
+            );
+            break;
+        case BYTECODE_OP_AT_LEAST:
+            stream__puts(
+                stream,
+                "        pc = (s[pcc_code[pc]] >= pcc_code[pc + 1]) ? pcc_code[pc + 2] : pc + 3;\n"
+                "        PCC_NEXT;\n"
+            );
+            break;
+        case BYTECODE_OP_UNMOVED:
+            stream__puts(
+                stream,
+                "        pc = (ctx->cur == s[pcc_code[pc]]) ? pcc_code[pc + 1] : pc + 2;\n"
+                "        PCC_NEXT;\n"
+            );
+            break;
+        case BYTECODE_OP_CAPTURE:
+            stream__puts(
+                stream,
+                "        pcc_capture_t *const c = &(chunk->capts.p[pcc_code[pc]]);\n"
+                "        c->range.start = s[pcc_code[pc + 1]];\n"
+                "        c->range.end = ctx->cur;\n"
+                "        pcc_char_array__resize(ctx->auxil, &(c->string), 0);\n"
+                "        pc += 2;\n"
+                "        PCC_NEXT;\n"
+            );
+            break;
+        case BYTECODE_OP_MATCH_CAPT:
+            stream__puts(
+                stream,
+                "        const pcc_capture_t *const c = &(chunk->capts.p[pcc_code[pc]]);\n"
+                "        const size_t n = c->range.end - c->range.start;\n"
+                "        size_t i;\n"
+                "        for (i = 0; i < n; i++) {\n"
+                "            if (pcc_refill_buffer(ctx, i + 1) < i + 1 || (ctx->buffer.p + ctx->cur)[i] != (ctx->buffer.p + c->range.start)[i]) break;\n"
+                "        }\n"
+                "        if (i < n) {\n"
+                "            pc = pcc_code[pc + 1];\n"
+                "            PCC_NEXT;\n"
+                "        }\n"
+                "        ctx->cur += n;\n"
+                "        pc += 2;\n"
+                "        PCC_NEXT;\n"
+            );
+            break;
+        case BYTECODE_OP_MATCH_MVAR:
+            stream__puts(
+                stream,
+                "        const pcc_char_array_t *const q = pcc_code_marker(ctx, pcc_code[pc]);\n"
+                "        const size_t n = (q->n > 1) ? q->n - 1 : 0;\n"
+                "        size_t i;\n"
+                "        for (i = 0; i < n; i++) {\n"
+                "            if (pcc_refill_buffer(ctx, i + 1) < i + 1 || (ctx->buffer.p + ctx->cur)[i] != q->p[i]) break;\n"
+                "        }\n"
+                "        if (i < n) {\n"
+                "            pc = pcc_code[pc + 1];\n"
+                "            PCC_NEXT;\n"
+                "        }\n"
+                "        ctx->cur += n;\n"
+                "        pc += 2;\n"
+                "        PCC_NEXT;\n"
+            );
+            break;
+        case BYTECODE_OP_ACTION:
+            stream__puts(
+                stream,
+                "        pcc_thunk_array__add(ctx, &(chunk->thunks), pcc_code_create_thunk(ctx, chunk, rule, pcc_code[pc++]));\n"
+                "        PCC_NEXT;\n"
+            );
+            break;
+        case BYTECODE_OP_ERROR:
+            if (ctx->opts.runtime)
+                stream__printf(stream, "        %s%snull;\n", vt, vs);
+            else
+                stream__puts(stream, "        pcc_value_t null;\n");
+            stream__puts(
+                stream,
+                "        pcc_thunk_t *const thunk = pcc_code_create_thunk(ctx, chunk, rule, pcc_code[pc++]);\n"
+                "        memset(&null, 0, sizeof(null)); /* in case */\n"
+                "        thunk->data.leaf.action(ctx, thunk, &null);\n"
+                "        pcc_thunk__destroy(ctx, thunk);\n"
+                "        PCC_NEXT;\n"
+            );
+            break;
+        case BYTECODE_OP_PREDICATE:
+            stream__puts(
+                stream,
+                "        int r = pcc_code[pc + 1] ? 0 : 1;\n"
+                "        ctx->capt0.range.start = chunk->pos;\n"
+                "        ctx->capt0.range.end = ctx->cur;\n"
+                "        pcc_char_array__resize(ctx->auxil, &(ctx->capt0.string), 0);\n"
+                "        pcc_code_predicates[pcc_code[pc]](ctx, chunk, &r);\n"
+                "        if ((r != 0) == (pcc_code[pc + 1] != 0)) {\n"
+                "            pc = pcc_code[pc + 2];\n"
+                "            PCC_NEXT;\n"
+                "        }\n"
+                "        pc += 3;\n"
+                "        PCC_NEXT;\n"
+            );
+            break;
+        default:
+            print_error("Internal error [%d]\n", __LINE__);
+            exit(-1);
+        }
+        stream__puts(
+            stream,
+            "    }\n"
+        );
+    }
+    stream__puts(
+        stream,
+        "#ifndef PCC_THREADED_DISPATCH\n"
+        "    default:\n"
+        "        return PCC_FALSE;\n"
+        "    }\n"
+        "#endif\n"
+        "}\n"
+        "\n"
+        "#undef PCC_NEXT\n"
+        "#undef PCC_CASE\n"
+        "\n"
     );
-    {
-        size_t i;
-        for (i = 0; i < rvars->n; i++) {
-            assert(rvars->p[i]->type == NODE_REFERENCE);
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__printf(
-                gen->stream, "thunk->data.leaf.values.p[" FMT_LU "] = &(chunk->values.p[" FMT_LU "]);\n",
-                (ulong_t)rvars->p[i]->data.reference.index, (ulong_t)rvars->p[i]->data.reference.index
+    if (eval) {
+        stream__printf(
+            stream,
+            "static pcc_thunk_chunk_t *pcc_evaluate_code(pcc_context_t *ctx, size_t rule) {\n"
+            "    pcc_thunk_chunk_t *const chunk = pcc_thunk_chunk__create(ctx);\n"
+            "    chunk->pos = ctx->cur;\n"
+            "    PCC_DEBUG(%s, PCC_DBG_EVALUATE, pcc_code_rules[rule].name, ctx->level, chunk->pos, ctx->buffer.p + chunk->pos, ctx->buffer.n - chunk->pos);\n",
+            ax
+        );
+        if (ctx->opts.trace) {
+            stream__puts(
+                stream,
+                "    pcc_trace(ctx, rule, PCC_DBG_EVALUATE, chunk->pos);\n"
             );
         }
-        for (i = 0; i < capts->n; i++) {
-            assert(capts->p[i]->type == NODE_CAPTURE);
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__printf(
-                gen->stream, "thunk->data.leaf.capts.p[" FMT_LU "] = &(chunk->capts.p[" FMT_LU "]);\n",
-                (ulong_t)capts->p[i]->data.capture.index, (ulong_t)capts->p[i]->data.capture.index
+        stream__puts(
+            stream,
+            "    ctx->level++;\n"
+        );
+        if (capts) {
+            stream__puts(
+                stream,
+                "    if (pcc_code_rules[rule].capts > 0) pcc_capture_table__resize(ctx->auxil, &(chunk->capts), pcc_code_rules[rule].capts);\n"
             );
         }
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "thunk->data.leaf.capt0.range.start = chunk->pos;\n");
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "thunk->data.leaf.capt0.range.end = ctx->cur;\n");
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "pcc_char_array__resize(ctx->auxil, &(thunk->data.leaf.capt0.string), 0);\n");
-    }
-    if (gen->mvars) {
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "pcc_marker_value_set__copy_from(ctx->auxil, &(thunk->data.leaf.mvars), &(ctx->mvars.curr.set));\n");
-    }
-    if (error) {
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "memset(&null, 0, sizeof(pcc_value_t)); /* in case */\n");
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "thunk->data.leaf.action(ctx, thunk, &null);\n");
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "pcc_thunk__destroy(ctx, thunk);\n");
-    }
-    else {
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "pcc_thunk_array__add(ctx, &(chunk->thunks), thunk);\n");
-    }
-    if (!bare) {
-        indent -= INDENT_UNIT;
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "}\n");
-    }
-    return CODE_REACH_ALWAYS_SUCCEED;
-}
-
-static code_reach_t generate_thunking_error_code(
-    generate_t *gen, const node_t *expr, size_t index, const node_const_array_t *rvars, const node_const_array_t *capts, int onfail, size_t indent, bool_t bare
-) {
-    code_reach_t r;
-    const int l = ++gen->label;
-    const int m = ++gen->label;
-    assert(gen->rule->type == NODE_RULE);
-    if (!bare) {
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "{\n");
-        indent += INDENT_UNIT;
-    }
-    r = generate_code(gen, expr, l, indent, TRUE);
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__printf(gen->stream, "goto L%04d;\n", m);
-    if (indent > INDENT_UNIT) stream__write_characters(gen->stream, ' ', indent - INDENT_UNIT);
-    stream__printf(gen->stream, "L%04d:;\n", l);
-    generate_thunking_action_code(gen, index, rvars, capts, TRUE, l, indent, FALSE);
-    stream__write_characters(gen->stream, ' ', indent);
-    stream__printf(gen->stream, "goto L%04d;\n", onfail);
-    if (indent > INDENT_UNIT) stream__write_characters(gen->stream, ' ', indent - INDENT_UNIT);
-    stream__printf(gen->stream, "L%04d:;\n", m);
-    if (!bare) {
-        indent -= INDENT_UNIT;
-        stream__write_characters(gen->stream, ' ', indent);
-        stream__puts(gen->stream, "}\n");
-    }
-    return r;
-}
-
-static code_reach_t generate_code(generate_t *gen, const node_t *node, int onfail, size_t indent, bool_t bare) {
-    if (node == NULL) {
-        print_error("Internal error [%d]\n", __LINE__);
-        exit(-1);
+        if (rvars) {
+            stream__puts(
+                stream,
+                "    if (pcc_code_rules[rule].values > 0) {\n"
+                "        pcc_value_table__resize(ctx->auxil, &(chunk->values), pcc_code_rules[rule].values);\n"
+                "        pcc_value_table__clear(ctx->auxil, &(chunk->values));\n"
+                "    }\n"
+            );
+        }
+        stream__printf(
+            stream,
+            "    if (!pcc_execute_code(ctx, chunk, rule, pcc_code_rules[rule].evaluation)) {\n"
+            "        ctx->level--;\n"
+            "        PCC_DEBUG(%s, PCC_DBG_NOMATCH, pcc_code_rules[rule].name, ctx->level, chunk->pos, ctx->buffer.p + chunk->pos, ctx->cur - chunk->pos);\n",
+            ax
+        );
+        if (ctx->opts.trace) {
+            stream__puts(
+                stream,
+                "        pcc_trace(ctx, rule, PCC_DBG_NOMATCH, chunk->pos);\n"
+            );
+        }
+        stream__printf(
+            stream,
+            "        pcc_thunk_chunk__destroy(ctx, chunk);\n"
+            "        return NULL;\n"
+            "    }\n"
+            "    ctx->level--;\n"
+            "    PCC_DEBUG(%s, PCC_DBG_MATCH, pcc_code_rules[rule].name, ctx->level, chunk->pos, ctx->buffer.p + chunk->pos, ctx->cur - chunk->pos);\n",
+            ax
+        );
+        if (ctx->opts.trace) {
+            stream__puts(
+                stream,
+                "    pcc_trace(ctx, rule, PCC_DBG_MATCH, chunk->pos);\n"
+            );
+        }
+        if (ctx->mvars.n > 0) {
+            stream__puts(
+                stream,
+                "    pcc_marker_variable_set_entry__copy(ctx->auxil, &(chunk->mvars), &(ctx->mvars.curr));\n"
+            );
+        }
+        stream__puts(
+            stream,
+            "    return chunk;\n"
+            "}\n"
+            "\n"
+        );
     }
-    switch (node->type) {
-    case NODE_RULE:
-        print_error("Internal error [%d]\n", __LINE__);
-        exit(-1);
-    case NODE_REFERENCE:
-        if (node->data.reference.index != VOID_VALUE) {
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__printf(
-                gen->stream, "if (!pcc_apply_rule(ctx, pcc_evaluate_rule_%s, &(chunk->thunks), &(chunk->values.p[" FMT_LU "]))) goto L%04d;\n",
-                node->data.reference.name, (ulong_t)node->data.reference.index, onfail
+    if (recog) {
+        stream__printf(
+            stream,
+            "static pcc_bool_t pcc_recognize_code(pcc_context_t *ctx, size_t rule) {\n"
+            "    MARK_VAR_AS_USED\n"
+            "    const size_t pos = ctx->cur;\n"
+            "    PCC_DEBUG(%s, PCC_DBG_EVALUATE, pcc_code_rules[rule].name, ctx->level, pos, ctx->buffer.p + pos, ctx->buffer.n - pos);\n",
+            ax
+        );
+        if (ctx->opts.trace) {
+            stream__puts(
+                stream,
+                "    pcc_trace(ctx, rule, PCC_DBG_EVALUATE, pos);\n"
             );
         }
-        else {
-            stream__write_characters(gen->stream, ' ', indent);
-            stream__printf(
-                gen->stream, "if (!pcc_apply_rule(ctx, pcc_evaluate_rule_%s, &(chunk->thunks), NULL)) goto L%04d;\n",
-                node->data.reference.name, onfail
+        stream__printf(
+            stream,
+            "    ctx->level++;\n"
+            "    if (!pcc_execute_code(ctx, NULL, rule, pcc_code_rules[rule].recognition)) {\n"
+            "        ctx->level--;\n"
+            "        PCC_DEBUG(%s, PCC_DBG_NOMATCH, pcc_code_rules[rule].name, ctx->level, pos, ctx->buffer.p + pos, ctx->cur - pos);\n",
+            ax
+        );
+        if (ctx->opts.trace) {
+            stream__puts(
+                stream,
+                "        pcc_trace(ctx, rule, PCC_DBG_NOMATCH, pos);\n"
             );
         }
-        return CODE_REACH_BOTH;
-    case NODE_STRING:
-        return generate_matching_string_code(gen, &(node->data.string.value), onfail, indent, bare);
-    case NODE_CHARCLASS:
-        return gen->ascii ?
-               generate_matching_charclass_code(gen, &(node->data.charclass.value), onfail, indent, bare) :
-               generate_matching_utf8_charclass_code(gen, &(node->data.charclass.value), onfail, indent, bare);
-    case NODE_POSITION:
-        return generate_position_code(gen, node->data.position.value, onfail, indent, bare);
-    case NODE_QUANTITY:
-        return generate_quantifying_code(gen, node->data.quantity.expr, node->data.quantity.min, node->data.quantity.max, onfail, indent, bare);
-    case NODE_PREDICATE:
-        return generate_predicating_code(gen, node->data.predicate.expr, node->data.predicate.neg, onfail, indent, bare);
-    case NODE_PROGPRED:
-        return generate_progpred_code(gen, node->data.progpred.index, node->data.progpred.neg, onfail, indent, bare);
-    case NODE_SEQUENCE:
-        return generate_sequential_code(gen, &(node->data.sequence.nodes), onfail, indent, bare);
-    case NODE_ALTERNATE:
-        return generate_alternative_code(gen, &(node->data.alternate.nodes), onfail, indent, bare);
-    case NODE_CAPTURE:
-        return generate_capturing_code(gen, node->data.capture.expr, node->data.capture.index, onfail, indent, bare);
-    case NODE_MATCH_CAPT:
-        return generate_matching_capt_code(gen, node->data.match_capt.index, onfail, indent, bare);
-    case NODE_MATCH_MVAR:
-        return generate_matching_mvar_code(gen, node->data.match_mvar.name, onfail, indent, bare);
-    case NODE_ACTION:
-        return generate_thunking_action_code(
-            gen, node->data.action.index, &(node->data.action.rvars), &(node->data.action.capts), FALSE, onfail, indent, bare
+        stream__printf(
+            stream,
+            "        return PCC_FALSE;\n"
+            "    }\n"
+            "    ctx->level--;\n"
+            "    PCC_DEBUG(%s, PCC_DBG_MATCH, pcc_code_rules[rule].name, ctx->level, pos, ctx->buffer.p + pos, ctx->cur - pos);\n",
+            ax
         );
-    case NODE_ERROR:
-        return generate_thunking_error_code(
-            gen, node->data.error.expr, node->data.error.index, &(node->data.error.rvars), &(node->data.error.capts), onfail, indent, bare
+        if (ctx->opts.trace) {
+            stream__puts(
+                stream,
+                "    pcc_trace(ctx, rule, PCC_DBG_MATCH, pos);\n"
+            );
+        }
+        stream__puts(
+            stream,
+            "    return PCC_TRUE;\n"
+            "}\n"
+            "\n"
+        );
+    }
+    for (i = 0; i < ctx->rules.n; i++) {
+        const node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
+        if (!rule->eval) continue;
+        stream__printf(
+            stream,
+            "static pcc_thunk_chunk_t *pcc_evaluate_rule_%s(pcc_context_t *ctx) {\n"
+            "    return pcc_evaluate_code(ctx, " FMT_LU ");\n"
+            "}\n"
+            "\n",
+            rule->name, (ulong_t)i
+        );
+    }
+    for (i = 0; i < ctx->rules.n; i++) {
+        const node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
+        if (!rule->recog) continue;
+        stream__printf(
+            stream,
+            "static pcc_bool_t pcc_recognize_rule_%s(pcc_context_t *ctx) {\n"
+            "    return pcc_recognize_code(ctx, " FMT_LU ");\n"
+            "}\n"
+            "\n",
+            rule->name, (ulong_t)i
         );
-    default:
-        print_error("Internal error [%d]\n", __LINE__);
-        exit(-1);
     }
+    size_array__finalize(&entries);
+    bytecode__finalize(&bc);
 }
 
 static bool_t generate(context_t *ctx) {
@@ -5261,8 +8583,15 @@ static bool_t generate(context_t *ctx) {
     const char *const at = get_auxil_type(ctx);
     const bool_t vp = is_pointer_type(vt);
     const bool_t ap = is_pointer_type(at);
-    stream_t sstream = stream__wrap(fopen_wt_e(ctx->spath), ctx->spath, ctx->opts.lines ? 0 : VOID_VALUE);
-    stream_t hstream = stream__wrap(fopen_wt_e(ctx->hpath), ctx->hpath, ctx->opts.lines ? 0 : VOID_VALUE);
+    const size_t nu = ctx->upaths.n + 1;
+    const code_flag_t flags = ctx->flags;
+    const char *const ax = ctx->opts.runtime ? "pcc_ref_auxil_(ctx)" : "ctx->auxil"; /* the user-defined data passed to the user-defined macros */
+    stream_t sstream, hstream, pstream;
+    stream_t gstream, rhstream, rsstream; /* the grammar-specific code set aside, and the header and source of the shared runtime */
+    stream_t istream; /* the hot paths of the shared runtime to be inlined by the parsers through its header */
+    stream_t **const ustreams = (stream_t **)malloc_e(sizeof(stream_t *) * nu); /* the C source file streams of the respective units */
+    stream__initialize(&sstream, ctx->ppath ? ctx->ppath : ctx->spath, ctx->opts.lines ? 0 : VOID_VALUE); /* the code up to the runtime goes to the private header if split */
+    stream__initialize(&hstream, ctx->hpath, ctx->opts.lines ? 0 : VOID_VALUE);
     stream__printf(&sstream, "/* A parser generated by PackCC %s */\n\n", PACKCC_VERSION);
     stream__printf(&hstream, "/* A parser generated by PackCC %s */\n\n", PACKCC_VERSION);
     {
@@ -5374,6 +8703,47 @@ static bool_t generate(context_t *ctx) {
         }
     }
     {
+        if (ctx->ppath) {
+            stream__puts(
+                &sstream,
+                "#ifdef _MSC_VER\n"
+                "#pragma warning(push)\n"
+                "#pragma warning(disable: 4505) /* the runtime functions unused in a C source file */\n"
+                "#elif defined __GNUC__\n"
+                "#pragma GCC diagnostic push\n"
+                "#pragma GCC diagnostic ignored \"-Wunused-function\" /* the runtime functions unused in a C source file */\n"
+                "#endif\n"
+                "\n"
+            );
+        }
+        if (ctx->opts.runtime) { /* the code up to the context structure goes to the runtime header */
+            const int n = (ctx->opts.recog ? 1 : 0) | (ctx->opts.whole ? 2 : 0) | (ctx->opts.feed ? 4 : 0) | (ctx->opts.memory ? 8 : 0);
+            stream__printf(
+                &sstream,
+                "#include \"%s\"\n"
+                "\n"
+                "#if PCC_RUNTIME_OPTIONS != %d\n"
+                "#error \"The shared runtime is generated with different options\"\n"
+                "#endif\n"
+                "\n",
+                extract_filename(ctx->rhpath), n
+            );
+            gstream = sstream;
+            stream__initialize(&sstream, ctx->rhpath, VOID_VALUE);
+            stream__printf(&sstream, "/* A parser runtime generated by PackCC %s */\n\n", PACKCC_VERSION);
+            stream__printf(
+                &sstream,
+                "#ifndef PCC_INCLUDED_RUNTIME\n"
+                "#define PCC_INCLUDED_RUNTIME\n"
+                "\n"
+                "#include <stddef.h>\n"
+                "\n"
+                "#define PCC_RUNTIME_OPTIONS %d /* 1: --recognize, 2: --whole-input, 4: --feed, 8: --memory */\n"
+                "\n",
+                n
+            );
+            ctx->flags = (code_flag_t)~CODE_FLAG_NONE; /* the runtime serves any grammars */
+        }
         stream__puts(
             &sstream,
             "#if !defined __has_attribute || defined _MSC_VER\n"
@@ -5412,6 +8782,18 @@ static bool_t generate(context_t *ctx) {
             "#define PCC_POOL_MIN_SIZE 65536\n"
             "#endif /* !PCC_POOL_MIN_SIZE */\n"
             "\n"
+        );
+        if (ctx->opts.trace) {
+            stream__puts(
+                &sstream,
+                "#ifndef PCC_TRACE_BUFFER_SIZE\n"
+                "#define PCC_TRACE_BUFFER_SIZE 65536\n"
+                "#endif /* !PCC_TRACE_BUFFER_SIZE */\n"
+                "\n"
+            );
+        }
+        stream__puts(
+            &sstream,
             "#define PCC_DBG_EVALUATE 0\n"
             "#define PCC_DBG_MATCH    1\n"
             "#define PCC_DBG_NOMATCH  2\n"
@@ -5419,6 +8801,14 @@ static bool_t generate(context_t *ctx) {
             "#define PCC_VOID_VALUE (~(size_t)0)\n"
             "\n"
         );
+        if (!ctx->opts.recog) {
+            stream__puts(
+                &sstream,
+                "#define PCC_PHASE_PARSE  0\n"
+                "#define PCC_PHASE_ACTION 1\n"
+                "\n"
+            );
+        }
         if (ctx->mvars.n > 0) {
             stream__puts(
                 &sstream,
@@ -5475,19 +8865,43 @@ static bool_t generate(context_t *ctx) {
             "} pcc_range_t;\n"
             "\n"
         );
-        stream__printf(
-            &sstream,
-            "typedef %s%spcc_value_t;\n"
-            "\n",
-            vt, vp ? "" : " "
-        );
-        stream__printf(
-            &sstream,
-            "typedef %s%spcc_auxil_t;\n"
-            "\n",
-            at, ap ? "" : " "
-        );
-        if (strcmp(get_prefix(ctx), "pcc") != 0) {
+        if (ctx->opts.runtime) {
+            stream__puts(
+                &sstream,
+                "typedef void pcc_value_t; /* the output values are opaque; their size is given by the grammar descriptor */\n"
+                "\n"
+                "#ifndef PCC_CONTEXT_T_DEFINED\n"
+                "#define PCC_CONTEXT_T_DEFINED\n"
+                "typedef struct pcc_context_tag pcc_context_t;\n"
+                "#endif /* !PCC_CONTEXT_T_DEFINED */\n"
+                "\n"
+                "typedef pcc_context_t *pcc_auxil_t; /* the context is passed to the grammar descriptor functions instead of the user-defined data */\n"
+                "\n"
+                "typedef struct pcc_grammar_tag { /* the grammar descriptor */\n"
+                "    size_t value_size; /* the size of the output value type */\n"
+                "    void *(*allocate)(pcc_context_t *ctx, size_t size);\n"
+                "    void *(*reallocate)(pcc_context_t *ctx, void *ptr, size_t size);\n"
+                "    void (*deallocate)(pcc_context_t *ctx, void *ptr);\n"
+                "    int (*read_char)(pcc_context_t *ctx);\n"
+                "} pcc_grammar_t;\n"
+                "\n"
+            );
+        }
+        else {
+            stream__printf(
+                &sstream,
+                "typedef %s%spcc_value_t;\n"
+                "\n",
+                vt, vp ? "" : " "
+            );
+            stream__printf(
+                &sstream,
+                "typedef %s%spcc_auxil_t;\n"
+                "\n",
+                at, ap ? "" : " "
+            );
+        }
+        if (!ctx->opts.runtime && strcmp(get_prefix(ctx), "pcc") != 0) {
             stream__printf(
                 &sstream,
                 "typedef %s_context_t pcc_context_t;\n"
@@ -5668,6 +9082,15 @@ static bool_t generate(context_t *ctx) {
             "    pcc_lr_answer_type_t type;\n"
             "    pcc_lr_answer_data_t data;\n"
             "    size_t pos; /* the absolute position in the input */\n"
+        );
+        if (ctx->opts.feed) {
+            stream__puts(
+                &sstream,
+                "    pcc_bool_t starved; /* the characters not fed yet have been requested in matching */\n"
+            );
+        }
+        stream__puts(
+            &sstream,
             "    pcc_lr_answer_t *hold;\n"
             "};\n"
             "\n"
@@ -5701,17 +9124,77 @@ static bool_t generate(context_t *ctx) {
             "    pcc_lr_memo_t a[PCC_LR_MEMO_MAP_MIN_SIZE]; /* for reducing memory allocation frequency */\n"
             "} pcc_lr_memo_map_t;\n"
             "\n"
+        );
+        if (ctx->flags & CODE_FLAG_RECOGNITION) {
+            stream__puts(
+                &sstream,
+                "typedef pcc_bool_t (*pcc_recognizer_t)(pcc_context_t *);\n"
+                "\n"
+                "typedef struct pcc_recognition_tag {\n"
+                "    pcc_recognizer_t rule;\n"
+                "    size_t pos; /* the absolute position in the input after matching; PCC_VOID_VALUE if not matched */\n"
+                "    size_t cycle; /* the index of the group of mutually left-recursive rules; 0 if not left-recursive */\n"
+                "    pcc_bool_t grow; /* true while the seed of left recursion is growing */\n"
+            );
+            if (ctx->opts.feed) {
+                stream__puts(
+                    &sstream,
+                    "    pcc_bool_t starved; /* the characters not fed yet have been requested in matching */\n"
+                );
+            }
+            stream__puts(
+                &sstream,
+                "} pcc_recognition_t;\n"
+                "\n"
+                "typedef struct pcc_recognition_map_tag {\n"
+                "    size_t m, n;\n"
+                "    pcc_recognition_t *p;\n"
+                "    pcc_recognition_t a[PCC_LR_MEMO_MAP_MIN_SIZE]; /* for reducing memory allocation frequency */\n"
+                "} pcc_recognition_map_t;\n"
+                "\n"
+            );
+        }
+        stream__puts(
+            &sstream,
             "typedef struct pcc_lr_table_entry_tag {\n"
             "    pcc_lr_head_t *head; /* just a reference */\n"
             "    pcc_lr_memo_map_t memos;\n"
+        );
+        if (ctx->flags & CODE_FLAG_RECOGNITION) {
+            stream__puts(
+                &sstream,
+                "    pcc_recognition_map_t recogs;\n"
+            );
+        }
+        stream__puts(
+            &sstream,
             "    pcc_lr_answer_t *hold_a;\n"
             "    pcc_lr_head_t *hold_h;\n"
+        );
+        if (ctx->opts.feed) {
+            stream__puts(
+                &sstream,
+                "    pcc_bool_t starved; /* true if the entry is in the list of the entries with the starved results */\n"
+                "    struct pcc_lr_table_entry_tag *next; /* the next entry in the list; just a reference */\n"
+            );
+        }
+        stream__puts(
+            &sstream,
             "} pcc_lr_table_entry_t;\n"
             "\n"
             "typedef struct pcc_lr_table_tag {\n"
             "    size_t m, n;\n"
             "    size_t o;\n"
             "    pcc_lr_table_entry_t **p;\n"
+        );
+        if (ctx->opts.feed) {
+            stream__puts(
+                &sstream,
+                "    pcc_lr_table_entry_t *starved; /* the list of the entries with the starved results; just a reference */\n"
+            );
+        }
+        stream__puts(
+            &sstream,
             "} pcc_lr_table_t;\n"
             "\n"
             "struct pcc_lr_entry_tag {\n"
@@ -5745,9 +9228,53 @@ static bool_t generate(context_t *ctx) {
             "    pcc_memory_pool_t *pool_list;\n"
             "    pcc_memory_entry_t *entry_list;\n"
             "    size_t element_size;\n"
+        );
+        if (ctx->opts.memory) {
+            stream__puts(
+                &sstream,
+                "#ifdef PCC_ALLOC_STATS\n"
+                "    size_t live; /* the number of the elements in use */\n"
+                "    size_t peak; /* the maximum number of the elements in use at a time */\n"
+                "#endif\n"
+            );
+        }
+        stream__puts(
+            &sstream,
             "} pcc_memory_recycler_t;\n"
             "\n"
         );
+        if (ctx->opts.profile) {
+            stream__puts(
+                &sstream,
+                "typedef struct pcc_rule_profile_tag {\n"
+                "    size_t calls;    /* the number of the applications of the rule */\n"
+                "    size_t hits;     /* the number of the applications answered from the memo table */\n"
+                "    size_t misses;   /* the number of the evaluations of the rule not memoized yet */\n"
+                "    size_t failures; /* the number of the applications not matched */\n"
+                "    size_t bytes;    /* the total number of the bytes consumed by the matched applications */\n"
+                "    size_t growths;  /* the number of the re-evaluations to grow left-recursive matches */\n"
+                "    size_t thunks;   /* the number of the thunks created for the actions */\n"
+                "} pcc_rule_profile_t;\n"
+                "\n"
+            );
+        }
+        if (ctx->opts.trace) {
+            stream__puts(
+                &sstream,
+                "typedef struct pcc_trace_record_tag {\n"
+                "    size_t pos;          /* the position in the input at which the rule is evaluated */\n"
+                "    unsigned int rule;   /* the index of the rule */\n"
+                "    unsigned short level; /* the nesting level of the rule evaluation, saturated at 65535 */\n"
+                "    unsigned char event; /* PCC_DBG_EVALUATE, PCC_DBG_MATCH, or PCC_DBG_NOMATCH */\n"
+                "} pcc_trace_record_t;\n"
+                "\n"
+                "typedef struct pcc_trace_buffer_tag {\n"
+                "    pcc_trace_record_t *p; /* the ring buffer of PCC_TRACE_BUFFER_SIZE records */\n"
+                "    size_t n; /* the total number of the records made */\n"
+                "} pcc_trace_buffer_t;\n"
+                "\n"
+            );
+        }
         stream__printf(
             &sstream,
             "struct %s_context_tag {\n"
@@ -5758,8 +9285,13 @@ static bool_t generate(context_t *ctx) {
             "    pcc_lr_table_t lrtable;\n"
             "    pcc_lr_stack_t lrstack;\n"
             "    pcc_thunk_array_t thunks;\n"
-            "    pcc_capture_t capt0; /* used only for programmable predicates */\n",
-            get_prefix(ctx)
+            "    pcc_capture_t capt0; /* used only for programmable predicates */\n"
+            "%s",
+            ctx->opts.runtime ? "pcc" : get_prefix(ctx),
+            ctx->opts.runtime ?
+                "    const pcc_grammar_t *grammar;\n"
+                "    pcc_value_t *null; /* the output value of the rules referenced without rule variables; held by the parser */\n" :
+                "    pcc_value_t null; /* the output value of the rules referenced without rule variables */\n"
         );
         if (ctx->mvars.n > 0) {
             stream__puts(
@@ -5767,6 +9299,32 @@ static bool_t generate(context_t *ctx) {
                 "    pcc_marker_variable_set_record_t mvars;\n"
             );
         }
+        if (ctx->opts.recog) {
+            stream__puts(
+                &sstream,
+                "    size_t fpos; /* the farthest position in the input at which the rules have finished matching */\n"
+            );
+        }
+        if (ctx->opts.profile && ctx->rules.n > 0) {
+            stream__printf(
+                &sstream,
+                "    pcc_rule_profile_t profile[" FMT_LU "]; /* the profiling counters indexed in the order of the rules */\n",
+                (ulong_t)ctx->rules.n
+            );
+        }
+        if (ctx->opts.trace) {
+            stream__puts(
+                &sstream,
+                "    pcc_trace_buffer_t trace;\n"
+            );
+        }
+        if (ctx->opts.feed) {
+            stream__puts(
+                &sstream,
+                "    pcc_bool_t eof; /* the end of the input has been fed */\n"
+                "    pcc_bool_t starved; /* the characters not fed yet have been requested */\n"
+            );
+        }
         stream__puts(
             &sstream,
             "    pcc_auxil_t auxil;\n"
@@ -5779,6 +9337,10 @@ static bool_t generate(context_t *ctx) {
             "};\n"
             "\n"
         );
+        if (ctx->opts.runtime) { /* the user-defined macros are expanded only in the grammar-specific code */
+            rhstream = sstream;
+            sstream = gstream;
+        }
         stream__puts(
             &sstream,
             "#ifndef PCC_ERROR\n"
@@ -5827,6 +9389,88 @@ static bool_t generate(context_t *ctx) {
             "#endif /* !PCC_DEBUG */\n"
             "\n"
         );
+        if (!ctx->opts.recog) {
+            stream__puts(
+                &sstream,
+                "#ifndef PCC_PHASE\n"
+                "#define PCC_PHASE(auxil, phase) ((void)0)\n"
+                "#endif /* !PCC_PHASE */\n"
+                "\n"
+            );
+        }
+        if (ctx->opts.runtime) {
+            stream__printf(
+                &sstream,
+                "typedef struct pcc_parser_context_tag {\n"
+                "    pcc_context_t base; /* must be the first member */\n"
+                "    %s%sauxil;\n"
+                "    %s%snull; /* the output value of the rules referenced without rule variables */\n"
+                "} pcc_parser_context_t;\n"
+                "\n"
+                "MARK_FUNC_AS_USED\n"
+                "static %s%spcc_ref_auxil_(pcc_context_t *ctx) {\n"
+                "    return ((pcc_parser_context_t *)ctx)->auxil;\n"
+                "}\n"
+                "\n",
+                at, ap ? "" : " ", vt, vp ? "" : " ", at, ap ? "" : " "
+            );
+            stream__printf(
+                &sstream,
+                "static void *pcc_allocate_(pcc_context_t *ctx, size_t size) {\n"
+                "    return PCC_MALLOC(pcc_ref_auxil_(ctx), size);\n"
+                "}\n"
+                "\n"
+                "static void *pcc_reallocate_(pcc_context_t *ctx, void *ptr, size_t size) {\n"
+                "    return PCC_REALLOC(pcc_ref_auxil_(ctx), ptr, size);\n"
+                "}\n"
+                "\n"
+                "static void pcc_deallocate_(pcc_context_t *ctx, void *ptr) {\n"
+                "    PCC_FREE(pcc_ref_auxil_(ctx), ptr);\n"
+                "}\n"
+                "\n"
+                "static int pcc_read_char_(pcc_context_t *ctx) {\n"
+                "    return PCC_GETCHAR(pcc_ref_auxil_(ctx));\n"
+                "}\n"
+                "\n"
+                "MARK_VAR_AS_USED\n"
+                "static const pcc_grammar_t pcc_grammar = {\n"
+                "    sizeof(%s),\n"
+                "    pcc_allocate_,\n"
+                "    pcc_reallocate_,\n"
+                "    pcc_deallocate_,\n"
+                "    pcc_read_char_\n"
+                "};\n"
+                "\n",
+                vt
+            );
+            gstream = sstream; /* the runtime functions go to the runtime source */
+            stream__initialize(&sstream, ctx->rspath, VOID_VALUE);
+            stream__initialize(&istream, NULL, VOID_VALUE);
+            stream__printf(&sstream, "/* A parser runtime generated by PackCC %s */\n\n", PACKCC_VERSION);
+            stream__printf(
+                &sstream,
+                "#ifdef _MSC_VER\n"
+                "#undef _CRT_NONSTDC_NO_WARNINGS\n"
+                "#undef _CRT_SECURE_NO_WARNINGS\n"
+                "#define _CRT_NONSTDC_NO_WARNINGS\n"
+                "#define _CRT_SECURE_NO_WARNINGS\n"
+                "#endif /* _MSC_VER */\n"
+                "#include <stddef.h>\n"
+                "#include <stdio.h>\n"
+                "#include <stdlib.h>\n"
+                "#include <string.h>\n"
+                "\n"
+                "#include \"%s\"\n"
+                "\n"
+                "#define PCC_MALLOC(auxil, size) ((auxil)->grammar->allocate(auxil, size))\n"
+                "#define PCC_REALLOC(auxil, ptr, size) ((auxil)->grammar->reallocate(auxil, ptr, size))\n"
+                "#define PCC_FREE(auxil, ptr) ((auxil)->grammar->deallocate(auxil, ptr))\n"
+                "#define PCC_GETCHAR(auxil) ((auxil)->grammar->read_char(auxil))\n"
+                "#define PCC_VALUE_SIZE(auxil) ((auxil)->grammar->value_size)\n"
+                "\n",
+                extract_filename(ctx->rhpath)
+            );
+        }
         {
             stream__puts(
                 &sstream,
@@ -5852,20 +9496,25 @@ static bool_t generate(context_t *ctx) {
                 "    obj->n = len;\n"
                 "}\n"
                 "\n"
-                "static void pcc_char_array__add(pcc_auxil_t auxil, pcc_char_array_t *obj, char ch) {\n"
-                "    if (obj->m <= obj->n) {\n"
-                "        const size_t n = obj->n + 1;\n"
-                "        size_t m = obj->m;\n"
-                "        if (m == 0) m = PCC_BUFFER_MIN_SIZE;\n"
-                "        while (m < n && m != 0) m <<= 1;\n"
-                "        if (m == 0) m = n;\n"
-                "        obj->p = (char *)PCC_REALLOC(auxil, obj->p, m);\n"
-                "        obj->m = m;\n"
-                "    }\n"
-                "    obj->p[obj->n++] = ch;\n"
-                "}\n"
-                "\n"
             );
+            if (!ctx->opts.feed) {
+                stream__puts(
+                    &sstream,
+                    "static void pcc_char_array__add(pcc_auxil_t auxil, pcc_char_array_t *obj, char ch) {\n"
+                    "    if (obj->m <= obj->n) {\n"
+                    "        const size_t n = obj->n + 1;\n"
+                    "        size_t m = obj->m;\n"
+                    "        if (m == 0) m = PCC_BUFFER_MIN_SIZE;\n"
+                    "        while (m < n && m != 0) m <<= 1;\n"
+                    "        if (m == 0) m = n;\n"
+                    "        obj->p = (char *)PCC_REALLOC(auxil, obj->p, m);\n"
+                    "        obj->m = m;\n"
+                    "    }\n"
+                    "    obj->p[obj->n++] = ch;\n"
+                    "}\n"
+                    "\n"
+                );
+            }
         }
         if (ctx->mvars.n > 0) {
             stream__puts(
@@ -5878,7 +9527,7 @@ static bool_t generate(context_t *ctx) {
                 "\n"
             );
         }
-        if (ctx->rules.n > 0) {
+        if (ctx->flags & CODE_FLAG_EVALUATION) {
             stream__puts(
                 &sstream,
                 "static void pcc_value_table__initialize(pcc_auxil_t auxil, pcc_value_table_t *obj) {\n"
@@ -5899,10 +9548,11 @@ static bool_t generate(context_t *ctx) {
             );
         }
         if (ctx->flags & CODE_FLAG_RULE_VARIABLE) {
-            stream__puts(
+            const char *const z = ctx->opts.runtime ? "PCC_VALUE_SIZE(auxil)" : "sizeof(pcc_value_t)";
+            stream__printf(
                 &sstream,
                 "static void pcc_value_table__clear(pcc_auxil_t auxil, pcc_value_table_t *obj) {\n"
-                "    memset(obj->p, 0, sizeof(pcc_value_t) * obj->n);\n"
+                "    memset(obj->p, 0, %s * obj->n);\n"
                 "}\n"
                 "\n"
                 "static void pcc_value_table__resize(pcc_auxil_t auxil, pcc_value_table_t *obj, size_t len) {\n"
@@ -5911,12 +9561,13 @@ static bool_t generate(context_t *ctx) {
                 "        if (m == 0) m = PCC_ARRAY_MIN_SIZE;\n"
                 "        while (m < len && m != 0) m <<= 1;\n"
                 "        if (m == 0) m = len;\n"
-                "        obj->p = (pcc_value_t *)PCC_REALLOC(auxil, obj->p, sizeof(pcc_value_t) * m);\n"
+                "        obj->p = (pcc_value_t *)PCC_REALLOC(auxil, obj->p, %s * m);\n"
                 "        obj->m = m;\n"
                 "    }\n"
                 "    obj->n = len;\n"
                 "}\n"
-                "\n"
+                "\n",
+                z, z
             );
         }
         if (ctx->flags & (CODE_FLAG_ACTION | CODE_FLAG_ERROR)) {
@@ -5973,7 +9624,7 @@ static bool_t generate(context_t *ctx) {
                 "\n"
             );
         }
-        if (ctx->rules.n > 0) {
+        if (ctx->flags & CODE_FLAG_EVALUATION) {
             stream__puts(
                 &sstream,
                 "static void pcc_capture_table__initialize(pcc_auxil_t auxil, pcc_capture_table_t *obj) {\n"
@@ -6457,6 +10108,18 @@ static bool_t generate(context_t *ctx) {
                 "    obj->pool_list = NULL;\n"
                 "    obj->entry_list = NULL;\n"
                 "    obj->element_size = element_size;\n"
+            );
+            if (ctx->opts.memory) {
+                stream__puts(
+                    &sstream,
+                    "#ifdef PCC_ALLOC_STATS\n"
+                    "    obj->live = 0;\n"
+                    "    obj->peak = 0;\n"
+                    "#endif\n"
+                );
+            }
+            stream__puts(
+                &sstream,
                 "}\n"
                 "\n"
                 "static void pcc_memory_recycler__finalize(pcc_auxil_t auxil, pcc_memory_recycler_t *obj) {\n"
@@ -6469,10 +10132,100 @@ static bool_t generate(context_t *ctx) {
                 "\n"
             );
         }
-        if (ctx->rules.n > 0) {
+        if (ctx->opts.memory) {
+            stream__puts(
+                &sstream,
+                "static size_t pcc_memory_recycler__count_used(const pcc_memory_recycler_t *obj) {\n"
+                "    /* the elements supplied from the pools so far, whether in use or in the free list */\n"
+                "    const pcc_memory_pool_t *pool;\n"
+                "    size_t n = 0;\n"
+                "    for (pool = obj->pool_list; pool; pool = pool->next) {\n"
+                "        n += pool->allocated - pool->unused;\n"
+                "    }\n"
+                "    return n;\n"
+                "}\n"
+                "\n"
+                "static size_t pcc_memory_recycler__count_idle(const pcc_memory_recycler_t *obj) {\n"
+                "    const pcc_memory_entry_t *entry;\n"
+                "    size_t n = 0;\n"
+                "    for (entry = obj->entry_list; entry; entry = entry->next) {\n"
+                "        n++;\n"
+                "    }\n"
+                "    return n;\n"
+                "}\n"
+                "\n"
+                "static size_t pcc_memory_recycler__trim(pcc_auxil_t auxil, pcc_memory_recycler_t *obj, size_t keep) {\n"
+                "    size_t n = 0;\n"
+                "    if (pcc_memory_recycler__count_idle(obj) == pcc_memory_recycler__count_used(obj)) {\n"
+                "        /* the pools can be released only if all elements are free */\n"
+                "        pcc_memory_pool_t *k = NULL;\n"
+                "        obj->entry_list = NULL;\n"
+                "        while (obj->pool_list) {\n"
+                "            pcc_memory_pool_t *const pool = obj->pool_list;\n"
+                "            obj->pool_list = pool->next;\n"
+                "            if (sizeof(pcc_memory_pool_t) + obj->element_size * pool->allocated <= keep && (k == NULL || k->allocated < pool->allocated)) {\n"
+                "                if (k) PCC_FREE(auxil, k);\n"
+                "                k = pool; /* the largest pool within the limit is kept */\n"
+                "            }\n"
+                "            else {\n"
+                "                PCC_FREE(auxil, pool);\n"
+                "            }\n"
+                "        }\n"
+                "        if (k) {\n"
+                "            k->next = NULL;\n"
+                "            k->unused = k->allocated;\n"
+                "        }\n"
+                "        obj->pool_list = k;\n"
+                "    }\n"
+                "    {\n"
+                "        const pcc_memory_pool_t *pool;\n"
+                "        for (pool = obj->pool_list; pool; pool = pool->next) {\n"
+                "            n += sizeof(pcc_memory_pool_t) + obj->element_size * pool->allocated;\n"
+                "        }\n"
+                "    }\n"
+                "    return n;\n"
+                "}\n"
+                "\n"
+            );
+            stream__printf(
+                ctx->opts.runtime ? &gstream : &sstream, /* depends on the API type */
+                "static void pcc_memory_recycler__get_stats(const pcc_memory_recycler_t *obj, const char *name, %s_memory_stats_t *stats) {\n"
+                "    const pcc_memory_pool_t *pool;\n"
+                "    stats->name = name;\n"
+                "    stats->pools = 0;\n"
+                "    stats->bytes = 0;\n"
+                "    for (pool = obj->pool_list; pool; pool = pool->next) {\n"
+                "        stats->pools++;\n"
+                "        stats->bytes += sizeof(pcc_memory_pool_t) + obj->element_size * pool->allocated;\n"
+                "    }\n"
+                "    stats->idle = pcc_memory_recycler__count_idle(obj);\n"
+                "    stats->live = pcc_memory_recycler__count_used(obj) - stats->idle;\n"
+                "#ifdef PCC_ALLOC_STATS\n"
+                "    stats->peak = obj->peak;\n"
+                "#else\n"
+                "    stats->peak = 0; /* not counted */\n"
+                "#endif\n"
+                "}\n"
+                "\n",
+                get_prefix(ctx)
+            );
+        }
+        if (ctx->flags & (CODE_FLAG_EVALUATION | CODE_FLAG_RECOGNITION)) {
             stream__puts(
                 &sstream,
                 "static void *pcc_memory_recycler__supply(pcc_auxil_t auxil, pcc_memory_recycler_t *obj) {\n"
+            );
+            if (ctx->opts.memory) {
+                stream__puts(
+                    &sstream,
+                    "#ifdef PCC_ALLOC_STATS\n"
+                    "    obj->live++;\n"
+                    "    if (obj->peak < obj->live) obj->peak = obj->live;\n"
+                    "#endif\n"
+                );
+            }
+            stream__puts(
+                &sstream,
                 "    if (obj->entry_list) {\n"
                 "        pcc_memory_entry_t *const tmp = obj->entry_list;\n"
                 "        obj->entry_list = tmp->next;\n"
@@ -6506,6 +10259,17 @@ static bool_t generate(context_t *ctx) {
                 "static void pcc_memory_recycler__recycle(pcc_auxil_t auxil, pcc_memory_recycler_t *obj, void *ptr) {\n"
                 "    pcc_memory_entry_t *const tmp = (pcc_memory_entry_t *)ptr;\n"
                 "    if (tmp == NULL) return;\n"
+            );
+            if (ctx->opts.memory) {
+                stream__puts(
+                    &sstream,
+                    "#ifdef PCC_ALLOC_STATS\n"
+                    "    obj->live--;\n"
+                    "#endif\n"
+                );
+            }
+            stream__puts(
+                &sstream,
                 "    tmp->next = obj->entry_list;\n"
                 "    obj->entry_list = tmp;\n"
                 "}\n"
@@ -6538,7 +10302,7 @@ static bool_t generate(context_t *ctx) {
                 "\n"
             );
         }
-        if (ctx->rules.n > 0) {
+        if (ctx->flags & CODE_FLAG_EVALUATION) {
             stream__puts(
                 &sstream,
                 "static pcc_thunk_t *pcc_thunk__create_node(pcc_context_t *ctx, const pcc_thunk_array_t *thunks, pcc_value_t *value) {\n"
@@ -6598,34 +10362,68 @@ static bool_t generate(context_t *ctx) {
                 "\n"
             );
         }
-        if (ctx->rules.n > 0) {
-            stream__puts(
-                &sstream,
-                "static void pcc_thunk_array__add(pcc_context_t *ctx, pcc_thunk_array_t *obj, pcc_thunk_t *thunk) {\n"
-                "    if (obj->m <= obj->n) {\n"
-                "        const size_t n = obj->n + 1;\n"
-                "        size_t m = obj->m;\n"
-                "        if (m == 0) m = PCC_THUNK_ARRAY_MIN_SIZE << 1;\n"
-                "        while (m < n && m != 0) m <<= 1;\n"
-                "        if (m == 0) m = n;\n"
-                "        if (obj->p == obj->a) {\n"
-                "            size_t i;\n"
-                "            obj->p = (pcc_thunk_t **)PCC_MALLOC(ctx->auxil, sizeof(pcc_thunk_t *) * m);\n"
-                "            for (i = 0; i < PCC_THUNK_ARRAY_MIN_SIZE; i++) obj->p[i] = obj->a[i];\n"
-                "        }\n"
-                "        else {\n"
-                "            obj->p = (pcc_thunk_t **)PCC_REALLOC(ctx->auxil, obj->p, sizeof(pcc_thunk_t *) * m);\n"
-                "        }\n"
-                "        obj->m = m;\n"
-                "    }\n"
-                "    obj->p[obj->n++] = thunk;\n"
-                "}\n"
-                "\n"
-            );
+        if (ctx->flags & CODE_FLAG_EVALUATION) {
+            if (ctx->opts.runtime) { /* only the growth is out of line */
+                stream__puts(
+                    &sstream,
+                    "static void pcc_thunk_array__expand(pcc_context_t *ctx, pcc_thunk_array_t *obj) {\n"
+                    "    const size_t n = obj->n + 1;\n"
+                    "    size_t m = obj->m;\n"
+                    "    if (m == 0) m = PCC_THUNK_ARRAY_MIN_SIZE << 1;\n"
+                    "    while (m < n && m != 0) m <<= 1;\n"
+                    "    if (m == 0) m = n;\n"
+                    "    if (obj->p == obj->a) {\n"
+                    "        size_t i;\n"
+                    "        obj->p = (pcc_thunk_t **)PCC_MALLOC(ctx->auxil, sizeof(pcc_thunk_t *) * m);\n"
+                    "        for (i = 0; i < PCC_THUNK_ARRAY_MIN_SIZE; i++) obj->p[i] = obj->a[i];\n"
+                    "    }\n"
+                    "    else {\n"
+                    "        obj->p = (pcc_thunk_t **)PCC_REALLOC(ctx->auxil, obj->p, sizeof(pcc_thunk_t *) * m);\n"
+                    "    }\n"
+                    "    obj->m = m;\n"
+                    "}\n"
+                    "\n"
+                );
+                stream__puts(
+                    &istream,
+                    "MARK_FUNC_AS_USED\n"
+                    "static void pcc_thunk_array__add(pcc_context_t *ctx, pcc_thunk_array_t *obj, pcc_thunk_t *thunk) {\n"
+                    "    if (obj->m <= obj->n) pcc_thunk_array__expand(ctx, obj);\n"
+                    "    obj->p[obj->n++] = thunk;\n"
+                    "}\n"
+                    "\n"
+                );
+            }
+            else {
+                stream__puts(
+                    &sstream,
+                    "static void pcc_thunk_array__add(pcc_context_t *ctx, pcc_thunk_array_t *obj, pcc_thunk_t *thunk) {\n"
+                    "    if (obj->m <= obj->n) {\n"
+                    "        const size_t n = obj->n + 1;\n"
+                    "        size_t m = obj->m;\n"
+                    "        if (m == 0) m = PCC_THUNK_ARRAY_MIN_SIZE << 1;\n"
+                    "        while (m < n && m != 0) m <<= 1;\n"
+                    "        if (m == 0) m = n;\n"
+                    "        if (obj->p == obj->a) {\n"
+                    "            size_t i;\n"
+                    "            obj->p = (pcc_thunk_t **)PCC_MALLOC(ctx->auxil, sizeof(pcc_thunk_t *) * m);\n"
+                    "            for (i = 0; i < PCC_THUNK_ARRAY_MIN_SIZE; i++) obj->p[i] = obj->a[i];\n"
+                    "        }\n"
+                    "        else {\n"
+                    "            obj->p = (pcc_thunk_t **)PCC_REALLOC(ctx->auxil, obj->p, sizeof(pcc_thunk_t *) * m);\n"
+                    "        }\n"
+                    "        obj->m = m;\n"
+                    "    }\n"
+                    "    obj->p[obj->n++] = thunk;\n"
+                    "}\n"
+                    "\n"
+                );
+            }
         }
-        {
+        if (ctx->flags & CODE_FLAG_EVALUATION) {
+            if (ctx->opts.runtime) stream__puts(&istream, "MARK_FUNC_AS_USED\n");
             stream__puts(
-                &sstream,
+                ctx->opts.runtime ? &istream : &sstream,
                 "static void pcc_thunk_array__revert(pcc_context_t *ctx, pcc_thunk_array_t *obj, size_t len) {\n"
                 "    while (obj->n > len) {\n"
                 "        obj->n--;\n"
@@ -6635,7 +10433,7 @@ static bool_t generate(context_t *ctx) {
                 "\n"
             );
         }
-        if (ctx->rules.n > 0) {
+        if (ctx->flags & CODE_FLAG_EVALUATION) {
             stream__puts(
                 &sstream,
                 "static pcc_thunk_chunk_t *pcc_thunk_chunk__create(pcc_context_t *ctx) {\n"
@@ -6680,7 +10478,7 @@ static bool_t generate(context_t *ctx) {
                 "\n"
             );
         }
-        if (ctx->rules.n > 0) {
+        if (ctx->flags & CODE_FLAG_EVALUATION) {
             stream__puts(
                 &sstream,
                 "static void pcc_rule_set__initialize(pcc_auxil_t auxil, pcc_rule_set_t *obj) {\n"
@@ -6700,7 +10498,7 @@ static bool_t generate(context_t *ctx) {
                 "\n"
             );
         }
-        if (ctx->rules.n > 0) {
+        if (ctx->flags & CODE_FLAG_EVALUATION) {
             stream__puts(
                 &sstream,
                 "static void pcc_rule_set__clear(pcc_auxil_t auxil, pcc_rule_set_t *obj) {\n"
@@ -6776,13 +10574,22 @@ static bool_t generate(context_t *ctx) {
                 "\n"
             );
         }
-        if (ctx->rules.n > 0) {
+        if (ctx->flags & CODE_FLAG_EVALUATION) {
             stream__puts(
                 &sstream,
                 "static pcc_lr_answer_t *pcc_lr_answer__create(pcc_context_t *ctx, pcc_lr_answer_type_t type, size_t pos) {\n"
                 "    pcc_lr_answer_t *obj = (pcc_lr_answer_t *)pcc_memory_recycler__supply(ctx->auxil, &(ctx->lr_answer_recycler));\n"
                 "    obj->type = type;\n"
                 "    obj->pos = pos;\n"
+            );
+            if (ctx->opts.feed) {
+                stream__puts(
+                    &sstream,
+                    "    obj->starved = PCC_FALSE;\n"
+                );
+            }
+            stream__puts(
+                &sstream,
                 "    obj->hold = NULL;\n"
                 "    switch (obj->type) {\n"
                 "    case PCC_LR_ANSWER_LR:\n"
@@ -6823,7 +10630,7 @@ static bool_t generate(context_t *ctx) {
                 "\n"
             );
         }
-        if (ctx->rules.n > 0) {
+        if (ctx->flags & CODE_FLAG_EVALUATION) {
             stream__puts(
                 &sstream,
                 "static void pcc_lr_answer__set_chunk(pcc_context_t *ctx, pcc_lr_answer_t *obj, pcc_thunk_chunk_t *chunk) {\n"
@@ -6845,6 +10652,8 @@ static bool_t generate(context_t *ctx) {
                 "}\n"
                 "\n"
             );
+        }
+        if (ctx->flags & (CODE_FLAG_EVALUATION | CODE_FLAG_RECOGNITION)) {
             stream__puts(
                 &sstream,
                 "static void pcc_lr_memo_map__initialize(pcc_context_t *ctx, pcc_lr_memo_map_t *obj) {\n"
@@ -6868,7 +10677,7 @@ static bool_t generate(context_t *ctx) {
                 "\n"
             );
         }
-        if (ctx->rules.n > 0) {
+        if (ctx->flags & CODE_FLAG_EVALUATION) {
             stream__puts(
                 &sstream,
                 "static size_t pcc_lr_memo_map__index(pcc_context_t *ctx, pcc_lr_memo_map_t *obj, pcc_rule_t rule) {\n"
@@ -6908,20 +10717,128 @@ static bool_t generate(context_t *ctx) {
                 "    }\n"
                 "}\n"
                 "\n"
-                "static pcc_lr_answer_t *pcc_lr_memo_map__get(pcc_context_t *ctx, pcc_lr_memo_map_t *obj, pcc_rule_t rule) {\n"
-                "    const size_t i = pcc_lr_memo_map__index(ctx, obj, rule);\n"
-                "    return (i != PCC_VOID_VALUE) ? obj->p[i].answer : NULL;\n"
+                "static pcc_lr_answer_t *pcc_lr_memo_map__get(pcc_context_t *ctx, pcc_lr_memo_map_t *obj, pcc_rule_t rule) {\n"
+                "    const size_t i = pcc_lr_memo_map__index(ctx, obj, rule);\n"
+                "    return (i != PCC_VOID_VALUE) ? obj->p[i].answer : NULL;\n"
+                "}\n"
+                "\n"
+            );
+        }
+        if (ctx->flags & CODE_FLAG_RECOGNITION) {
+            stream__puts(
+                &sstream,
+                "static void pcc_recognition_map__initialize(pcc_context_t *ctx, pcc_recognition_map_t *obj) {\n"
+                "    obj->m = PCC_LR_MEMO_MAP_MIN_SIZE;\n"
+                "    obj->n = 0;\n"
+                "    obj->p = obj->a;\n"
+                "}\n"
+                "\n"
+                "static void pcc_recognition_map__finalize(pcc_context_t *ctx, pcc_recognition_map_t *obj) {\n"
+                "    if (obj->p != obj->a) PCC_FREE(ctx->auxil, obj->p);\n"
+                "}\n"
+                "\n"
+                "static void pcc_recognition_map__put(pcc_context_t *ctx, pcc_recognition_map_t *obj, pcc_recognizer_t rule, size_t pos, size_t cycle, pcc_bool_t grow) {\n"
+                "    size_t i;\n"
+                "    for (i = 0; i < obj->n; i++) {\n"
+                "        if (obj->p[i].rule == rule) {\n"
+                "            obj->p[i].pos = pos;\n"
+                "            obj->p[i].grow = grow;\n"
+            );
+            if (ctx->opts.feed) {
+                stream__puts(
+                    &sstream,
+                    "            obj->p[i].starved = ctx->starved; /* in the matching since the flag was cleared */\n"
+                );
+            }
+            stream__puts(
+                &sstream,
+                "            return;\n"
+                "        }\n"
+                "    }\n"
+                "    if (obj->m <= obj->n) {\n"
+                "        const size_t n = obj->n + 1;\n"
+                "        size_t m = obj->m;\n"
+                "        if (m == 0) m = PCC_LR_MEMO_MAP_MIN_SIZE << 1;\n"
+                "        while (m < n && m != 0) m <<= 1;\n"
+                "        if (m == 0) m = n;\n"
+                "        if (obj->p == obj->a) {\n"
+                "            obj->p = (pcc_recognition_t *)PCC_MALLOC(ctx->auxil, sizeof(pcc_recognition_t) * m);\n"
+                "            for (i = 0; i < PCC_LR_MEMO_MAP_MIN_SIZE; i++) obj->p[i] = obj->a[i];\n"
+                "        }\n"
+                "        else {\n"
+                "            obj->p = (pcc_recognition_t *)PCC_REALLOC(ctx->auxil, obj->p, sizeof(pcc_recognition_t) * m);\n"
+                "        }\n"
+                "        obj->m = m;\n"
+                "    }\n"
+                "    obj->p[obj->n].rule = rule;\n"
+                "    obj->p[obj->n].pos = pos;\n"
+                "    obj->p[obj->n].cycle = cycle;\n"
+                "    obj->p[obj->n].grow = grow;\n"
+            );
+            if (ctx->opts.feed) {
+                stream__puts(
+                    &sstream,
+                    "    obj->p[obj->n].starved = ctx->starved;\n"
+                );
+            }
+            stream__puts(
+                &sstream,
+                "    obj->n++;\n"
+                "}\n"
+                "\n"
+                "static const pcc_recognition_t *pcc_recognition_map__get(pcc_context_t *ctx, const pcc_recognition_map_t *obj, pcc_recognizer_t rule) {\n"
+                "    size_t i;\n"
+                "    for (i = 0; i < obj->n; i++) {\n"
+                "        if (obj->p[i].rule == rule) return &(obj->p[i]);\n"
+                "    }\n"
+                "    return NULL;\n"
                 "}\n"
                 "\n"
             );
+            if (ctx->flags & CODE_FLAG_LEFT_RECURSION) {
+                stream__puts(
+                    &sstream,
+                    "static void pcc_recognition_map__reset(pcc_context_t *ctx, pcc_recognition_map_t *obj, size_t cycle) {\n"
+                    "    size_t i = 0;\n"
+                    "    while (i < obj->n) {\n"
+                    "        if (obj->p[i].cycle == cycle && !obj->p[i].grow)\n"
+                    "            obj->p[i] = obj->p[--obj->n];\n"
+                    "        else\n"
+                    "            i++;\n"
+                    "    }\n"
+                    "}\n"
+                    "\n"
+                );
+            }
+        }
+        if (ctx->flags & (CODE_FLAG_EVALUATION | CODE_FLAG_RECOGNITION)) {
             stream__puts(
                 &sstream,
                 "static pcc_lr_table_entry_t *pcc_lr_table_entry__create(pcc_context_t *ctx) {\n"
                 "    pcc_lr_table_entry_t *const obj = (pcc_lr_table_entry_t *)pcc_memory_recycler__supply(ctx->auxil, &(ctx->lr_table_entry_recycler));\n"
                 "    obj->head = NULL;\n"
                 "    pcc_lr_memo_map__initialize(ctx, &(obj->memos));\n"
+            );
+            if (ctx->flags & CODE_FLAG_RECOGNITION) {
+                stream__puts(
+                    &sstream,
+                    "    pcc_recognition_map__initialize(ctx, &(obj->recogs));\n"
+                );
+            }
+            stream__puts(
+                &sstream,
                 "    obj->hold_a = NULL;\n"
                 "    obj->hold_h = NULL;\n"
+            );
+            if (ctx->opts.feed) {
+                stream__puts(
+                    &sstream,
+                    "    obj->starved = PCC_FALSE;\n"
+                    "    obj->next = NULL;\n"
+                );
+            }
+            stream__puts(
+                &sstream,
                 "    return obj;\n"
                 "}\n"
                 "\n"
@@ -6933,6 +10850,15 @@ static bool_t generate(context_t *ctx) {
                 "static void pcc_lr_table_entry__destroy(pcc_context_t *ctx, pcc_lr_table_entry_t *obj) {\n"
                 "    if (obj == NULL) return;\n"
                 "    pcc_lr_memo_map__finalize(ctx, &(obj->memos));\n"
+            );
+            if (ctx->flags & CODE_FLAG_RECOGNITION) {
+                stream__puts(
+                    &sstream,
+                    "    pcc_recognition_map__finalize(ctx, &(obj->recogs));\n"
+                );
+            }
+            stream__puts(
+                &sstream,
                 "    pcc_lr_answer__destroy(ctx, obj->hold_a);\n"
                 "    pcc_lr_head__destroy(ctx, obj->hold_h);\n"
                 "    pcc_memory_recycler__recycle(ctx->auxil, &(ctx->lr_table_entry_recycler), obj);\n"
@@ -6946,6 +10872,15 @@ static bool_t generate(context_t *ctx) {
                 "    obj->m = 0;\n"
                 "    obj->n = 0;\n"
                 "    obj->p = NULL;\n"
+            );
+            if (ctx->opts.feed) {
+                stream__puts(
+                    &sstream,
+                    "    obj->starved = NULL;\n"
+                );
+            }
+            stream__puts(
+                &sstream,
                 "}\n"
                 "\n"
                 "static void pcc_lr_table__finalize(pcc_context_t *ctx, pcc_lr_table_t *obj) {\n"
@@ -6958,7 +10893,7 @@ static bool_t generate(context_t *ctx) {
                 "\n"
             );
         }
-        if (ctx->rules.n > 0) {
+        if (ctx->flags & (CODE_FLAG_EVALUATION | CODE_FLAG_RECOGNITION)) {
             stream__puts(
                 &sstream,
                 "static void pcc_lr_table__resize(pcc_context_t *ctx, pcc_lr_table_t *obj, size_t len) {\n"
@@ -6976,6 +10911,11 @@ static bool_t generate(context_t *ctx) {
                 "    obj->n = len;\n"
                 "}\n"
                 "\n"
+            );
+        }
+        if (ctx->flags & CODE_FLAG_EVALUATION) {
+            stream__puts(
+                &sstream,
                 "static void pcc_lr_table__set_head(pcc_context_t *ctx, pcc_lr_table_t *obj, size_t index, pcc_lr_head_t *head) {\n"
                 "    index += obj->o;\n"
                 "    if (index >= obj->n) pcc_lr_table__resize(ctx, obj, index + 1);\n"
@@ -7018,6 +10958,11 @@ static bool_t generate(context_t *ctx) {
                 "    return pcc_lr_memo_map__get(ctx, &(obj->p[index]->memos), rule);\n"
                 "}\n"
                 "\n"
+            );
+        }
+        if (ctx->flags & (CODE_FLAG_EVALUATION | CODE_FLAG_RECOGNITION)) {
+            stream__puts(
+                &sstream,
                 "static void pcc_lr_table__shift(pcc_context_t *ctx, pcc_lr_table_t *obj, size_t count) {\n"
                 "    size_t i;\n"
                 "    if (count > obj->n - obj->o) count = obj->n - obj->o;\n"
@@ -7030,6 +10975,91 @@ static bool_t generate(context_t *ctx) {
                 "}\n"
                 "\n"
             );
+        }
+        if (ctx->opts.feed && (ctx->flags & (CODE_FLAG_EVALUATION | CODE_FLAG_RECOGNITION))) {
+            stream__puts(
+                &sstream,
+                "static void pcc_lr_table__mark_starved(pcc_context_t *ctx, pcc_lr_table_t *obj, size_t index) {\n"
+                "    pcc_lr_table_entry_t *const e = obj->p[index + obj->o]; /* existing since a result has been stored */\n"
+                "    if (e->starved) return;\n"
+                "    e->starved = PCC_TRUE;\n"
+                "    e->next = obj->starved;\n"
+                "    obj->starved = e;\n"
+                "}\n"
+                "\n"
+                "static void pcc_lr_table__discard_starved(pcc_context_t *ctx, pcc_lr_table_t *obj) {\n"
+                "    /* only the results that can change with the input not fed yet are discarded */\n"
+                "    while (obj->starved) {\n"
+                "        pcc_lr_table_entry_t *const e = obj->starved;\n"
+                "        size_t j;\n"
+                "        obj->starved = e->next;\n"
+                "        e->starved = PCC_FALSE;\n"
+                "        e->next = NULL;\n"
+            );
+            if (ctx->flags & CODE_FLAG_EVALUATION) {
+                stream__puts(
+                    &sstream,
+                    "        j = 0;\n"
+                    "        while (j < e->memos.n) {\n"
+                    "            if (e->memos.p[j].answer->starved) {\n"
+                    "                pcc_lr_answer__destroy(ctx, e->memos.p[j].answer);\n"
+                    "                e->memos.p[j] = e->memos.p[--e->memos.n];\n"
+                    "            }\n"
+                    "            else {\n"
+                    "                j++;\n"
+                    "            }\n"
+                    "        }\n"
+                );
+            }
+            if (ctx->flags & CODE_FLAG_RECOGNITION) {
+                stream__puts(
+                    &sstream,
+                    "        j = 0;\n"
+                    "        while (j < e->recogs.n) {\n"
+                    "            if (e->recogs.p[j].starved)\n"
+                    "                e->recogs.p[j] = e->recogs.p[--e->recogs.n];\n"
+                    "            else\n"
+                    "                j++;\n"
+                    "        }\n"
+                );
+            }
+            stream__puts(
+                &sstream,
+                "    }\n"
+                "}\n"
+                "\n"
+            );
+        }
+        if (ctx->flags & CODE_FLAG_RECOGNITION) {
+            stream__puts(
+                &sstream,
+                "static void pcc_lr_table__set_recognition(pcc_context_t *ctx, pcc_lr_table_t *obj, size_t index, pcc_recognizer_t rule, size_t pos, size_t cycle, pcc_bool_t grow) {\n"
+                "    index += obj->o;\n"
+                "    if (index >= obj->n) pcc_lr_table__resize(ctx, obj, index + 1);\n"
+                "    if (obj->p[index] == NULL) obj->p[index] = pcc_lr_table_entry__create(ctx);\n"
+                "    pcc_recognition_map__put(ctx, &(obj->p[index]->recogs), rule, pos, cycle, grow);\n"
+                "}\n"
+                "\n"
+                "static const pcc_recognition_t *pcc_lr_table__get_recognition(pcc_context_t *ctx, pcc_lr_table_t *obj, size_t index, pcc_recognizer_t rule) {\n"
+                "    index += obj->o;\n"
+                "    if (index >= obj->n || obj->p[index] == NULL) return NULL;\n"
+                "    return pcc_recognition_map__get(ctx, &(obj->p[index]->recogs), rule);\n"
+                "}\n"
+                "\n"
+            );
+            if (ctx->flags & CODE_FLAG_LEFT_RECURSION) {
+                stream__puts(
+                    &sstream,
+                    "static void pcc_lr_table__reset_recognitions(pcc_context_t *ctx, pcc_lr_table_t *obj, size_t index, size_t cycle) {\n"
+                    "    index += obj->o;\n"
+                    "    if (index >= obj->n || obj->p[index] == NULL) return;\n"
+                    "    pcc_recognition_map__reset(ctx, &(obj->p[index]->recogs), cycle);\n"
+                    "}\n"
+                    "\n"
+                );
+            }
+        }
+        if (ctx->flags & CODE_FLAG_EVALUATION) {
             stream__puts(
                 &sstream,
                 "static pcc_lr_entry_t *pcc_lr_entry__create(pcc_context_t *ctx, pcc_rule_t rule) {\n"
@@ -7064,7 +11094,7 @@ static bool_t generate(context_t *ctx) {
                 "\n"
             );
         }
-        if (ctx->rules.n > 0) {
+        if (ctx->flags & CODE_FLAG_EVALUATION) {
             stream__puts(
                 &sstream,
                 "static void pcc_lr_stack__push(pcc_auxil_t auxil, pcc_lr_stack_t *obj, pcc_lr_entry_t *lr) {\n"
@@ -7086,84 +11116,283 @@ static bool_t generate(context_t *ctx) {
                 "\n"
             );
         }
-        {
+        {
+            stream__puts(
+                &sstream,
+                ctx->opts.runtime ?
+                    "static void pcc_context__initialize(pcc_context_t *ctx, const pcc_grammar_t *grammar) { /* the context is allocated by the parser */\n"
+                    "    const pcc_auxil_t auxil = ctx;\n"
+                    "    ctx->grammar = grammar;\n"
+                    "    ctx->auxil = auxil;\n" :
+                    "static pcc_context_t *pcc_context__create(pcc_auxil_t auxil) {\n"
+                    "    pcc_context_t *const ctx = (pcc_context_t *)PCC_MALLOC(auxil, sizeof(pcc_context_t));\n"
+            );
+            stream__puts(
+                &sstream,
+                "    ctx->pos = 0;\n"
+                "    ctx->cur = 0;\n"
+                "    ctx->level = 0;\n"
+                "    pcc_char_array__initialize(auxil, &(ctx->buffer));\n"
+                "    pcc_lr_table__initialize(ctx, &(ctx->lrtable));\n"
+                "    pcc_lr_stack__initialize(auxil, &(ctx->lrstack));\n"
+                "    pcc_thunk_array__initialize(ctx, &(ctx->thunks));\n"
+                "    pcc_capture__initialize(ctx->auxil, &(ctx->capt0));\n"
+            );
+            if (ctx->mvars.n > 0) {
+                stream__puts(
+                    &sstream,
+                    "    pcc_marker_variable_set_record__initialize(ctx->auxil, &(ctx->mvars));\n"
+                );
+            }
+            if (ctx->opts.recog) {
+                stream__puts(
+                    &sstream,
+                    "    ctx->fpos = 0;\n"
+                );
+            }
+            if (ctx->opts.feed) {
+                stream__puts(
+                    &sstream,
+                    "    ctx->eof = PCC_FALSE;\n"
+                    "    ctx->starved = PCC_FALSE;\n"
+                );
+            }
+            if (ctx->opts.profile && ctx->rules.n > 0) {
+                stream__puts(
+                    &sstream,
+                    "    memset(ctx->profile, 0, sizeof(ctx->profile));\n"
+                );
+            }
+            if (ctx->opts.trace) {
+                stream__puts(
+                    &sstream,
+                    "    ctx->trace.p = (pcc_trace_record_t *)PCC_MALLOC(auxil, sizeof(pcc_trace_record_t) * PCC_TRACE_BUFFER_SIZE);\n"
+                    "    ctx->trace.n = 0;\n"
+                );
+            }
+            stream__puts(
+                &sstream,
+                "    pcc_memory_recycler__initialize(auxil, &(ctx->thunk_recycler), sizeof(pcc_thunk_t));\n"
+                "    pcc_memory_recycler__initialize(auxil, &(ctx->thunk_chunk_recycler), sizeof(pcc_thunk_chunk_t));\n"
+                "    pcc_memory_recycler__initialize(auxil, &(ctx->lr_head_recycler), sizeof(pcc_lr_head_t));\n"
+                "    pcc_memory_recycler__initialize(auxil, &(ctx->lr_answer_recycler), sizeof(pcc_lr_answer_t));\n"
+                "    pcc_memory_recycler__initialize(auxil, &(ctx->lr_table_entry_recycler), sizeof(pcc_lr_table_entry_t));\n"
+                "    pcc_memory_recycler__initialize(auxil, &(ctx->lr_entry_recycler), sizeof(pcc_lr_entry_t));\n"
+            );
+            stream__puts(
+                &sstream,
+                ctx->opts.runtime ?
+                    "}\n"
+                    "\n"
+                    "static void pcc_context__finalize(pcc_context_t *ctx) { /* the context is deallocated by the parser */\n" :
+                    "    ctx->auxil = auxil;\n"
+                    "    return ctx;\n"
+                    "}\n"
+                    "\n"
+                    "static void pcc_context__destroy(pcc_context_t *ctx) {\n"
+                    "    if (ctx == NULL) return;\n"
+            );
+            stream__puts(
+                &sstream,
+                "    pcc_char_array__finalize(ctx->auxil, &(ctx->buffer));\n"
+                "    pcc_lr_table__finalize(ctx, &(ctx->lrtable));\n"
+                "    pcc_lr_stack__finalize(ctx->auxil, &(ctx->lrstack));\n"
+                "    pcc_thunk_array__finalize(ctx, &(ctx->thunks));\n"
+                "    pcc_capture__finalize(ctx->auxil, &(ctx->capt0));\n"
+            );
+            if (ctx->mvars.n > 0) {
+                stream__puts(
+                    &sstream,
+                    "    pcc_marker_variable_set_record__finalize(ctx->auxil, &(ctx->mvars));\n"
+                );
+            }
+            if (ctx->opts.trace) {
+                stream__puts(
+                    &sstream,
+                    "    PCC_FREE(ctx->auxil, ctx->trace.p);\n"
+                );
+            }
+            stream__puts(
+                &sstream,
+                "    pcc_memory_recycler__finalize(ctx->auxil, &(ctx->thunk_recycler));\n"
+                "    pcc_memory_recycler__finalize(ctx->auxil, &(ctx->thunk_chunk_recycler));\n"
+                "    pcc_memory_recycler__finalize(ctx->auxil, &(ctx->lr_head_recycler));\n"
+                "    pcc_memory_recycler__finalize(ctx->auxil, &(ctx->lr_answer_recycler));\n"
+                "    pcc_memory_recycler__finalize(ctx->auxil, &(ctx->lr_table_entry_recycler));\n"
+                "    pcc_memory_recycler__finalize(ctx->auxil, &(ctx->lr_entry_recycler));\n"
+            );
+            stream__puts(
+                &sstream,
+                ctx->opts.runtime ?
+                    "}\n"
+                    "\n"
+                    "static void pcc_context__reset(pcc_context_t *ctx) { /* keeps the allocated memory for reuse */\n" :
+                    "    PCC_FREE(ctx->auxil, ctx);\n"
+                    "}\n"
+                    "\n"
+                    "static void pcc_context__reset(pcc_context_t *ctx, pcc_auxil_t auxil) { /* keeps the allocated memory for reuse */\n"
+            );
+            if (ctx->flags & CODE_FLAG_EVALUATION) {
+                stream__puts(
+                    &sstream,
+                    "    pcc_thunk_array__revert(ctx, &(ctx->thunks), 0);\n"
+                );
+            }
+            if (ctx->flags & (CODE_FLAG_EVALUATION | CODE_FLAG_RECOGNITION)) {
+                stream__puts(
+                    &sstream,
+                    "    pcc_lr_table__shift(ctx, &(ctx->lrtable), ctx->lrtable.n);\n"
+                );
+            }
+            stream__puts(
+                &sstream,
+                "    ctx->lrtable.o = 0;\n"
+                "    ctx->lrtable.n = 0;\n"
+                "    ctx->lrstack.n = 0;\n"
+                "    ctx->buffer.n = 0;\n"
+                "    ctx->pos = 0;\n"
+                "    ctx->cur = 0;\n"
+                "    ctx->level = 0;\n"
+            );
+            if (ctx->opts.feed) {
+                stream__puts(
+                    &sstream,
+                    "    ctx->lrtable.starved = NULL;\n"
+                );
+            }
+            if (ctx->mvars.n > 0) {
+                stream__puts(
+                    &sstream,
+                    "    pcc_marker_variable_set_record__finalize(ctx->auxil, &(ctx->mvars));\n"
+                    "    pcc_marker_variable_set_record__initialize(auxil, &(ctx->mvars));\n"
+                );
+            }
+            if (ctx->opts.recog) {
+                stream__puts(
+                    &sstream,
+                    "    ctx->fpos = 0;\n"
+                );
+            }
+            if (ctx->opts.feed) {
+                stream__puts(
+                    &sstream,
+                    "    ctx->eof = PCC_FALSE;\n"
+                );
+            }
+            if (ctx->opts.profile && ctx->rules.n > 0) {
+                stream__puts(
+                    &sstream,
+                    "    memset(ctx->profile, 0, sizeof(ctx->profile));\n"
+                );
+            }
+            if (ctx->opts.trace) {
+                stream__puts(
+                    &sstream,
+                    "    ctx->trace.n = 0;\n"
+                );
+            }
+            stream__puts(
+                &sstream,
+                ctx->opts.runtime ?
+                    "}\n"
+                    "\n" :
+                    "    ctx->auxil = auxil;\n"
+                    "}\n"
+                    "\n"
+            );
+            if (ctx->opts.whole) {
+                stream__puts(
+                    &sstream,
+                    "static void pcc_load_input(pcc_context_t *ctx) {\n"
+                    "    for (;;) {\n"
+                    "        const int c = PCC_GETCHAR(ctx->auxil);\n"
+                    "        if (c < 0) break;\n"
+                    "        pcc_char_array__add(ctx->auxil, &(ctx->buffer), (char)c);\n"
+                    "    }\n"
+                    "    pcc_char_array__add(ctx->auxil, &(ctx->buffer), '\\0'); /* the sentinel */\n"
+                    "    ctx->buffer.n--;\n"
+                    "}\n"
+                    "\n"
+                );
+                if (ctx->opts.runtime) stream__puts(&istream, "MARK_FUNC_AS_USED\n");
+                stream__puts(
+                    ctx->opts.runtime ? &istream : &sstream,
+                    "static size_t pcc_refill_buffer(pcc_context_t *ctx, size_t num) { /* the whole input is already loaded */\n"
+                    "    return ctx->buffer.n - ctx->cur;\n"
+                    "}\n"
+                    "\n"
+                );
+            }
+            else if (ctx->opts.feed) {
+                if (ctx->opts.runtime) stream__puts(&istream, "MARK_FUNC_AS_USED\n");
+                stream__puts(
+                    ctx->opts.runtime ? &istream : &sstream,
+                    "static size_t pcc_refill_buffer(pcc_context_t *ctx, size_t num) { /* the input is fed by the API */\n"
+                    "    if (ctx->buffer.n < ctx->cur + num && !ctx->eof) ctx->starved = PCC_TRUE;\n"
+                    "    return ctx->buffer.n - ctx->cur;\n"
+                    "}\n"
+                    "\n"
+                );
+            }
+            else if (ctx->opts.runtime) { /* only the reading is out of line */
+                stream__puts(
+                    &sstream,
+                    "static size_t pcc_read_input(pcc_context_t *ctx, size_t num) {\n"
+                    "    while (ctx->buffer.n < ctx->cur + num) {\n"
+                    "        const int c = PCC_GETCHAR(ctx->auxil);\n"
+                    "        if (c < 0) break;\n"
+                    "        pcc_char_array__add(ctx->auxil, &(ctx->buffer), (char)c);\n"
+                    "    }\n"
+                    "    return ctx->buffer.n - ctx->cur;\n"
+                    "}\n"
+                    "\n"
+                );
+                stream__puts(
+                    &istream,
+                    "MARK_FUNC_AS_USED\n"
+                    "static size_t pcc_refill_buffer(pcc_context_t *ctx, size_t num) {\n"
+                    "    if (ctx->buffer.n >= ctx->cur + num) return ctx->buffer.n - ctx->cur;\n"
+                    "    return pcc_read_input(ctx, num);\n"
+                    "}\n"
+                    "\n"
+                );
+            }
+            else {
+                stream__puts(
+                    &sstream,
+                    "static size_t pcc_refill_buffer(pcc_context_t *ctx, size_t num) {\n"
+                    "    if (ctx->buffer.n >= ctx->cur + num) return ctx->buffer.n - ctx->cur;\n"
+                    "    while (ctx->buffer.n < ctx->cur + num) {\n"
+                    "        const int c = PCC_GETCHAR(ctx->auxil);\n"
+                    "        if (c < 0) break;\n"
+                    "        pcc_char_array__add(ctx->auxil, &(ctx->buffer), (char)c);\n"
+                    "    }\n"
+                    "    return ctx->buffer.n - ctx->cur;\n"
+                    "}\n"
+                    "\n"
+                );
+            }
+        }
+        if (ctx->flags & (CODE_FLAG_EVALUATION | CODE_FLAG_RECOGNITION)) {
             stream__puts(
                 &sstream,
-                "static pcc_context_t *pcc_context__create(pcc_auxil_t auxil) {\n"
-                "    pcc_context_t *const ctx = (pcc_context_t *)PCC_MALLOC(auxil, sizeof(pcc_context_t));\n"
-                "    ctx->pos = 0;\n"
-                "    ctx->cur = 0;\n"
-                "    ctx->level = 0;\n"
-                "    pcc_char_array__initialize(auxil, &(ctx->buffer));\n"
-                "    pcc_lr_table__initialize(ctx, &(ctx->lrtable));\n"
-                "    pcc_lr_stack__initialize(auxil, &(ctx->lrstack));\n"
-                "    pcc_thunk_array__initialize(ctx, &(ctx->thunks));\n"
-                "    pcc_capture__initialize(ctx->auxil, &(ctx->capt0));\n"
+                "static void pcc_commit_buffer(pcc_context_t *ctx) {\n"
             );
-            if (ctx->mvars.n > 0) {
+            if (ctx->opts.whole) {
                 stream__puts(
                     &sstream,
-                    "    pcc_marker_variable_set_record__initialize(ctx->auxil, &(ctx->mvars));\n"
+                    "    memmove(ctx->buffer.p, ctx->buffer.p + ctx->cur, ctx->buffer.n - ctx->cur + 1); /* with the sentinel */\n"
                 );
             }
-            stream__puts(
-                &sstream,
-                "    pcc_memory_recycler__initialize(auxil, &(ctx->thunk_recycler), sizeof(pcc_thunk_t));\n"
-                "    pcc_memory_recycler__initialize(auxil, &(ctx->thunk_chunk_recycler), sizeof(pcc_thunk_chunk_t));\n"
-                "    pcc_memory_recycler__initialize(auxil, &(ctx->lr_head_recycler), sizeof(pcc_lr_head_t));\n"
-                "    pcc_memory_recycler__initialize(auxil, &(ctx->lr_answer_recycler), sizeof(pcc_lr_answer_t));\n"
-                "    pcc_memory_recycler__initialize(auxil, &(ctx->lr_table_entry_recycler), sizeof(pcc_lr_table_entry_t));\n"
-                "    pcc_memory_recycler__initialize(auxil, &(ctx->lr_entry_recycler), sizeof(pcc_lr_entry_t));\n"
-                "    ctx->auxil = auxil;\n"
-                "    return ctx;\n"
-                "}\n"
-                "\n"
-                "static void pcc_context__destroy(pcc_context_t *ctx) {\n"
-                "    if (ctx == NULL) return;\n"
-                "    pcc_char_array__finalize(ctx->auxil, &(ctx->buffer));\n"
-                "    pcc_lr_table__finalize(ctx, &(ctx->lrtable));\n"
-                "    pcc_lr_stack__finalize(ctx->auxil, &(ctx->lrstack));\n"
-                "    pcc_thunk_array__finalize(ctx, &(ctx->thunks));\n"
-                "    pcc_capture__finalize(ctx->auxil, &(ctx->capt0));\n"
-            );
-            if (ctx->mvars.n > 0) {
+            else {
                 stream__puts(
                     &sstream,
-                    "    pcc_marker_variable_set_record__finalize(ctx->auxil, &(ctx->mvars));\n"
+                    "    if (ctx->cur < ctx->buffer.n)\n"
+                    "        memmove(ctx->buffer.p, ctx->buffer.p + ctx->cur, ctx->buffer.n - ctx->cur);\n"
                 );
             }
             stream__puts(
                 &sstream,
-                "    pcc_memory_recycler__finalize(ctx->auxil, &(ctx->thunk_recycler));\n"
-                "    pcc_memory_recycler__finalize(ctx->auxil, &(ctx->thunk_chunk_recycler));\n"
-                "    pcc_memory_recycler__finalize(ctx->auxil, &(ctx->lr_head_recycler));\n"
-                "    pcc_memory_recycler__finalize(ctx->auxil, &(ctx->lr_answer_recycler));\n"
-                "    pcc_memory_recycler__finalize(ctx->auxil, &(ctx->lr_table_entry_recycler));\n"
-                "    pcc_memory_recycler__finalize(ctx->auxil, &(ctx->lr_entry_recycler));\n"
-                "    PCC_FREE(ctx->auxil, ctx);\n"
-                "}\n"
-                "\n"
-            );
-            stream__puts(
-                &sstream,
-                "static size_t pcc_refill_buffer(pcc_context_t *ctx, size_t num) {\n"
-                "    if (ctx->buffer.n >= ctx->cur + num) return ctx->buffer.n - ctx->cur;\n"
-                "    while (ctx->buffer.n < ctx->cur + num) {\n"
-                "        const int c = PCC_GETCHAR(ctx->auxil);\n"
-                "        if (c < 0) break;\n"
-                "        pcc_char_array__add(ctx->auxil, &(ctx->buffer), (char)c);\n"
-                "    }\n"
-                "    return ctx->buffer.n - ctx->cur;\n"
-                "}\n"
-                "\n"
-            );
-        }
-        if (ctx->rules.n > 0) {
-            stream__puts(
-                &sstream,
-                "static void pcc_commit_buffer(pcc_context_t *ctx) {\n"
-                "    if (ctx->cur < ctx->buffer.n)\n"
-                "        memmove(ctx->buffer.p, ctx->buffer.p + ctx->cur, ctx->buffer.n - ctx->cur);\n"
                 "    ctx->buffer.n -= ctx->cur;\n"
                 "    ctx->pos += ctx->cur;\n"
                 "    pcc_lr_table__shift(ctx, &(ctx->lrtable), ctx->cur);\n"
@@ -7181,6 +11410,30 @@ static bool_t generate(context_t *ctx) {
                 "\n"
             );
         }
+        if (ctx->split) {
+            const node_t *const node = find_split_rule(ctx)->data.rule.expr;
+            const size_t n = (node->type == NODE_ALTERNATE) ? node->data.alternate.nodes.n : 1;
+            stream_t *const stream = ctx->opts.runtime ? &gstream : &sstream;
+            size_t i;
+            stream__printf(
+                stream,
+                "static size_t pcc_match_split_rule(const char *text, size_t len) { /* matches the rule '%s' and returns the matched length */\n",
+                ctx->split
+            );
+            for (i = 0; i < n; i++) {
+                const char_array_t *const v = (node->type == NODE_ALTERNATE) ?
+                    &(node->data.alternate.nodes.p[i]->data.string.value) : &(node->data.string.value);
+                stream__printf(stream, "    if (len >= " FMT_LU " && memcmp(text, \"", (ulong_t)v->n);
+                stream__write_escaped_string(stream, v->p, v->n);
+                stream__printf(stream, "\", " FMT_LU ") == 0) return " FMT_LU ";\n", (ulong_t)v->n, (ulong_t)v->n);
+            }
+            stream__puts(
+                stream,
+                "    return 0;\n"
+                "}\n"
+                "\n"
+            );
+        }
         {
             stream__puts(
                 &sstream,
@@ -7200,48 +11453,84 @@ static bool_t generate(context_t *ctx) {
         if (ctx->flags & CODE_FLAG_UTF8_CHARCLASS) {
             stream__puts(
                 &sstream,
+                "static const unsigned char pcc_utf8_classes[128] = { /* the byte classes of 0x80-0xff for the UTF-8 decoding automaton */\n"
+                "     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,\n"
+                "     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,\n"
+                "     7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,\n"
+                "     7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,\n"
+                "     8,  8,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,\n"
+                "     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,\n"
+                "    10,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  3,  3,\n"
+                "    11,  6,  6,  6,  5,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8\n"
+                "};\n"
+                "\n"
+                "static const unsigned char pcc_utf8_states[108] = { /* the transitions indexed by the sum of a state and a byte class; 0: accepted, 12: rejected */\n"
+                "     0, 12, 24, 36, 60, 96, 84, 12, 12, 12, 48, 72,\n"
+                "    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,\n"
+                "    12,  0, 12, 12, 12, 12, 12,  0, 12,  0, 12, 12,\n"
+                "    12, 24, 12, 12, 12, 12, 12, 24, 12, 24, 12, 12,\n"
+                "    12, 12, 12, 12, 12, 12, 12, 24, 12, 12, 12, 12,\n"
+                "    12, 24, 12, 12, 12, 12, 12, 12, 12, 24, 12, 12,\n"
+                "    12, 12, 12, 12, 12, 12, 12, 36, 12, 36, 12, 12,\n"
+                "    12, 36, 12, 12, 12, 12, 12, 36, 12, 36, 12, 12,\n"
+                "    12, 36, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12\n"
+                "};\n"
+                "\n"
                 "static size_t pcc_get_char_as_utf32(pcc_context_t *ctx, int *out) { /* with checking UTF-8 validity */\n"
-                "    int c, u;\n"
-                "    size_t n, i;\n"
+                "    int c, u, s, k;\n"
+                "    size_t n;\n"
                 "    if (pcc_refill_buffer(ctx, 1) < 1) return 0;\n"
                 "    c = (int)(unsigned char)ctx->buffer.p[ctx->cur];\n"
-                "    n = (c < 0x80) ? 1 :\n"
-                "        ((c & 0xe0) == 0xc0) ? 2 :\n"
-                "        ((c & 0xf0) == 0xe0) ? 3 :\n"
-                "        ((c & 0xf8) == 0xf0) ? 4 :\n"
-                "        ((c & 0xfc) == 0xf8) ? 5 :\n"
-                "        ((c & 0xfe) == 0xfc) ? 6 : 0;\n"
-                "    if (n < 1) return 0;\n"
-                "    if (pcc_refill_buffer(ctx, n) < n) return 0;\n"
-                "    u = (n <= 1) ? c : (c & ((1 << (7 - n)) - 1));\n"
-                "    for (i = 1; i < n; i++) {\n"
-                "        const int d = (int)(unsigned char)ctx->buffer.p[ctx->cur + i];\n"
-                "        if ((d & 0xc0) != 0x80) return 0; /* not a continuation byte */\n"
-                "        u = (u << 6) | (d & 0x3f);\n"
+                "    if (c < 0x80) { /* ASCII */\n"
+                "        if (out) *out = c;\n"
+                "        return 1;\n"
+                "    }\n"
+                "    k = pcc_utf8_classes[c - 0x80];\n"
+                "    s = pcc_utf8_states[k];\n"
+                "    u = c & (0xff >> k);\n"
+                "    for (n = 1; s != 0; n++) {\n"
+                "        if (s == 12 || pcc_refill_buffer(ctx, n + 1) < n + 1) return 0;\n"
+                "        c = (int)(unsigned char)ctx->buffer.p[ctx->cur + n];\n"
+                "        k = (c < 0x80) ? 0 : pcc_utf8_classes[c - 0x80];\n"
+                "        s = pcc_utf8_states[s + k];\n"
+                "        u = (u << 6) | (c & 0x3f);\n"
                 "    }\n"
-                "    if (\n"
-                "        (n == 2 && u < 0x00000080) ||\n"
-                "        (n == 3 && u < 0x00000800) ||\n"
-                "        (n == 4 && u < 0x00010000) ||\n"
-                "        (n == 5 && u < 0x00200000) ||\n"
-                "        (n == 6 && u < 0x04000000)\n"
-                "    ) return 0; /* invalidly encoded */\n"
                 "    if (out) *out = u;\n"
                 "    return n;\n"
                 "}\n"
                 "\n"
             );
         }
-        if (ctx->rules.n > 0) {
+        if (ctx->flags & CODE_FLAG_EVALUATION) {
+            stream__puts(
+                &sstream,
+                ctx->opts.profile ?
+                    "static pcc_bool_t pcc_apply_rule(pcc_context_t *ctx, pcc_rule_t rule, size_t index, pcc_thunk_array_t *thunks, pcc_value_t *value) {\n" :
+                    "static pcc_bool_t pcc_apply_rule(pcc_context_t *ctx, pcc_rule_t rule, pcc_thunk_array_t *thunks, pcc_value_t *value) {\n"
+            );
             stream__puts(
                 &sstream,
-                "static pcc_bool_t pcc_apply_rule(pcc_context_t *ctx, pcc_rule_t rule, pcc_thunk_array_t *thunks, pcc_value_t *value) {\n"
-                "    static pcc_value_t null;\n"
                 "    pcc_thunk_chunk_t *c = NULL;\n"
                 "    const size_t p = ctx->pos + ctx->cur;\n"
                 "    pcc_bool_t b = PCC_TRUE;\n"
                 "    pcc_lr_answer_t *a = pcc_lr_table__get_answer(ctx, &(ctx->lrtable), p, rule);\n"
                 "    pcc_lr_head_t *h = pcc_lr_table__get_head(ctx, &(ctx->lrtable), p);\n"
+            );
+            if (ctx->opts.feed) {
+                stream__puts(
+                    &sstream,
+                    "    const pcc_bool_t s = ctx->starved;\n"
+                );
+            }
+            if (ctx->opts.profile) {
+                stream__puts(
+                    &sstream,
+                    "    pcc_rule_profile_t *const f = &(ctx->profile[index]);\n"
+                    "    f->calls++;\n"
+                );
+            }
+            stream__puts(
+                &sstream,
                 "    if (h != NULL) {\n"
                 "        if (a == NULL && rule != h->rule && pcc_rule_set__index(ctx->auxil, &(h->invol), rule) == PCC_VOID_VALUE) {\n"
                 "            b = PCC_FALSE;\n"
@@ -7250,6 +11539,15 @@ static bool_t generate(context_t *ctx) {
                 "        else if (pcc_rule_set__remove(ctx->auxil, &(h->eval), rule)) {\n"
                 "            b = PCC_FALSE;\n"
                 "            c = rule(ctx);\n"
+            );
+            if (ctx->opts.profile) {
+                stream__puts(
+                    &sstream,
+                    "            f->growths++;\n"
+                );
+            }
+            stream__puts(
+                &sstream,
                 "            a = pcc_lr_answer__create(ctx, PCC_LR_ANSWER_CHUNK, ctx->pos + ctx->cur);\n"
                 "            a->data.chunk = c;\n"
                 "            pcc_lr_table__hold_answer(ctx, &(ctx->lrtable), p, a);\n"
@@ -7257,7 +11555,25 @@ static bool_t generate(context_t *ctx) {
                 "    }\n"
                 "    if (b) {\n"
                 "        if (a != NULL) {\n"
+            );
+            if (ctx->opts.profile) {
+                stream__puts(
+                    &sstream,
+                    "            f->hits++;\n"
+                );
+            }
+            stream__puts(
+                &sstream,
                 "            ctx->cur = a->pos - ctx->pos;\n"
+            );
+            if (ctx->opts.feed) {
+                stream__puts(
+                    &sstream,
+                    "            if (a->starved) ctx->starved = PCC_TRUE;\n"
+                );
+            }
+            stream__puts(
+                &sstream,
                 "            switch (a->type) {\n"
                 "            case PCC_LR_ANSWER_LR:\n"
                 "                if (a->data.lr->head == NULL) {\n"
@@ -7297,9 +11613,39 @@ static bool_t generate(context_t *ctx) {
                 "            a = pcc_lr_answer__create(ctx, PCC_LR_ANSWER_LR, p);\n"
                 "            a->data.lr = e;\n"
                 "            pcc_lr_table__set_answer(ctx, &(ctx->lrtable), p, rule, a);\n"
+            );
+            if (ctx->opts.feed) {
+                stream__puts(
+                    &sstream,
+                    "            ctx->starved = PCC_FALSE; /* to know whether this matching requests the characters not fed yet */\n"
+                );
+            }
+            stream__puts(
+                &sstream,
                 "            c = rule(ctx);\n"
+            );
+            if (ctx->opts.profile) {
+                stream__puts(
+                    &sstream,
+                    "            f->misses++;\n"
+                );
+            }
+            stream__puts(
+                &sstream,
                 "            pcc_lr_stack__pop(ctx->auxil, &(ctx->lrstack));\n"
                 "            a->pos = ctx->pos + ctx->cur;\n"
+            );
+            if (ctx->opts.feed) {
+                stream__puts(
+                    &sstream,
+                    "            if (ctx->starved) {\n"
+                    "                a->starved = PCC_TRUE;\n"
+                    "                pcc_lr_table__mark_starved(ctx, &(ctx->lrtable), p);\n"
+                    "            }\n"
+                );
+            }
+            stream__puts(
+                &sstream,
                 "            if (e->head == NULL) {\n"
                 "                pcc_lr_answer__set_chunk(ctx, a, c);\n"
                 "            }\n"
@@ -7323,6 +11669,15 @@ static bool_t generate(context_t *ctx) {
                 "                            ctx->cur = p - ctx->pos;\n"
                 "                            pcc_rule_set__copy(ctx->auxil, &(h->eval), &(h->invol));\n"
                 "                            c = rule(ctx);\n"
+            );
+            if (ctx->opts.profile) {
+                stream__puts(
+                    &sstream,
+                    "                        f->growths++;\n"
+                );
+            }
+            stream__puts(
+                &sstream,
                 "                            if (c == NULL || ctx->pos + ctx->cur <= a->pos) break;\n"
                 "                            pcc_lr_answer__set_chunk(ctx, a, c);\n"
                 "                            a->pos = ctx->pos + ctx->cur;\n"
@@ -7331,36 +11686,264 @@ static bool_t generate(context_t *ctx) {
                 "                        pcc_lr_table__set_head(ctx, &(ctx->lrtable), p, NULL);\n"
                 "                        ctx->cur = a->pos - ctx->pos;\n"
                 "                        c = a->data.chunk;\n"
+            );
+            if (ctx->opts.feed) {
+                stream__puts(
+                    &sstream,
+                    "                        if (ctx->starved) {\n"
+                    "                            a->starved = PCC_TRUE;\n"
+                    "                            pcc_lr_table__mark_starved(ctx, &(ctx->lrtable), p);\n"
+                    "                        }\n"
+                );
+            }
+            stream__puts(
+                &sstream,
                 "                    }\n"
                 "                }\n"
                 "            }\n"
                 "        }\n"
                 "    }\n"
-                "    if (c == NULL) return PCC_FALSE;\n"
-                "    if (value == NULL) value = &null;\n"
-                "    memset(value, 0, sizeof(pcc_value_t)); /* in case */\n"
-                "    pcc_thunk_array__add(ctx, thunks, pcc_thunk__create_node(ctx, &(c->thunks), value));\n"
+            );
+            if (ctx->opts.feed) {
+                stream__puts(
+                    &sstream,
+                    "    if (s) ctx->starved = PCC_TRUE;\n"
+                );
+            }
+            if (ctx->opts.profile) {
+                stream__puts(
+                    &sstream,
+                    "    if (c == NULL) {\n"
+                    "        f->failures++;\n"
+                    "        return PCC_FALSE;\n"
+                    "    }\n"
+                    "    f->bytes += ctx->pos + ctx->cur - p;\n"
+                );
+            }
+            else {
+                stream__puts(
+                    &sstream,
+                    "    if (c == NULL) return PCC_FALSE;\n"
+                );
+            }
+            stream__printf(
+                &sstream,
+                "%s"
+                "    pcc_thunk_array__add(ctx, thunks, pcc_thunk__create_node(ctx, &(c->thunks), value));\n"
+                "    return PCC_TRUE;\n"
+                "}\n"
+                "\n",
+                ctx->opts.runtime ?
+                    "    if (value == NULL) value = ctx->null;\n"
+                    "    memset(value, 0, PCC_VALUE_SIZE(ctx->auxil)); /* in case */\n" :
+                    "    if (value == NULL) value = &(ctx->null);\n"
+                    "    memset(value, 0, sizeof(pcc_value_t)); /* in case */\n"
+            );
+            stream__puts(
+                &sstream,
+                "static void pcc_do_action(pcc_context_t *ctx, const pcc_thunk_array_t *thunks, pcc_value_t *value) {\n"
+                "    size_t i;\n"
+                "    for (i = 0; i < thunks->n; i++) {\n"
+                "        pcc_thunk_t *const thunk = thunks->p[i];\n"
+                "        switch (thunk->type) {\n"
+                "        case PCC_THUNK_LEAF:\n"
+                "            thunk->data.leaf.action(ctx, thunk, value);\n"
+                "            break;\n"
+                "        case PCC_THUNK_NODE:\n"
+                "            pcc_do_action(ctx, thunk->data.node.thunks, thunk->data.node.value);\n"
+                "            break;\n"
+                "        default: /* unknown */\n"
+                "            break;\n"
+                "        }\n"
+                "    }\n"
+                "}\n"
+                "\n"
+            );
+        }
+        if (ctx->flags & CODE_FLAG_RECOGNITION) {
+            if (ctx->opts.profile) {
+                stream__puts(
+                    &sstream,
+                    "static pcc_bool_t pcc_recognize_rule(pcc_context_t *ctx, pcc_recognizer_t rule, size_t index, size_t cycle) {\n"
+                    "    const size_t p = ctx->pos + ctx->cur;\n"
+                    "    const pcc_recognition_t *const r = pcc_lr_table__get_recognition(ctx, &(ctx->lrtable), p, rule);\n"
+                    "    pcc_rule_profile_t *const f = &(ctx->profile[index]);\n"
+                );
+            }
+            else {
+                stream__puts(
+                    &sstream,
+                    "static pcc_bool_t pcc_recognize_rule(pcc_context_t *ctx, pcc_recognizer_t rule, size_t cycle) {\n"
+                    "    const size_t p = ctx->pos + ctx->cur;\n"
+                    "    const pcc_recognition_t *const r = pcc_lr_table__get_recognition(ctx, &(ctx->lrtable), p, rule);\n"
+                );
+            }
+            if (ctx->opts.feed) {
+                stream__puts(
+                    &sstream,
+                    "    const pcc_bool_t s = ctx->starved;\n"
+                );
+            }
+            stream__puts(
+                &sstream,
+                "    size_t q;\n"
+            );
+            if (ctx->opts.profile) {
+                stream__puts(
+                    &sstream,
+                    "    f->calls++;\n"
+                    "    if (r != NULL) {\n"
+                    "        f->hits++;\n"
+                );
+            }
+            else {
+                stream__puts(
+                    &sstream,
+                    "    if (r != NULL) {\n"
+                );
+            }
+            stream__puts(
+                &sstream,
+                "        q = r->pos;\n"
+            );
+            if (ctx->opts.feed) {
+                stream__puts(
+                    &sstream,
+                    "        if (r->starved) ctx->starved = PCC_TRUE;\n"
+                );
+            }
+            stream__puts(
+                &sstream,
+                "    }\n"
+            );
+            if (ctx->flags & CODE_FLAG_LEFT_RECURSION) {
+                stream__puts(
+                    &sstream,
+                    "    else if (cycle > 0) {\n"
+                    "        /* grows the seed of left recursion until the match stops getting longer */\n"
+                );
+                if (ctx->opts.feed) {
+                    stream__puts(
+                        &sstream,
+                        "        ctx->starved = PCC_FALSE; /* to know whether this matching requests the characters not fed yet */\n"
+                    );
+                }
+                stream__puts(
+                    &sstream,
+                    "        q = PCC_VOID_VALUE;\n"
+                    "        pcc_lr_table__set_recognition(ctx, &(ctx->lrtable), p, rule, q, cycle, PCC_TRUE);\n"
+                    "        for (;;) {\n"
+                    "            ctx->cur = p - ctx->pos;\n"
+                    "            /* the other rules involved in the left recursion are to be re-evaluated with the grown seed */\n"
+                    "            pcc_lr_table__reset_recognitions(ctx, &(ctx->lrtable), p, cycle);\n"
+                );
+                if (ctx->opts.profile) {
+                    stream__puts(
+                        &sstream,
+                        "            if (q == PCC_VOID_VALUE)\n"
+                        "                f->misses++;\n"
+                        "            else\n"
+                        "                f->growths++;\n"
+                    );
+                }
+                stream__puts(
+                    &sstream,
+                    "            if (!rule(ctx)) break;\n"
+                    "            if (q != PCC_VOID_VALUE && ctx->pos + ctx->cur <= q) break;\n"
+                    "            q = ctx->pos + ctx->cur;\n"
+                    "            pcc_lr_table__set_recognition(ctx, &(ctx->lrtable), p, rule, q, cycle, PCC_TRUE);\n"
+                    "        }\n"
+                    "        pcc_lr_table__set_recognition(ctx, &(ctx->lrtable), p, rule, q, cycle, PCC_FALSE);\n"
+                    "    }\n"
+                );
+            }
+            stream__puts(
+                &sstream,
+                "    else {\n"
+            );
+            if (ctx->opts.profile) {
+                stream__puts(
+                    &sstream,
+                    "        f->misses++;\n"
+                );
+            }
+            if (ctx->opts.feed) {
+                stream__puts(
+                    &sstream,
+                    "        ctx->starved = PCC_FALSE; /* to know whether this matching requests the characters not fed yet */\n"
+                );
+            }
+            stream__puts(
+                &sstream,
+                "        q = rule(ctx) ? ctx->pos + ctx->cur : PCC_VOID_VALUE;\n"
+                "        pcc_lr_table__set_recognition(ctx, &(ctx->lrtable), p, rule, q, cycle, PCC_FALSE);\n"
+                "    }\n"
+            );
+            if (ctx->opts.feed) {
+                stream__puts(
+                    &sstream,
+                    "    if (ctx->starved) pcc_lr_table__mark_starved(ctx, &(ctx->lrtable), p);\n"
+                    "    if (s) ctx->starved = PCC_TRUE;\n"
+                );
+            }
+            stream__puts(
+                &sstream,
+                "    if (q == PCC_VOID_VALUE) {\n"
+                "        ctx->cur = p - ctx->pos;\n"
+            );
+            if (ctx->opts.profile) {
+                stream__puts(
+                    &sstream,
+                    "        f->failures++;\n"
+                );
+            }
+            stream__puts(
+                &sstream,
+                "        return PCC_FALSE;\n"
+                "    }\n"
+            );
+            if (ctx->opts.profile) {
+                stream__puts(
+                    &sstream,
+                    "    f->bytes += q - p;\n"
+                );
+            }
+            if (ctx->opts.recog) {
+                stream__puts(
+                    &sstream,
+                    "    if (ctx->fpos < q) ctx->fpos = q;\n"
+                );
+            }
+            stream__puts(
+                &sstream,
+                "    ctx->cur = q - ctx->pos;\n"
                 "    return PCC_TRUE;\n"
                 "}\n"
                 "\n"
             );
+        }
+        if (ctx->opts.runtime) { /* the rest is grammar-specific */
+            stream__export_functions(&sstream, &rhstream, ctx->opts.export_prefix);
+            if (istream.text.n > 0) {
+                stream__putc(&rhstream, '\n');
+                char_array__append(&(rhstream.text), istream.text.p, istream.text.n - 1); /* without the last empty line */
+            }
+            stream__finalize(&istream);
+            stream__puts(
+                &rhstream,
+                "\n"
+                "#endif /* !PCC_INCLUDED_RUNTIME */\n"
+            );
+            rsstream = sstream;
+            sstream = gstream;
+            ctx->flags = flags;
+        }
+        else {
             stream__puts(
                 &sstream,
-                "static void pcc_do_action(pcc_context_t *ctx, const pcc_thunk_array_t *thunks, pcc_value_t *value) {\n"
-                "    size_t i;\n"
-                "    for (i = 0; i < thunks->n; i++) {\n"
-                "        pcc_thunk_t *const thunk = thunks->p[i];\n"
-                "        switch (thunk->type) {\n"
-                "        case PCC_THUNK_LEAF:\n"
-                "            thunk->data.leaf.action(ctx, thunk, value);\n"
-                "            break;\n"
-                "        case PCC_THUNK_NODE:\n"
-                "            pcc_do_action(ctx, thunk->data.node.thunks, thunk->data.node.value);\n"
-                "            break;\n"
-                "        default: /* unknown */\n"
-                "            break;\n"
-                "        }\n"
-                "    }\n"
+                "MARK_FUNC_AS_USED\n"
+                "static pcc_auxil_t pcc_ref_auxil_(pcc_context_t *ctx) {\n"
+                "    return ctx->auxil;\n"
                 "}\n"
                 "\n"
             );
@@ -7368,11 +11951,6 @@ static bool_t generate(context_t *ctx) {
         stream__puts(
             &sstream,
             "MARK_FUNC_AS_USED\n"
-            "static pcc_auxil_t pcc_ref_auxil_(pcc_context_t *ctx) {\n"
-            "    return ctx->auxil;\n"
-            "}\n"
-            "\n"
-            "MARK_FUNC_AS_USED\n"
             "static const char *pcc_ref_capture_0_(pcc_context_t *ctx) {\n"
             "    return pcc_get_capture_string(ctx, &(ctx->capt0));\n"
             "}\n"
@@ -7432,32 +12010,77 @@ static bool_t generate(context_t *ctx) {
             "    return ctx->pos + in->data.leaf.capts.p[index]->range.end;\n"
             "}\n"
             "\n"
-            "MARK_FUNC_AS_USED\n"
-            "static pcc_value_t *pcc_ref_leaf_variable_(pcc_context_t *ctx, pcc_thunk_t *in, size_t index) {\n"
-            "    return in->data.leaf.values.p[index];\n"
-            "}\n"
-            "\n"
         );
+        if (ctx->opts.runtime) {
+            stream__printf(
+                &sstream,
+                "MARK_FUNC_AS_USED\n"
+                "static %s%s*pcc_ref_leaf_variable_(pcc_context_t *ctx, pcc_thunk_t *in, size_t index) {\n"
+                "    return (%s%s*)in->data.leaf.values.p[index];\n"
+                "}\n"
+                "\n",
+                vt, vp ? "" : " ", vt, vp ? "" : " "
+            );
+        }
+        else {
+            stream__puts(
+                &sstream,
+                "MARK_FUNC_AS_USED\n"
+                "static pcc_value_t *pcc_ref_leaf_variable_(pcc_context_t *ctx, pcc_thunk_t *in, size_t index) {\n"
+                "    return in->data.leaf.values.p[index];\n"
+                "}\n"
+                "\n"
+            );
+        }
+        ustreams[0] = &sstream;
+        if (ctx->ppath) { /* the code so far is shared by all the C source files through the private header */
+            size_t u;
+            stream__puts(
+                &sstream,
+                "#ifdef _MSC_VER\n"
+                "#pragma warning(pop)\n"
+                "#elif defined __GNUC__\n"
+                "#pragma GCC diagnostic pop\n"
+                "#endif\n"
+                "\n"
+            );
+            pstream = sstream;
+            stream__initialize(&sstream, ctx->spath, ctx->opts.lines ? 0 : VOID_VALUE);
+            for (u = 1; u < nu; u++) {
+                ustreams[u] = (stream_t *)malloc_e(sizeof(stream_t));
+                stream__initialize(ustreams[u], ctx->upaths.p[u - 1], ctx->opts.lines ? 0 : VOID_VALUE);
+            }
+            for (u = 0; u < nu; u++) {
+                stream__printf(ustreams[u], "/* A parser generated by PackCC %s */\n\n", PACKCC_VERSION);
+                stream__printf(
+                    ustreams[u],
+                    "#include \"%s\"\n"
+                    "\n",
+                    extract_filename(ctx->ppath)
+                );
+            }
+        }
         {
             size_t i, j, k;
             for (i = 0; i < ctx->rules.n; i++) {
                 const node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
+                stream_t *const stream = ustreams[i * nu / ctx->rules.n];
                 for (j = 0; j < rule->preds.n; j++) {
                     const code_block_t *const b = &(rule->preds.p[j]->data.progpred.code);
                     const size_t d = rule->preds.p[j]->data.progpred.index;
                     const node_const_array_t *const c = &(rule->preds.p[j]->data.progpred.capts);
                     stream__printf(
-                        &sstream,
+                        stream,
                         "static void pcc_predicate_%s_" FMT_LU "(%s_context_t *pcc_ctx, pcc_thunk_chunk_t *pcc_in, int *pcc_out) {\n",
                         rule->name, (ulong_t)d, get_prefix(ctx)
                     );
                     stream__puts(
-                        &sstream,
+                        stream,
                         "#define auxil pcc_ref_auxil_(pcc_ctx)\n"
                         "#define " VARNAME_PROGPRED_OUT " (*pcc_out)\n"
                     );
                     stream__puts(
-                        &sstream,
+                        stream,
                         "#define " VARNAME_CAPTURE_PREFIX "0 pcc_ref_capture_0_(pcc_ctx)\n"
                         "#define " VARNAME_CAPTURE_PREFIX "0s pcc_ref_capture_0s_(pcc_ctx)\n"
                         "#define " VARNAME_CAPTURE_PREFIX "0e pcc_ref_capture_0e_(pcc_ctx)\n"
@@ -7466,24 +12089,24 @@ static bool_t generate(context_t *ctx) {
                     while (k < c->n) {
                         assert(c->p[k]->type == NODE_CAPTURE);
                         stream__printf(
-                            &sstream,
+                            stream,
                             "#define " VARNAME_CAPTURE_PREFIX FMT_LU " pcc_ref_capture_(pcc_ctx, pcc_in, " FMT_LU ")\n",
                             (ulong_t)(c->p[k]->data.capture.index + 1), (ulong_t)c->p[k]->data.capture.index
                         );
                         stream__printf(
-                            &sstream,
+                            stream,
                             "#define " VARNAME_CAPTURE_PREFIX FMT_LU "s pcc_ref_capture_s_(pcc_ctx, pcc_in, " FMT_LU ")\n",
                             (ulong_t)(c->p[k]->data.capture.index + 1), (ulong_t)c->p[k]->data.capture.index
                         );
                         stream__printf(
-                            &sstream,
+                            stream,
                             "#define " VARNAME_CAPTURE_PREFIX FMT_LU "e pcc_ref_capture_e_(pcc_ctx, pcc_in, " FMT_LU ")\n",
                             (ulong_t)(c->p[k]->data.capture.index + 1), (ulong_t)c->p[k]->data.capture.index
                         );
                         k++;
                     }
                     stream__write_code_block(
-                        &sstream, b->text, b->len, ctx->opts.ascii, INDENT_UNIT,
+                        stream, b->text, b->len, ctx->opts.ascii, INDENT_UNIT,
                         b->fpos.path, b->fpos.line, b->fpos.col, CODE_BLOCK_KIND_PROGPRED,
                         c, &(ctx->mvars), &(ctx->finfo), &(ctx->subst), &(ctx->errnum)
                     );
@@ -7492,34 +12115,34 @@ static bool_t generate(context_t *ctx) {
                         k--;
                         assert(c->p[k]->type == NODE_CAPTURE);
                         stream__printf(
-                            &sstream,
+                            stream,
                             "#undef " VARNAME_CAPTURE_PREFIX FMT_LU "e\n",
                             (ulong_t)(c->p[k]->data.capture.index + 1)
                         );
                         stream__printf(
-                            &sstream,
+                            stream,
                             "#undef " VARNAME_CAPTURE_PREFIX FMT_LU "s\n",
                             (ulong_t)(c->p[k]->data.capture.index + 1)
                         );
                         stream__printf(
-                            &sstream,
+                            stream,
                             "#undef " VARNAME_CAPTURE_PREFIX FMT_LU "\n",
                             (ulong_t)(c->p[k]->data.capture.index + 1)
                         );
                     }
                     stream__puts(
-                        &sstream,
+                        stream,
                         "#undef " VARNAME_CAPTURE_PREFIX "0e\n"
                         "#undef " VARNAME_CAPTURE_PREFIX "0s\n"
                         "#undef " VARNAME_CAPTURE_PREFIX "0\n"
                     );
                     stream__puts(
-                        &sstream,
+                        stream,
                         "#undef " VARNAME_PROGPRED_OUT "\n"
                         "#undef auxil\n"
                     );
                     stream__puts(
-                        &sstream,
+                        stream,
                         "}\n"
                         "\n"
                     );
@@ -7530,18 +12153,22 @@ static bool_t generate(context_t *ctx) {
             size_t i, j, k;
             for (i = 0; i < ctx->rules.n; i++) {
                 const node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
+                stream_t *const stream = ustreams[i * nu / ctx->rules.n];
                 for (j = 0; j < rule->codes.n; j++) {
                     const code_block_t *b;
                     size_t d;
                     const node_const_array_t *v, *c;
+                    bool_t e;
                     switch (rule->codes.p[j]->type) {
                     case NODE_ACTION:
+                        e = rule->codes.p[j]->data.action.eval;
                         b = &(rule->codes.p[j]->data.action.code);
                         d = rule->codes.p[j]->data.action.index;
                         v = &(rule->codes.p[j]->data.action.rvars);
                         c = &(rule->codes.p[j]->data.action.capts);
                         break;
                     case NODE_ERROR:
+                        e = rule->codes.p[j]->data.error.eval;
                         b = &(rule->codes.p[j]->data.error.code);
                         d = rule->codes.p[j]->data.error.index;
                         v = &(rule->codes.p[j]->data.error.rvars);
@@ -7551,28 +12178,32 @@ static bool_t generate(context_t *ctx) {
                         print_error("Internal error [%d]\n", __LINE__);
                         exit(-1);
                     }
+                    if (!e) continue; /* not called by any code */
                     stream__printf(
-                        &sstream,
+                        stream,
                         "static void pcc_action_%s_" FMT_LU "(%s_context_t *pcc_ctx, pcc_thunk_t *pcc_in, pcc_value_t *pcc_out) {\n",
                         rule->name, (ulong_t)d, get_prefix(ctx)
                     );
                     stream__puts(
-                        &sstream,
+                        stream,
                         "#define auxil pcc_ref_auxil_(pcc_ctx)\n"
-                        "#define " VARNAME_ACTION_OUT " (*pcc_out)\n"
                     );
+                    if (ctx->opts.runtime)
+                        stream__printf(stream, "#define " VARNAME_ACTION_OUT " (*(%s%s*)pcc_out)\n", vt, vp ? "" : " ");
+                    else
+                        stream__puts(stream, "#define " VARNAME_ACTION_OUT " (*pcc_out)\n");
                     k = 0;
                     while (k < v->n) {
                         assert(v->p[k]->type == NODE_REFERENCE);
                         stream__printf(
-                            &sstream,
+                            stream,
                             "#define %s (*pcc_ref_leaf_variable_(pcc_ctx, pcc_in, " FMT_LU "))\n",
                             v->p[k]->data.reference.rvar, (ulong_t)v->p[k]->data.reference.index
                         );
                         k++;
                     }
                     stream__puts(
-                        &sstream,
+                        stream,
                         "#define " VARNAME_CAPTURE_PREFIX "0 pcc_ref_leaf_capture_0_(pcc_ctx, pcc_in)\n"
                         "#define " VARNAME_CAPTURE_PREFIX "0s pcc_ref_leaf_capture_0s_(pcc_ctx, pcc_in)\n"
                         "#define " VARNAME_CAPTURE_PREFIX "0e pcc_ref_leaf_capture_0e_(pcc_ctx, pcc_in)\n"
@@ -7581,24 +12212,24 @@ static bool_t generate(context_t *ctx) {
                     while (k < c->n) {
                         assert(c->p[k]->type == NODE_CAPTURE);
                         stream__printf(
-                            &sstream,
+                            stream,
                             "#define " VARNAME_CAPTURE_PREFIX FMT_LU " pcc_ref_leaf_capture_(pcc_ctx, pcc_in, " FMT_LU ")\n",
                             (ulong_t)(c->p[k]->data.capture.index + 1), (ulong_t)c->p[k]->data.capture.index
                         );
                         stream__printf(
-                            &sstream,
+                            stream,
                             "#define " VARNAME_CAPTURE_PREFIX FMT_LU "s pcc_ref_leaf_capture_s_(pcc_ctx, pcc_in, " FMT_LU ")\n",
                             (ulong_t)(c->p[k]->data.capture.index + 1), (ulong_t)c->p[k]->data.capture.index
                         );
                         stream__printf(
-                            &sstream,
+                            stream,
                             "#define " VARNAME_CAPTURE_PREFIX FMT_LU "e pcc_ref_leaf_capture_e_(pcc_ctx, pcc_in, " FMT_LU ")\n",
                             (ulong_t)(c->p[k]->data.capture.index + 1), (ulong_t)c->p[k]->data.capture.index
                         );
                         k++;
                     }
                     stream__write_code_block(
-                        &sstream, b->text, b->len, ctx->opts.ascii, INDENT_UNIT,
+                        stream, b->text, b->len, ctx->opts.ascii, INDENT_UNIT,
                         b->fpos.path, b->fpos.line, b->fpos.col, CODE_BLOCK_KIND_ACTION,
                         c, &(ctx->mvars), &(ctx->finfo), &(ctx->subst), &(ctx->errnum)
                     );
@@ -7607,194 +12238,1005 @@ static bool_t generate(context_t *ctx) {
                         k--;
                         assert(c->p[k]->type == NODE_CAPTURE);
                         stream__printf(
-                            &sstream,
+                            stream,
                             "#undef " VARNAME_CAPTURE_PREFIX FMT_LU "e\n",
                             (ulong_t)(c->p[k]->data.capture.index + 1)
                         );
                         stream__printf(
-                            &sstream,
+                            stream,
                             "#undef " VARNAME_CAPTURE_PREFIX FMT_LU "s\n",
                             (ulong_t)(c->p[k]->data.capture.index + 1)
                         );
                         stream__printf(
-                            &sstream,
+                            stream,
                             "#undef " VARNAME_CAPTURE_PREFIX FMT_LU "\n",
                             (ulong_t)(c->p[k]->data.capture.index + 1)
                         );
                     }
+                    stream__puts(
+                        stream,
+                        "#undef " VARNAME_CAPTURE_PREFIX "0e\n"
+                        "#undef " VARNAME_CAPTURE_PREFIX "0s\n"
+                        "#undef " VARNAME_CAPTURE_PREFIX "0\n"
+                    );
+                    k = v->n;
+                    while (k > 0) {
+                        k--;
+                        assert(v->p[k]->type == NODE_REFERENCE);
+                        stream__printf(
+                            stream,
+                            "#undef %s\n",
+                            v->p[k]->data.reference.rvar
+                        );
+                    }
+                    stream__puts(
+                        stream,
+                        "#undef " VARNAME_ACTION_OUT "\n"
+                        "#undef auxil\n"
+                    );
+                    stream__puts(
+                        stream,
+                        "}\n"
+                        "\n"
+                    );
+                }
+            }
+        }
+        {
+            const char *const linkage = ctx->ppath ? "" : "static "; /* the rule functions are called across the C source files if split */
+            stream_t *const dstream = ctx->ppath ? &pstream : &sstream;
+            size_t i;
+            if (ctx->ppath && strcmp(get_prefix(ctx), "pcc") != 0) {
+                for (i = 0; i < ctx->rules.n; i++) {
+                    const node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
+                    if (rule->eval) {
+                        stream__printf(
+                            dstream,
+                            "#define pcc_evaluate_rule_%s %s_evaluate_rule_%s\n",
+                            rule->name, get_prefix(ctx), rule->name
+                        );
+                    }
+                    if (rule->recog) {
+                        stream__printf(
+                            dstream,
+                            "#define pcc_recognize_rule_%s %s_recognize_rule_%s\n",
+                            rule->name, get_prefix(ctx), rule->name
+                        );
+                    }
+                }
+                stream__puts(
+                    dstream,
+                    "\n"
+                );
+            }
+            for (i = 0; i < ctx->rules.n; i++) {
+                const node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
+                if (!rule->eval) continue;
+                stream__printf(
+                    dstream,
+                    "%spcc_thunk_chunk_t *pcc_evaluate_rule_%s(pcc_context_t *ctx);\n",
+                    linkage, rule->name
+                );
+            }
+            for (i = 0; i < ctx->rules.n; i++) {
+                const node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
+                if (!rule->recog) continue;
+                stream__printf(
+                    dstream,
+                    "%spcc_bool_t pcc_recognize_rule_%s(pcc_context_t *ctx);\n",
+                    linkage, rule->name
+                );
+            }
+            stream__puts(
+                dstream,
+                "\n"
+            );
+            if ((ctx->opts.profile || ctx->opts.trace) && ctx->rules.n > 0) {
+                stream__printf(
+                    dstream,
+                    "static const char *const pcc_rule_names[" FMT_LU "] = {\n",
+                    (ulong_t)ctx->rules.n
+                );
+                for (i = 0; i < ctx->rules.n; i++) {
+                    stream__printf(
+                        dstream,
+                        "    \"%s\"%s\n",
+                        ctx->rules.p[i]->data.rule.name, (i < ctx->rules.n - 1) ? "," : ""
+                    );
+                }
+                stream__puts(
+                    dstream,
+                    "};\n"
+                    "\n"
+                );
+            }
+            if (ctx->opts.trace && ctx->rules.n > 0) {
+                stream__puts(
+                    dstream,
+                    "static void pcc_trace(pcc_context_t *ctx, size_t rule, int event, size_t pos) {\n"
+                    "    pcc_trace_record_t *const r = &(ctx->trace.p[ctx->trace.n++ % PCC_TRACE_BUFFER_SIZE]);\n"
+                    "    r->pos = ctx->pos + pos;\n"
+                    "    r->rule = (unsigned int)rule;\n"
+                    "    r->level = (unsigned short)((ctx->level < 0xffff) ? ctx->level : 0xffff);\n"
+                    "    r->event = (unsigned char)event;\n"
+                    "}\n"
+                    "\n"
+                );
+            }
+            if (ctx->opts.bytecode) {
+                generate_bytecode_rules(ctx, &sstream, vt, ax);
+            }
+            else {
+                for (i = 0; i < ctx->rules.n; i++) {
+                    code_reach_t r;
+                    generate_t g;
+                    const node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
+                    stream_t *const stream = ustreams[i * nu / ctx->rules.n];
+                    if (!rule->eval) continue;
+                    g.stream = stream;
+                    g.rule = ctx->rules.p[i];
+                    g.label = 0;
+                    g.ascii = ctx->opts.ascii;
+                    g.mvars = (ctx->mvars.n > 0) ? TRUE : FALSE;
+                    g.whole = ctx->opts.whole;
+                    g.profile = ctx->opts.profile;
+                    g.trace = ctx->opts.trace;
+                    g.dfa = ctx->opts.dfa;
+                    g.vtype = ctx->opts.runtime ? vt : NULL;
+                    g.mode = CODE_MODE_NORMAL;
+                    g.bytecode = NULL;
+                    stream__printf(
+                        stream,
+                        "%spcc_thunk_chunk_t *pcc_evaluate_rule_%s(pcc_context_t *ctx) {\n",
+                        linkage, rule->name
+                    );
+                    stream__printf(
+                        stream,
+                        "    pcc_thunk_chunk_t *const chunk = pcc_thunk_chunk__create(ctx);\n"
+                        "    chunk->pos = ctx->cur;\n"
+                        "    PCC_DEBUG(%s, PCC_DBG_EVALUATE, \"%s\", ctx->level, chunk->pos, ctx->buffer.p + chunk->pos, ctx->buffer.n - chunk->pos);\n",
+                        ax, rule->name
+                    );
+                    generate_trace_call(&g, "PCC_DBG_EVALUATE", "chunk->pos");
+                    stream__puts(
+                        stream,
+                        "    ctx->level++;\n"
+                    );
+                    if (rule->capts.n > 0) {
+                        stream__printf(
+                            stream,
+                            "    pcc_capture_table__resize(ctx->auxil, &(chunk->capts), " FMT_LU ");\n",
+                            (ulong_t)rule->capts.n
+                        );
+                    }
+                    if (rule->rvars.n > 0) {
+                        stream__printf(
+                            stream,
+                            "    pcc_value_table__resize(ctx->auxil, &(chunk->values), " FMT_LU ");\n",
+                            (ulong_t)rule->rvars.n
+                        );
+                        stream__puts(
+                            stream,
+                            "    pcc_value_table__clear(ctx->auxil, &(chunk->values));\n"
+                        );
+                    }
+                    r = generate_code(&g, rule->expr, 0, INDENT_UNIT, FALSE);
+                    stream__printf(
+                        stream,
+                        "    ctx->level--;\n"
+                        "    PCC_DEBUG(%s, PCC_DBG_MATCH, \"%s\", ctx->level, chunk->pos, ctx->buffer.p + chunk->pos, ctx->cur - chunk->pos);\n",
+                        ax, rule->name
+                    );
+                    generate_trace_call(&g, "PCC_DBG_MATCH", "chunk->pos");
+                    if (ctx->mvars.n > 0) {
+                        stream__puts(
+                            stream,
+                            "    pcc_marker_variable_set_entry__copy(ctx->auxil, &(chunk->mvars), &(ctx->mvars.curr));\n"
+                        );
+                    }
+                    stream__puts(
+                        stream,
+                        "    return chunk;\n"
+                    );
+                    if (r != CODE_REACH_ALWAYS_SUCCEED) {
+                        stream__printf(
+                            stream,
+                            "L0000:;\n"
+                            "    ctx->level--;\n"
+                            "    PCC_DEBUG(%s, PCC_DBG_NOMATCH, \"%s\", ctx->level, chunk->pos, ctx->buffer.p + chunk->pos, ctx->cur - chunk->pos);\n",
+                            ax, rule->name
+                        );
+                        generate_trace_call(&g, "PCC_DBG_NOMATCH", "chunk->pos");
+                        stream__puts(
+                            stream,
+                            "    pcc_thunk_chunk__destroy(ctx, chunk);\n"
+                            "    return NULL;\n"
+                        );
+                    }
+                    stream__puts(
+                        stream,
+                        "}\n"
+                        "\n"
+                    );
+                }
+                for (i = 0; i < ctx->rules.n; i++) {
+                    code_reach_t r;
+                    generate_t g;
+                    const node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
+                    stream_t *const stream = ustreams[i * nu / ctx->rules.n];
+                    if (!rule->recog) continue;
+                    g.stream = stream;
+                    g.rule = ctx->rules.p[i];
+                    g.label = 0;
+                    g.ascii = ctx->opts.ascii;
+                    g.mvars = FALSE; /* no marker variables are updated in recognition */
+                    g.whole = ctx->opts.whole;
+                    g.profile = ctx->opts.profile;
+                    g.trace = ctx->opts.trace;
+                    g.dfa = ctx->opts.dfa;
+                    g.vtype = ctx->opts.runtime ? vt : NULL;
+                    g.mode = CODE_MODE_RECOGNITION;
+                    g.bytecode = NULL;
+                    stream__printf(
+                        stream,
+                        "%spcc_bool_t pcc_recognize_rule_%s(pcc_context_t *ctx) {\n",
+                        linkage, rule->name
+                    );
+                    stream__printf(
+                        stream,
+                        "    MARK_VAR_AS_USED\n"
+                        "    const size_t pos = ctx->cur;\n"
+                        "    PCC_DEBUG(%s, PCC_DBG_EVALUATE, \"%s\", ctx->level, pos, ctx->buffer.p + pos, ctx->buffer.n - pos);\n",
+                        ax, rule->name
+                    );
+                    generate_trace_call(&g, "PCC_DBG_EVALUATE", "pos");
+                    stream__puts(
+                        stream,
+                        "    ctx->level++;\n"
+                    );
+                    r = generate_code(&g, rule->expr, 0, INDENT_UNIT, FALSE);
+                    stream__printf(
+                        stream,
+                        "    ctx->level--;\n"
+                        "    PCC_DEBUG(%s, PCC_DBG_MATCH, \"%s\", ctx->level, pos, ctx->buffer.p + pos, ctx->cur - pos);\n",
+                        ax, rule->name
+                    );
+                    generate_trace_call(&g, "PCC_DBG_MATCH", "pos");
+                    stream__puts(
+                        stream,
+                        "    return PCC_TRUE;\n"
+                    );
+                    if (r != CODE_REACH_ALWAYS_SUCCEED) {
+                        stream__printf(
+                            stream,
+                            "L0000:;\n"
+                            "    ctx->level--;\n"
+                            "    PCC_DEBUG(%s, PCC_DBG_NOMATCH, \"%s\", ctx->level, pos, ctx->buffer.p + pos, ctx->cur - pos);\n",
+                            ax, rule->name
+                        );
+                        generate_trace_call(&g, "PCC_DBG_NOMATCH", "pos");
+                        stream__puts(
+                            stream,
+                            "    return PCC_FALSE;\n"
+                        );
+                    }
+                    stream__puts(
+                        stream,
+                        "}\n"
+                        "\n"
+                    );
+                }
+            }
+        }
+        stream__printf(
+            &sstream,
+            "%s_context_t *%s_create(%s%sauxil) {\n",
+            get_prefix(ctx), get_prefix(ctx),
+            at, ap ? "" : " "
+        );
+        if (ctx->opts.runtime) {
+            stream__puts(
+                &sstream,
+                "    pcc_parser_context_t *const p = (pcc_parser_context_t *)PCC_MALLOC(auxil, sizeof(pcc_parser_context_t));\n"
+                "    p->auxil = auxil;\n"
+                "    pcc_context__initialize(&(p->base), &pcc_grammar);\n"
+                "    p->base.null = &(p->null);\n"
+                "    return &(p->base);\n"
+                "}\n"
+                "\n"
+            );
+        }
+        else {
+            stream__puts(
+                &sstream,
+                "    return pcc_context__create(auxil);\n"
+                "}\n"
+                "\n"
+            );
+        }
+        if (ctx->opts.feed) {
+            stream__printf(
+                &sstream,
+                "int %s_feed(%s_context_t *ctx, const char *data, size_t len, %s%s*ret) {\n",
+                get_prefix(ctx), get_prefix(ctx),
+                vt, vp ? "" : " "
+            );
+            if (ctx->rules.n > 0) {
+                stream__puts(
+                    &sstream,
+                    "    pcc_bool_t b;\n"
+                );
+            }
+            stream__puts(
+                &sstream,
+                "    if (data) {\n"
+                "        const size_t n = ctx->buffer.n;\n"
+                "        pcc_char_array__resize(ctx->auxil, &(ctx->buffer), n + len);\n"
+                "        if (len > 0) memcpy(ctx->buffer.p + n, data, len);\n"
+                "    }\n"
+                "    else {\n"
+                "        ctx->eof = PCC_TRUE;\n"
+                "    }\n"
+                "    if (pcc_refill_buffer(ctx, 1) < 1) return ctx->eof ? PCC_FEED_END : PCC_FEED_NEED_MORE;\n"
+            );
+            if (ctx->rules.n > 0) {
+                stream__puts(
+                    &sstream,
+                    "    ctx->starved = PCC_FALSE;\n"
+                );
+                if (ctx->opts.recog) {
+                    stream__printf(
+                        &sstream,
+                        "    ctx->fpos = ctx->pos + ctx->cur;\n"
+                        "    b = pcc_recognize_rule(ctx, pcc_recognize_rule_%s, %s" FMT_LU ");\n",
+                        ctx->rules.p[0]->data.rule.name, ctx->opts.profile ? "0, " : "", (ulong_t)ctx->rules.p[0]->data.rule.cycle
+                    );
+                }
+                else {
+                    stream__printf(
+                        &sstream,
+                        "    b = pcc_apply_rule(ctx, pcc_evaluate_rule_%s, %s&(ctx->thunks), ret);\n",
+                        ctx->rules.p[0]->data.rule.name, ctx->opts.profile ? "0, " : ""
+                    );
+                }
+                stream__puts(
+                    &sstream,
+                    "    if (ctx->starved) { /* the result can change with the input not fed yet; reparsed later from the same position */\n"
+                );
+                if (!ctx->opts.recog) {
                     stream__puts(
                         &sstream,
-                        "#undef " VARNAME_CAPTURE_PREFIX "0e\n"
-                        "#undef " VARNAME_CAPTURE_PREFIX "0s\n"
-                        "#undef " VARNAME_CAPTURE_PREFIX "0\n"
+                        "        pcc_thunk_array__revert(ctx, &(ctx->thunks), 0);\n"
                     );
-                    k = v->n;
-                    while (k > 0) {
-                        k--;
-                        assert(v->p[k]->type == NODE_REFERENCE);
-                        stream__printf(
-                            &sstream,
-                            "#undef %s\n",
-                            v->p[k]->data.reference.rvar
-                        );
-                    }
+                }
+                stream__puts(
+                    &sstream,
+                    "        pcc_lr_table__discard_starved(ctx, &(ctx->lrtable));\n"
+                );
+                if (ctx->mvars.n > 0) {
                     stream__puts(
                         &sstream,
-                        "#undef " VARNAME_ACTION_OUT "\n"
-                        "#undef auxil\n"
+                        "        pcc_marker_variable_set_record__restore(ctx->auxil, &(ctx->mvars), ctx->pos);\n"
                     );
-                    stream__puts(
+                }
+                stream__puts(
+                    &sstream,
+                    "        ctx->cur = 0;\n"
+                    "        return PCC_FEED_NEED_MORE;\n"
+                    "    }\n"
+                );
+                if (ctx->opts.recog) {
+                    stream__printf(
                         &sstream,
-                        "}\n"
-                        "\n"
+                        "    if (!b)\n"
+                        "        PCC_ERROR(%s);\n"
+                        "    pcc_commit_buffer(ctx);\n",
+                        ax
+                    );
+                }
+                else {
+                    stream__printf(
+                        &sstream,
+                        "    if (b) {\n"
+                        "        PCC_PHASE(%s, PCC_PHASE_ACTION);\n"
+                        "        pcc_do_action(ctx, &(ctx->thunks), ret);\n"
+                        "        PCC_PHASE(%s, PCC_PHASE_PARSE);\n"
+                        "    }\n"
+                        "    else {\n"
+                        "        PCC_ERROR(%s);\n"
+                        "    }\n"
+                        "    pcc_commit_buffer(ctx);\n"
+                        "    pcc_thunk_array__revert(ctx, &(ctx->thunks), 0);\n",
+                        ax, ax, ax
                     );
                 }
+                stream__puts(
+                    &sstream,
+                    "    return b ? PCC_FEED_DONE : PCC_FEED_ERROR;\n"
+                    "}\n"
+                    "\n"
+                );
             }
-        }
-        {
-            size_t i;
-            for (i = 0; i < ctx->rules.n; i++) {
-                const node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
+            else {
+                stream__puts(
+                    &sstream,
+                    "    return PCC_FEED_DONE;\n"
+                    "}\n"
+                    "\n"
+                );
+            }
+            if (ctx->opts.recog) {
                 stream__printf(
                     &sstream,
-                    "static pcc_thunk_chunk_t *pcc_evaluate_rule_%s(pcc_context_t *ctx);\n",
-                    rule->name
+                    "size_t %s_get_error_position(%s_context_t *ctx) {\n"
+                    "    return ctx->fpos;\n"
+                    "}\n"
+                    "\n",
+                    get_prefix(ctx), get_prefix(ctx)
                 );
             }
-            stream__puts(
+        }
+        else {
+            stream__printf(
                 &sstream,
-                "\n"
+                "int %s_parse(%s_context_t *ctx, %s%s*ret) {\n",
+                get_prefix(ctx), get_prefix(ctx),
+                vt, vp ? "" : " "
             );
-            for (i = 0; i < ctx->rules.n; i++) {
-                code_reach_t r;
-                generate_t g;
-                const node_rule_t *const rule = &(ctx->rules.p[i]->data.rule);
-                g.stream = &sstream;
-                g.rule = ctx->rules.p[i];
-                g.label = 0;
-                g.ascii = ctx->opts.ascii;
-                g.mvars = (ctx->mvars.n > 0) ? TRUE : FALSE;
-                stream__printf(
+            if (ctx->opts.whole) {
+                stream__puts(
                     &sstream,
-                    "static pcc_thunk_chunk_t *pcc_evaluate_rule_%s(pcc_context_t *ctx) {\n",
-                    rule->name
+                    "    pcc_load_input(ctx);\n"
                 );
-                stream__printf(
+            }
+            stream__puts(
+                &sstream,
+                "    if (pcc_refill_buffer(ctx, 1) < 1) return 0;\n"
+            );
+            if (ctx->opts.recog) {
+                stream__puts(
                     &sstream,
-                    "    pcc_thunk_chunk_t *const chunk = pcc_thunk_chunk__create(ctx);\n"
-                    "    chunk->pos = ctx->cur;\n"
-                    "    PCC_DEBUG(ctx->auxil, PCC_DBG_EVALUATE, \"%s\", ctx->level, chunk->pos, ctx->buffer.p + chunk->pos, ctx->buffer.n - chunk->pos);\n"
-                    "    ctx->level++;\n",
-                    rule->name
+                    "    ctx->fpos = ctx->pos + ctx->cur;\n"
                 );
-                if (rule->capts.n > 0) {
+                if (ctx->rules.n > 0) {
                     stream__printf(
                         &sstream,
-                        "    pcc_capture_table__resize(ctx->auxil, &(chunk->capts), " FMT_LU ");\n",
-                        (ulong_t)rule->capts.n
+                        "    if (!pcc_recognize_rule(ctx, pcc_recognize_rule_%s, %s" FMT_LU "))\n"
+                        "        PCC_ERROR(%s);\n"
+                        "    pcc_commit_buffer(ctx);\n",
+                        ctx->rules.p[0]->data.rule.name, ctx->opts.profile ? "0, " : "", (ulong_t)ctx->rules.p[0]->data.rule.cycle, ax
                     );
                 }
-                if (rule->rvars.n > 0) {
+                stream__puts(
+                    &sstream,
+                    "    return 1;\n"
+                    "}\n"
+                    "\n"
+                );
+                stream__printf(
+                    &sstream,
+                    "size_t %s_get_error_position(%s_context_t *ctx) {\n"
+                    "    return ctx->fpos;\n"
+                    "}\n"
+                    "\n",
+                    get_prefix(ctx), get_prefix(ctx)
+                );
+            }
+            else {
+                if (ctx->rules.n > 0) {
                     stream__printf(
                         &sstream,
-                        "    pcc_value_table__resize(ctx->auxil, &(chunk->values), " FMT_LU ");\n",
-                        (ulong_t)rule->rvars.n
+                        "    if (pcc_apply_rule(ctx, pcc_evaluate_rule_%s, %s&(ctx->thunks), ret)) {\n",
+                        ctx->rules.p[0]->data.rule.name, ctx->opts.profile ? "0, " : ""
                     );
-                    stream__puts(
+                    stream__printf(
                         &sstream,
-                        "    pcc_value_table__clear(ctx->auxil, &(chunk->values));\n"
+                        "        PCC_PHASE(%s, PCC_PHASE_ACTION);\n"
+                        "        pcc_do_action(ctx, &(ctx->thunks), ret);\n"
+                        "        PCC_PHASE(%s, PCC_PHASE_PARSE);\n"
+                        "    }\n"
+                        "    else {\n"
+                        "        PCC_ERROR(%s);\n"
+                        "    }\n"
+                        "    pcc_commit_buffer(ctx);\n"
+                        "    pcc_thunk_array__revert(ctx, &(ctx->thunks), 0);\n",
+                        ax, ax, ax
                     );
                 }
-                r = generate_code(&g, rule->expr, 0, INDENT_UNIT, FALSE);
+                stream__puts(
+                    &sstream,
+                    "    return 1;\n"
+                    "}\n"
+                    "\n"
+                );
+            }
+        }
+        if (ctx->opts.memory) {
+            stream__printf(
+                &sstream,
+                "size_t %s_trim(%s_context_t *ctx, size_t keep) {\n"
+                "    size_t n = 0;\n",
+                get_prefix(ctx), get_prefix(ctx)
+            );
+            stream__printf(
+                &sstream,
+                "    if (ctx->buffer.n == 0) {\n"
+                "        pcc_char_array__finalize(ctx->auxil, &(ctx->buffer));\n"
+                "        pcc_char_array__initialize(ctx->auxil, &(ctx->buffer));\n"
+                "    }\n"
+                "    if (ctx->lrtable.n == ctx->lrtable.o) {\n"
+                "        PCC_FREE(%s, ctx->lrtable.p);\n"
+                "        pcc_lr_table__initialize(ctx, &(ctx->lrtable));\n"
+                "    }\n"
+                "    n += pcc_memory_recycler__trim(ctx->auxil, &(ctx->thunk_recycler), (keep > n) ? keep - n : 0);\n"
+                "    n += pcc_memory_recycler__trim(ctx->auxil, &(ctx->thunk_chunk_recycler), (keep > n) ? keep - n : 0);\n"
+                "    n += pcc_memory_recycler__trim(ctx->auxil, &(ctx->lr_head_recycler), (keep > n) ? keep - n : 0);\n"
+                "    n += pcc_memory_recycler__trim(ctx->auxil, &(ctx->lr_answer_recycler), (keep > n) ? keep - n : 0);\n"
+                "    n += pcc_memory_recycler__trim(ctx->auxil, &(ctx->lr_table_entry_recycler), (keep > n) ? keep - n : 0);\n"
+                "    n += pcc_memory_recycler__trim(ctx->auxil, &(ctx->lr_entry_recycler), (keep > n) ? keep - n : 0);\n"
+                "    return n;\n"
+                "}\n"
+                "\n",
+                ax
+            );
+            stream__printf(
+                &sstream,
+                "size_t %s_get_memory_stats(%s_context_t *ctx, %s_memory_stats_t *stats, size_t num) {\n"
+                "    if (num > 0) pcc_memory_recycler__get_stats(&(ctx->thunk_recycler), \"thunk\", &(stats[0]));\n"
+                "    if (num > 1) pcc_memory_recycler__get_stats(&(ctx->thunk_chunk_recycler), \"thunk_chunk\", &(stats[1]));\n"
+                "    if (num > 2) pcc_memory_recycler__get_stats(&(ctx->lr_head_recycler), \"lr_head\", &(stats[2]));\n"
+                "    if (num > 3) pcc_memory_recycler__get_stats(&(ctx->lr_answer_recycler), \"lr_answer\", &(stats[3]));\n"
+                "    if (num > 4) pcc_memory_recycler__get_stats(&(ctx->lr_table_entry_recycler), \"lr_table_entry\", &(stats[4]));\n"
+                "    if (num > 5) pcc_memory_recycler__get_stats(&(ctx->lr_entry_recycler), \"lr_entry\", &(stats[5]));\n"
+                "    return 6;\n"
+                "}\n"
+                "\n",
+                get_prefix(ctx), get_prefix(ctx), get_prefix(ctx)
+            );
+        }
+        if (ctx->opts.profile) {
+            size_t w = 4; /* the length of "rule" */
+            size_t i;
+            for (i = 0; i < ctx->rules.n; i++) {
+                const size_t l = strlen(ctx->rules.p[i]->data.rule.name);
+                if (w < l) w = l;
+            }
+            stream__printf(
+                &sstream,
+                "void %s_print_profile(%s_context_t *ctx, FILE *stream, int csv) {\n",
+                get_prefix(ctx), get_prefix(ctx)
+            );
+            if (ctx->rules.n > 0) {
+                stream__puts(
+                    &sstream,
+                    "    size_t i;\n"
+                );
+            }
+            stream__printf(
+                &sstream,
+                "    if (csv)\n"
+                "        fprintf(stream, \"rule,calls,hits,misses,failures,bytes,growths,thunks\\n\");\n"
+                "    else\n"
+                "        fprintf(stream, \"%%-" FMT_LU "s %%10s %%10s %%10s %%10s %%12s %%10s %%10s\\n\", "
+                "\"rule\", \"calls\", \"hits\", \"misses\", \"failures\", \"bytes\", \"growths\", \"thunks\");\n",
+                (ulong_t)w
+            );
+            if (ctx->rules.n > 0) {
+                stream__printf(
+                    &sstream,
+                    "    for (i = 0; i < " FMT_LU "; i++) {\n"
+                    "        const pcc_rule_profile_t *const f = &(ctx->profile[i]);\n"
+                    "        fprintf(\n"
+                    "            stream, csv ? \"%%s,%%lu,%%lu,%%lu,%%lu,%%lu,%%lu,%%lu\\n\" : \"%%-" FMT_LU "s %%10lu %%10lu %%10lu %%10lu %%12lu %%10lu %%10lu\\n\",\n"
+                    "            pcc_rule_names[i], (unsigned long)f->calls, (unsigned long)f->hits, (unsigned long)f->misses, (unsigned long)f->failures,\n"
+                    "            (unsigned long)f->bytes, (unsigned long)f->growths, (unsigned long)f->thunks\n"
+                    "        );\n"
+                    "    }\n",
+                    (ulong_t)ctx->rules.n, (ulong_t)w
+                );
+            }
+            stream__puts(
+                &sstream,
+                "}\n"
+                "\n"
+            );
+        }
+        if (ctx->opts.trace) {
+            stream__puts(
+                &sstream,
+                "static void pcc_trace__write_number(FILE *stream, size_t value, size_t size) {\n"
+                "    unsigned char b[8] = { 0 };\n"
+                "    size_t i;\n"
+                "    for (i = 0; i < size; i++) { /* in little endian */\n"
+                "        b[i] = (unsigned char)(value & 0xff);\n"
+                "        value >>= 8;\n"
+                "    }\n"
+                "    fwrite(b, 1, size, stream);\n"
+                "}\n"
+                "\n"
+            );
+            stream__printf(
+                &sstream,
+                "size_t %s_write_trace(%s_context_t *ctx, FILE *stream) {\n"
+                "    const size_t n = (ctx->trace.n < PCC_TRACE_BUFFER_SIZE) ? ctx->trace.n : PCC_TRACE_BUFFER_SIZE;\n"
+                "    size_t i;\n"
+                "    fwrite(\"PCCTRACE\", 1, 8, stream);\n"
+                "    pcc_trace__write_number(stream, 1, 4); /* the format version */\n"
+                "    pcc_trace__write_number(stream, " FMT_LU ", 4); /* the number of the rules */\n"
+                "    pcc_trace__write_number(stream, n, 8); /* the number of the records */\n"
+                "    pcc_trace__write_number(stream, ctx->trace.n - n, 8); /* the number of the overwritten records */\n",
+                get_prefix(ctx), get_prefix(ctx),
+                (ulong_t)ctx->rules.n
+            );
+            if (ctx->rules.n > 0) {
+                stream__printf(
+                    &sstream,
+                    "    for (i = 0; i < " FMT_LU "; i++) {\n"
+                    "        const size_t l = strlen(pcc_rule_names[i]);\n"
+                    "        pcc_trace__write_number(stream, l, 4);\n"
+                    "        fwrite(pcc_rule_names[i], 1, l, stream);\n"
+                    "    }\n",
+                    (ulong_t)ctx->rules.n
+                );
+            }
+            stream__puts(
+                &sstream,
+                "    for (i = ctx->trace.n - n; i < ctx->trace.n; i++) { /* from the oldest record */\n"
+                "        const pcc_trace_record_t *const r = &(ctx->trace.p[i % PCC_TRACE_BUFFER_SIZE]);\n"
+                "        pcc_trace__write_number(stream, r->pos, 8);\n"
+                "        pcc_trace__write_number(stream, r->rule, 4);\n"
+                "        pcc_trace__write_number(stream, r->level, 2);\n"
+                "        pcc_trace__write_number(stream, r->event, 1);\n"
+                "        pcc_trace__write_number(stream, 0, 1); /* reserved */\n"
+                "    }\n"
+                "    return ferror(stream) ? 0 : n;\n"
+                "}\n"
+                "\n"
+            );
+        }
+        if (ctx->split) {
+            stream__printf(
+                &sstream,
+                "size_t %s_split(const char *text, size_t len, size_t *offsets, size_t num) {\n"
+                "    size_t n = 0, k = 0;\n"
+                "    while (n < num && k < len) {\n"
+                "        size_t i = len / num * (n + 1); /* the position to start searching for the end of the segment */\n"
+                "        offsets[n++] = k;\n"
+                "        if (i < k) i = k;\n"
+                "        for (; i < len; i++) {\n"
+                "            const size_t l = pcc_match_split_rule(text + i, len - i);\n"
+                "            if (l > 0) {\n"
+                "                i += l;\n"
+                "                break;\n"
+                "            }\n"
+                "        }\n"
+                "        k = i;\n"
+                "    }\n"
+                "    return n;\n"
+                "}\n"
+                "\n",
+                get_prefix(ctx)
+            );
+            stream__printf(
+                &sstream,
+                "typedef struct pcc_split_segment_tag {\n"
+                "    %s%sauxil;\n"
+                "    const char *text;\n"
+                "    size_t len;\n",
+                at, ap ? "" : " "
+            );
+            if (!ctx->opts.recog) {
+                stream__printf(
+                    &sstream,
+                    "    %s%s*values; /* the values of the matches */\n"
+                    "    size_t m; /* the capacity of the values */\n",
+                    vt, vp ? "" : " "
+                );
+            }
+            stream__puts(
+                &sstream,
+                "    size_t n; /* the number of the matches */\n"
+                "    size_t pos; /* the end position of the last match */\n"
+                "    int done; /* nonzero if the whole segment has matched */\n"
+                "} pcc_split_segment_t;\n"
+                "\n"
+            );
+            stream__printf(
+                &sstream,
+                "static %s_context_t *pcc_split__create(%s%sauxil, const char *text, size_t len) {\n"
+                "    %s_context_t *const ctx = %s_create(auxil);\n",
+                get_prefix(ctx), at, ap ? "" : " ",
+                get_prefix(ctx), get_prefix(ctx)
+            );
+            if (ctx->opts.feed) {
+                stream__puts(
+                    &sstream,
+                    "    pcc_char_array__resize(ctx->auxil, &(ctx->buffer), len);\n"
+                    "    if (len > 0) memcpy(ctx->buffer.p, text, len);\n"
+                    "    ctx->eof = PCC_TRUE;\n"
+                );
+            }
+            else {
+                stream__puts(
+                    &sstream,
+                    "    (void)text;\n"
+                    "    (void)len;\n"
+                );
+            }
+            stream__puts(
+                &sstream,
+                "    return ctx;\n"
+                "}\n"
+                "\n"
+            );
+            if (ctx->opts.recog) {
+                stream__printf(
+                    &sstream,
+                    "static int pcc_split__parse(%s_context_t *ctx) { /* returns 1 if matched, 0 at the end of the input, or -1 if not matched */\n",
+                    get_prefix(ctx)
+                );
+            }
+            else {
+                stream__printf(
+                    &sstream,
+                    "static int pcc_split__parse(%s_context_t *ctx, %s%s*ret) { /* returns 1 if matched, 0 at the end of the input, or -1 if not matched */\n",
+                    get_prefix(ctx), vt, vp ? "" : " "
+                );
+            }
+            stream__puts(
+                &sstream,
+                "    const size_t p = ctx->pos;\n"
+            );
+            if (ctx->opts.whole) {
+                stream__puts(
+                    &sstream,
+                    "    pcc_load_input(ctx);\n"
+                );
+            }
+            stream__puts(
+                &sstream,
+                "    if (pcc_refill_buffer(ctx, 1) < 1) return 0;\n"
+            );
+            if (ctx->opts.recog) {
+                stream__printf(
+                    &sstream,
+                    "    ctx->fpos = ctx->pos + ctx->cur;\n"
+                    "    if (!pcc_recognize_rule(ctx, pcc_recognize_rule_%s, %s" FMT_LU ")) return -1;\n"
+                    "    pcc_commit_buffer(ctx);\n",
+                    ctx->rules.p[0]->data.rule.name, ctx->opts.profile ? "0, " : "", (ulong_t)ctx->rules.p[0]->data.rule.cycle
+                );
+            }
+            else {
+                stream__printf(
+                    &sstream,
+                    "    if (!pcc_apply_rule(ctx, pcc_evaluate_rule_%s, %s&(ctx->thunks), ret)) return -1;\n"
+                    "    PCC_PHASE(%s, PCC_PHASE_ACTION);\n"
+                    "    pcc_do_action(ctx, &(ctx->thunks), ret);\n"
+                    "    PCC_PHASE(%s, PCC_PHASE_PARSE);\n"
+                    "    pcc_commit_buffer(ctx);\n"
+                    "    pcc_thunk_array__revert(ctx, &(ctx->thunks), 0);\n",
+                    ctx->rules.p[0]->data.rule.name, ctx->opts.profile ? "0, " : "", ax, ax
+                );
+            }
+            stream__puts(
+                &sstream,
+                "    return (ctx->pos > p) ? 1 : -1; /* an empty match cannot make progress */\n"
+                "}\n"
+                "\n"
+            );
+            stream__printf(
+                &sstream,
+                "static void pcc_split__run(void *arg) { /* parses a segment speculatively */\n"
+                "    pcc_split_segment_t *const s = (pcc_split_segment_t *)arg;\n"
+                "    %s_context_t *const ctx = pcc_split__create(s->auxil, s->text, s->len);\n",
+                get_prefix(ctx)
+            );
+            if (ctx->opts.recog) {
+                stream__puts(
+                    &sstream,
+                    "    int r;\n"
+                    "    while ((r = pcc_split__parse(ctx)) > 0) {\n"
+                    "        s->n++;\n"
+                    "        s->pos = ctx->pos;\n"
+                    "    }\n"
+                );
+            }
+            else {
+                stream__printf(
+                    &sstream,
+                    "    %s%sv;\n"
+                    "    int r;\n"
+                    "    while ((r = pcc_split__parse(ctx, &v)) > 0) {\n"
+                    "        if (s->n >= s->m) {\n"
+                    "            s->m = (s->m > 0) ? s->m << 1 : PCC_ARRAY_MIN_SIZE;\n"
+                    "            s->values = (%s%s*)PCC_REALLOC(s->auxil, s->values, sizeof(%s) * s->m);\n"
+                    "        }\n"
+                    "        s->values[s->n++] = v;\n"
+                    "        s->pos = ctx->pos;\n"
+                    "    }\n",
+                    vt, vp ? "" : " ",
+                    vt, vp ? "" : " ", vt
+                );
+            }
+            stream__printf(
+                &sstream,
+                "    s->done = (r == 0);\n"
+                "    %s_destroy(ctx);\n"
+                "}\n"
+                "\n",
+                get_prefix(ctx)
+            );
+            stream__printf(
+                &sstream,
+                "static int pcc_split__reparse(const %s_split_driver_t *driver, %s%sauxil, const char *text, size_t len, const size_t *offsets, size_t n, size_t *k, size_t *i) {\n"
+                "    /* parses sequentially from the position *k until a match ends at one of the segment boundaries */\n"
+                "    %s_context_t *const ctx = pcc_split__create(auxil, text + *k, len - *k);\n"
+                "    const size_t p = *k;\n",
+                get_prefix(ctx), at, ap ? "" : " ",
+                get_prefix(ctx)
+            );
+            if (!ctx->opts.recog) {
                 stream__printf(
                     &sstream,
-                    "    ctx->level--;\n"
-                    "    PCC_DEBUG(ctx->auxil, PCC_DBG_MATCH, \"%s\", ctx->level, chunk->pos, ctx->buffer.p + chunk->pos, ctx->cur - chunk->pos);\n",
-                    rule->name
+                    "    %s%sv;\n",
+                    vt, vp ? "" : " "
                 );
-                if (ctx->mvars.n > 0) {
-                    stream__puts(
-                        &sstream,
-                        "    pcc_marker_variable_set_entry__copy(ctx->auxil, &(chunk->mvars), &(ctx->mvars.curr));\n"
-                    );
-                }
+            }
+            stream__printf(
+                &sstream,
+                "    int r;\n"
+                "    while ((r = pcc_split__parse(ctx%s)) > 0) {\n"
+                "        driver->accept(driver->data, %s);\n"
+                "        *k = p + ctx->pos;\n"
+                "        while (*i < n && offsets[*i] < *k) (*i)++;\n"
+                "        if (*i < n && offsets[*i] == *k) break; /* the segment from here has been parsed from a right position */\n"
+                "    }\n"
+                "    if (r < 0) PCC_ERROR(auxil);\n"
+                "    %s_destroy(ctx);\n"
+                "    return (r >= 0) ? 1 : 0;\n"
+                "}\n"
+                "\n",
+                ctx->opts.recog ? "" : ", &v", ctx->opts.recog ? "NULL" : "&v",
+                get_prefix(ctx)
+            );
+            stream__printf(
+                &sstream,
+                "int %s_parse_split(const %s_split_driver_t *driver, const char *text, size_t len, size_t num) {\n"
+                "    %s%sconst auxil = driver->open(driver->data, text, len);\n"
+                "    size_t *const offsets = (size_t *)PCC_MALLOC(auxil, sizeof(size_t) * (num + 1));\n"
+                "    pcc_split_segment_t *const s = (pcc_split_segment_t *)PCC_MALLOC(auxil, sizeof(pcc_split_segment_t) * (num + 1));\n"
+                "    void **const a = (void **)PCC_MALLOC(auxil, sizeof(void *) * (num + 1));\n"
+                "    size_t n = (driver->run && num > 1) ? %s_split(text, len, offsets, num) : 0;\n"
+                "    size_t i, k = 0;\n"
+                "    int b = 1;\n"
+                "    if (n > 1) {\n"
+                "        for (i = 0; i < n; i++) {\n"
+                "            s[i].text = text + offsets[i];\n"
+                "            s[i].len = ((i + 1 < n) ? offsets[i + 1] : len) - offsets[i];\n"
+                "            s[i].auxil = driver->open(driver->data, s[i].text, s[i].len);\n",
+                get_prefix(ctx), get_prefix(ctx),
+                at, ap ? "" : " ",
+                get_prefix(ctx)
+            );
+            if (!ctx->opts.recog) {
                 stream__puts(
                     &sstream,
-                    "    return chunk;\n"
+                    "            s[i].values = NULL;\n"
+                    "            s[i].m = 0;\n"
                 );
-                if (r != CODE_REACH_ALWAYS_SUCCEED) {
-                    stream__printf(
-                        &sstream,
-                        "L0000:;\n"
-                        "    ctx->level--;\n"
-                        "    PCC_DEBUG(ctx->auxil, PCC_DBG_NOMATCH, \"%s\", ctx->level, chunk->pos, ctx->buffer.p + chunk->pos, ctx->cur - chunk->pos);\n"
-                        "    pcc_thunk_chunk__destroy(ctx, chunk);\n"
-                        "    return NULL;\n",
-                        rule->name
-                    );
-                }
+            }
+            stream__puts(
+                &sstream,
+                "            s[i].n = 0;\n"
+                "            s[i].pos = 0;\n"
+                "            s[i].done = 0;\n"
+                "            a[i] = &(s[i]);\n"
+                "        }\n"
+                "        driver->run(driver->data, pcc_split__run, a, n);\n"
+                "    }\n"
+                "    else {\n"
+                "        n = 0;\n"
+                "    }\n"
+                "    i = 0;\n"
+                "    while (b && k < len) { /* merges the results in order */\n"
+                "        if (i < n && offsets[i] == k) {\n"
+                "            const pcc_split_segment_t *const t = &(s[i++]);\n"
+                "            size_t j;\n"
+                "            for (j = 0; j < t->n; j++) {\n"
+            );
+            stream__printf(
+                &sstream,
+                "                driver->accept(driver->data, %s);\n",
+                ctx->opts.recog ? "NULL" : "&(t->values[j])"
+            );
+            stream__puts(
+                &sstream,
+                "            }\n"
+                "            k += t->pos;\n"
+                "            if (t->done) continue;\n"
+                "        }\n"
+                "        if (k > 0) { /* falls back to the sequential parsing from the last match */\n"
+            );
+            stream__printf(
+                &sstream,
+                "            %s%sconst r = driver->open(driver->data, text + k, len - k);\n"
+                "            b = pcc_split__reparse(driver, r, text, len, offsets, n, &k, &i);\n"
+                "            driver->close(driver->data, r);\n"
+                "        }\n"
+                "        else {\n"
+                "            b = pcc_split__reparse(driver, auxil, text, len, offsets, n, &k, &i);\n"
+                "        }\n"
+                "    }\n"
+                "    for (i = 0; i < n; i++) {\n",
+                at, ap ? "" : " "
+            );
+            if (!ctx->opts.recog) {
                 stream__puts(
                     &sstream,
-                    "}\n"
-                    "\n"
+                    "        PCC_FREE(s[i].auxil, s[i].values);\n"
                 );
             }
+            stream__puts(
+                &sstream,
+                "        driver->close(driver->data, s[i].auxil);\n"
+                "    }\n"
+                "    PCC_FREE(auxil, a);\n"
+                "    PCC_FREE(auxil, s);\n"
+                "    PCC_FREE(auxil, offsets);\n"
+                "    driver->close(driver->data, auxil);\n"
+                "    return b;\n"
+                "}\n"
+                "\n"
+            );
         }
         stream__printf(
             &sstream,
-            "%s_context_t *%s_create(%s%sauxil) {\n",
+            "void %s_reset(%s_context_t *ctx, %s%sauxil) {\n",
             get_prefix(ctx), get_prefix(ctx),
             at, ap ? "" : " "
         );
         stream__puts(
             &sstream,
-            "    return pcc_context__create(auxil);\n"
-            "}\n"
-            "\n"
+            ctx->opts.runtime ?
+                "    pcc_context__reset(ctx);\n"
+                "    ((pcc_parser_context_t *)ctx)->auxil = auxil;\n"
+                "}\n"
+                "\n" :
+                "    pcc_context__reset(ctx, auxil);\n"
+                "}\n"
+                "\n"
         );
         stream__printf(
             &sstream,
-            "int %s_parse(%s_context_t *ctx, %s%s*ret) {\n",
-            get_prefix(ctx), get_prefix(ctx),
-            vt, vp ? "" : " "
+            "void %s_destroy(%s_context_t *ctx) {\n",
+            get_prefix(ctx), get_prefix(ctx)
         );
-        stream__printf(
+        stream__puts(
             &sstream,
-            "    if (pcc_refill_buffer(ctx, 1) < 1) return 0;\n"
+            ctx->opts.runtime ?
+                "    if (ctx == NULL) return;\n"
+                "    pcc_context__finalize(ctx);\n"
+                "    PCC_FREE(pcc_ref_auxil_(ctx), ctx);\n"
+                "}\n" :
+                "    pcc_context__destroy(ctx);\n"
+                "}\n"
         );
-        if (ctx->rules.n > 0) {
-            stream__printf(
-                &sstream,
-                "    if (pcc_apply_rule(ctx, pcc_evaluate_rule_%s, &(ctx->thunks), ret))\n",
-                ctx->rules.p[0]->data.rule.name
-            );
+    }
+    {
+        stream__puts(
+            &hstream,
+            "#include <stddef.h> /* for size_t */\n"
+        );
+        if (ctx->opts.profile || ctx->opts.trace) {
             stream__puts(
-                &sstream,
-                "        pcc_do_action(ctx, &(ctx->thunks), ret);\n"
-                "    else\n"
-                "        PCC_ERROR(ctx->auxil);\n"
-                "    pcc_commit_buffer(ctx);\n"
+                &hstream,
+                "#include <stdio.h> /* for FILE */\n"
             );
         }
         stream__puts(
-            &sstream,
-            "    pcc_thunk_array__revert(ctx, &(ctx->thunks), 0);\n"
-            "    return 1;\n"
-            "}\n"
+            &hstream,
             "\n"
         );
-        stream__printf(
-            &sstream,
-            "void %s_destroy(%s_context_t *ctx) {\n",
-            get_prefix(ctx), get_prefix(ctx)
-        );
-        stream__puts(
-            &sstream,
-            "    pcc_context__destroy(ctx);\n"
-            "}\n"
-        );
-    }
-    {
         stream__puts(
             &hstream,
             "#ifdef __cplusplus\n"
@@ -7802,23 +13244,133 @@ static bool_t generate(context_t *ctx) {
             "#endif\n"
             "\n"
         );
-        stream__printf(
-            &hstream,
-            "typedef struct %s_context_tag %s_context_t;\n"
-            "\n",
-            get_prefix(ctx), get_prefix(ctx)
-        );
+        if (ctx->opts.runtime && strcmp(get_prefix(ctx), "pcc") == 0) {
+            stream__puts(
+                &hstream,
+                "#ifndef PCC_CONTEXT_T_DEFINED\n"
+                "#define PCC_CONTEXT_T_DEFINED\n"
+                "typedef struct pcc_context_tag pcc_context_t;\n"
+                "#endif /* !PCC_CONTEXT_T_DEFINED */\n"
+                "\n"
+            );
+        }
+        else {
+            stream__printf(
+                &hstream,
+                "typedef struct %s_context_tag %s_context_t;\n"
+                "\n",
+                ctx->opts.runtime ? "pcc" : get_prefix(ctx), get_prefix(ctx)
+            );
+        }
+        if (ctx->opts.memory) {
+            stream__printf(
+                &hstream,
+                "typedef struct %s_memory_stats_tag {\n"
+                "    const char *name; /* the name of the memory recycler */\n"
+                "    size_t pools; /* the number of the memory pools allocated */\n"
+                "    size_t bytes; /* the total size of the memory pools in bytes */\n"
+                "    size_t live;  /* the number of the elements in use */\n"
+                "    size_t idle;  /* the number of the elements in the free list */\n"
+                "    size_t peak;  /* the maximum number of the elements in use at a time; counted only if PCC_ALLOC_STATS is defined */\n"
+                "} %s_memory_stats_t;\n"
+                "\n",
+                get_prefix(ctx), get_prefix(ctx)
+            );
+        }
+        if (ctx->split) {
+            stream__printf(
+                &hstream,
+                "typedef struct %s_split_driver_tag {\n"
+                "    %s%s(*open)(void *data, const char *text, size_t len); /* returns the auxiliary data to read the text */\n"
+                "    void (*close)(void *data, %s%sauxil); /* releases the auxiliary data */\n"
+                "    void (*accept)(void *data, %s%s*value); /* receives the value of every match in order */\n"
+                "    void (*run)(void *data, void (*job)(void *), void **args, size_t num); /* calls job(args[i]) for each i, concurrently if possible */\n"
+                "    void *data; /* the user-defined data passed to the functions above */\n"
+                "} %s_split_driver_t;\n"
+                "\n",
+                get_prefix(ctx),
+                at, ap ? "" : " ",
+                at, ap ? "" : " ",
+                vt, vp ? "" : " ",
+                get_prefix(ctx)
+            );
+        }
+        if (ctx->opts.feed) {
+            stream__puts(
+                &hstream,
+                "#ifndef PCC_FEED_END\n"
+                "#define PCC_FEED_END 0       /* no input text is left to be parsed */\n"
+                "#define PCC_FEED_DONE 1      /* the input text has matched the start rule */\n"
+                "#define PCC_FEED_NEED_MORE 2 /* more input text needs to be fed */\n"
+                "#define PCC_FEED_ERROR 3     /* the input text has not matched the start rule */\n"
+                "#endif\n"
+                "\n"
+            );
+        }
         stream__printf(
             &hstream,
             "%s_context_t *%s_create(%s%sauxil);\n",
             get_prefix(ctx), get_prefix(ctx),
             at, ap ? "" : " "
         );
+        if (ctx->opts.feed) {
+            stream__printf(
+                &hstream,
+                "int %s_feed(%s_context_t *ctx, const char *data, size_t len, %s%s*ret);\n",
+                get_prefix(ctx), get_prefix(ctx),
+                vt, vp ? "" : " "
+            );
+        }
+        else {
+            stream__printf(
+                &hstream,
+                "int %s_parse(%s_context_t *ctx, %s%s*ret);\n",
+                get_prefix(ctx), get_prefix(ctx),
+                vt, vp ? "" : " "
+            );
+        }
+        if (ctx->opts.recog) {
+            stream__printf(
+                &hstream,
+                "size_t %s_get_error_position(%s_context_t *ctx);\n",
+                get_prefix(ctx), get_prefix(ctx)
+            );
+        }
+        if (ctx->opts.memory) {
+            stream__printf(
+                &hstream,
+                "size_t %s_trim(%s_context_t *ctx, size_t keep);\n"
+                "size_t %s_get_memory_stats(%s_context_t *ctx, %s_memory_stats_t *stats, size_t num);\n",
+                get_prefix(ctx), get_prefix(ctx), get_prefix(ctx), get_prefix(ctx), get_prefix(ctx)
+            );
+        }
+        if (ctx->opts.profile) {
+            stream__printf(
+                &hstream,
+                "void %s_print_profile(%s_context_t *ctx, FILE *stream, int csv);\n",
+                get_prefix(ctx), get_prefix(ctx)
+            );
+        }
+        if (ctx->opts.trace) {
+            stream__printf(
+                &hstream,
+                "size_t %s_write_trace(%s_context_t *ctx, FILE *stream);\n",
+                get_prefix(ctx), get_prefix(ctx)
+            );
+        }
+        if (ctx->split) {
+            stream__printf(
+                &hstream,
+                "size_t %s_split(const char *text, size_t len, size_t *offsets, size_t num);\n"
+                "int %s_parse_split(const %s_split_driver_t *driver, const char *text, size_t len, size_t num);\n",
+                get_prefix(ctx), get_prefix(ctx), get_prefix(ctx)
+            );
+        }
         stream__printf(
             &hstream,
-            "int %s_parse(%s_context_t *ctx, %s%s*ret);\n",
+            "void %s_reset(%s_context_t *ctx, %s%sauxil);\n",
             get_prefix(ctx), get_prefix(ctx),
-            vt, vp ? "" : " "
+            at, ap ? "" : " "
         );
         stream__printf(
             &hstream,
@@ -7850,14 +13402,35 @@ static bool_t generate(context_t *ctx) {
             );
         }
     }
-    fclose_e(hstream.file, hstream.path);
-    fclose_e(sstream.file, sstream.path);
-    if (ctx->errnum) {
-        unlink(ctx->hpath);
-        unlink(ctx->spath);
-        return FALSE;
+    {
+        const bool_t b = (ctx->errnum == 0) ? TRUE : FALSE;
+        size_t u;
+        if (b) stream__flush(&hstream);
+        stream__finalize(&hstream);
+        if (!b) unlink(ctx->hpath);
+        if (ctx->ppath) {
+            if (b) stream__flush(&pstream);
+            stream__finalize(&pstream);
+            if (!b) unlink(ctx->ppath);
+            for (u = 1; u < nu; u++) {
+                if (b) stream__flush(ustreams[u]);
+                stream__finalize(ustreams[u]);
+                free(ustreams[u]);
+                if (!b) unlink(ctx->upaths.p[u - 1]);
+            }
+        }
+        if (b) stream__flush(&sstream);
+        stream__finalize(&sstream);
+        if (!b) unlink(ctx->spath);
+        if (ctx->opts.runtime) { /* not removed on errors since shared by other parsers */
+            if (b) stream__flush(&rhstream);
+            stream__finalize(&rhstream);
+            if (b) stream__flush(&rsstream);
+            stream__finalize(&rsstream);
+        }
+        free(ustreams);
+        return b;
     }
-    return TRUE;
 }
 
 #define COMMAND_LINE_OPTION_ERROR_NOT_OPTION            -1
@@ -7896,7 +13469,12 @@ static const command_line_option_t g_command_opts[] = {
     {
         0, 'o', NULL, COMMAND_LINE_OPTION_ARGUMENT_REQUIRED, "BASENAME",
         "specify a base name of output source and header files;\n"
-        "can be used only once"
+        "can be used only once, and only with a single PEG source file"
+    },
+    {
+        0, 'b', "batch", COMMAND_LINE_OPTION_ARGUMENT_REQUIRED, "FILENAME",
+        "specify a file listing PEG source files to generate parsers at once;\n"
+        "each line has a file name optionally followed by a base name of outputs"
     },
     {
         0, 'a', "ascii", COMMAND_LINE_OPTION_ARGUMENT_NOT_REQUIRED, NULL,
@@ -7910,6 +13488,61 @@ static const command_line_option_t g_command_opts[] = {
         0, 'd', "debug", COMMAND_LINE_OPTION_ARGUMENT_NOT_REQUIRED, NULL,
         "with printing debug information"
     },
+    {
+        0, 'r', "recognize", COMMAND_LINE_OPTION_ARGUMENT_NOT_REQUIRED, NULL,
+        "generate a recognizer that only checks whether the input matches;\n"
+        "no actions are executed and no output data are created"
+    },
+    {
+        0, 'w', "whole-input", COMMAND_LINE_OPTION_ARGUMENT_NOT_REQUIRED, NULL,
+        "read the whole input before parsing to omit end-of-input checks\n"
+        "in matching of strings and character classes"
+    },
+    {
+        0, 'f', "feed", COMMAND_LINE_OPTION_ARGUMENT_NOT_REQUIRED, NULL,
+        "generate a push-style parser that is fed the input in chunks\n"
+        "by the API function <prefix>_feed() instead of <prefix>_parse()"
+    },
+    {
+        0, 'p', "profile", COMMAND_LINE_OPTION_ARGUMENT_NOT_REQUIRED, NULL,
+        "with counting rule applications, memo table hits, and so on\n"
+        "to be printed by the API function <prefix>_print_profile()"
+    },
+    {
+        0, 't', "trace", COMMAND_LINE_OPTION_ARGUMENT_NOT_REQUIRED, NULL,
+        "with recording rule evaluation events in a ring buffer\n"
+        "to be written by the API function <prefix>_write_trace()"
+    },
+    {
+        0, 'm', "memory", COMMAND_LINE_OPTION_ARGUMENT_NOT_REQUIRED, NULL,
+        "with the API functions <prefix>_trim() to release the memory pools\n"
+        "and <prefix>_get_memory_stats() to get their statistics"
+    },
+    {
+        0, 'u', "units", COMMAND_LINE_OPTION_ARGUMENT_REQUIRED, "NUM",
+        "distribute the rule functions among NUM C source files\n"
+        "to compile them in parallel (default: 1)"
+    },
+    {
+        0, 'c', "bytecode", COMMAND_LINE_OPTION_ARGUMENT_NOT_REQUIRED, NULL,
+        "compile the rules into bytecode run by an interpreter instead of C code\n"
+        "to make the generated parser smaller and faster to build"
+    },
+    {
+        0, 'x', "dfa", COMMAND_LINE_OPTION_ARGUMENT_NOT_REQUIRED, NULL,
+        "match the regular subexpressions without captures and actions\n"
+        "by deterministic finite automata, inlining the regular rules"
+    },
+    {
+        0, 's', "runtime", COMMAND_LINE_OPTION_ARGUMENT_REQUIRED, "BASENAME",
+        "generate the runtime into C source and header files with the base name\n"
+        "to be compiled once and shared by parsers generated with the same options"
+    },
+    {
+        0, 'e', "export-prefix", COMMAND_LINE_OPTION_ARGUMENT_REQUIRED, "PREFIX",
+        "rename the functions exported by the shared runtime from pcc_* to PREFIX_*\n"
+        "to link runtimes generated with different options into a program"
+    },
     {
         0, 'h', "help", COMMAND_LINE_OPTION_ARGUMENT_NOT_REQUIRED, NULL,
         "print this help message and exit"
@@ -8096,7 +13729,7 @@ static void print_version(FILE *output) {
 }
 
 static void print_usage(FILE *output) {
-    fprintf(output, "Usage: %s [OPTIONS] [FILE]\n", g_cmdname);
+    fprintf(output, "Usage: %s [OPTIONS] [FILE]...\n", g_cmdname);
     fprintf(output, "Generates a parser for C.\n");
     fprintf(output, "\n");
     fprintf(output, "Options:\n");
@@ -8108,6 +13741,47 @@ static void print_usage(FILE *output) {
     fprintf(output, "Full documentation at: <%s>\n", PACKCC_WEBSITE);
 }
 
+static bool_t read_batch_file(const char *path, string_array_t *ipaths, string_array_t *opaths) {
+    /* reads lines each of which has an input file name optionally followed by an output base name */
+    FILE *const file = fopen_rb_e(path);
+    char_array_t text;
+    bool_t b = TRUE;
+    size_t i = 0, l = 0;
+    char_array__initialize(&text);
+    char_array__read_file(&text, file, path);
+    fclose_e(file, path);
+    while (i < text.n) {
+        size_t h[3], t[3], k = 0;
+        while (i < text.n && text.p[i] != '\n' && text.p[i] != '\r') {
+            if (text.p[i] == ' ' || text.p[i] == '\t') {
+                i++;
+                continue;
+            }
+            if (k == 0 && text.p[i] == '#') { /* a comment line */
+                while (i < text.n && text.p[i] != '\n' && text.p[i] != '\r') i++;
+                break;
+            }
+            if (k < 3) h[k] = i;
+            while (i < text.n && text.p[i] != '\n' && text.p[i] != '\r' && text.p[i] != ' ' && text.p[i] != '\t') i++;
+            if (k < 3) t[k] = i;
+            k++;
+        }
+        if (k > 2) {
+            print_error("%s:" FMT_LU ": Extra field in batch file: '%.*s'\n", path, (ulong_t)(l + 1), (int)(t[2] - h[2]), text.p + h[2]);
+            b = FALSE;
+        }
+        else if (k > 0) {
+            string_array__add(ipaths, text.p + h[0], t[0] - h[0]);
+            string_array__add(opaths, (k > 1) ? text.p + h[1] : "", (k > 1) ? t[1] - h[1] : 0);
+        }
+        if (i < text.n && text.p[i] == '\r') i++;
+        if (i < text.n && text.p[i] == '\n') i++;
+        l++;
+    }
+    char_array__finalize(&text);
+    return b;
+}
+
 int main(int argc, char **argv) {
     int ret = 0;
 #ifdef _MSC_VER
@@ -8119,17 +13793,28 @@ int main(int argc, char **argv) {
 #endif
     g_cmdname = extract_filename(argv[0]);
     {
-        const char *ipath = NULL;
-        const char *opath = NULL;
         options_t opts = { 0 };
-        string_array_t dirs;
+        string_array_t ipaths, opaths, dirs;
+        string_array__initialize(&ipaths);
+        string_array__initialize(&opaths);
         string_array__initialize(&dirs);
         {
-            const char *path = NULL;
             const char *opt_o = NULL;
+            const char *opt_b = NULL;
+            size_t opt_u = 1;
+            const char *opt_s = NULL;
+            const char *opt_e = NULL;
             bool_t opt_a = FALSE;
             bool_t opt_l = FALSE;
             bool_t opt_d = FALSE;
+            bool_t opt_r = FALSE;
+            bool_t opt_w = FALSE;
+            bool_t opt_f = FALSE;
+            bool_t opt_p = FALSE;
+            bool_t opt_t = FALSE;
+            bool_t opt_m = FALSE;
+            bool_t opt_c = FALSE;
+            bool_t opt_x = FALSE;
             bool_t opt_h = FALSE;
             bool_t opt_v = FALSE;
             const char *a = NULL;
@@ -8178,6 +13863,16 @@ int main(int argc, char **argv) {
                     }
                     opt_o = a;
                     break;
+                case 'b':
+                    if (opt_b != NULL) {
+                        print_error("Extra batch file name: '%s'\n", a);
+                        fprintf(stderr, "\n");
+                        print_usage(stderr);
+                        ret = 1;
+                        goto EXIT;
+                    }
+                    opt_b = a;
+                    break;
                 case 'a':
                     opt_a = TRUE;
                     break;
@@ -8187,6 +13882,53 @@ int main(int argc, char **argv) {
                 case 'd':
                     opt_d = TRUE;
                     break;
+                case 'r':
+                    opt_r = TRUE;
+                    break;
+                case 'w':
+                    opt_w = TRUE;
+                    break;
+                case 'f':
+                    opt_f = TRUE;
+                    break;
+                case 'p':
+                    opt_p = TRUE;
+                    break;
+                case 't':
+                    opt_t = TRUE;
+                    break;
+                case 'm':
+                    opt_m = TRUE;
+                    break;
+                case 'u':
+                    opt_u = string_to_size_t(a);
+                    if (opt_u == VOID_VALUE || opt_u == 0) {
+                        print_error("Invalid number of C source files: '%s'\n", a);
+                        fprintf(stderr, "\n");
+                        print_usage(stderr);
+                        ret = 1;
+                        goto EXIT;
+                    }
+                    break;
+                case 'c':
+                    opt_c = TRUE;
+                    break;
+                case 'x':
+                    opt_x = TRUE;
+                    break;
+                case 's':
+                    opt_s = a;
+                    break;
+                case 'e':
+                    if (!is_identifier_string(a)) {
+                        print_error("Invalid export prefix: '%s'\n", a);
+                        fprintf(stderr, "\n");
+                        print_usage(stderr);
+                        ret = 1;
+                        goto EXIT;
+                    }
+                    opt_e = a;
+                    break;
                 case 'h':
                     opt_h = TRUE;
                     break;
@@ -8201,30 +13943,80 @@ int main(int argc, char **argv) {
                     goto EXIT;
                 }
             }
-            switch (argc - i) {
-            case 0:
-                break;
-            case 1:
-                path = argv[i];
-                break;
-            default:
-                print_error("Extra input file: '%s'\n", argv[i + 1]);
+            if (opt_h || opt_v) {
+                if (opt_v) print_version(stdout);
+                if (opt_v && opt_h) fprintf(stdout, "\n");
+                if (opt_h) print_usage(stdout);
+                goto EXIT;
+            }
+            if (opt_w && opt_f) {
+                print_error("Incompatible options: '--whole-input' and '--feed'\n");
                 fprintf(stderr, "\n");
                 print_usage(stderr);
                 ret = 1;
                 goto EXIT;
             }
-            if (opt_h || opt_v) {
-                if (opt_v) print_version(stdout);
-                if (opt_v && opt_h) fprintf(stdout, "\n");
-                if (opt_h) print_usage(stdout);
+            if (opt_s && (opt_p || opt_t)) {
+                print_error("Incompatible options: '--runtime' and '%s'\n", opt_p ? "--profile" : "--trace");
+                fprintf(stderr, "\n");
+                print_usage(stderr);
+                ret = 1;
+                goto EXIT;
+            }
+            if (opt_e && !opt_s) {
+                print_error("Export prefix without '--runtime': '%s'\n", opt_e);
+                fprintf(stderr, "\n");
+                print_usage(stderr);
+                ret = 1;
+                goto EXIT;
+            }
+            if (opt_c && opt_u > 1) {
+                print_error("Incompatible options: '--bytecode' and '--units'\n");
+                fprintf(stderr, "\n");
+                print_usage(stderr);
+                ret = 1;
+                goto EXIT;
+            }
+            if (opt_c && opt_x) {
+                print_error("Incompatible options: '--bytecode' and '--dfa'\n");
+                fprintf(stderr, "\n");
+                print_usage(stderr);
+                ret = 1;
+                goto EXIT;
+            }
+            if (opt_o && (opt_b || argc - i > 1)) {
+                print_error("Output base name with multiple input files: '%s'\n", opt_o);
+                fprintf(stderr, "\n");
+                print_usage(stderr);
+                ret = 1;
+                goto EXIT;
+            }
+            if (opt_b && !read_batch_file(opt_b, &ipaths, &opaths)) {
+                ret = 1;
                 goto EXIT;
             }
-            ipath = (path && path[0]) ? path : NULL;
-            opath = (opt_o && opt_o[0]) ? opt_o : NULL;
+            for (; i < argc; i++) {
+                string_array__add(&ipaths, argv[i], VOID_VALUE);
+                string_array__add(&opaths, opt_o ? opt_o : "", VOID_VALUE);
+            }
+            if (ipaths.n == 0 && !opt_b) { /* reads the standard input */
+                string_array__add(&ipaths, "", VOID_VALUE);
+                string_array__add(&opaths, opt_o ? opt_o : "", VOID_VALUE);
+            }
             opts.ascii = opt_a;
             opts.lines = opt_l;
             opts.debug = opt_d;
+            opts.recog = opt_r;
+            opts.whole = opt_w;
+            opts.feed = opt_f;
+            opts.profile = opt_p;
+            opts.trace = opt_t;
+            opts.memory = opt_m;
+            opts.bytecode = opt_c;
+            opts.dfa = opt_x;
+            opts.units = opt_u;
+            opts.runtime = opt_s;
+            opts.export_prefix = opt_e;
         }
         {
             const char *const v = getenv(ENVVAR_IMPORT_PATH);
@@ -8266,13 +14058,20 @@ int main(int argc, char **argv) {
 #endif
         }
         {
-            context_t *const ctx = create_context(ipath, opath, &dirs, &opts);
-            const int b = parse(ctx) && generate(ctx);
-            destroy_context(ctx);
-            if (!b) ret = 10;
+            size_t i;
+            for (i = 0; i < ipaths.n; i++) { /* the options and the import directories are shared among the input files */
+                const char *const ipath = ipaths.p[i][0] ? ipaths.p[i] : NULL;
+                const char *const opath = opaths.p[i][0] ? opaths.p[i] : NULL;
+                context_t *const ctx = create_context(ipath, opath, &dirs, &opts);
+                const int b = parse(ctx) && generate(ctx);
+                destroy_context(ctx);
+                if (!b) ret = 10;
+            }
         }
     EXIT:;
         string_array__finalize(&dirs);
+        string_array__finalize(&opaths);
+        string_array__finalize(&ipaths);
     }
     return ret;
 }
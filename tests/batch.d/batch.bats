@@ -0,0 +1,44 @@
+#!/usr/bin/env bats
+
+load "$TESTDIR/utils.sh"
+
+copy_to_temporary_directory() { # leaves the generated files out of the source tree
+    local d
+    d="$(mktemp -d)"
+    cp "$BATS_TEST_DIRNAME"/*.peg "$BATS_TEST_DIRNAME/batch.txt" "$d"
+    echo "$d"
+}
+
+generate_in() {
+    cd "$1" && shift && "$PACKCC" "$@"
+}
+
+@test "Testing $TEST_NAME - batch file" {
+    d="$(copy_to_temporary_directory)"
+    (generate_in "$d" --batch=batch.txt)
+    grep -Fq "first_context_t" "$d/parser_first.h"
+    grep -Fq "second_context_t" "$d/second.h"
+    rm -rf "$d"
+}
+
+@test "Testing $TEST_NAME - multiple input files" {
+    d="$(copy_to_temporary_directory)"
+    (generate_in "$d" first.peg second.peg)
+    grep -Fq "first_context_t" "$d/first.h"
+    grep -Fq "second_context_t" "$d/second.h"
+    rm -rf "$d"
+}
+
+@test "Testing $TEST_NAME - multiple input files with an error" {
+    d="$(copy_to_temporary_directory)"
+    run generate_in "$d" first.peg invalid.peg second.peg
+    [ "$status" -eq 10 ]
+    [ -f "$d/first.h" ] && [ ! -f "$d/invalid.h" ] && [ -f "$d/second.h" ]
+    rm -rf "$d"
+}
+
+@test "Testing $TEST_NAME - output base name with multiple input files" {
+    run "$PACKCC" -o parser "$BATS_TEST_DIRNAME/first.peg" "$BATS_TEST_DIRNAME/second.peg"
+    [ "$status" -eq 1 ]
+    [[ "${lines[0]}" =~ "Output base name with multiple input files: 'parser'" ]]
+}
@@ -0,0 +1,37 @@
+#!/usr/bin/env bats
+
+load "$TESTDIR/utils.sh"
+
+@test "Testing $TEST_NAME - generation" {
+    PACKCC_OPTS=("--bytecode")
+    test_generate
+}
+
+@test "Testing $TEST_NAME - check code" {
+    in_source 'static const pcc_code_t pcc_code['
+    in_source 'static pcc_bool_t pcc_execute_code(pcc_context_t *ctx, pcc_thunk_chunk_t *chunk, size_t rule, size_t pc) {'
+    in_source '    return pcc_evaluate_code(ctx, 0);'
+    ! in_source 'goto L0000;'
+}
+
+@test "Testing $TEST_NAME - compilation" {
+    test_compile
+}
+
+@test "Testing $TEST_NAME - run" {
+    run_for_input "$BATS_TEST_DIRNAME/input.txt"
+}
+
+@test "Testing $TEST_NAME - compilation without threaded dispatch" {
+    test_compile -DPCC_NO_THREADED_DISPATCH
+}
+
+@test "Testing $TEST_NAME - run without threaded dispatch" {
+    run_for_input "$BATS_TEST_DIRNAME/input.txt"
+}
+
+@test "Testing $TEST_NAME - incompatible options" {
+    run "$PACKCC" --bytecode --units=2 -o "$BATS_TEST_DIRNAME/parser" "$BATS_TEST_DIRNAME/input.peg"
+    [ "$status" -eq 1 ]
+    [[ "$output" == *"Incompatible options: '--bytecode' and '--units'"* ]]
+}
@@ -0,0 +1,20 @@
+#!/usr/bin/env bats
+
+load "$TESTDIR/utils.sh"
+
+@test "Testing $TEST_NAME - generation" {
+    test_generate
+}
+
+@test "Testing $TEST_NAME - check code" {
+    in_header "void calc_reset(calc_context_t *ctx, document_t *auxil);"
+}
+
+@test "Testing $TEST_NAME - compilation" {
+    $CC $CFLAGS -I "$BATS_TEST_DIRNAME" "$BATS_TEST_DIRNAME/main.c" "$BATS_TEST_DIRNAME/parser.c" -o "$BATS_TEST_DIRNAME/parser"
+}
+
+@test "Testing $TEST_NAME - run" {
+    run timeout 5s "$BATS_TEST_DIRNAME/parser"
+    check_output "$BATS_TEST_DIRNAME/expected.txt"
+}
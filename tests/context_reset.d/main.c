@@ -0,0 +1,33 @@
+#include <stdio.h>
+
+#include "parser.h"
+
+int main(void) {
+    static const char *const texts[] = {
+        "1 + 2 * 3\n",
+        "(4 - 5\n",
+        "6 * -(7 - 8)\n",
+        "9 +\n",
+        "10 - 11 - 12\n"
+    };
+    document_t docs[2];
+    calc_context_t *ctx;
+    int i;
+    docs[0].text = docs[1].text = NULL;
+    ctx = calc_create(&(docs[0]));
+    for (i = 0; i < (int)(sizeof(texts) / sizeof(texts[0])); i++) {
+        document_t *const doc = &(docs[i % 2]);
+        long ret = 0;
+        doc->text = texts[i];
+        doc->pos = 0;
+        doc->error = 0;
+        calc_reset(ctx, doc);
+        calc_parse(ctx, &ret);
+        if (doc->error)
+            printf("error\n");
+        else
+            printf("%ld\n", ret);
+    }
+    calc_destroy(ctx);
+    return 0;
+}
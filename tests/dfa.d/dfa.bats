@@ -0,0 +1,49 @@
+#!/usr/bin/env bats
+
+load "$TESTDIR/utils.sh"
+
+@test "Testing $TEST_NAME - generation" {
+    PACKCC_OPTS=("--dfa")
+    test_generate
+}
+
+@test "Testing $TEST_NAME - check code" {
+    in_source 'static const unsigned char x[256] = { /* the byte classes */'
+    in_source 'if (pcc_refill_buffer(ctx, i + 1) < i + 1) break;'
+    in_source 'ctx->cur += j;'
+    ! in_source 'pcc_evaluate_rule_NAME('
+    ! in_source 'pcc_evaluate_rule_NUMBER('
+    ! in_source 'pcc_evaluate_rule_OPERATOR('
+}
+
+@test "Testing $TEST_NAME - compilation" {
+    test_compile
+}
+
+@test "Testing $TEST_NAME - run" {
+    run_for_input "$BATS_TEST_DIRNAME/input.txt"
+}
+
+@test "Testing $TEST_NAME - generation [whole input]" {
+    PACKCC_OPTS=("--dfa" "--whole-input")
+    test_generate
+}
+
+@test "Testing $TEST_NAME - check code [whole input]" {
+    in_source 'static const unsigned char x[256] = { /* the byte classes */'
+    ! in_source 'if (pcc_refill_buffer(ctx, i + 1) < i + 1) break;'
+}
+
+@test "Testing $TEST_NAME - compilation [whole input]" {
+    test_compile
+}
+
+@test "Testing $TEST_NAME - run [whole input]" {
+    run_for_input "$BATS_TEST_DIRNAME/input.txt"
+}
+
+@test "Testing $TEST_NAME - incompatible options" {
+    run "$PACKCC" --bytecode --dfa -o "$BATS_TEST_DIRNAME/parser" "$BATS_TEST_DIRNAME/input.peg"
+    [ "$status" -eq 1 ]
+    [[ "$output" == *"Incompatible options: '--bytecode' and '--dfa'"* ]]
+}
@@ -0,0 +1,20 @@
+#!/usr/bin/env bats
+
+load "$TESTDIR/utils.sh"
+
+@test "Testing $TEST_NAME - generation" {
+    run test_generate
+    [ "$status" -eq 10 ]
+    [[ "$output" =~ ': input.peg:1:2009: No definition of rule: '"'b'" ]]
+    [[ "$output" =~ ': input.peg:2:1: Illegal rule syntax' ]]
+    [[ "$output" =~ ': input.peg:4:11: Illegal rule syntax' ]]
+}
+
+@test "Testing $TEST_NAME - generation [ascii]" {
+    PACKCC_OPTS=("--ascii")
+    run test_generate
+    [ "$status" -eq 10 ]
+    [[ "$output" =~ ': input.peg:1:5009: No definition of rule: '"'b'" ]]
+    [[ "$output" =~ ': input.peg:2:1: Illegal rule syntax' ]]
+    [[ "$output" =~ ': input.peg:4:13: Illegal rule syntax' ]]
+}
@@ -0,0 +1,22 @@
+#!/usr/bin/env bats
+
+load "$TESTDIR/utils.sh"
+
+@test "Testing $TEST_NAME - generation" {
+    PACKCC_OPTS=("--feed")
+    test_generate
+}
+
+@test "Testing $TEST_NAME - check code" {
+    in_header "int calc_feed(calc_context_t *ctx, const char *data, size_t len, long *ret);"
+    ! in_header "int calc_parse(calc_context_t *ctx, long *ret);"
+}
+
+@test "Testing $TEST_NAME - compilation" {
+    $CC $CFLAGS -I "$BATS_TEST_DIRNAME" "$BATS_TEST_DIRNAME/main.c" "$BATS_TEST_DIRNAME/parser.c" -o "$BATS_TEST_DIRNAME/parser"
+}
+
+@test "Testing $TEST_NAME - run" {
+    run timeout 5s "$BATS_TEST_DIRNAME/parser"
+    check_output "$BATS_TEST_DIRNAME/expected.txt"
+}
@@ -0,0 +1,45 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "parser.h"
+
+static const char text[] =
+    "1 + 2 * 3\n"
+    "(4 - 5\n"
+    "6 * -(7 - 8)\n"
+    "123 + 456\n"
+    "10 - 11 - 12";
+
+static void feed_in_chunks(size_t size) {
+    int error = 0;
+    calc_context_t *ctx = calc_create(&error);
+    size_t i = 0;
+    printf("chunk size: %lu\n", (unsigned long)size);
+    for (;;) {
+        const size_t n = (i + size < sizeof(text) - 1) ? size : sizeof(text) - 1 - i;
+        long ret = 0;
+        int r = calc_feed(ctx, (n > 0) ? text + i : NULL, n, &ret);
+        i += n;
+        while (r == PCC_FEED_DONE) {
+            if (error)
+                printf("error\n");
+            else
+                printf("%ld\n", ret);
+            error = 0;
+            r = calc_feed(ctx, text + i, 0, &ret);
+        }
+        if (r == PCC_FEED_END) break;
+        if (r == PCC_FEED_ERROR) {
+            printf("unexpected error\n");
+            break;
+        }
+    }
+    calc_destroy(ctx);
+}
+
+int main(void) {
+    feed_in_chunks(1);
+    feed_in_chunks(7);
+    feed_in_chunks(sizeof(text));
+    return 0;
+}
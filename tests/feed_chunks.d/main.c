@@ -0,0 +1,40 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "parser.h"
+
+#define ITEMS 2000
+
+static char text[ITEMS * 4 + 1];
+
+static void feed_in_chunks(size_t size) {
+    counter_t counter = { 0, 0, 0 };
+    list_context_t *ctx = list_create(&counter);
+    const size_t len = strlen(text);
+    size_t i = 0, chunks = 0;
+    long ret = 0;
+    int r;
+    printf("chunk size: %lu\n", (unsigned long)size);
+    for (;;) {
+        const size_t n = (i + size < len) ? size : len - i;
+        r = list_feed(ctx, (n > 0) ? text + i : NULL, n, &ret);
+        i += n;
+        chunks++;
+        if (r != PCC_FEED_NEED_MORE) break;
+    }
+    printf("result: %s\n", (r == PCC_FEED_DONE && !counter.error) ? "done" : "error");
+    printf("items: %ld\n", ret);
+    /* the items matched before the last chunk are not evaluated again */
+    printf("evaluations: %s\n", (counter.checks <= ITEMS + (long)chunks) ? "bounded" : "repeated");
+    list_destroy(ctx);
+}
+
+int main(void) {
+    size_t i;
+    for (i = 0; i < ITEMS; i++) memcpy(text + i * 4, (i % 16 == 15) ? "123\n" : "123 ", 4);
+    text[ITEMS * 4] = '\0';
+    feed_in_chunks(3);
+    feed_in_chunks(16);
+    feed_in_chunks(sizeof(text));
+    return 0;
+}
@@ -0,0 +1,18 @@
+#!/usr/bin/env bats
+
+load "$TESTDIR/utils.sh"
+
+generate_chain() { # every rule references the next one to make a very long chain of rules
+    awk -v n="$1" 'BEGIN {
+        for (i = 0; i < n; i++) printf "r%d <- \"a\" r%d? / r%d \"b\" / \"c\"\n", i, i + 1, i + 1
+        printf "r%d <- \"z\"\n", n
+    }'
+}
+
+@test "Testing $TEST_NAME - generation" {
+    (cd "$BATS_TEST_DIRNAME" && generate_chain 100000 | "$PACKCC" -o parser)
+}
+
+@test "Testing $TEST_NAME - check code" {
+    in_source "pcc_evaluate_rule_r100000"
+}
@@ -0,0 +1,20 @@
+#!/usr/bin/env bats
+
+load "$TESTDIR/utils.sh"
+
+@test "Testing $TEST_NAME - generation" {
+    test_generate
+}
+
+@test "Testing $TEST_NAME - check code" {
+    [ "$(grep -c "pcc_apply_rule(ctx, pcc_evaluate_rule_KEY," "$BATS_TEST_DIRNAME/parser.c")" -eq 1 ]
+    [ "$(grep -c "pcc_apply_rule(ctx, pcc_evaluate_rule__," "$BATS_TEST_DIRNAME/parser.c")" -eq 3 ]
+}
+
+@test "Testing $TEST_NAME - compilation" {
+    test_compile
+}
+
+@test "Testing $TEST_NAME - run" {
+    run_for_input "$BATS_TEST_DIRNAME/input.txt"
+}
@@ -0,0 +1,46 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "parser.h"
+
+static char text[8192];
+
+static void print_stats(calc_context_t *ctx) {
+    calc_memory_stats_t stats[8];
+    size_t n = calc_get_memory_stats(ctx, stats, sizeof(stats) / sizeof(stats[0]));
+    size_t i;
+    for (i = 0; i < n; i++) {
+        printf(
+            "%s: pools %s, live %lu, peak %s\n", stats[i].name,
+            (stats[i].pools > 0) ? "yes" : "no", (unsigned long)stats[i].live, (stats[i].peak > 0) ? "yes" : "no"
+        );
+    }
+}
+
+static long parse(calc_context_t *ctx, document_t *doc) {
+    long ret = 0;
+    doc->pos = 0;
+    doc->error = 0;
+    calc_reset(ctx, doc);
+    calc_parse(ctx, &ret);
+    return doc->error ? -1 : ret;
+}
+
+int main(void) {
+    document_t doc;
+    calc_context_t *ctx;
+    size_t i;
+    for (i = 0; i + 4 < sizeof(text); i += 4) memcpy(text + i, "1 + ", 4);
+    memcpy(text + i - 4, "1\n", 3);
+    doc.text = text;
+    ctx = calc_create(&doc);
+    printf("%ld\n", parse(ctx, &doc));
+    print_stats(ctx);
+    printf("trim: %lu\n", (unsigned long)calc_trim(ctx, 0));
+    print_stats(ctx);
+    printf("%ld\n", parse(ctx, &doc));
+    printf("trim: %s\n", (calc_trim(ctx, (size_t)-1) > 0) ? "kept" : "released");
+    printf("%ld\n", parse(ctx, &doc));
+    calc_destroy(ctx);
+    return 0;
+}
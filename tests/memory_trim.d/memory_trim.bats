@@ -0,0 +1,42 @@
+#!/usr/bin/env bats
+
+load "$TESTDIR/utils.sh"
+
+@test "Testing $TEST_NAME - generation" {
+    PACKCC_OPTS=("--memory")
+    test_generate
+}
+
+@test "Testing $TEST_NAME - check code" {
+    in_header "size_t calc_trim(calc_context_t *ctx, size_t keep);"
+    in_header "size_t calc_get_memory_stats(calc_context_t *ctx, calc_memory_stats_t *stats, size_t num);"
+}
+
+@test "Testing $TEST_NAME - compilation" {
+    $CC $CFLAGS -DPCC_ALLOC_STATS -I "$BATS_TEST_DIRNAME" "$BATS_TEST_DIRNAME/main.c" "$BATS_TEST_DIRNAME/parser.c" -o "$BATS_TEST_DIRNAME/parser"
+}
+
+@test "Testing $TEST_NAME - run" {
+    run timeout 5s "$BATS_TEST_DIRNAME/parser"
+    check_output "$BATS_TEST_DIRNAME/expected.txt"
+}
+
+@test "Testing $TEST_NAME - compilation without counters" {
+    $CC $CFLAGS -I "$BATS_TEST_DIRNAME" "$BATS_TEST_DIRNAME/main.c" "$BATS_TEST_DIRNAME/parser.c" -o "$BATS_TEST_DIRNAME/parser"
+}
+
+@test "Testing $TEST_NAME - run without counters" {
+    run timeout 5s "$BATS_TEST_DIRNAME/parser"
+    check_output "$BATS_TEST_DIRNAME/expected-nocount.txt"
+}
+
+@test "Testing $TEST_NAME - generation without option" {
+    test_generate
+}
+
+@test "Testing $TEST_NAME - check code without option" {
+    ! in_header "calc_trim"
+    ! in_header "calc_get_memory_stats"
+    ! in_source "pcc_memory_recycler__trim"
+    ! in_source "PCC_ALLOC_STATS"
+}
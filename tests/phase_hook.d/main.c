@@ -0,0 +1,17 @@
+#include <stddef.h>
+
+#include "parser.h"
+
+int main(void) {
+    input_t input;
+    phase_context_t *ctx;
+    int ret;
+    input.text = "ab\nc\n0\n";
+    input.pos = 0;
+    ctx = phase_create(&input);
+    while (phase_parse(ctx, &ret)) {
+        if (input.pos >= 6) break; /* stops after the error */
+    }
+    phase_destroy(ctx);
+    return 0;
+}
@@ -0,0 +1,22 @@
+#!/usr/bin/env bats
+
+load "$TESTDIR/utils.sh"
+
+@test "Testing $TEST_NAME - generation" {
+    test_generate
+}
+
+@test "Testing $TEST_NAME - compilation" {
+    $CC $CFLAGS -I "$BATS_TEST_DIRNAME" "$BATS_TEST_DIRNAME/main.c" "$BATS_TEST_DIRNAME/parser.c" -o "$BATS_TEST_DIRNAME/parser"
+}
+
+@test "Testing $TEST_NAME - run" {
+    run "$BATS_TEST_DIRNAME/parser"
+    check_output "$BATS_TEST_DIRNAME/expected.txt"
+}
+
+@test "Testing $TEST_NAME - recognition" {
+    PACKCC_OPTS=("--recognize")
+    test_generate
+    ! in_source "PCC_PHASE_ACTION);"
+}
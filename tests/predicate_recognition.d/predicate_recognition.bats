@@ -0,0 +1,51 @@
+#!/usr/bin/env bats
+
+load "$TESTDIR/utils.sh"
+
+@test "Testing $TEST_NAME - generation" {
+    test_generate
+}
+
+@test "Testing $TEST_NAME - recognition functions" {
+    in_source "static pcc_bool_t pcc_recognize_rule_KEYWORD(pcc_context_t *ctx) {"
+    in_source "static pcc_bool_t pcc_recognize_rule_IDCHAR(pcc_context_t *ctx) {"
+    ! in_source "pcc_evaluate_rule_KEYWORD"
+    ! in_source "pcc_recognize_rule_TAGGED"
+    ! in_source "pcc_recognize_rule_EXPR"
+}
+
+@test "Testing $TEST_NAME - compilation" {
+    test_compile
+}
+
+@test "Testing $TEST_NAME - run" {
+    run_for_input "$BATS_TEST_DIRNAME/input.txt"
+}
+
+@test "Testing $TEST_NAME - generation [predicated action]" {
+    test_generate predicated_action.peg
+}
+
+@test "Testing $TEST_NAME - unused functions [predicated action]" {
+    ! in_source "pcc_action_A_0"
+    ! in_source "pcc_action_B_0"
+    ! in_source "pcc_thunk__create_leaf"
+}
+
+@test "Testing $TEST_NAME - compilation [predicated action]" {
+    test_compile
+}
+
+@test "Testing $TEST_NAME - generation [lookahead allocation]" {
+    test_generate lookahead.peg
+}
+
+@test "Testing $TEST_NAME - compilation [lookahead allocation]" {
+    $CC $CFLAGS -I "$BATS_TEST_DIRNAME" "$BATS_TEST_DIRNAME/parser.c" -o "$BATS_TEST_DIRNAME/parser"
+}
+
+@test "Testing $TEST_NAME - run [lookahead allocation]" {
+    run timeout 5s "$BATS_TEST_DIRNAME/parser"
+    [ "$status" -eq 0 ]
+    [ "$output" = "no allocation per token" ]
+}
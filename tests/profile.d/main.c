@@ -0,0 +1,12 @@
+#include <stdio.h>
+
+#include "parser.h"
+
+int main(int argc, char **argv) {
+    calc_context_t *ctx = calc_create(NULL);
+    long ret;
+    while (calc_parse(ctx, &ret)) printf("%ld\n", ret);
+    calc_print_profile(ctx, stdout, argc > 1);
+    calc_destroy(ctx);
+    return 0;
+}
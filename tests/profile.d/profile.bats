@@ -0,0 +1,27 @@
+#!/usr/bin/env bats
+
+load "$TESTDIR/utils.sh"
+
+@test "Testing $TEST_NAME - generation" {
+    PACKCC_OPTS=("--profile")
+    test_generate
+}
+
+@test "Testing $TEST_NAME - check code" {
+    in_header "void calc_print_profile(calc_context_t *ctx, FILE *stream, int csv);"
+    in_source "pcc_rule_profile_t profile[7];"
+    in_source "pcc_apply_rule(ctx, pcc_evaluate_rule_factor, 3, &(chunk->thunks)"
+}
+
+@test "Testing $TEST_NAME - compilation" {
+    $CC $CFLAGS -I "$BATS_TEST_DIRNAME" "$BATS_TEST_DIRNAME/main.c" "$BATS_TEST_DIRNAME/parser.c" -o "$BATS_TEST_DIRNAME/parser"
+}
+
+@test "Testing $TEST_NAME - run" {
+    run_for_input "$BATS_TEST_DIRNAME/input.txt"
+}
+
+@test "Testing $TEST_NAME - run with CSV output" {
+    run timeout 5s "$BATS_TEST_DIRNAME/parser" csv < "$BATS_TEST_DIRNAME/input.txt"
+    check_output "$BATS_TEST_DIRNAME/expected-csv.txt"
+}
@@ -0,0 +1,39 @@
+#!/usr/bin/env bats
+
+load "$TESTDIR/utils.sh"
+
+check_output_error() {
+    diff --strip-trailing-cr -uN "$1" --label "$1" <(echo "$output" | sed -e 's/^packcc\.exe/packcc/') --label "output"
+}
+
+@test "Testing $TEST_NAME - generation" {
+    PACKCC_OPTS=("--recognize")
+    test_generate
+}
+
+@test "Testing $TEST_NAME - check code" {
+    in_header "pcc_get_error_position"
+    in_source "static pcc_bool_t pcc_recognize_rule_FILE(pcc_context_t *ctx) {"
+    ! in_source "pcc_evaluate_rule_"
+    ! in_source "pcc_thunk_chunk__create"
+    ! in_source "pcc_action_EXPR_"
+}
+
+@test "Testing $TEST_NAME - compilation" {
+    test_compile
+}
+
+@test "Testing $TEST_NAME - run" {
+    run_for_input "$BATS_TEST_DIRNAME/input.txt"
+}
+
+@test "Testing $TEST_NAME - run [error]" {
+    run_for_input "$BATS_TEST_DIRNAME/input-error.txt"
+}
+
+@test "Testing $TEST_NAME - generation [invalid case]" {
+    PACKCC_OPTS=("--recognize")
+    run test_generate error.peg
+    [ "$status" -ne 0 ]
+    check_output_error "$BATS_TEST_DIRNAME/error_expected.txt"
+}
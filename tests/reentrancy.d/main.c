@@ -0,0 +1,52 @@
+#define _POSIX_C_SOURCE 200112L
+
+#include <pthread.h>
+#include <stdio.h>
+
+#include "parser.h"
+
+#define NUM_THREADS 8
+#define NUM_DOCUMENTS 200
+
+typedef struct worker_tag {
+    pthread_t thread;
+    int seed;
+    int errors;
+} worker_t;
+
+static void *work(void *arg) {
+    worker_t *const w = (worker_t *)arg;
+    int i;
+    for (i = 0; i < NUM_DOCUMENTS; i++) {
+        const long a = (w->seed * 31 + i * 7) % 1000, b = (i * 13) % 100, c = (w->seed + i) % 10, d = i;
+        char text[128];
+        document_t doc;
+        calc_context_t *ctx;
+        long ret = 0;
+        sprintf(text, "(%ld + %ld) * -%ld - %ld\n", a, b, c, d);
+        doc.text = text;
+        doc.pos = 0;
+        doc.error = 0;
+        ctx = calc_create(&doc);
+        calc_parse(ctx, &ret);
+        calc_destroy(ctx);
+        if (doc.error || ret != (a + b) * -c - d) w->errors++;
+    }
+    return NULL;
+}
+
+int main(void) {
+    worker_t workers[NUM_THREADS];
+    int i, errors = 0;
+    for (i = 0; i < NUM_THREADS; i++) {
+        workers[i].seed = i;
+        workers[i].errors = 0;
+        if (pthread_create(&(workers[i].thread), NULL, work, &(workers[i])) != 0) return 1;
+    }
+    for (i = 0; i < NUM_THREADS; i++) {
+        pthread_join(workers[i].thread, NULL);
+        errors += workers[i].errors;
+    }
+    printf("documents: %d, errors: %d\n", NUM_THREADS * NUM_DOCUMENTS, errors);
+    return 0;
+}
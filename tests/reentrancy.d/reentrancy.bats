@@ -0,0 +1,20 @@
+#!/usr/bin/env bats
+
+load "$TESTDIR/utils.sh"
+
+@test "Testing $TEST_NAME - generation" {
+    test_generate
+}
+
+@test "Testing $TEST_NAME - compilation" {
+    [ -v WINDIR ] && skip "POSIX threads are required"
+    # ThreadSanitizer cannot be combined with AddressSanitizer
+    $CC ${CFLAGS/address/thread} -I "$BATS_TEST_DIRNAME" "$BATS_TEST_DIRNAME/main.c" "$BATS_TEST_DIRNAME/parser.c" -o "$BATS_TEST_DIRNAME/parser" -pthread
+}
+
+@test "Testing $TEST_NAME - run" {
+    [ -v WINDIR ] && skip "POSIX threads are required"
+    run timeout 60s "$BATS_TEST_DIRNAME/parser"
+    [ "$status" -eq 0 ]
+    [ "$output" = "documents: 1600, errors: 0" ]
+}
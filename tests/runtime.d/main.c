@@ -0,0 +1,24 @@
+#include <stdio.h>
+
+#include "parser.h"
+#include "second.h"
+
+int main(void) {
+    first_context_t *const first = first_create(NULL);
+    reader_t reader;
+    second_context_t *second;
+    long ret = 0;
+    double sum = 0.0;
+    reader.text = "1.5, 2.25, 3";
+    reader.pos = 0;
+    second = second_create(&reader);
+    while (first_parse(first, &ret)) {
+        printf("first: %ld\n", ret);
+    }
+    if (second_parse(second, &sum)) {
+        printf("second: %.2f\n", sum);
+    }
+    first_destroy(first);
+    second_destroy(second);
+    return 0;
+}
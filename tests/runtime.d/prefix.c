@@ -0,0 +1,20 @@
+#include <stdio.h>
+
+#include "parser.h"
+#include "third.h"
+
+int main(void) {
+    first_context_t *const first = first_create(NULL);
+    const char *text = "1,22,333";
+    third_context_t *const third = third_create(&text);
+    long ret = 0;
+    int n = 0;
+    while (first_parse(first, &ret)) {
+        printf("first: %ld\n", ret);
+    }
+    while (third_parse(third, NULL)) n++;
+    printf("third: %d\n", n);
+    first_destroy(first);
+    third_destroy(third);
+    return 0;
+}
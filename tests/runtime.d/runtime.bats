@@ -0,0 +1,53 @@
+#!/usr/bin/env bats
+
+load "$TESTDIR/utils.sh"
+
+@test "Testing $TEST_NAME - generation" {
+    PACKCC_OPTS=("--runtime=runtime")
+    test_generate
+    (cd "$BATS_TEST_DIRNAME" && "$PACKCC" --runtime=runtime -o second second.peg)
+    [ -f "$BATS_TEST_DIRNAME/runtime.c" ]
+    [ -f "$BATS_TEST_DIRNAME/runtime.h" ]
+}
+
+@test "Testing $TEST_NAME - check code" {
+    in_source '#include "runtime.h"'
+    ! in_source 'static size_t pcc_refill_buffer('
+    grep -Fq 'static size_t pcc_refill_buffer(pcc_context_t *ctx, size_t num) {' "$BATS_TEST_DIRNAME/runtime.h"
+    grep -Fq 'size_t pcc_read_input(pcc_context_t *ctx, size_t num);' "$BATS_TEST_DIRNAME/runtime.h"
+    ! grep -Fq '#define pcc_' "$BATS_TEST_DIRNAME/runtime.h"
+}
+
+@test "Testing $TEST_NAME - compilation" {
+    $CC $CFLAGS -I "$BATS_TEST_DIRNAME" "$BATS_TEST_DIRNAME/main.c" "$BATS_TEST_DIRNAME/parser.c" "$BATS_TEST_DIRNAME/second.c" "$BATS_TEST_DIRNAME/runtime.c" -o "$BATS_TEST_DIRNAME/parser"
+}
+
+@test "Testing $TEST_NAME - run" {
+    run_for_input "$BATS_TEST_DIRNAME/input.txt"
+}
+
+@test "Testing $TEST_NAME - export prefix" {
+    (cd "$BATS_TEST_DIRNAME" && "$PACKCC" --recognize --runtime=recognizer --export-prefix=rec -o third third.peg)
+    grep -Fq '#define pcc_apply_rule rec_apply_rule' "$BATS_TEST_DIRNAME/recognizer.h"
+    $CC $CFLAGS -I "$BATS_TEST_DIRNAME" "$BATS_TEST_DIRNAME/prefix.c" "$BATS_TEST_DIRNAME/parser.c" "$BATS_TEST_DIRNAME/third.c" "$BATS_TEST_DIRNAME/runtime.c" "$BATS_TEST_DIRNAME/recognizer.c" -o "$BATS_TEST_DIRNAME/parser"
+    run timeout 5s "$BATS_TEST_DIRNAME/parser" < "$BATS_TEST_DIRNAME/input.txt"
+    [ "$output" = "$(printf 'first: 7\nfirst: 6\nfirst: 42\nthird: 1')" ]
+}
+
+@test "Testing $TEST_NAME - export prefix without runtime" {
+    run "$PACKCC" --export-prefix=rec -o "$BATS_TEST_DIRNAME/parser" "$BATS_TEST_DIRNAME/input.peg"
+    [ "$status" -eq 1 ]
+    [[ "$output" == *"Export prefix without '--runtime': 'rec'"* ]]
+}
+
+@test "Testing $TEST_NAME - incompatible options" {
+    run "$PACKCC" --runtime=runtime --profile -o "$BATS_TEST_DIRNAME/parser" "$BATS_TEST_DIRNAME/input.peg"
+    [ "$status" -eq 1 ]
+    [[ "$output" == *"Incompatible options: '--runtime' and '--profile'"* ]]
+}
+
+@test "Testing $TEST_NAME - marker variable" {
+    run "$PACKCC" --runtime=runtime -o "$BATS_TEST_DIRNAME/invalid" "$BATS_TEST_DIRNAME/invalid.peg"
+    [ "$status" -ne 0 ]
+    [[ "$output" == *"Marker variable with shared runtime: '@x'"* ]]
+}
@@ -0,0 +1,139 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "parser.h"
+
+#define NUM_SEGMENTS 4
+#define NUM_LINES 10000
+#define NUM_COMMENT_LINES 1000
+
+typedef struct result_tag {
+    long count;
+    long sum;
+    unsigned long hash; /* depends on the order of the values */
+    int opened;
+    int errors;
+} result_t;
+
+static segment_t *open_segment(void *data, const char *text, size_t len) {
+    result_t *const result = (result_t *)data;
+    segment_t *const segment = (segment_t *)malloc(sizeof(segment_t));
+    if (segment == NULL) exit(1);
+    segment->text = text;
+    segment->len = len;
+    segment->pos = 0;
+    segment->error = 0;
+    result->opened++;
+    return segment;
+}
+
+static void close_segment(void *data, segment_t *segment) {
+    result_t *const result = (result_t *)data;
+    result->errors += segment->error;
+    free(segment);
+}
+
+static void accept_value(void *data, long *value) {
+    result_t *const result = (result_t *)data;
+    result->count++;
+    result->sum += *value;
+    result->hash = (result->hash * 31 + (unsigned long)(*value + 1000)) % 1000003;
+}
+
+typedef struct job_tag {
+    void (*function)(void *);
+    void *arg;
+} job_t;
+
+static void *run_thread(void *arg) {
+    const job_t *const job = (const job_t *)arg;
+    job->function(job->arg);
+    return NULL;
+}
+
+static void run_jobs(void *data, void (*function)(void *), void **args, size_t num) {
+    pthread_t threads[NUM_SEGMENTS];
+    job_t jobs[NUM_SEGMENTS];
+    size_t i;
+    (void)data;
+    for (i = 0; i < num; i++) {
+        jobs[i].function = function;
+        jobs[i].arg = args[i];
+        if (pthread_create(&(threads[i]), NULL, run_thread, &(jobs[i])) != 0) exit(1);
+    }
+    for (i = 0; i < num; i++) {
+        pthread_join(threads[i], NULL);
+    }
+}
+
+static void parse_sequentially(const char *text, size_t len, result_t *result) {
+    segment_t segment;
+    calc_context_t *ctx;
+    long ret = 0;
+    segment.text = text;
+    segment.len = len;
+    segment.pos = 0;
+    segment.error = 0;
+    ctx = calc_create(&segment);
+    memset(result, 0, sizeof(result_t));
+    while (calc_parse(ctx, &ret)) {
+        if (segment.error) break;
+        accept_value(result, &ret);
+    }
+    result->errors = segment.error;
+    calc_destroy(ctx);
+}
+
+static void parse_in_parallel(const char *text, size_t len, int threaded, result_t *result) {
+    calc_split_driver_t driver;
+    memset(result, 0, sizeof(result_t));
+    driver.open = open_segment;
+    driver.close = close_segment;
+    driver.accept = accept_value;
+    driver.run = threaded ? run_jobs : NULL;
+    driver.data = result;
+    if (!calc_parse_split(&driver, text, len, NUM_SEGMENTS) != !!result->errors) exit(1);
+}
+
+static void print_result(const char *name, const result_t *result) {
+    printf("%s: %ld statements, sum %ld, hash %lu, errors %d\n", name, result->count, result->sum, result->hash, result->errors);
+}
+
+int main(void) {
+    static char text[(NUM_LINES + NUM_COMMENT_LINES) * 32];
+    size_t len = 0, offsets[NUM_SEGMENTS], num, i, c0, c1;
+    result_t result;
+    for (i = 0; i < NUM_LINES; i++) {
+        if (i == NUM_LINES / 2) { /* a comment containing line breaks around the middle of the text */
+            size_t j;
+            len += sprintf(text + len, "7 /* ");
+            c0 = len;
+            for (j = 0; j < NUM_COMMENT_LINES; j++) {
+                len += sprintf(text + len, "1 + 1\n");
+            }
+            c1 = len;
+            len += sprintf(text + len, "*/ + 1\n");
+        }
+        len += sprintf(text + len, (i % 3 == 0) ? "%d + %d * 2\r\n" : "(%d - %d)\n", (int)(i % 100), (int)(i % 7));
+    }
+    num = calc_split(text, len, offsets, NUM_SEGMENTS);
+    for (i = 0; i < num; i++) {
+        if (offsets[i] > c0 && offsets[i] < c1) break;
+    }
+    printf("segments: %d, boundary in comment: %s\n", (int)num, (i < num) ? "yes" : "no");
+    parse_in_parallel(text, len, 1, &result);
+    print_result("parallel", &result);
+    printf("fallbacks: %d\n", result.opened - (int)num - 1);
+    parse_in_parallel(text, len, 0, &result);
+    print_result("unthreaded", &result);
+    parse_sequentially(text, len, &result);
+    print_result("sequential", &result);
+    memcpy(text + len - 12, "1 +", 3); /* makes a syntax error in the last segment */
+    parse_in_parallel(text, len, 1, &result);
+    print_result("parallel", &result);
+    parse_sequentially(text, len, &result);
+    print_result("sequential", &result);
+    return 0;
+}
@@ -0,0 +1,38 @@
+#!/usr/bin/env bats
+
+load "$TESTDIR/utils.sh"
+
+@test "Testing $TEST_NAME - generation" {
+    test_generate
+}
+
+@test "Testing $TEST_NAME - check code" {
+    in_header "size_t calc_split(const char *text, size_t len, size_t *offsets, size_t num);"
+    in_header "int calc_parse_split(const calc_split_driver_t *driver, const char *text, size_t len, size_t num);"
+    in_source 'if (len >= 2 && memcmp(text, "\r\n", 2) == 0) return 2;'
+}
+
+@test "Testing $TEST_NAME - invalid split rule" {
+    run test_generate invalid.peg
+    [ "$status" -ne 0 ]
+    [[ "$output" == *"Split rule not consisting of nonempty string literals: 'EOL'"* ]]
+}
+
+@test "Testing $TEST_NAME - compilation" {
+    [ -v WINDIR ] && skip "POSIX threads are required"
+    # ThreadSanitizer cannot be combined with AddressSanitizer
+    $CC ${CFLAGS/address/thread} -I "$BATS_TEST_DIRNAME" "$BATS_TEST_DIRNAME/main.c" "$BATS_TEST_DIRNAME/parser.c" -o "$BATS_TEST_DIRNAME/parser" -pthread
+}
+
+@test "Testing $TEST_NAME - run" {
+    [ -v WINDIR ] && skip "POSIX threads are required"
+    run timeout 60s "$BATS_TEST_DIRNAME/parser"
+    [ "$status" -eq 0 ]
+    [ "${lines[0]}" = "segments: 4, boundary in comment: yes" ]
+    [ "${lines[1]}" = "parallel: 10001 statements, sum 495011, hash 142813, errors 0" ]
+    [ "${lines[2]}" = "fallbacks: 1" ]
+    [ "${lines[3]}" = "unthreaded: 10001 statements, sum 495011, hash 142813, errors 0" ]
+    [ "${lines[4]}" = "sequential: 10001 statements, sum 495011, hash 142813, errors 0" ]
+    [ "${lines[5]}" = "parallel: 10000 statements, sum 494906, hash 359411, errors 1" ]
+    [ "${lines[6]}" = "sequential: 10000 statements, sum 494906, hash 359411, errors 1" ]
+}
@@ -0,0 +1,46 @@
+#include <stdio.h>
+
+#include "parser.h"
+
+static unsigned long read_number(FILE *stream, size_t size) {
+    unsigned long v = 0;
+    size_t i;
+    for (i = 0; i < size; i++) v |= (unsigned long)fgetc(stream) << (8 * i);
+    return v;
+}
+
+int main(void) {
+    static const char *const events[3] = { "EVALUATE", "MATCH", "NOMATCH" };
+    list_context_t *ctx = list_create(NULL);
+    FILE *file = tmpfile();
+    char magic[9] = { 0 };
+    char name[64];
+    unsigned long rules, records, dropped, i;
+    while (list_parse(ctx, NULL));
+    printf("written: %lu\n", (unsigned long)list_write_trace(ctx, file));
+    list_destroy(ctx);
+    rewind(file);
+    if (fread(magic, 1, 8, file) != 8) return 1;
+    printf("magic: %s\n", magic);
+    printf("version: %lu\n", read_number(file, 4));
+    rules = read_number(file, 4);
+    records = read_number(file, 8);
+    dropped = read_number(file, 8);
+    printf("records: %lu, dropped: %lu\n", records, dropped);
+    for (i = 0; i < rules; i++) {
+        const unsigned long l = read_number(file, 4);
+        if (l >= sizeof(name) || fread(name, 1, l, file) != l) return 1;
+        name[l] = '\0';
+        printf("rule %lu: %s\n", i, name);
+    }
+    for (i = 0; i < records; i++) {
+        const unsigned long pos = read_number(file, 8);
+        const unsigned long rule = read_number(file, 4);
+        const unsigned long level = read_number(file, 2);
+        const unsigned long event = read_number(file, 1);
+        read_number(file, 1);
+        printf("%lu %s %lu %lu\n", level, events[event], rule, pos);
+    }
+    fclose(file);
+    return 0;
+}
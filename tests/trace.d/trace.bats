@@ -0,0 +1,31 @@
+#!/usr/bin/env bats
+
+load "$TESTDIR/utils.sh"
+
+@test "Testing $TEST_NAME - generation" {
+    PACKCC_OPTS=("--trace")
+    test_generate
+}
+
+@test "Testing $TEST_NAME - check code" {
+    in_header "size_t list_write_trace(list_context_t *ctx, FILE *stream);"
+    in_source "pcc_trace(ctx, 1, PCC_DBG_EVALUATE, chunk->pos);"
+    in_source "#define PCC_TRACE_BUFFER_SIZE 65536"
+}
+
+@test "Testing $TEST_NAME - compilation" {
+    $CC $CFLAGS -I "$BATS_TEST_DIRNAME" "$BATS_TEST_DIRNAME/main.c" "$BATS_TEST_DIRNAME/parser.c" -o "$BATS_TEST_DIRNAME/parser"
+}
+
+@test "Testing $TEST_NAME - run" {
+    run_for_input "$BATS_TEST_DIRNAME/input.txt"
+}
+
+@test "Testing $TEST_NAME - compilation with a small buffer" {
+    $CC $CFLAGS -DPCC_TRACE_BUFFER_SIZE=4 -I "$BATS_TEST_DIRNAME" "$BATS_TEST_DIRNAME/main.c" "$BATS_TEST_DIRNAME/parser.c" -o "$BATS_TEST_DIRNAME/parser"
+}
+
+@test "Testing $TEST_NAME - run with a small buffer" {
+    run timeout 5s "$BATS_TEST_DIRNAME/parser" < "$BATS_TEST_DIRNAME/input.txt"
+    check_output "$BATS_TEST_DIRNAME/expected-small.txt"
+}
@@ -0,0 +1,36 @@
+#!/usr/bin/env bats
+
+load "$TESTDIR/utils.sh"
+
+@test "Testing $TEST_NAME - generation" {
+    PACKCC_OPTS=("--units=3")
+    test_generate "$ROOTDIR/examples/calc.peg"
+    [ -f "$BATS_TEST_DIRNAME/parser_private.h" ]
+    [ -f "$BATS_TEST_DIRNAME/parser_1.c" ] && [ -f "$BATS_TEST_DIRNAME/parser_2.c" ]
+    grep -Fq '#include "parser_private.h"' "$BATS_TEST_DIRNAME/parser_2.c"
+}
+
+@test "Testing $TEST_NAME - compilation" {
+    $CC $CFLAGS -I "$BATS_TEST_DIRNAME" "$BATS_TEST_DIRNAME"/parser*.c -o "$BATS_TEST_DIRNAME/parser"
+}
+
+@test "Testing $TEST_NAME - run" {
+    run_for_input "$BATS_TEST_DIRNAME/input.txt"
+}
+
+@test "Testing $TEST_NAME - invalid number" {
+    run "$PACKCC" --units=0 -o "$BATS_TEST_DIRNAME/parser" "$ROOTDIR/examples/calc.peg"
+    [ "$status" -eq 1 ]
+    [[ "${lines[0]}" =~ "Invalid number of C source files: '0'" ]]
+}
+
+@test "Testing $TEST_NAME - warnings outside runtime" {
+    [ -v WINDIR ] && skip "GCC-compatible compiler is required"
+    PACKCC_OPTS=("--units=2")
+    test_generate "$ROOTDIR/examples/calc.peg"
+    echo "static int unused_helper(void) { return 0; }" >> "$BATS_TEST_DIRNAME/parser_1.c"
+    run $CC ${CFLAGS/-Werror/} -Wunused-function -c "$BATS_TEST_DIRNAME/parser_1.c" -o /dev/null
+    [ "$status" -eq 0 ]
+    [[ "$output" == *"unused_helper"* ]]
+    [[ "$output" != *"pcc_"* ]]
+}
@@ -0,0 +1,31 @@
+#!/usr/bin/env bats
+
+load "$TESTDIR/utils.sh"
+
+@test "Testing $TEST_NAME - generation" {
+    test_generate
+}
+
+@test "Testing $TEST_NAME - compilation" {
+    test_compile
+}
+
+@test "Testing $TEST_NAME - run" {
+    run_for_input "$BATS_TEST_DIRNAME/input.txt"
+}
+
+@test "Testing $TEST_NAME - run [overlong]" {
+    run_for_input "$BATS_TEST_DIRNAME/input-overlong.txt"
+}
+
+@test "Testing $TEST_NAME - run [surrogate]" {
+    run_for_input "$BATS_TEST_DIRNAME/input-surrogate.txt"
+}
+
+@test "Testing $TEST_NAME - run [large]" {
+    run_for_input "$BATS_TEST_DIRNAME/input-large.txt"
+}
+
+@test "Testing $TEST_NAME - run [truncated]" {
+    run_for_input "$BATS_TEST_DIRNAME/input-truncated.txt"
+}
@@ -0,0 +1,26 @@
+#!/usr/bin/env bats
+
+load "$TESTDIR/utils.sh"
+
+@test "Testing $TEST_NAME - generation" {
+    PACKCC_OPTS=("--whole-input")
+    test_generate
+}
+
+@test "Testing $TEST_NAME - check code" {
+    in_source "static void pcc_load_input(pcc_context_t *ctx) {"
+    in_source "(ctx->buffer.p + ctx->cur)[4] != 'e'"
+    ! in_source "pcc_refill_buffer(ctx, 5) < 5"
+}
+
+@test "Testing $TEST_NAME - compilation" {
+    test_compile
+}
+
+@test "Testing $TEST_NAME - run" {
+    run_for_input "$BATS_TEST_DIRNAME/input.txt"
+}
+
+@test "Testing $TEST_NAME - run [keyword]" {
+    run_for_input "$BATS_TEST_DIRNAME/input-keyword.txt"
+}
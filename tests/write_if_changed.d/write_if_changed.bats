@@ -0,0 +1,30 @@
+#!/usr/bin/env bats
+
+load "$TESTDIR/utils.sh"
+
+set_old_timestamps() {
+    touch -t 200001010000 "$BATS_TEST_DIRNAME/parser.c" "$BATS_TEST_DIRNAME/parser.h"
+}
+
+get_year() {
+    date -r "$BATS_TEST_DIRNAME/$1" +%Y
+}
+
+@test "Testing $TEST_NAME - generation" {
+    test_generate
+}
+
+@test "Testing $TEST_NAME - generation [unchanged]" {
+    set_old_timestamps
+    test_generate
+    [ "$(get_year parser.c)" = "2000" ]
+    [ "$(get_year parser.h)" = "2000" ]
+}
+
+@test "Testing $TEST_NAME - generation [changed]" {
+    set_old_timestamps
+    PACKCC_OPTS=("--lines")
+    test_generate
+    [ "$(get_year parser.c)" != "2000" ]
+    [ "$(get_year parser.h)" = "2000" ]
+}